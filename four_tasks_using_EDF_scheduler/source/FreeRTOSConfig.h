@@ -58,8 +58,172 @@
 #define configSUPPORT_DYNAMIC_ALLOCATION 1
 #define configUSE_MUTEXES                1
 
+/* index 0 for the application and one for each EDF module waking tasks with a
+   notification, the modules take 1 to 4 (see task.h) */
+#define configTASK_NOTIFICATION_ARRAY_ENTRIES    5
+
 #define configUSE_EDF_SCHEDULER   1
 
+/* run time stats on timer 1, also used by vTaskBusyWaitExecutionTime() to
+   measure execution time.  Timer 1 is started in prvSetupHardware(). */
+#define configGENERATE_RUN_TIME_STATS              1
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
+#define portGET_RUN_TIME_COUNTER_VALUE()           ( ( uint32_t ) T1TC )
+
+/* scheduler micro-benchmarks (edf_benchmark.c), replaces the application tasks */
+#define configUSE_EDF_BENCHMARK   0
+
+#if ( configUSE_EDF_BENCHMARK == 1 )
+
+#define configUSE_APPLICATION_TASK_TAG   1
+#define configEDF_BENCH_MAX_TASKS        16
+#define configEDF_BENCH_STACK_SIZE       64
+
+/* timer 1 runs at the PCLK with a zero prescaler in benchmark builds */
+#define configEDF_BENCH_GET_CYCLES()     ( ( uint32_t ) T1TC )
+
+extern void vEDFBenchTickEnter( void );
+extern void vEDFBenchTickExit( void );
+extern void vEDFBenchTaskReady( void * pvTaskTag );
+extern void vEDFBenchJobComplete( void * pvTaskTag );
+extern void vEDFBenchTaskSwitchedIn( void * pvTaskTag );
+
+#define traceTASK_INCREMENT_TICK( xTickCount )             vEDFBenchTickEnter()
+#define traceTASK_INCREMENT_TICK_END( xSwitchRequired )    vEDFBenchTickExit()
+#define traceMOVED_TASK_TO_READY_STATE( pxTCB )            vEDFBenchTaskReady( ( void * ) ( pxTCB )->pxTaskTag )
+#define traceTASK_SWITCHED_IN()                            vEDFBenchTaskSwitchedIn( ( void * ) pxCurrentTCB->pxTaskTag )
+#define traceTASK_DELAY_UNTIL( xTimeToWake )               vEDFBenchJobComplete( ( void * ) pxCurrentTCB->pxTaskTag )
+
+#endif
+
+/* scheduling trace in Chrome trace event format (edf_trace.c), written to the
+   serial port by a drain task */
+#define configUSE_EDF_TRACE       0
+
+#if ( configUSE_EDF_TRACE == 1 )
+
+#if ( configUSE_EDF_BENCHMARK == 1 )
+#error "configUSE_EDF_TRACE and configUSE_EDF_BENCHMARK both use the task switch trace macros"
+#endif
+
+/* the trace identifies tasks by their TCB number */
+#undef configUSE_TRACE_FACILITY
+#define configUSE_TRACE_FACILITY  1
+
+extern void vEDFTraceTick( uint32_t ulTickCount );
+extern void vEDFTraceTaskCreated( uint32_t ulTask, const char * pcName );
+extern void vEDFTraceTaskSwitchedIn( uint32_t ulTask );
+extern void vEDFTraceJobRelease( uint32_t ulTask, uint32_t ulDeadline );
+extern void vEDFTraceJobComplete( uint32_t ulTask, uint32_t ulDeadline );
+
+#define traceTASK_INCREMENT_TICK( xTickCount )    vEDFTraceTick( ( uint32_t ) ( xTickCount ) )
+#define traceTASK_CREATE( pxNewTCB )              vEDFTraceTaskCreated( ( uint32_t ) ( pxNewTCB )->uxTCBNumber, ( pxNewTCB )->pcTaskName )
+#define traceTASK_SWITCHED_IN()                   vEDFTraceTaskSwitchedIn( ( uint32_t ) pxCurrentTCB->uxTCBNumber )
+#define traceTASK_JOB_RELEASE( pxTCB )            vEDFTraceJobRelease( ( uint32_t ) ( pxTCB )->uxTCBNumber, ( uint32_t ) ( pxTCB )->xTaskAbsoluteDeadline )
+#define traceTASK_JOB_COMPLETE( pxTCB )           vEDFTraceJobComplete( ( uint32_t ) ( pxTCB )->uxTCBNumber, ( uint32_t ) ( pxTCB )->xTaskAbsoluteDeadline )
+
+#endif
+
+/* cycle-conserving EDF frequency scaling (edf_power.c), the PLL is switched
+   between the levels of configEDF_POWER_LEVELS_HZ */
+#define configUSE_EDF_DVFS        0
+
+#if ( configUSE_EDF_DVFS == 1 )
+extern uint32_t ulEDFPowerSetSpeed( uint32_t ulUtilisation );
+
+#define configEDF_DVFS_SET_SPEED( ulUtilisation )    ulEDFPowerSetSpeed( ulUtilisation )
+#endif
+
+/* zero-copy mailbox (edf_mailbox.c), carries the messages of the application
+   tasks instead of a queue of pointers */
+#define configUSE_EDF_MAILBOX     1
+
+/* lock-free single-producer/single-consumer ring (edf_ring.c) */
+#define configUSE_EDF_RING        0
+
+/* asynchronous serial transmit (edf_serial.c), the UART receiver task queues
+   its messages instead of sending them character by character.  Takes slot 1
+   of the VIC and the UART0 interrupt over from the serial driver; other
+   compilers than GCC need an interrupt wrapper in configEDF_SERIAL_ISR_ADDRESS
+   (see edf_serial.h).  The trace and the benchmark then need an output of their
+   own, their default one is vSerialPutString() */
+#define configUSE_EDF_SERIAL_TX   0
+
+#if ( configUSE_EDF_SERIAL_TX == 1 )
+/* the messages are queued in an SPSC ring */
+#undef configUSE_EDF_RING
+#define configUSE_EDF_RING        1
+#endif
+
+/* event driven GPIO edges (edf_gpio.c), the button tasks are released by the
+   edges of their pin instead of polling it */
+#define configUSE_EDF_GPIO_EDGE   1
+
+#if ( configUSE_EDF_GPIO_EDGE == 1 )
+/* the pins are sampled from the tick hook */
+#undef configUSE_TICK_HOOK
+#define configUSE_TICK_HOOK       1
+/* each edge is an arrival of a sporadic button task */
+#undef configUSE_EDF_SPORADIC
+#define configUSE_EDF_SPORADIC    1
+#endif
+
+/* delayed tasks in a hierarchical timing wheel instead of the sorted delayed
+   lists, 3 levels of 16 slots span 4096 ticks */
+#define configUSE_EDF_TIMING_WHEEL   0
+
+/* periodic tasks dispatched from a table of one hyperperiod built by
+   xTaskScheduleTableBuild() before the scheduler starts, only with the
+   polling button tasks (configUSE_EDF_GPIO_EDGE 0) as it has no sporadic
+   tasks */
+#define configUSE_EDF_SCHEDULE_TABLE 0
+
+/* a task is only preempted by tasks of a relative deadline below its
+   threshold, thresholds assigned by xTaskAssignPreemptionThresholds() */
+#define configUSE_EDF_PREEMPTION_THRESHOLD 0
+
+/* a preemption waits up to the end of the non-preemptive region of the running
+   task or its next vTaskPreemptionPoint(), regions assigned by
+   xTaskAssignNonPreemptiveRegions() */
+#define configUSE_EDF_DEFERRED_PREEMPTION 0
+
+/* deadlines in microseconds of timer 1 and releases between ticks by its
+   match interrupt, see xTaskDelayUntilUs() (edf_timebase.c) */
+#define configUSE_EDF_HIGH_RES_TIME 0
+
+#if ( configUSE_EDF_HIGH_RES_TIME == 1 )
+extern uint32_t ulEDFTimebaseNowUs( void );
+extern void vEDFTimebaseSetAlarmUs( uint32_t ulTimeUs );
+
+#define configEDF_TIME_US()                  ulEDFTimebaseNowUs()
+#define configEDF_SET_ALARM_US( ulTimeUs )   vEDFTimebaseSetAlarmUs( ulTimeUs )
+#endif
+
+/* no periodic tick, timer 1 interrupts at the next release only
+   (edf_tickless.c) */
+#define configUSE_EDF_TICKLESS_KERNEL 0
+
+#if ( configUSE_EDF_TICKLESS_KERNEL == 1 )
+extern void vEDFTicklessStart( void );
+extern uint32_t ulEDFTicklessElapsed( void );
+extern void vEDFTicklessSetEvent( uint32_t ulTicks );
+
+#define configEDF_TICKLESS_START()               vEDFTicklessStart()
+#define configEDF_TICKLESS_ELAPSED()             ulEDFTicklessElapsed()
+#define configEDF_TICKLESS_SET_EVENT( xTicks )   vEDFTicklessSetEvent( ( uint32_t ) ( xTicks ) )
+
+/* timer 1 counts microseconds, the tick count no longer calibrates it */
+#define configRUN_TIME_COUNTS_PER_TICK           ( 1000000UL / configTICK_RATE_HZ )
+#endif
+
+/* synthetic task set (edf_taskset.c), replaces the application tasks */
+#define configUSE_EDF_TASKSET     0
+
+#if ( configUSE_EDF_TASKSET == 1 )
+#define configEDF_TASKSET_MAX_TASKS      8
+#define configEDF_TASKSET_STACK_SIZE     64
+#endif
+
 #define configQUEUE_REGISTRY_SIZE 0
 
 /* Co-routine definitions. */
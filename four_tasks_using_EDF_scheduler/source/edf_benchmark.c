@@ -0,0 +1,502 @@
+/*
+ * EDF scheduler micro-benchmarks.  See edf_benchmark.h.
+ *
+ * A controller task sweeps the number of periodic worker tasks and the
+ * distribution of their periods (and so of their deadlines).  For each point
+ * it creates the workers, lets them run for configEDF_BENCH_WINDOW_TICKS,
+ * deletes them again and prints the min/avg/max of every metric.
+ *
+ * Workers are identified in the trace hooks by their application task tag,
+ * which holds the worker index + 1 (0 means "not a benchmark worker").
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+#include <string.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "edf_benchmark.h"
+
+#if ( configUSE_EDF_RING == 1 )
+#include "queue.h"
+#include "edf_ring.h"
+#endif
+
+#if ( configUSE_EDF_BENCHMARK == 1 )
+
+#if ( configUSE_APPLICATION_TASK_TAG != 1 )
+#error "The EDF benchmark needs configUSE_APPLICATION_TASK_TAG set to 1"
+#endif
+
+/* Period of the controller.  It only has to be later than the deadline of any
+ * worker so it does not disturb the measurement. */
+#define benchCONTROLLER_PERIOD      ( ( TickType_t ) ( configEDF_BENCH_WINDOW_TICKS * 2 ) )
+
+/* Ticks given to the idle task to free the deleted workers. */
+#define benchCLEAN_UP_TICKS         ( ( TickType_t ) 50 )
+
+#define benchLINE_LENGTH            192
+
+/* Items pushed then popped in one round of the ring against queue benchmark,
+ * and number of rounds. */
+#define benchRING_LENGTH            16U
+#define benchRING_ROUNDS            1000U
+
+/* Implementation of the delayed tasks the tick walks, so runs with and
+ * without the timing wheel can be told apart and compared. */
+#if ( configUSE_EDF_TIMING_WHEEL == 1 )
+#define benchDELAYED_IMPL           "wheel"
+#else
+#define benchDELAYED_IMPL           "list"
+#endif
+
+/* Period distributions of the worker tasks.  With implicit deadlines the
+ * period distribution is the deadline distribution. */
+typedef enum
+{
+	eBenchDistIdentical = 0, /* All periods equal - every release collides. */
+	eBenchDistHarmonic,      /* 10, 20, 40, 80 ticks. */
+	eBenchDistUniform,       /* Uniform in [10, 100] ticks. */
+	eBenchDistLogUniform,    /* Log-uniform in [10, 1000] ticks. */
+	eBenchDistCount
+} eBenchDist_t;
+
+static const char * const pcDistNames[ eBenchDistCount ] =
+{
+	"identical",
+	"harmonic",
+	"uniform",
+	"log_uniform"
+};
+
+typedef struct xBENCH_STAT
+{
+	uint32_t ulMin;
+	uint32_t ulMax;
+	uint64_t ullSum;
+	uint32_t ulSamples;
+} BenchStat_t;
+
+typedef struct xBENCH_WORKER
+{
+	TaskHandle_t xHandle;
+	TickType_t xPeriod;
+	volatile uint32_t ulReadyStamp;
+	volatile BaseType_t xReleasePending;
+	volatile BaseType_t xStarted;
+} BenchWorker_t;
+
+static BenchWorker_t xWorkers[ configEDF_BENCH_MAX_TASKS ];
+
+static BenchStat_t xTickStat;
+static BenchStat_t xReleaseStat;
+static BenchStat_t xCompleteStat;
+
+static volatile BaseType_t xMeasuring = pdFALSE;
+static volatile uint32_t ulTickEnterStamp = 0;
+static volatile uint32_t ulCompleteStamp = 0;
+static volatile BaseType_t xCompleteMeasurePending = pdFALSE;
+
+static uint32_t ulRandomState = 0x1234567UL;
+
+#if ( configUSE_EDF_RING == 1 )
+static EDFRing_t xBenchRing;
+static uint32_t ulBenchRingBuffer[ benchRING_LENGTH ];
+#endif
+
+/*-----------------------------------------------------------*/
+
+/* Small deterministic PRNG (xorshift32) so every run uses the same task sets. */
+static uint32_t prvRandom( void )
+{
+	ulRandomState ^= ulRandomState << 13;
+	ulRandomState ^= ulRandomState >> 17;
+	ulRandomState ^= ulRandomState << 5;
+	return ulRandomState;
+}
+/*-----------------------------------------------------------*/
+
+static TickType_t prvPickPeriod( eBenchDist_t eDist, UBaseType_t uxIndex )
+{
+	static const TickType_t xHarmonic[] = { 10, 20, 40, 80 };
+	TickType_t xPeriod;
+	uint32_t ulDecade;
+
+	switch( eDist )
+	{
+		case eBenchDistHarmonic:
+			xPeriod = xHarmonic[ uxIndex % ( sizeof( xHarmonic ) / sizeof( xHarmonic[ 0 ] ) ) ];
+			break;
+
+		case eBenchDistUniform:
+			xPeriod = ( TickType_t ) ( 10U + ( prvRandom() % 91U ) );
+			break;
+
+		case eBenchDistLogUniform:
+			/* Pick the decade first, then uniformly within it.  Close enough to
+			 * log-uniform without needing floating point on target. */
+			ulDecade = prvRandom() % 2U;
+			xPeriod = ( ulDecade == 0U ) ? ( TickType_t ) ( 10U + ( prvRandom() % 90U ) ) : ( TickType_t ) ( 100U + ( prvRandom() % 901U ) );
+			break;
+
+		case eBenchDistIdentical:
+		default:
+			xPeriod = 10;
+			break;
+	}
+
+	return xPeriod;
+}
+/*-----------------------------------------------------------*/
+
+static void prvStatReset( BenchStat_t * pxStat )
+{
+	pxStat->ulMin = 0xFFFFFFFFUL;
+	pxStat->ulMax = 0;
+	pxStat->ullSum = 0;
+	pxStat->ulSamples = 0;
+}
+/*-----------------------------------------------------------*/
+
+static void prvStatAdd( BenchStat_t * pxStat, uint32_t ulValue )
+{
+	if( ulValue < pxStat->ulMin )
+	{
+		pxStat->ulMin = ulValue;
+	}
+
+	if( ulValue > pxStat->ulMax )
+	{
+		pxStat->ulMax = ulValue;
+	}
+
+	pxStat->ullSum += ulValue;
+	pxStat->ulSamples++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvReport( const char * pcMetric, UBaseType_t uxTasks, eBenchDist_t eDist, const BenchStat_t * pxStat )
+{
+	char cLine[ benchLINE_LENGTH ];
+	uint32_t ulAvg = 0, ulMin = 0;
+
+	if( pxStat->ulSamples > 0U )
+	{
+		ulAvg = ( uint32_t ) ( pxStat->ullSum / pxStat->ulSamples );
+		ulMin = pxStat->ulMin;
+	}
+
+	snprintf( cLine, sizeof( cLine ),
+			  "{\"bench\":\"edf\",\"metric\":\"%s\",\"impl\":\"%s\",\"tasks\":%u,\"dist\":\"%s\",\"unit\":\"%s\",\"samples\":%lu,\"min\":%lu,\"avg\":%lu,\"max\":%lu}\r\n",
+			  pcMetric,
+			  benchDELAYED_IMPL,
+			  ( unsigned ) uxTasks,
+			  pcDistNames[ eDist ],
+			  configEDF_BENCH_CYCLES_UNIT,
+			  ( unsigned long ) pxStat->ulSamples,
+			  ( unsigned long ) ulMin,
+			  ( unsigned long ) ulAvg,
+			  ( unsigned long ) pxStat->ulMax );
+
+	configEDF_BENCH_OUTPUT( cLine );
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_RING == 1 )
+
+static void prvReportThroughput( const char * pcMetric, const BenchStat_t * pxStat )
+{
+	char cLine[ benchLINE_LENGTH ];
+	uint32_t ulAvg = 0, ulMin = 0;
+
+	if( pxStat->ulSamples > 0U )
+	{
+		ulAvg = ( uint32_t ) ( pxStat->ullSum / pxStat->ulSamples );
+		ulMin = pxStat->ulMin;
+	}
+
+	snprintf( cLine, sizeof( cLine ),
+			  "{\"bench\":\"edf\",\"metric\":\"%s\",\"items\":%u,\"unit\":\"%s\",\"samples\":%lu,\"min\":%lu,\"avg\":%lu,\"max\":%lu}\r\n",
+			  pcMetric,
+			  ( unsigned ) benchRING_LENGTH,
+			  configEDF_BENCH_CYCLES_UNIT,
+			  ( unsigned long ) pxStat->ulSamples,
+			  ( unsigned long ) ulMin,
+			  ( unsigned long ) ulAvg,
+			  ( unsigned long ) pxStat->ulMax );
+
+	configEDF_BENCH_OUTPUT( cLine );
+}
+/*-----------------------------------------------------------*/
+
+/* Time pushing benchRING_LENGTH items then popping them all, in the ring and
+ * in a queue of the same length, and report the cost per item.  Both are used
+ * from the controller alone, so only the primitives themselves are measured. */
+static void prvBenchRingVersusQueue( void )
+{
+	QueueHandle_t xQueue;
+	BenchStat_t xRingStat, xQueueStat;
+	uint32_t ulRound, ulItem, ulValue, ulStart;
+
+	prvStatReset( &xRingStat );
+	prvStatReset( &xQueueStat );
+	vEDFRingInit( &xBenchRing, ulBenchRingBuffer, sizeof( uint32_t ), benchRING_LENGTH );
+	xQueue = xQueueCreate( benchRING_LENGTH, sizeof( uint32_t ) );
+
+	for( ulRound = 0; ulRound < benchRING_ROUNDS; ulRound++ )
+	{
+		ulStart = configEDF_BENCH_GET_CYCLES();
+
+		for( ulItem = 0; ulItem < benchRING_LENGTH; ulItem++ )
+		{
+			( void ) xEDFRingPush( &xBenchRing, &ulItem );
+		}
+
+		for( ulItem = 0; ulItem < benchRING_LENGTH; ulItem++ )
+		{
+			( void ) xEDFRingPop( &xBenchRing, &ulValue );
+		}
+
+		prvStatAdd( &xRingStat, ( configEDF_BENCH_GET_CYCLES() - ulStart ) / benchRING_LENGTH );
+
+		if( xQueue != NULL )
+		{
+			ulStart = configEDF_BENCH_GET_CYCLES();
+
+			for( ulItem = 0; ulItem < benchRING_LENGTH; ulItem++ )
+			{
+				( void ) xQueueSend( xQueue, &ulItem, 0 );
+			}
+
+			for( ulItem = 0; ulItem < benchRING_LENGTH; ulItem++ )
+			{
+				( void ) xQueueReceive( xQueue, &ulValue, 0 );
+			}
+
+			prvStatAdd( &xQueueStat, ( configEDF_BENCH_GET_CYCLES() - ulStart ) / benchRING_LENGTH );
+		}
+	}
+
+	if( xQueue != NULL )
+	{
+		vQueueDelete( xQueue );
+	}
+
+	prvReportThroughput( "ring_push_pop", &xRingStat );
+	prvReportThroughput( "queue_send_receive", &xQueueStat );
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_EDF_RING */
+
+static void prvBenchWorker( void * pvParameters )
+{
+	BenchWorker_t * pxWorker = ( BenchWorker_t * ) pvParameters;
+	TickType_t xLastWakeTime = xTaskGetTickCount();
+	volatile uint32_t ulLoop;
+
+	pxWorker->xStarted = pdTRUE;
+
+	for( ; ; )
+	{
+		for( ulLoop = 0; ulLoop < configEDF_BENCH_WORK_LOOPS; ulLoop++ )
+		{
+		}
+
+		/* Opens the completion measurement if the worker blocks, the
+		 * switch-in hook of the next task closes it. */
+		vTaskDelayUntil( &xLastWakeTime, pxWorker->xPeriod );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvCreateWorkers( UBaseType_t uxTasks, eBenchDist_t eDist )
+{
+	UBaseType_t uxCreated;
+	BenchWorker_t * pxWorker;
+
+	for( uxCreated = 0; uxCreated < uxTasks; uxCreated++ )
+	{
+		pxWorker = &( xWorkers[ uxCreated ] );
+		pxWorker->xPeriod = prvPickPeriod( eDist, uxCreated );
+		pxWorker->xReleasePending = pdFALSE;
+		pxWorker->xStarted = pdFALSE;
+
+		if( xTaskPeriodicCreate( prvBenchWorker,
+								 "BENCH",
+								 configEDF_BENCH_STACK_SIZE,
+								 ( void * ) pxWorker,
+								 1,
+								 &( pxWorker->xHandle ),
+								 pxWorker->xPeriod ) != pdPASS )
+		{
+			break;
+		}
+
+		vTaskSetApplicationTaskTag( pxWorker->xHandle, ( TaskHookFunction_t ) ( uintptr_t ) ( uxCreated + 1U ) );
+	}
+
+	return uxCreated;
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchController( void * pvParameters )
+{
+	UBaseType_t uxTasks, uxCreated, ux;
+	eBenchDist_t eDist;
+	BenchStat_t xTick, xRelease, xComplete;
+
+	( void ) pvParameters;
+
+	for( eDist = eBenchDistIdentical; eDist < eBenchDistCount; eDist++ )
+	{
+		for( uxTasks = 1; uxTasks <= configEDF_BENCH_MAX_TASKS; uxTasks *= 2U )
+		{
+			ulRandomState = 0x1234567UL + ( uint32_t ) uxTasks;
+			uxCreated = prvCreateWorkers( uxTasks, eDist );
+
+			taskENTER_CRITICAL();
+			{
+				prvStatReset( &xTickStat );
+				prvStatReset( &xReleaseStat );
+				prvStatReset( &xCompleteStat );
+				xCompleteMeasurePending = pdFALSE;
+				xMeasuring = pdTRUE;
+			}
+			taskEXIT_CRITICAL();
+
+			vTaskDelay( configEDF_BENCH_WINDOW_TICKS );
+
+			taskENTER_CRITICAL();
+			{
+				xMeasuring = pdFALSE;
+				xTick = xTickStat;
+				xRelease = xReleaseStat;
+				xComplete = xCompleteStat;
+			}
+			taskEXIT_CRITICAL();
+
+			for( ux = 0; ux < uxCreated; ux++ )
+			{
+				vTaskDelete( xWorkers[ ux ].xHandle );
+			}
+
+			vTaskDelay( benchCLEAN_UP_TICKS );
+
+			prvReport( "tick", uxCreated, eDist, &xTick );
+			prvReport( "release_to_run", uxCreated, eDist, &xRelease );
+			prvReport( "complete_to_switch", uxCreated, eDist, &xComplete );
+
+			if( uxCreated < uxTasks )
+			{
+				/* Out of heap - larger sets cannot be created either. */
+				break;
+			}
+		}
+	}
+
+#if ( configUSE_EDF_RING == 1 )
+	prvBenchRingVersusQueue();
+#endif
+
+	configEDF_BENCH_OUTPUT( "{\"bench\":\"edf\",\"metric\":\"done\"}\r\n" );
+	vTaskDelete( NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vStartEDFBenchmark( void )
+{
+	xTaskPeriodicCreate( prvBenchController,
+						 "BENCHC",
+						 configMINIMAL_STACK_SIZE * 2,
+						 NULL,
+						 1,
+						 NULL,
+						 benchCONTROLLER_PERIOD );
+}
+/*-----------------------------------------------------------*/
+
+void vEDFBenchTickEnter( void )
+{
+	ulTickEnterStamp = configEDF_BENCH_GET_CYCLES();
+}
+/*-----------------------------------------------------------*/
+
+void vEDFBenchTickExit( void )
+{
+	if( xMeasuring != pdFALSE )
+	{
+		prvStatAdd( &xTickStat, configEDF_BENCH_GET_CYCLES() - ulTickEnterStamp );
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vEDFBenchTaskReady( void * pvTaskTag )
+{
+	UBaseType_t uxIndex = ( UBaseType_t ) ( uintptr_t ) pvTaskTag;
+	BenchWorker_t * pxWorker;
+
+	if( ( uxIndex != 0U ) && ( uxIndex <= configEDF_BENCH_MAX_TASKS ) )
+	{
+		pxWorker = &( xWorkers[ uxIndex - 1U ] );
+
+		/* Only releases count, not the move to the ready list on creation. */
+		if( pxWorker->xStarted != pdFALSE )
+		{
+			pxWorker->ulReadyStamp = configEDF_BENCH_GET_CYCLES();
+			pxWorker->xReleasePending = pdTRUE;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vEDFBenchJobComplete( void * pvTaskTag )
+{
+	UBaseType_t uxIndex = ( UBaseType_t ) ( uintptr_t ) pvTaskTag;
+
+	/* Called with the scheduler suspended as the worker blocks, so the next
+	 * switch is always to another task. */
+	if( ( uxIndex != 0U ) && ( uxIndex <= configEDF_BENCH_MAX_TASKS ) )
+	{
+		ulCompleteStamp = configEDF_BENCH_GET_CYCLES();
+		xCompleteMeasurePending = pdTRUE;
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vEDFBenchTaskSwitchedIn( void * pvTaskTag )
+{
+	const uint32_t ulNow = configEDF_BENCH_GET_CYCLES();
+	UBaseType_t uxIndex = ( UBaseType_t ) ( uintptr_t ) pvTaskTag;
+	BenchWorker_t * pxWorker;
+
+	if( xCompleteMeasurePending != pdFALSE )
+	{
+		xCompleteMeasurePending = pdFALSE;
+
+		if( xMeasuring != pdFALSE )
+		{
+			prvStatAdd( &xCompleteStat, ulNow - ulCompleteStamp );
+		}
+	}
+
+	if( ( uxIndex != 0U ) && ( uxIndex <= configEDF_BENCH_MAX_TASKS ) )
+	{
+		pxWorker = &( xWorkers[ uxIndex - 1U ] );
+
+		if( pxWorker->xReleasePending != pdFALSE )
+		{
+			pxWorker->xReleasePending = pdFALSE;
+
+			if( xMeasuring != pdFALSE )
+			{
+				prvStatAdd( &xReleaseStat, ulNow - pxWorker->ulReadyStamp );
+			}
+		}
+	}
+}
+
+#endif /* configUSE_EDF_BENCHMARK */
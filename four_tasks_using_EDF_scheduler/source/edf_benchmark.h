@@ -0,0 +1,102 @@
+/*
+ * EDF scheduler micro-benchmarks.
+ *
+ * Measures, as a function of the number of periodic tasks and of the way
+ * their deadlines are distributed:
+ *  - the cost of xTaskIncrementTick() (tick handler),
+ *  - the release-to-run latency (task moved to the ready list by the tick
+ *    until it is switched in),
+ *  - the job completion latency (a worker blocking at the end of its job
+ *    until the next task is switched in).
+ * With configUSE_EDF_RING set to 1 it then compares the cost per item of the
+ * SPSC ring (edf_ring.h) with xQueueSend()/xQueueReceive().
+ *
+ * Every result is written as one JSON object per line so the output of a run
+ * can be captured and compared against a previous run by a script.  The tick
+ * and release lines carry an "impl" field, "list" or "wheel" after
+ * configUSE_EDF_TIMING_WHEEL, to compare the delayed task implementations.
+ *
+ * The benchmark hooks into the kernel through the trace macros, see the
+ * configUSE_EDF_BENCHMARK section of FreeRTOSConfig.h.
+ */
+
+#ifndef EDF_BENCHMARK_H
+#define EDF_BENCHMARK_H
+
+/* Largest task set of the sweep.  The sweep runs 1, 2, 4 ... tasks up to this
+ * value, stopping early if the heap runs out. */
+#ifndef configEDF_BENCH_MAX_TASKS
+#define configEDF_BENCH_MAX_TASKS      256
+#endif
+
+/* Number of ticks each (task count, distribution) point is measured for. */
+#ifndef configEDF_BENCH_WINDOW_TICKS
+#define configEDF_BENCH_WINDOW_TICKS   1000
+#endif
+
+/* Stack size in words of each benchmark worker task. */
+#ifndef configEDF_BENCH_STACK_SIZE
+#define configEDF_BENCH_STACK_SIZE     configMINIMAL_STACK_SIZE
+#endif
+
+/* Iterations of the empty loop each worker job runs before completing. */
+#ifndef configEDF_BENCH_WORK_LOOPS
+#define configEDF_BENCH_WORK_LOOPS     100
+#endif
+
+/* Free running counter used to time stamp the samples.  On target this is a
+ * cycle (or timer) counter, on the POSIX port the monotonic clock in ns. */
+#ifndef configEDF_BENCH_GET_CYCLES
+#if defined( __unix__ ) || defined( __APPLE__ )
+#include <time.h>
+static inline uint32_t ulEDFBenchPosixCycles( void )
+{
+	struct timespec xNow;
+
+	clock_gettime( CLOCK_MONOTONIC, &xNow );
+	return ( uint32_t ) ( ( uint64_t ) xNow.tv_sec * 1000000000ULL + ( uint64_t ) xNow.tv_nsec );
+}
+#define configEDF_BENCH_GET_CYCLES()    ulEDFBenchPosixCycles()
+#define configEDF_BENCH_CYCLES_UNIT     "ns"
+#elif ( configUSE_EDF_BENCHMARK == 1 )
+#error "configEDF_BENCH_GET_CYCLES() must be defined in FreeRTOSConfig.h"
+#endif
+#endif
+
+#ifndef configEDF_BENCH_CYCLES_UNIT
+#define configEDF_BENCH_CYCLES_UNIT     "cycles"
+#endif
+
+/* Where the result lines go. */
+#ifndef configEDF_BENCH_OUTPUT
+#if defined( __unix__ ) || defined( __APPLE__ )
+#include <stdio.h>
+#define configEDF_BENCH_OUTPUT( pcLine )    do { fputs( ( pcLine ), stdout ); fflush( stdout ); } while( 0 )
+#else
+#if ( configUSE_EDF_SERIAL_TX == 1 ) && ( configUSE_EDF_BENCHMARK == 1 )
+#error "The benchmark results go to vSerialPutString() by default, which cannot be used once configUSE_EDF_SERIAL_TX gives UART0 to edf_serial.c; define configEDF_BENCH_OUTPUT() in FreeRTOSConfig.h"
+#endif
+#include <string.h>
+#include "serial.h"
+#define configEDF_BENCH_OUTPUT( pcLine )    vSerialPutString( ( const signed char * ) ( pcLine ), ( unsigned short ) strlen( pcLine ) )
+#endif
+#endif
+
+/*
+ * Create the benchmark controller task.  Call before vTaskStartScheduler() and
+ * instead of creating the application tasks, so that only the benchmark
+ * workers are measured.
+ */
+void vStartEDFBenchmark( void );
+
+/*
+ * Trace hooks, called from the kernel trace macros.  They must not be called
+ * from application code.
+ */
+void vEDFBenchTickEnter( void );
+void vEDFBenchTickExit( void );
+void vEDFBenchTaskReady( void * pvTaskTag );
+void vEDFBenchJobComplete( void * pvTaskTag );
+void vEDFBenchTaskSwitchedIn( void * pvTaskTag );
+
+#endif /* EDF_BENCHMARK_H */
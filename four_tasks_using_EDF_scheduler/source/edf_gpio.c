@@ -0,0 +1,204 @@
+/*
+ * Event driven GPIO edges.  See edf_gpio.h.
+ *
+ * Each tick the attached pins are read and compared with their last level.  A
+ * change is added to the edges pending for the pin and, if none were pending,
+ * signalled as an arrival of the task.  The sporadic tasks of the kernel keep
+ * the time of the arrival and the minimum inter-arrival time, the pin only
+ * holds the edges until the job they released takes them.  The tick interrupt
+ * switches to the task itself if its deadline is the earliest.
+ */
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "edf_gpio.h"
+
+#if ( configUSE_EDF_GPIO_EDGE == 1 )
+
+#if ( configUSE_EDF_SPORADIC != 1 )
+#error "The GPIO edges release sporadic tasks, configUSE_EDF_SPORADIC must be 1"
+#endif
+
+#if ( configUSE_TICK_HOOK != 1 )
+#error "The GPIO edges are sampled from the tick hook, configUSE_TICK_HOOK must be 1"
+#endif
+
+#if ( configUSE_EDF_TICKLESS_KERNEL == 1 )
+#error "The GPIO edges are sampled from the tick hook, which a tickless kernel only calls at its events"
+#endif
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+
+/* Simulated pins, a bit set per low pin so all start high. */
+#define gpioSIMULATED_PORTS        2U
+#define gpioSIMULATED_PINS         32U
+
+static volatile uint32_t ulSimulatedLow[ gpioSIMULATED_PORTS ];
+
+static pinState_t prvSimulatedRead( portX_t xPort,
+									pinX_t xPin );
+
+#define gpioREAD( xPort, xPin )    prvSimulatedRead( ( xPort ), ( xPin ) )
+
+#else
+
+#define gpioREAD( xPort, xPin )    GPIO_read( ( xPort ), ( xPin ) )
+
+#endif /* if defined( __unix__ ) || defined( __APPLE__ ) */
+
+typedef struct xEDF_GPIO_EDGE_PIN
+{
+	portX_t xPort;
+	pinX_t xPin;
+	TaskHandle_t xTask;
+	pinState_t xLevel;           /* Level at the last sample. */
+	uint32_t ulPending;          /* Edges of the arrival not taken by a job yet. */
+} EDFGpioEdgePin_t;
+
+static EDFGpioEdgePin_t xPins[ configEDF_GPIO_MAX_PINS ];
+
+/* Only grows, a pin is filled in before it is counted. */
+static volatile UBaseType_t uxPins = 0U;
+
+/*-----------------------------------------------------------*/
+
+BaseType_t xEDFGpioEdgeAttach( portX_t xPort,
+							   pinX_t xPin,
+							   TaskHandle_t xTask )
+{
+	EDFGpioEdgePin_t * pxPin;
+	BaseType_t xReturn = pdFAIL;
+
+	if( xTask == NULL )
+	{
+		/* The tick hook needs the actual handle. */
+		xTask = xTaskGetCurrentTaskHandle();
+	}
+
+	taskENTER_CRITICAL();
+	{
+		if( uxPins < ( UBaseType_t ) configEDF_GPIO_MAX_PINS )
+		{
+			pxPin = &( xPins[ uxPins ] );
+			pxPin->xPort = xPort;
+			pxPin->xPin = xPin;
+			pxPin->xTask = xTask;
+			pxPin->xLevel = gpioREAD( xPort, xPin );
+			pxPin->ulPending = 0UL;
+			uxPins++;
+
+			xReturn = pdPASS;
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xEDFGpioEdgeWait( uint32_t * pulEdges,
+							 TickType_t xTicksToWait )
+{
+	const TaskHandle_t xTask = xTaskGetCurrentTaskHandle();
+	EDFGpioEdgePin_t * pxPin = NULL;
+	BaseType_t xReturn;
+	UBaseType_t uxPin;
+
+	for( uxPin = 0U; uxPin < uxPins; uxPin++ )
+	{
+		if( xPins[ uxPin ].xTask == xTask )
+		{
+			pxPin = &( xPins[ uxPin ] );
+			break;
+		}
+	}
+
+	configASSERT( pxPin != NULL );
+
+	xReturn = xTaskWaitSporadicRelease( xTicksToWait );
+	*pulEdges = 0UL;
+
+	if( xReturn == pdPASS )
+	{
+		/* The next edge is a new arrival. */
+		taskENTER_CRITICAL();
+		{
+			*pulEdges = pxPin->ulPending;
+			pxPin->ulPending = 0UL;
+		}
+		taskEXIT_CRITICAL();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vEDFGpioEdgeTick( void )
+{
+	EDFGpioEdgePin_t * pxPin;
+	pinState_t xLevel;
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+	UBaseType_t uxPin;
+
+	for( uxPin = 0U; uxPin < uxPins; uxPin++ )
+	{
+		pxPin = &( xPins[ uxPin ] );
+		xLevel = gpioREAD( pxPin->xPort, pxPin->xPin );
+
+		if( xLevel != pxPin->xLevel )
+		{
+			pxPin->xLevel = xLevel;
+
+			if( pxPin->ulPending == 0UL )
+			{
+				/* Arrives now, or once the minimum inter-arrival time has
+				 * passed if that is later. */
+				( void ) xTaskReleaseSporadicFromISR( pxPin->xTask, &xHigherPriorityTaskWoken );
+			}
+
+			pxPin->ulPending |= ( xLevel == PIN_IS_HIGH ) ? edfGPIO_RISING_EDGE : edfGPIO_FALLING_EDGE;
+		}
+	}
+
+	/* The notification leaves a yield pending, which the tick interrupt
+	 * performs on return. */
+	( void ) xHigherPriorityTaskWoken;
+}
+/*-----------------------------------------------------------*/
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+
+static pinState_t prvSimulatedRead( portX_t xPort,
+									pinX_t xPin )
+{
+	configASSERT( ( ( UBaseType_t ) xPort < gpioSIMULATED_PORTS ) && ( ( UBaseType_t ) xPin < gpioSIMULATED_PINS ) );
+
+	return ( ( ulSimulatedLow[ xPort ] & ( 1UL << ( uint32_t ) xPin ) ) != 0UL ) ? PIN_IS_LOW : PIN_IS_HIGH;
+}
+/*-----------------------------------------------------------*/
+
+void vEDFGpioSimulateLevel( portX_t xPort,
+							pinX_t xPin,
+							pinState_t xState )
+{
+	configASSERT( ( ( UBaseType_t ) xPort < gpioSIMULATED_PORTS ) && ( ( UBaseType_t ) xPin < gpioSIMULATED_PINS ) );
+
+	taskENTER_CRITICAL();
+	{
+		if( xState == PIN_IS_LOW )
+		{
+			ulSimulatedLow[ xPort ] |= ( 1UL << ( uint32_t ) xPin );
+		}
+		else
+		{
+			ulSimulatedLow[ xPort ] &= ~( 1UL << ( uint32_t ) xPin );
+		}
+	}
+	taskEXIT_CRITICAL();
+}
+
+#endif /* if defined( __unix__ ) || defined( __APPLE__ ) */
+
+#endif /* configUSE_EDF_GPIO_EDGE */
@@ -0,0 +1,68 @@
+/*
+ * Event driven GPIO edges.
+ *
+ * A sporadic task (xTaskSporadicCreate()) attached to a pin with
+ * xEDFGpioEdgeAttach() sleeps in xEDFGpioEdgeWait() until the pin changes,
+ * instead of waking periodically to compare its level with the last one.  An
+ * edge is an arrival of the task (xTaskReleaseSporadicFromISR()), timestamped
+ * with the tick that sees it: the kernel releases a job with a deadline
+ * counted from the edge, even if the task only waits for it later, and defers
+ * the arrivals less than the minimum inter-arrival time of the task apart.
+ * Edges coming while an arrival is pending are added to it.
+ *
+ * The button pins of the board (P0.1, P0.2) cannot all raise an external
+ * interrupt, so the pins are sampled by vEDFGpioEdgeTick() from the tick hook,
+ * which costs a pin read per tick and no task wake up.  On the POSIX port the
+ * levels come from vEDFGpioSimulateLevel().
+ */
+
+#ifndef EDF_GPIO_H
+#define EDF_GPIO_H
+
+#include "GPIO.h"
+
+/* Number of pins that can be attached. */
+#ifndef configEDF_GPIO_MAX_PINS
+#define configEDF_GPIO_MAX_PINS        4
+#endif
+
+/* Edges returned by xEDFGpioEdgeWait(). */
+#define edfGPIO_RISING_EDGE            ( ( uint32_t ) 0x01 )
+#define edfGPIO_FALLING_EDGE           ( ( uint32_t ) 0x02 )
+
+/*
+ * Release a job of the sporadic task xTask (the calling task if NULL) on the
+ * edges of xPin of xPort.  The level of the pin now is the reference for the
+ * first edge.  The edges deferred by the minimum inter-arrival time are
+ * counted by uxTaskGetSporadicEarlyArrivals().  Returns pdFAIL if
+ * configEDF_GPIO_MAX_PINS pins are already attached.
+ */
+BaseType_t xEDFGpioEdgeAttach( portX_t xPort,
+							   pinX_t xPin,
+							   TaskHandle_t xTask );
+
+/*
+ * Wait up to xTicksToWait for the edges of the pin of the calling task, which
+ * ends the current job.  Returns pdPASS with the edges of the job released
+ * (edfGPIO_RISING_EDGE, edfGPIO_FALLING_EDGE) in *pulEdges.
+ */
+BaseType_t xEDFGpioEdgeWait( uint32_t * pulEdges,
+							 TickType_t xTicksToWait );
+
+/*
+ * Sample the attached pins and signal an arrival of the tasks with new edges.
+ * Called from vApplicationTickHook(), configUSE_TICK_HOOK must be 1.
+ */
+void vEDFGpioEdgeTick( void );
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+
+/* Set the level the POSIX port reads for xPin of xPort.  All pins are high
+ * until set. */
+void vEDFGpioSimulateLevel( portX_t xPort,
+							pinX_t xPin,
+							pinState_t xState );
+
+#endif
+
+#endif /* EDF_GPIO_H */
@@ -0,0 +1,356 @@
+/*
+ * Zero-copy mailbox for passing buffers between EDF tasks.  See edf_mailbox.h.
+ *
+ * A task that has to wait links an EDFMailboxWaiter_t on its own stack into
+ * the list of the mailbox, in deadline order, and blocks on its notification.
+ * The task that serves it passes the message through the waiter, unlinks it
+ * and notifies the task, so a woken task never has to compete for the message
+ * again.  A waiter that times out unlinks itself.  A notification left over
+ * from a waiter served just as it timed out only makes the next wait loop once
+ * more, as the waits check xDone before returning.
+ */
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "edf_mailbox.h"
+
+#if ( configUSE_EDF_MAILBOX == 1 )
+
+#if ( configUSE_EDF_SCHEDULER != 1 ) || ( configUSE_TASK_NOTIFICATIONS != 1 )
+#error "The EDF mailbox needs configUSE_EDF_SCHEDULER and configUSE_TASK_NOTIFICATIONS set to 1"
+#endif
+
+/* Deadlines wrap with the tick count, a difference from here on is negative. */
+#define mailboxTIME_BEFORE    ( ( TickType_t ) ( ( portMAX_DELAY >> 1 ) + 1U ) )
+
+/*
+ * Link pxWaiter into *ppxList, after the waiters with an earlier or equal
+ * deadline.  Called from a critical section.
+ */
+static void prvInsertWaiter( EDFMailboxWaiter_t ** ppxList,
+							 EDFMailboxWaiter_t * pxWaiter );
+
+/*
+ * Unlink pxWaiter from *ppxList if it is still there.  Called from a critical
+ * section.
+ */
+static void prvRemoveWaiter( EDFMailboxWaiter_t ** ppxList,
+							 const EDFMailboxWaiter_t * pxWaiter );
+
+/*
+ * Wait with pxWaiter in *ppxList until it is served or xTicksToWait passed.
+ * Called, and returns, inside a critical section.
+ */
+static BaseType_t prvWait( EDFMailboxWaiter_t ** ppxList,
+						   EDFMailboxWaiter_t * pxWaiter,
+						   TickType_t xTicksToWait );
+
+/*
+ * Put pvMessage in the mailbox, or give it to the first waiting receiver.
+ * Returns pdFALSE if the mailbox is full, otherwise pdTRUE and the task to
+ * notify in *pxToNotify, if any.  Called from a critical section.
+ */
+static BaseType_t prvPut( EDFMailbox_t * pxMailbox,
+						  void * pvMessage,
+						  TaskHandle_t * pxToNotify );
+
+/*-----------------------------------------------------------*/
+
+static void prvInsertWaiter( EDFMailboxWaiter_t ** ppxList,
+							 EDFMailboxWaiter_t * pxWaiter )
+{
+	EDFMailboxWaiter_t ** ppxPosition = ppxList;
+
+	while( ( *ppxPosition != NULL ) &&
+		   ( ( TickType_t ) ( pxWaiter->xDeadline - ( *ppxPosition )->xDeadline ) < mailboxTIME_BEFORE ) )
+	{
+		ppxPosition = &( ( *ppxPosition )->pxNext );
+	}
+
+	pxWaiter->pxNext = *ppxPosition;
+	*ppxPosition = pxWaiter;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveWaiter( EDFMailboxWaiter_t ** ppxList,
+							 const EDFMailboxWaiter_t * pxWaiter )
+{
+	EDFMailboxWaiter_t ** ppxPosition = ppxList;
+
+	while( *ppxPosition != NULL )
+	{
+		if( *ppxPosition == pxWaiter )
+		{
+			*ppxPosition = pxWaiter->pxNext;
+			break;
+		}
+
+		ppxPosition = &( ( *ppxPosition )->pxNext );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvWait( EDFMailboxWaiter_t ** ppxList,
+						   EDFMailboxWaiter_t * pxWaiter,
+						   TickType_t xTicksToWait )
+{
+	TimeOut_t xTimeOut;
+
+	pxWaiter->xTask = xTaskGetCurrentTaskHandle();
+	pxWaiter->xDeadline = xTaskGetDeadline( NULL );
+	pxWaiter->xDone = pdFALSE;
+	prvInsertWaiter( ppxList, pxWaiter );
+	vTaskSetTimeOutState( &xTimeOut );
+
+	for( ; ; )
+	{
+		taskEXIT_CRITICAL();
+		( void ) ulTaskNotifyTakeIndexed( configEDF_MAILBOX_NOTIFY_INDEX, pdTRUE, xTicksToWait );
+		taskENTER_CRITICAL();
+
+		if( pxWaiter->xDone != pdFALSE )
+		{
+			break;
+		}
+
+		if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+		{
+			prvRemoveWaiter( ppxList, pxWaiter );
+			break;
+		}
+	}
+
+	return pxWaiter->xDone;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvPut( EDFMailbox_t * pxMailbox,
+						  void * pvMessage,
+						  TaskHandle_t * pxToNotify )
+{
+	EDFMailboxWaiter_t * pxReceiver = pxMailbox->pxReceivers;
+	BaseType_t xReturn = pdTRUE;
+
+	*pxToNotify = NULL;
+
+	if( pxReceiver != NULL )
+	{
+		/* A receiver only waits while the mailbox is empty. */
+		pxMailbox->pxReceivers = pxReceiver->pxNext;
+		pxReceiver->pvMessage = pvMessage;
+		pxReceiver->xDone = pdTRUE;
+		*pxToNotify = pxReceiver->xTask;
+	}
+	else if( pxMailbox->uxCount < pxMailbox->uxLength )
+	{
+		pxMailbox->ppvSlots[ ( pxMailbox->uxHead + pxMailbox->uxCount ) % pxMailbox->uxLength ] = pvMessage;
+		pxMailbox->uxCount++;
+	}
+	else
+	{
+		xReturn = pdFALSE;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vEDFMailboxInit( EDFMailbox_t * pxMailbox,
+					  void ** ppvSlots,
+					  UBaseType_t uxLength )
+{
+	configASSERT( uxLength > 0U );
+
+	pxMailbox->ppvSlots = ppvSlots;
+	pxMailbox->uxLength = uxLength;
+	pxMailbox->uxHead = 0U;
+	pxMailbox->uxCount = 0U;
+	pxMailbox->pxReceivers = NULL;
+	pxMailbox->pxSenders = NULL;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xEDFMailboxSend( EDFMailbox_t * pxMailbox,
+							void * pvMessage,
+							TickType_t xTicksToWait )
+{
+	EDFMailboxWaiter_t xWaiter;
+	TaskHandle_t xToNotify;
+	BaseType_t xReturn = pdPASS;
+
+	taskENTER_CRITICAL();
+	{
+		if( prvPut( pxMailbox, pvMessage, &xToNotify ) != pdFALSE )
+		{
+			if( xToNotify != NULL )
+			{
+				( void ) xTaskNotifyGiveIndexed( xToNotify, configEDF_MAILBOX_NOTIFY_INDEX );
+			}
+		}
+		else if( xTicksToWait == ( TickType_t ) 0 )
+		{
+			xReturn = errQUEUE_FULL;
+		}
+		else
+		{
+			/* A receiver takes the message straight from the waiter. */
+			xWaiter.pvMessage = pvMessage;
+
+			if( prvWait( &( pxMailbox->pxSenders ), &xWaiter, xTicksToWait ) == pdFALSE )
+			{
+				xReturn = errQUEUE_FULL;
+			}
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xEDFMailboxSendFromISR( EDFMailbox_t * pxMailbox,
+								   void * pvMessage,
+								   BaseType_t * pxHigherPriorityTaskWoken )
+{
+	TaskHandle_t xToNotify;
+	BaseType_t xReturn = pdPASS;
+	UBaseType_t uxSavedInterruptStatus;
+
+	uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+	{
+		if( prvPut( pxMailbox, pvMessage, &xToNotify ) != pdFALSE )
+		{
+			if( xToNotify != NULL )
+			{
+				vTaskNotifyGiveIndexedFromISR( xToNotify, configEDF_MAILBOX_NOTIFY_INDEX, pxHigherPriorityTaskWoken );
+			}
+		}
+		else
+		{
+			xReturn = errQUEUE_FULL;
+		}
+	}
+	taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xEDFMailboxReceive( EDFMailbox_t * pxMailbox,
+							   void ** ppvMessage,
+							   TickType_t xTicksToWait )
+{
+	EDFMailboxWaiter_t xWaiter;
+	EDFMailboxWaiter_t * pxSender;
+	BaseType_t xReturn = pdPASS;
+
+	taskENTER_CRITICAL();
+	{
+		if( pxMailbox->uxCount > 0U )
+		{
+			*ppvMessage = pxMailbox->ppvSlots[ pxMailbox->uxHead ];
+			pxMailbox->uxHead = ( pxMailbox->uxHead + 1U ) % pxMailbox->uxLength;
+			pxMailbox->uxCount--;
+
+			/* The room goes to the sender with the earliest deadline. */
+			pxSender = pxMailbox->pxSenders;
+
+			if( pxSender != NULL )
+			{
+				pxMailbox->pxSenders = pxSender->pxNext;
+				pxMailbox->ppvSlots[ ( pxMailbox->uxHead + pxMailbox->uxCount ) % pxMailbox->uxLength ] = pxSender->pvMessage;
+				pxMailbox->uxCount++;
+				pxSender->xDone = pdTRUE;
+				( void ) xTaskNotifyGiveIndexed( pxSender->xTask, configEDF_MAILBOX_NOTIFY_INDEX );
+			}
+		}
+		else if( xTicksToWait == ( TickType_t ) 0 )
+		{
+			xReturn = errQUEUE_EMPTY;
+		}
+		else if( prvWait( &( pxMailbox->pxReceivers ), &xWaiter, xTicksToWait ) != pdFALSE )
+		{
+			*ppvMessage = xWaiter.pvMessage;
+		}
+		else
+		{
+			xReturn = errQUEUE_EMPTY;
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxEDFMailboxMessagesWaiting( const EDFMailbox_t * pxMailbox )
+{
+	/* A single word, read atomically. */
+	return pxMailbox->uxCount;
+}
+/*-----------------------------------------------------------*/
+
+void vEDFMailboxPoolInit( EDFMailboxPool_t * pxPool,
+						  void * pvStorage,
+						  size_t xBlockSize,
+						  UBaseType_t uxBlocks )
+{
+	uint8_t * pucBlock = ( uint8_t * ) pvStorage;
+	UBaseType_t uxBlock;
+
+	if( xBlockSize < sizeof( void * ) )
+	{
+		xBlockSize = sizeof( void * );
+	}
+
+	xBlockSize = ( xBlockSize + ( size_t ) portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+	pxPool->pvFree = NULL;
+	pxPool->uxFree = uxBlocks;
+
+	/* Thread the blocks in address order. */
+	for( uxBlock = uxBlocks; uxBlock > 0U; uxBlock-- )
+	{
+		*( void ** ) ( pucBlock + ( ( size_t ) ( uxBlock - 1U ) * xBlockSize ) ) = pxPool->pvFree;
+		pxPool->pvFree = pucBlock + ( ( size_t ) ( uxBlock - 1U ) * xBlockSize );
+	}
+}
+/*-----------------------------------------------------------*/
+
+void * pvEDFMailboxPoolAlloc( EDFMailboxPool_t * pxPool )
+{
+	void * pvBlock;
+
+	taskENTER_CRITICAL();
+	{
+		pvBlock = pxPool->pvFree;
+
+		if( pvBlock != NULL )
+		{
+			pxPool->pvFree = *( void ** ) pvBlock;
+			pxPool->uxFree--;
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return pvBlock;
+}
+/*-----------------------------------------------------------*/
+
+void vEDFMailboxPoolFree( EDFMailboxPool_t * pxPool,
+						  void * pvBlock )
+{
+	configASSERT( pvBlock != NULL );
+
+	taskENTER_CRITICAL();
+	{
+		*( void ** ) pvBlock = pxPool->pvFree;
+		pxPool->pvFree = pvBlock;
+		pxPool->uxFree++;
+	}
+	taskEXIT_CRITICAL();
+}
+
+#endif /* configUSE_EDF_MAILBOX */
@@ -0,0 +1,104 @@
+/*
+ * Zero-copy mailbox for passing buffers between EDF tasks.
+ *
+ * A mailbox holds pointers only: sending a message hands the buffer it points
+ * to over to the receiver, which owns it until it passes it on or frees it.
+ * Nothing is copied and the critical sections are a few pointer updates long,
+ * where a queue of pointers copies every item with memcpy() inside its
+ * critical sections.  Buffers of a fixed size come from a pool,
+ * EDFMailboxPool_t, so allocating and freeing them takes constant time too.
+ *
+ * Tasks waiting to receive from an empty mailbox, or to send to a full one,
+ * are served earliest deadline first, not in arrival or priority order, and a
+ * message sent to a waiting receiver is given to it directly.  Waiting tasks
+ * are woken with a task notification at index configEDF_MAILBOX_NOTIFY_INDEX,
+ * which the application must not use for anything else.
+ */
+
+#ifndef EDF_MAILBOX_H
+#define EDF_MAILBOX_H
+
+/* A task waiting on a mailbox, on the stack of the task. */
+typedef struct xEDF_MAILBOX_WAITER
+{
+	struct xEDF_MAILBOX_WAITER * pxNext;
+	TaskHandle_t xTask;
+	TickType_t xDeadline;       /* Deadline of the job of the task when it started waiting. */
+	void * pvMessage;           /* Message to send, or message received. */
+	volatile BaseType_t xDone;  /* pdTRUE once the message has been passed. */
+} EDFMailboxWaiter_t;
+
+typedef struct xEDF_MAILBOX
+{
+	void ** ppvSlots;                 /* uxLength messages, oldest at uxHead. */
+	UBaseType_t uxLength;
+	UBaseType_t uxHead;
+	UBaseType_t uxCount;
+	EDFMailboxWaiter_t * pxReceivers; /* Tasks waiting for a message, earliest deadline first. */
+	EDFMailboxWaiter_t * pxSenders;   /* Tasks waiting for room, earliest deadline first. */
+} EDFMailbox_t;
+
+typedef struct xEDF_MAILBOX_POOL
+{
+	void * pvFree;                    /* Free blocks, each holding the next one. */
+	UBaseType_t uxFree;
+} EDFMailboxPool_t;
+
+/*
+ * Initialise pxMailbox to hold up to uxLength messages in ppvSlots, an array
+ * of uxLength pointers that must remain valid as long as the mailbox is used.
+ */
+void vEDFMailboxInit( EDFMailbox_t * pxMailbox,
+					  void ** ppvSlots,
+					  UBaseType_t uxLength );
+
+/*
+ * Send pvMessage, handing the buffer it points to over to the receiver.  If
+ * the mailbox is full, wait up to xTicksToWait for room.  Returns pdPASS if
+ * the message was sent, errQUEUE_FULL otherwise, in which case the caller
+ * still owns the buffer.
+ */
+BaseType_t xEDFMailboxSend( EDFMailbox_t * pxMailbox,
+							void * pvMessage,
+							TickType_t xTicksToWait );
+
+/*
+ * Same as xEDFMailboxSend() from an interrupt, never waits.
+ * *pxHigherPriorityTaskWoken is set to pdTRUE if a context switch should be
+ * requested before the interrupt exits.
+ */
+BaseType_t xEDFMailboxSendFromISR( EDFMailbox_t * pxMailbox,
+								   void * pvMessage,
+								   BaseType_t * pxHigherPriorityTaskWoken );
+
+/*
+ * Receive the oldest message into *ppvMessage, the caller then owns the
+ * buffer.  If the mailbox is empty, wait up to xTicksToWait for a message.
+ * Returns pdPASS if a message was received, errQUEUE_EMPTY otherwise.
+ */
+BaseType_t xEDFMailboxReceive( EDFMailbox_t * pxMailbox,
+							   void ** ppvMessage,
+							   TickType_t xTicksToWait );
+
+/* Number of messages in the mailbox. */
+UBaseType_t uxEDFMailboxMessagesWaiting( const EDFMailbox_t * pxMailbox );
+
+/*
+ * Initialise pxPool with uxBlocks blocks of xBlockSize bytes carved from
+ * pvStorage, which must be aligned for the messages and at least
+ * uxBlocks * xBlockSize bytes long.  xBlockSize is rounded up to a multiple
+ * of portBYTE_ALIGNMENT and is at least the size of a pointer.
+ */
+void vEDFMailboxPoolInit( EDFMailboxPool_t * pxPool,
+						  void * pvStorage,
+						  size_t xBlockSize,
+						  UBaseType_t uxBlocks );
+
+/* Take a block from pxPool, NULL if none is free. */
+void * pvEDFMailboxPoolAlloc( EDFMailboxPool_t * pxPool );
+
+/* Give back a block taken from pxPool. */
+void vEDFMailboxPoolFree( EDFMailboxPool_t * pxPool,
+						  void * pvBlock );
+
+#endif /* EDF_MAILBOX_H */
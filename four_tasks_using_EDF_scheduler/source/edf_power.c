@@ -0,0 +1,461 @@
+/*
+ * Cycle-conserving EDF power manager.  See edf_power.h.
+ *
+ * Reference: Pillai and Shin, "Real-time dynamic voltage scaling for
+ * low-power embedded operating systems", SOSP 2001.
+ *
+ * ulEDFPowerSetSpeed() is called by the kernel from the tick interrupt or a
+ * critical section, so the state below needs no further locking.
+ */
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "edf_taskset.h"
+#include "edf_power.h"
+
+#if ( configUSE_EDF_DVFS == 1 )
+
+#if !defined( __unix__ ) && !defined( __APPLE__ )
+#include "lpc21xx.h"
+#endif
+
+static const uint32_t ulLevelHz[] = configEDF_POWER_LEVELS_HZ;
+
+#define powerLEVELS        ( sizeof( ulLevelHz ) / sizeof( ulLevelHz[ 0 ] ) )
+#define powerFULL_HZ       ( ulLevelHz[ powerLEVELS - 1U ] )
+
+/* ulCurrentLevel before the first call. */
+#define powerNO_LEVEL      ( ( uint32_t ) 0xffffffffUL )
+
+static uint32_t ulCurrentLevel = powerNO_LEVEL;
+static uint32_t ulLevelStartTime = 0;
+static uint64_t ullTimeAtLevel[ configEDF_POWER_MAX_LEVELS ];
+static uint32_t ulChanges = 0;
+
+/*-----------------------------------------------------------*/
+
+/* Speed of a level, 16.16, rounded down so it never overstates the level. */
+static uint32_t prvLevelSpeed( uint32_t ulLevel )
+{
+	return ( uint32_t ) ( ( ( uint64_t ) ulLevelHz[ ulLevel ] * ( uint64_t ) tskEDF_SPEED_FULL ) / ( uint64_t ) powerFULL_HZ );
+}
+
+/* Power of the model at a speed, relative to full speed. */
+static double prvPower( double dSpeed )
+{
+	const double dStatic = ( double ) configEDF_POWER_STATIC_PERMILLE / 1000.0;
+
+	return dStatic + ( 1.0 - dStatic ) * dSpeed * dSpeed * dSpeed;
+}
+
+static uint32_t prvGetTime( void )
+{
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+	return ( uint32_t ) portGET_RUN_TIME_COUNTER_VALUE();
+#else
+	return ( uint32_t ) xTaskGetTickCount();
+#endif
+}
+
+uint32_t ulEDFPowerSetSpeed( uint32_t ulUtilisation )
+{
+	uint32_t ulLevel = 0;
+	uint32_t ulNow;
+	uint32_t ulHz;
+
+	configASSERT( powerLEVELS <= configEDF_POWER_MAX_LEVELS );
+	configASSERT( powerFULL_HZ == configCPU_CLOCK_HZ );
+
+	while( ( ulLevel < ( powerLEVELS - 1U ) ) && ( prvLevelSpeed( ulLevel ) < ulUtilisation ) )
+	{
+		ulLevel++;
+	}
+
+	if( ulLevel != ulCurrentLevel )
+	{
+		ulHz = configEDF_POWER_SET_FREQUENCY( ulLevelHz[ ulLevel ] );
+
+		/* A switch down that did not take leaves the processor at the
+		 * frequency it ran at, faster than needed. */
+		if( ulHz != ulLevelHz[ ulLevel ] )
+		{
+			configASSERT( ulHz > ulLevelHz[ ulLevel ] );
+
+			ulLevel = powerLEVELS - 1U;
+
+			while( ( ulLevel > 0U ) && ( ulLevelHz[ ulLevel ] != ulHz ) )
+			{
+				ulLevel--;
+			}
+
+			configASSERT( ulLevelHz[ ulLevel ] == ulHz );
+		}
+
+		if( ulLevel != ulCurrentLevel )
+		{
+			ulNow = prvGetTime();
+
+			if( ulCurrentLevel != powerNO_LEVEL )
+			{
+				ullTimeAtLevel[ ulCurrentLevel ] += ( uint64_t ) ( ulNow - ulLevelStartTime );
+				ulChanges++;
+			}
+
+			ulLevelStartTime = ulNow;
+			ulCurrentLevel = ulLevel;
+		}
+	}
+
+	/* The top level is full speed exactly, whatever the rounding. */
+	return ( ulLevel == ( powerLEVELS - 1U ) ) ? tskEDF_SPEED_FULL : prvLevelSpeed( ulLevel );
+}
+/*-----------------------------------------------------------*/
+
+void vEDFPowerGetStats( EDFPowerStats_t * pxStats )
+{
+	uint32_t ulLevel;
+	double dTotal = 0.0, dEnergy = 0.0, dTime;
+
+	configASSERT( pxStats );
+
+	taskENTER_CRITICAL();
+	{
+		pxStats->ulLevels = ( uint32_t ) powerLEVELS;
+		pxStats->ulChanges = ulChanges;
+
+		for( ulLevel = 0; ulLevel < powerLEVELS; ulLevel++ )
+		{
+			pxStats->ulLevelHz[ ulLevel ] = ulLevelHz[ ulLevel ];
+			pxStats->ullTimeAtLevel[ ulLevel ] = ullTimeAtLevel[ ulLevel ];
+		}
+
+		if( ulCurrentLevel != powerNO_LEVEL )
+		{
+			pxStats->ullTimeAtLevel[ ulCurrentLevel ] += ( uint64_t ) ( prvGetTime() - ulLevelStartTime );
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	for( ulLevel = 0; ulLevel < powerLEVELS; ulLevel++ )
+	{
+		dTime = ( double ) pxStats->ullTimeAtLevel[ ulLevel ];
+		dTotal += dTime;
+		dEnergy += dTime * prvPower( ( double ) ulLevelHz[ ulLevel ] / ( double ) powerFULL_HZ );
+	}
+
+	pxStats->dEnergyRatio = ( dTotal > 0.0 ) ? ( dEnergy / dTotal ) : 1.0;
+}
+/*-----------------------------------------------------------*/
+
+#if !defined( __unix__ ) && !defined( __APPLE__ )
+
+/* PLL feed sequence, makes the PLLCON and PLLCFG writes take effect. */
+#define powerPLL_FEED()          do { PLLFEED = 0xAA; PLLFEED = 0x55; } while( 0 )
+
+#define powerPLL_ENABLE          ( ( unsigned long ) 0x01 )
+#define powerPLL_CONNECT         ( ( unsigned long ) 0x03 )
+#define powerPLL_LOCK            ( ( unsigned long ) 0x0400 )
+#define powerCRYSTAL_HZ          ( ( unsigned long ) 12000000 )
+
+/* MAM fetch cycles needed at a frequency. */
+static unsigned long prvMAMCycles( uint32_t ulHz )
+{
+	if( ulHz < 20000000UL )
+	{
+		return 1UL;
+	}
+	else if( ulHz < 40000000UL )
+	{
+		return 2UL;
+	}
+
+	return 3UL;
+}
+
+/* Rescale a divisor set for the current frequency, rounding to nearest. */
+static unsigned long prvRescale( unsigned long ulValue,
+								 uint32_t ulNewHz,
+								 uint32_t ulOldHz )
+{
+	return ( unsigned long ) ( ( ( ( uint64_t ) ulValue * ulNewHz ) + ( ulOldHz / 2U ) ) / ulOldHz );
+}
+
+uint32_t ulEDFPowerSetPLL( uint32_t ulHz )
+{
+	static uint32_t ulOldHz = configCPU_CLOCK_HZ;
+	unsigned long ulMultiplier = ulHz / powerCRYSTAL_HZ;
+	unsigned long ulDivider = 1, ulPSel = 0, ulMAMControl, ulDivisor;
+	unsigned long ulPolls = 0;
+	unsigned long ulOldConfig;
+
+	if( ulHz == ulOldHz )
+	{
+		return ulHz;
+	}
+
+	configASSERT( ( ulMultiplier >= 1UL ) && ( ulMultiplier <= 32UL ) && ( ( ulMultiplier * powerCRYSTAL_HZ ) == ulHz ) );
+
+	/* The current controlled oscillator runs at 2 * P * cclk, which must be
+	 * within 156 to 320 MHz. */
+	while( ( 2UL * ulDivider * ulHz ) < 156000000UL )
+	{
+		ulDivider <<= 1;
+		ulPSel++;
+	}
+
+	configASSERT( ulPSel <= 3UL );
+
+	/* Flash wait states for the faster of the two frequencies while
+	 * switching. */
+	ulMAMControl = MAMCR;
+
+	if( prvMAMCycles( ulHz ) > MAMTIM )
+	{
+		MAMCR = 0;
+		MAMTIM = prvMAMCycles( ulHz );
+		MAMCR = ulMAMControl;
+	}
+
+	/* Run from the crystal while the PLL locks on the new frequency. */
+	ulOldConfig = PLLCFG;
+	PLLCON = powerPLL_ENABLE;
+	powerPLL_FEED();
+	PLLCFG = ( ulMultiplier - 1UL ) | ( ulPSel << 5 );
+	powerPLL_FEED();
+
+	while( ( ( PLLSTAT & powerPLL_LOCK ) == 0UL ) && ( ulPolls < configEDF_POWER_PLL_LOCK_POLLS ) )
+	{
+		ulPolls++;
+	}
+
+	if( ( ( PLLSTAT & powerPLL_LOCK ) == 0UL ) && ( ulHz < ulOldHz ) )
+	{
+		/* Lowering the speed can wait for the next call.  Go back to the
+		 * setting that ran, the load admitted may still need it. */
+		PLLCFG = ulOldConfig;
+		powerPLL_FEED();
+		ulHz = ulOldHz;
+	}
+
+	/* The load needs the frequency the PLL is now set for, a raise or the
+	 * previous one, so that wait is not bounded: the crystal alone is too
+	 * slow for it. */
+	while( ( PLLSTAT & powerPLL_LOCK ) == 0UL )
+	{
+	}
+
+	PLLCON = powerPLL_CONNECT;
+	powerPLL_FEED();
+
+	if( prvMAMCycles( ulHz ) < MAMTIM )
+	{
+		MAMCR = 0;
+		MAMTIM = prvMAMCycles( ulHz );
+		MAMCR = ulMAMControl;
+	}
+
+	/* The peripheral clock follows the processor clock (VPBDIV is 1), keep
+	 * the tick, the run time counter and the baud rate where they were. */
+	T0MR0 = ( unsigned long ) ( ulHz / ( uint32_t ) configTICK_RATE_HZ );
+	T0TC = prvRescale( T0TC, ulHz, ulOldHz );
+	T1PR = prvRescale( T1PR + 1UL, ulHz, ulOldHz ) - 1UL;
+
+	U0LCR |= 0x80;
+	ulDivisor = prvRescale( ( U0DLM << 8 ) | U0DLL, ulHz, ulOldHz );
+	U0DLL = ulDivisor & 0xFFUL;
+	U0DLM = ( ulDivisor >> 8 ) & 0xFFUL;
+	U0LCR &= ~0x80;
+
+	ulOldHz = ulHz;
+
+	return ulHz;
+}
+
+#endif /* target */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_TASKSET == 1 )
+
+typedef enum
+{
+	ePowerSimFull = 0,
+	ePowerSimStatic,
+	ePowerSimCycleConserving
+} ePowerSimPolicy_t;
+
+typedef struct xEDF_POWER_SIM_TASK
+{
+	double dLeft;          /* Work left in the current job, full speed ticks. */
+	double dUtilisation;   /* Utilisation reserved by the task. */
+	double dActual;        /* Work of the current job. */
+	TickType_t xDeadline;  /* Absolute deadline of the current job. */
+} EDFPowerSimTask_t;
+
+static EDFPowerSimTask_t xSimTasks[ configEDF_TASKSET_MAX_TASKS ];
+
+/* Lowest level speed at least dUtilisation, as ulEDFPowerSetSpeed() picks. */
+static double prvSimSpeed( double dUtilisation )
+{
+	uint32_t ulLevel = 0;
+
+	while( ( ulLevel < ( powerLEVELS - 1U ) ) &&
+		   ( ( double ) ulLevelHz[ ulLevel ] / ( double ) powerFULL_HZ ) < dUtilisation - 1e-9 )
+	{
+		ulLevel++;
+	}
+
+	return ( double ) ulLevelHz[ ulLevel ] / ( double ) powerFULL_HZ;
+}
+
+/* xorshift32, private so a simulation does not disturb the generator. */
+static double prvSimRandom( uint32_t * pulState )
+{
+	*pulState ^= *pulState << 13;
+	*pulState ^= *pulState >> 17;
+	*pulState ^= *pulState << 5;
+	return ( double ) *pulState / 4294967296.0;
+}
+
+static double prvSimulate( const EDFTaskSet_t * pxTaskSet,
+						   ePowerSimPolicy_t ePolicy,
+						   double dMinActualRatio,
+						   TickType_t xHorizon,
+						   uint32_t * pulMisses,
+						   uint32_t * pulJobs )
+{
+	const EDFTaskSetTask_t * pxTask;
+	UBaseType_t uxIndex, uxRun;
+	TickType_t xTick;
+	uint32_t ulRandomState = 0x2545F491UL;
+	double dWCETUtilisation = 0.0, dEnergy = 0.0, dSpeed, dTimeLeft, dSum, dNeeded;
+
+	for( uxIndex = 0; uxIndex < pxTaskSet->uxTasks; uxIndex++ )
+	{
+		pxTask = &( pxTaskSet->xTasks[ uxIndex ] );
+		dWCETUtilisation += ( double ) pxTask->xWCET / ( double ) pxTask->xPeriod;
+		xSimTasks[ uxIndex ].dLeft = 0.0;
+		xSimTasks[ uxIndex ].dUtilisation = 0.0;
+	}
+
+	*pulMisses = 0;
+	*pulJobs = 0;
+
+	for( xTick = 0; xTick < xHorizon; xTick++ )
+	{
+		for( uxIndex = 0; uxIndex < pxTaskSet->uxTasks; uxIndex++ )
+		{
+			pxTask = &( pxTaskSet->xTasks[ uxIndex ] );
+
+			/* A job still running at its deadline is a miss and is dropped. */
+			if( ( xSimTasks[ uxIndex ].dLeft > 0.0 ) && ( xTick >= xSimTasks[ uxIndex ].xDeadline ) )
+			{
+				( *pulMisses )++;
+				xSimTasks[ uxIndex ].dLeft = 0.0;
+			}
+
+			if( ( xTick % pxTask->xPeriod ) == 0U )
+			{
+				xSimTasks[ uxIndex ].dActual = ( double ) pxTask->xWCET * ( dMinActualRatio + ( 1.0 - dMinActualRatio ) * prvSimRandom( &ulRandomState ) );
+				xSimTasks[ uxIndex ].dLeft = xSimTasks[ uxIndex ].dActual;
+				xSimTasks[ uxIndex ].dUtilisation = ( double ) pxTask->xWCET / ( double ) pxTask->xPeriod;
+				xSimTasks[ uxIndex ].xDeadline = xTick + pxTask->xDeadline;
+				( *pulJobs )++;
+			}
+		}
+
+		/* Run the tick, the speed changing as jobs complete. */
+		dTimeLeft = 1.0;
+
+		while( dTimeLeft > 0.0 )
+		{
+			uxRun = pxTaskSet->uxTasks;
+			dSum = 0.0;
+
+			for( uxIndex = 0; uxIndex < pxTaskSet->uxTasks; uxIndex++ )
+			{
+				dSum += xSimTasks[ uxIndex ].dUtilisation;
+
+				if( ( xSimTasks[ uxIndex ].dLeft > 0.0 ) &&
+					( ( uxRun == pxTaskSet->uxTasks ) || ( xSimTasks[ uxIndex ].xDeadline < xSimTasks[ uxRun ].xDeadline ) ) )
+				{
+					uxRun = uxIndex;
+				}
+			}
+
+			if( uxRun == pxTaskSet->uxTasks )
+			{
+				/* Idle. */
+				dEnergy += prvPower( 0.0 ) * dTimeLeft;
+				break;
+			}
+
+			if( ePolicy == ePowerSimFull )
+			{
+				dSpeed = 1.0;
+			}
+			else if( ePolicy == ePowerSimStatic )
+			{
+				dSpeed = prvSimSpeed( dWCETUtilisation );
+			}
+			else
+			{
+				dSpeed = prvSimSpeed( dSum );
+			}
+
+			dNeeded = xSimTasks[ uxRun ].dLeft / dSpeed;
+
+			if( dNeeded <= dTimeLeft )
+			{
+				dEnergy += prvPower( dSpeed ) * dNeeded;
+				dTimeLeft -= dNeeded;
+				xSimTasks[ uxRun ].dLeft = 0.0;
+
+				/* Cycle conserving: only the work done stays reserved. */
+				xSimTasks[ uxRun ].dUtilisation = xSimTasks[ uxRun ].dActual / ( double ) pxTaskSet->xTasks[ uxRun ].xPeriod;
+			}
+			else
+			{
+				dEnergy += prvPower( dSpeed ) * dTimeLeft;
+				xSimTasks[ uxRun ].dLeft -= dSpeed * dTimeLeft;
+				dTimeLeft = 0.0;
+			}
+		}
+	}
+
+	return dEnergy;
+}
+
+BaseType_t xEDFPowerSimulate( const EDFTaskSet_t * pxTaskSet,
+							  double dMinActualRatio,
+							  TickType_t xHorizon,
+							  EDFPowerSimResult_t * pxResult )
+{
+	UBaseType_t uxIndex;
+	double dUtilisation = 0.0;
+	uint32_t ulMisses;
+
+	configASSERT( pxTaskSet );
+	configASSERT( pxResult );
+
+	for( uxIndex = 0; uxIndex < pxTaskSet->uxTasks; uxIndex++ )
+	{
+		dUtilisation += ( double ) pxTaskSet->xTasks[ uxIndex ].xWCET / ( double ) pxTaskSet->xTasks[ uxIndex ].xPeriod;
+	}
+
+	if( ( dUtilisation > 1.0 ) || ( dMinActualRatio < 0.0 ) || ( dMinActualRatio > 1.0 ) )
+	{
+		return pdFAIL;
+	}
+
+	pxResult->dEnergyFull = prvSimulate( pxTaskSet, ePowerSimFull, dMinActualRatio, xHorizon, &ulMisses, &( pxResult->ulJobs ) );
+	pxResult->dEnergyStatic = prvSimulate( pxTaskSet, ePowerSimStatic, dMinActualRatio, xHorizon, &( pxResult->ulMissesStatic ), &( pxResult->ulJobs ) );
+	pxResult->dEnergyCycleConserving = prvSimulate( pxTaskSet, ePowerSimCycleConserving, dMinActualRatio, xHorizon, &( pxResult->ulMissesCycleConserving ), &( pxResult->ulJobs ) );
+
+	return pdPASS;
+}
+
+#endif /* configUSE_EDF_TASKSET */
+
+#endif /* configUSE_EDF_DVFS */
@@ -0,0 +1,117 @@
+/*
+ * Cycle-conserving EDF power manager.
+ *
+ * With configUSE_EDF_DVFS set to 1 the kernel keeps the utilisation the task
+ * set needs, reclaiming the slack of jobs that complete early, and calls
+ * configEDF_DVFS_SET_SPEED() whenever it changes (see tasks.c).  This module
+ * maps that utilisation to the lowest frequency of a table of levels that is
+ * fast enough, sets it through configEDF_POWER_SET_FREQUENCY() and records the
+ * time spent at each level to estimate the energy saved.
+ *
+ * On target the frequency is changed by reprogramming the LPC21xx PLL, with
+ * the tick timer, the run time counter timer and the UART divisor rescaled so
+ * they keep their rates.  On the POSIX port the level is only recorded.
+ *
+ * xEDFPowerSimulate() runs the same policy on a generated task set in a host
+ * model, to estimate the energy saved against running at full speed.
+ */
+
+#ifndef EDF_POWER_H
+#define EDF_POWER_H
+
+/* Processor frequencies in Hz, lowest first, the last one is full speed.  The
+ * LPC2129 PLL multiplies the 12 MHz crystal by 1 to 5; 12 MHz is left out as
+ * 115200 baud cannot be reached accurately from it. */
+#ifndef configEDF_POWER_LEVELS_HZ
+#define configEDF_POWER_LEVELS_HZ           { 24000000UL, 36000000UL, 48000000UL, 60000000UL }
+#endif
+
+/* Largest number of levels. */
+#ifndef configEDF_POWER_MAX_LEVELS
+#define configEDF_POWER_MAX_LEVELS          8
+#endif
+
+/* Power model used for the energy estimates: the power at frequency f is
+ * P( f ) = s + ( 1 - s ) * ( f / f_max )^3, the voltage scaling with the
+ * frequency, where s is the static share of the power at full speed, in
+ * per mille.  The idle processor draws s. */
+#ifndef configEDF_POWER_STATIC_PERMILLE
+#define configEDF_POWER_STATIC_PERMILLE     100
+#endif
+
+/* Polls of the PLL lock bit before giving up on lowering the frequency, which
+ * bounds the time the tick interrupt or the critical section changing the
+ * speed can take.  The PLL is then set back to the frequency it ran at.  A
+ * raise, and the return to the previous frequency, wait for the lock: the load
+ * admitted needs that speed.  The LPC2129 PLL locks within 100 us, each poll
+ * takes a few cycles at the 12 MHz of the crystal the processor runs from
+ * meanwhile. */
+#ifndef configEDF_POWER_PLL_LOCK_POLLS
+#define configEDF_POWER_PLL_LOCK_POLLS      1000UL
+#endif
+
+/* Set the processor frequency, called with interrupts masked.  Returns the
+ * frequency actually set. */
+#ifndef configEDF_POWER_SET_FREQUENCY
+#if defined( __unix__ ) || defined( __APPLE__ )
+#define configEDF_POWER_SET_FREQUENCY( ulHz )    ( ulHz )
+#else
+uint32_t ulEDFPowerSetPLL( uint32_t ulHz );
+#define configEDF_POWER_SET_FREQUENCY( ulHz )    ulEDFPowerSetPLL( ulHz )
+#endif
+#endif
+
+typedef struct xEDF_POWER_STATS
+{
+	uint32_t ulLevels;                                          /* Number of levels. */
+	uint32_t ulLevelHz[ configEDF_POWER_MAX_LEVELS ];           /* Frequency of each level. */
+	uint64_t ullTimeAtLevel[ configEDF_POWER_MAX_LEVELS ];      /* Run time counter counts spent at each level. */
+	uint32_t ulChanges;                                         /* Number of frequency changes. */
+	double dEnergyRatio;                                        /* Energy of the model relative to full speed. */
+} EDFPowerStats_t;
+
+/*
+ * Map a utilisation (16.16, at most tskEDF_SPEED_FULL) to the lowest level at
+ * least that fast, switch to it if needed and return its speed (16.16).  If
+ * the PLL did not lock on a lower level, the processor stays at the level it
+ * was at, whose speed is returned, and the switch is tried again by the next
+ * call.  The speed returned is never below ulUtilisation.  This is
+ * configEDF_DVFS_SET_SPEED(), it must not be called by the application.
+ */
+uint32_t ulEDFPowerSetSpeed( uint32_t ulUtilisation );
+
+/*
+ * Time spent at each level so far and the energy it is estimated to have
+ * taken, relative to running at full speed all along.  The processor is
+ * assumed busy at any speed, so the estimate is for the speed only; the
+ * simulator below accounts idle time too.
+ */
+void vEDFPowerGetStats( EDFPowerStats_t * pxStats );
+
+#if ( configUSE_EDF_TASKSET == 1 )
+
+typedef struct xEDF_POWER_SIM_RESULT
+{
+	double dEnergyFull;               /* Always at full speed, idle when nothing is ready. */
+	double dEnergyStatic;             /* At the lowest level covering the WCET utilisation. */
+	double dEnergyCycleConserving;    /* Cycle-conserving EDF. */
+	uint32_t ulMissesStatic;          /* Deadlines missed by each policy. */
+	uint32_t ulMissesCycleConserving;
+	uint32_t ulJobs;                  /* Jobs released in each run. */
+} EDFPowerSimResult_t;
+
+/*
+ * Host model of the power manager.  Simulate EDF on pxTaskSet for xHorizon
+ * ticks with every job executing a uniformly drawn [ dMinActualRatio, 1 ]
+ * share of its WCET, under the three policies of EDFPowerSimResult_t and with
+ * the same jobs each time.  Energies are in units of full speed power for one
+ * tick.  Returns pdFAIL if the WCET utilisation of the set is above 1.
+ */
+BaseType_t xEDFPowerSimulate( const EDFTaskSet_t * pxTaskSet,
+							  double dMinActualRatio,
+							  TickType_t xHorizon,
+							  EDFPowerSimResult_t * pxResult );
+
+#endif /* configUSE_EDF_TASKSET */
+
+#endif /* EDF_POWER_H */
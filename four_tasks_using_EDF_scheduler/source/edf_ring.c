@@ -0,0 +1,185 @@
+/*
+ * Single-producer/single-consumer ring buffer.  See edf_ring.h.
+ *
+ * uxHead and uxTail count the items pushed and popped since the ring was
+ * initialised and wrap around naturally, the ring holds uxHead - uxTail items
+ * and item n is in slot n & uxMask.  The producer copies the item, then
+ * publishes it by moving uxHead; the consumer copies the item, then frees the
+ * slot by moving uxTail.
+ *
+ * A consumer going to wait first publishes itself in xWaiting and then checks
+ * the ring once more, and a producer checks xWaiting after publishing an item,
+ * so at least one of them sees the other and no wake up is lost.  A producer
+ * may notify a consumer that has already found the item; the notification
+ * then only makes the next wait check the ring once more.
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "edf_ring.h"
+
+#if ( configUSE_EDF_RING == 1 )
+
+#if ( configUSE_TASK_NOTIFICATIONS != 1 )
+#error "The EDF ring needs configUSE_TASK_NOTIFICATIONS set to 1"
+#endif
+
+/*
+ * Copy the item and publish it.  Returns the consumer to wake, if any, in
+ * *pxToNotify.
+ */
+static BaseType_t prvPush( EDFRing_t * pxRing,
+						   const void * pvItem,
+						   TaskHandle_t * pxToNotify );
+
+/*-----------------------------------------------------------*/
+
+void vEDFRingInit( EDFRing_t * pxRing,
+				   void * pvBuffer,
+				   size_t xItemSize,
+				   UBaseType_t uxLength )
+{
+	/* The indexes wrap around, the length must divide their range. */
+	configASSERT( ( uxLength > 0U ) && ( ( uxLength & ( uxLength - 1U ) ) == 0U ) );
+
+	pxRing->pucBuffer = ( uint8_t * ) pvBuffer;
+	pxRing->xItemSize = xItemSize;
+	pxRing->uxMask = uxLength - 1U;
+	pxRing->uxHead = 0U;
+	pxRing->uxTail = 0U;
+	pxRing->xWaiting = NULL;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvPush( EDFRing_t * pxRing,
+						   const void * pvItem,
+						   TaskHandle_t * pxToNotify )
+{
+	const UBaseType_t uxHead = pxRing->uxHead;
+	BaseType_t xReturn = pdFAIL;
+
+	*pxToNotify = NULL;
+
+	if( ( UBaseType_t ) ( uxHead - pxRing->uxTail ) <= pxRing->uxMask )
+	{
+		/* The slot was freed before uxTail moved past it. */
+		configEDF_RING_BARRIER();
+		memcpy( &( pxRing->pucBuffer[ ( uxHead & pxRing->uxMask ) * pxRing->xItemSize ] ), pvItem, pxRing->xItemSize );
+		configEDF_RING_BARRIER();
+		pxRing->uxHead = uxHead + 1U;
+		configEDF_RING_BARRIER();
+
+		*pxToNotify = pxRing->xWaiting;
+		xReturn = pdPASS;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xEDFRingPush( EDFRing_t * pxRing,
+						 const void * pvItem )
+{
+	TaskHandle_t xToNotify;
+	BaseType_t xReturn;
+
+	xReturn = prvPush( pxRing, pvItem, &xToNotify );
+
+	if( xToNotify != NULL )
+	{
+		( void ) xTaskNotifyGiveIndexed( xToNotify, configEDF_RING_NOTIFY_INDEX );
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xEDFRingPushFromISR( EDFRing_t * pxRing,
+								const void * pvItem,
+								BaseType_t * pxHigherPriorityTaskWoken )
+{
+	TaskHandle_t xToNotify;
+	BaseType_t xReturn;
+
+	xReturn = prvPush( pxRing, pvItem, &xToNotify );
+
+	if( xToNotify != NULL )
+	{
+		vTaskNotifyGiveIndexedFromISR( xToNotify, configEDF_RING_NOTIFY_INDEX, pxHigherPriorityTaskWoken );
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xEDFRingPop( EDFRing_t * pxRing,
+						void * pvItem )
+{
+	const UBaseType_t uxTail = pxRing->uxTail;
+	BaseType_t xReturn = pdFAIL;
+
+	if( pxRing->uxHead != uxTail )
+	{
+		/* The item was copied before uxHead moved past it. */
+		configEDF_RING_BARRIER();
+		memcpy( pvItem, &( pxRing->pucBuffer[ ( uxTail & pxRing->uxMask ) * pxRing->xItemSize ] ), pxRing->xItemSize );
+		configEDF_RING_BARRIER();
+		pxRing->uxTail = uxTail + 1U;
+		xReturn = pdPASS;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xEDFRingPopWait( EDFRing_t * pxRing,
+							void * pvItem,
+							TickType_t xTicksToWait )
+{
+	TimeOut_t xTimeOut;
+	BaseType_t xReturn;
+
+	xReturn = xEDFRingPop( pxRing, pvItem );
+
+	if( ( xReturn == pdFAIL ) && ( xTicksToWait > ( TickType_t ) 0 ) )
+	{
+		vTaskSetTimeOutState( &xTimeOut );
+
+		for( ; ; )
+		{
+			pxRing->xWaiting = xTaskGetCurrentTaskHandle();
+			configEDF_RING_BARRIER();
+
+			/* An item pushed before xWaiting was seen brings no notification. */
+			xReturn = xEDFRingPop( pxRing, pvItem );
+
+			if( xReturn == pdFAIL )
+			{
+				( void ) ulTaskNotifyTakeIndexed( configEDF_RING_NOTIFY_INDEX, pdTRUE, xTicksToWait );
+				xReturn = xEDFRingPop( pxRing, pvItem );
+			}
+
+			pxRing->xWaiting = NULL;
+
+			if( ( xReturn != pdFAIL ) || ( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE ) )
+			{
+				break;
+			}
+		}
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxEDFRingCount( const EDFRing_t * pxRing )
+{
+	return ( UBaseType_t ) ( pxRing->uxHead - pxRing->uxTail );
+}
+
+#endif /* configUSE_EDF_RING */
@@ -0,0 +1,90 @@
+/*
+ * Single-producer/single-consumer ring buffer.
+ *
+ * One task or interrupt pushes, one task or interrupt pops, and neither ever
+ * masks interrupts or enters a critical section: the producer only writes the
+ * head index and the consumer only writes the tail index, each a single word
+ * read and written atomically, with a barrier between the item copy and the
+ * index update.  Push and pop are wait-free, they complete in a bounded number
+ * of steps whatever the other side does.
+ *
+ * A consumer task can also wait for an item with xEDFRingPopWait(), it is then
+ * woken by the producer with a task notification at index
+ * configEDF_RING_NOTIFY_INDEX.  That is the only path that uses the kernel,
+ * and only when the consumer is actually waiting.
+ *
+ * With more than one producer or more than one consumer, use a queue or an
+ * EDF mailbox (edf_mailbox.h) instead.
+ */
+
+#ifndef EDF_RING_H
+#define EDF_RING_H
+
+/* Orders the item copy and the index update as seen from the other side.  On
+ * one core only the compiler has to be stopped from reordering them. */
+#ifndef configEDF_RING_BARRIER
+#if defined( __GNUC__ ) && ( configNUMBER_OF_CORES > 1 )
+#define configEDF_RING_BARRIER()    __sync_synchronize()
+#elif defined( __GNUC__ )
+#define configEDF_RING_BARRIER()    __asm volatile ( "" ::: "memory" )
+#else
+#define configEDF_RING_BARRIER()    portMEMORY_BARRIER()
+#endif
+#endif
+
+typedef struct xEDF_RING
+{
+	uint8_t * pucBuffer;               /* uxLength items of xItemSize bytes. */
+	size_t xItemSize;
+	UBaseType_t uxMask;                /* uxLength - 1, uxLength is a power of 2. */
+	volatile UBaseType_t uxHead;       /* Items pushed, only written by the producer. */
+	volatile UBaseType_t uxTail;       /* Items popped, only written by the consumer. */
+	TaskHandle_t volatile xWaiting;    /* Consumer waiting in xEDFRingPopWait(), or NULL. */
+} EDFRing_t;
+
+/*
+ * Initialise pxRing to hold up to uxLength items of xItemSize bytes in
+ * pvBuffer, which must be uxLength * xItemSize bytes long.  uxLength must be
+ * a power of 2.
+ */
+void vEDFRingInit( EDFRing_t * pxRing,
+				   void * pvBuffer,
+				   size_t xItemSize,
+				   UBaseType_t uxLength );
+
+/*
+ * Copy the item at pvItem into the ring.  Returns pdFAIL if the ring is full.
+ * Wakes the consumer if it waits in xEDFRingPopWait().
+ */
+BaseType_t xEDFRingPush( EDFRing_t * pxRing,
+						 const void * pvItem );
+
+/*
+ * Same as xEDFRingPush() from an interrupt.  *pxHigherPriorityTaskWoken is set
+ * to pdTRUE if a context switch should be requested before the interrupt
+ * exits.
+ */
+BaseType_t xEDFRingPushFromISR( EDFRing_t * pxRing,
+								const void * pvItem,
+								BaseType_t * pxHigherPriorityTaskWoken );
+
+/*
+ * Copy the oldest item to pvItem and remove it from the ring.  Returns pdFAIL
+ * if the ring is empty.  Can be called from an interrupt.
+ */
+BaseType_t xEDFRingPop( EDFRing_t * pxRing,
+						void * pvItem );
+
+/*
+ * Same as xEDFRingPop() but wait up to xTicksToWait for an item if the ring
+ * is empty.  Task only.
+ */
+BaseType_t xEDFRingPopWait( EDFRing_t * pxRing,
+							void * pvItem,
+							TickType_t xTicksToWait );
+
+/* Number of items in the ring, exact when called by the producer or the
+ * consumer. */
+UBaseType_t uxEDFRingCount( const EDFRing_t * pxRing );
+
+#endif /* EDF_RING_H */
@@ -0,0 +1,231 @@
+/*
+ * Asynchronous serial transmit.  See edf_serial.h.
+ *
+ * The writing task is the producer of the ring of queued buffers and the
+ * transmit interrupt its consumer.  The interrupt takes the buffer at the
+ * head of the ring and writes up to a FIFO load of it each time the FIFO is
+ * empty.  When the FIFO runs dry with nothing left to send no interrupt comes
+ * any more, so the next write fills the FIFO itself, with interrupts masked
+ * so it does not race the interrupt for the ring.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "edf_ring.h"
+#include "edf_serial.h"
+
+#if ( configUSE_EDF_SERIAL_TX == 1 )
+
+#if ( configUSE_EDF_RING != 1 )
+#error "The asynchronous serial transmit needs configUSE_EDF_RING set to 1"
+#endif
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+
+/* No UART, the characters go to stdout a FIFO load per simulated interrupt. */
+#define serialFIFO_DEPTH           16U
+#define serialFIFO_EMPTY()         ( pdTRUE )
+#define serialWRITE( ucByte )      ( void ) putchar( ( int ) ( ucByte ) )
+#define serialINTERRUPT_DONE()     ( void ) fflush( stdout )
+
+#else
+
+#include "lpc21xx.h"
+
+/* UART0 transmit FIFO, empty when U0LSR.THRE is set. */
+#define serialFIFO_DEPTH           16U
+#define serialLSR_THRE             ( ( unsigned long ) 0x20 )
+#define serialIER_THRE             ( ( unsigned long ) 0x02 )
+#define serialFCR_FIFO_ENABLE      ( ( unsigned long ) 0x01 )
+#define serialVIC_UART0            ( ( unsigned long ) 0x40 )
+#define serialVIC_UART0_CHANNEL    ( ( unsigned long ) 6 )
+#define serialVIC_SLOT_ENABLE      ( ( unsigned long ) 0x20 )
+
+#define serialFIFO_EMPTY()         ( ( U0LSR & serialLSR_THRE ) != 0UL )
+#define serialWRITE( ucByte )      U0THR = ( unsigned long ) ( ucByte )
+
+/* Reading U0IIR clears the interrupt, writing VICVectAddr ends it. */
+#define serialINTERRUPT_DONE()     do { ( void ) U0IIR; VICVectAddr = 0UL; } while( 0 )
+
+#endif /* if defined( __unix__ ) || defined( __APPLE__ ) */
+
+typedef struct xEDF_SERIAL_TX_BUFFER
+{
+	const uint8_t * pucData;
+	size_t xLength;
+	TaskHandle_t xTaskToNotify;
+} EDFSerialTxBuffer_t;
+
+static EDFRing_t xTxRing;
+static EDFSerialTxBuffer_t xTxBuffers[ configEDF_SERIAL_TX_BUFFERS ];
+
+/* Owned by the consumer: the buffer being sent and the bytes already sent. */
+static EDFSerialTxBuffer_t xCurrent;
+static size_t xCurrentSent = 0;
+static volatile BaseType_t xCurrentValid = pdFALSE;
+
+/* pdTRUE while the last FIFO load is being sent, an interrupt will follow. */
+static volatile BaseType_t xTxBusy = pdFALSE;
+
+/*
+ * Write up to a FIFO load of the queued buffers, notifying the tasks of the
+ * buffers completed.  Called from the interrupt, or with interrupts masked.
+ */
+static void prvTxFill( BaseType_t * pxHigherPriorityTaskWoken );
+
+/*-----------------------------------------------------------*/
+
+static void prvTxFill( BaseType_t * pxHigherPriorityTaskWoken )
+{
+	UBaseType_t uxRoom = serialFIFO_DEPTH;
+
+	while( uxRoom > 0U )
+	{
+		if( xCurrentValid == pdFALSE )
+		{
+			if( xEDFRingPop( &xTxRing, &xCurrent ) == pdFAIL )
+			{
+				break;
+			}
+
+			xCurrentSent = 0;
+			xCurrentValid = pdTRUE;
+		}
+
+		if( xCurrentSent < xCurrent.xLength )
+		{
+			serialWRITE( xCurrent.pucData[ xCurrentSent ] );
+			xCurrentSent++;
+			uxRoom--;
+		}
+
+		if( xCurrentSent == xCurrent.xLength )
+		{
+			xCurrentValid = pdFALSE;
+
+			if( xCurrent.xTaskToNotify != NULL )
+			{
+				vTaskNotifyGiveIndexedFromISR( xCurrent.xTaskToNotify, configEDF_SERIAL_NOTIFY_INDEX, pxHigherPriorityTaskWoken );
+			}
+		}
+	}
+
+	xTxBusy = ( uxRoom < serialFIFO_DEPTH ) ? pdTRUE : pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+void vEDFSerialTxInit( void )
+{
+	vEDFRingInit( &xTxRing, xTxBuffers, sizeof( EDFSerialTxBuffer_t ), configEDF_SERIAL_TX_BUFFERS );
+
+#if !defined( __unix__ ) && !defined( __APPLE__ )
+	{
+		portENTER_CRITICAL();
+		{
+			U0FCR = serialFCR_FIFO_ENABLE;
+
+			VICIntSelect &= ~serialVIC_UART0;
+			VICVectAddr1 = configEDF_SERIAL_ISR_ADDRESS;
+			VICVectCntl1 = serialVIC_SLOT_ENABLE | serialVIC_UART0_CHANNEL;
+			VICIntEnable = serialVIC_UART0;
+
+			/* The receive interrupt of the serial driver would not be
+			 * cleared by this handler. */
+			U0IER = serialIER_THRE;
+		}
+		portEXIT_CRITICAL();
+	}
+#endif
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xEDFSerialWriteAsync( const uint8_t * pucData,
+								 size_t xLength,
+								 TaskHandle_t xTaskToNotify )
+{
+	EDFSerialTxBuffer_t xBuffer;
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+	BaseType_t xReturn = errQUEUE_FULL;
+
+	xBuffer.pucData = pucData;
+	xBuffer.xLength = xLength;
+	xBuffer.xTaskToNotify = xTaskToNotify;
+
+	if( xEDFRingPush( &xTxRing, &xBuffer ) == pdPASS )
+	{
+		xReturn = pdPASS;
+
+		/* No interrupt is coming, start the transmission. */
+		if( xTxBusy == pdFALSE )
+		{
+			taskENTER_CRITICAL();
+			{
+				if( ( xTxBusy == pdFALSE ) && serialFIFO_EMPTY() )
+				{
+					prvTxFill( &xHigherPriorityTaskWoken );
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			if( xHigherPriorityTaskWoken != pdFALSE )
+			{
+				taskYIELD();
+			}
+		}
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xEDFSerialWaitTxComplete( TickType_t xTicksToWait )
+{
+	/* One notification per buffer sent. */
+	return ( ulTaskNotifyTakeIndexed( configEDF_SERIAL_NOTIFY_INDEX, pdFALSE, xTicksToWait ) != 0UL ) ? pdPASS : pdFAIL;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxEDFSerialTxPending( void )
+{
+	return uxEDFRingCount( &xTxRing ) + ( ( xCurrentValid != pdFALSE ) ? 1U : 0U );
+}
+/*-----------------------------------------------------------*/
+
+void vEDFSerialTxHandler( void )
+{
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	prvTxFill( &xHigherPriorityTaskWoken );
+	serialINTERRUPT_DONE();
+
+	portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+}
+/*-----------------------------------------------------------*/
+
+#if !defined( __unix__ ) && !defined( __APPLE__ ) && defined( __GNUC__ )
+
+/* The handler can switch context, so the wrapper saves and restores it the
+ * same way as the tick interrupt of the port. */
+static void prvTxISRBody( void ) __attribute__( ( noinline ) );
+void vEDFSerialTxISR( void ) __attribute__( ( naked ) );
+
+static void prvTxISRBody( void )
+{
+	vEDFSerialTxHandler();
+}
+
+void vEDFSerialTxISR( void )
+{
+	portSAVE_CONTEXT();
+	prvTxISRBody();
+	portRESTORE_CONTEXT();
+}
+
+#endif
+
+#endif /* configUSE_EDF_SERIAL_TX */
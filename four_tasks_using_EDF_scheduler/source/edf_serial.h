@@ -0,0 +1,79 @@
+/*
+ * Asynchronous serial transmit.
+ *
+ * xEDFSerialWriteAsync() queues a buffer and returns straight away; the UART0
+ * transmit interrupt then feeds it to the transmit FIFO a FIFO load at a time,
+ * so the calling job does not spin for the 87 us each character takes at
+ * 115200 baud and the processor is free for the other EDF jobs meanwhile.
+ * Buffers are not copied: a buffer belongs to the driver until it has been
+ * sent, which the driver signals with a task notification at index
+ * configEDF_SERIAL_NOTIFY_INDEX to the task given with the buffer.
+ *
+ * Buffers are queued in an SPSC ring (edf_ring.h), so only one task may call
+ * xEDFSerialWriteAsync().  On the POSIX port there is no UART: the characters
+ * go to stdout and the interrupt is simulated by calling
+ * vEDFSerialTxHandler(), typically from the tick hook.
+ *
+ * On target the driver owns the UART0 interrupt: vEDFSerialTxInit() installs
+ * it in slot 1 of the vectored interrupt controller and leaves only the
+ * transmit interrupt enabled in U0IER, replacing what xSerialPortInitMinimal()
+ * set up there.  The interrupt driven calls of the serial driver
+ * (vSerialPutString(), xSerialGetChar()) must not be used from then on.
+ */
+
+#ifndef EDF_SERIAL_H
+#define EDF_SERIAL_H
+
+/* Number of buffers that can be queued. A power of 2. */
+#ifndef configEDF_SERIAL_TX_BUFFERS
+#define configEDF_SERIAL_TX_BUFFERS     8
+#endif
+
+/* Address installed in slot 1 of the vectored interrupt controller for UART0
+ * (slot 0 is the tick).  With GCC it is the wrapper of edf_serial.c; with
+ * other compilers, which cannot build that wrapper, an assembly wrapper saving
+ * the context like the tick one of the port must call vEDFSerialTxHandler(),
+ * and its address be given here. */
+#if ( configUSE_EDF_SERIAL_TX == 1 ) && !defined( __unix__ ) && !defined( __APPLE__ ) && !defined( configEDF_SERIAL_ISR_ADDRESS )
+#if defined( __GNUC__ )
+void vEDFSerialTxISR( void );
+#define configEDF_SERIAL_ISR_ADDRESS    ( ( unsigned long ) vEDFSerialTxISR )
+#else
+#error "configEDF_SERIAL_ISR_ADDRESS must be defined in FreeRTOSConfig.h"
+#endif
+#endif
+
+/*
+ * Enable the UART0 transmit interrupt.  Call after the UART has been
+ * configured (xSerialPortInitMinimal()) and before the first write.
+ */
+void vEDFSerialTxInit( void );
+
+/*
+ * Queue the xLength bytes at pucData for transmission and return without
+ * waiting.  The buffer must not be changed until it has been sent.  If
+ * xTaskToNotify is not NULL that task is notified once the last byte is in
+ * the transmit FIFO, see xEDFSerialWaitTxComplete().  Returns errQUEUE_FULL
+ * if configEDF_SERIAL_TX_BUFFERS buffers are already queued.
+ */
+BaseType_t xEDFSerialWriteAsync( const uint8_t * pucData,
+								 size_t xLength,
+								 TaskHandle_t xTaskToNotify );
+
+/*
+ * Wait up to xTicksToWait for one of the buffers queued with the calling task
+ * as xTaskToNotify to have been sent.  Returns pdPASS if one has.
+ */
+BaseType_t xEDFSerialWaitTxComplete( TickType_t xTicksToWait );
+
+/* Number of buffers queued or being sent. */
+UBaseType_t uxEDFSerialTxPending( void );
+
+/*
+ * Body of the transmit interrupt, feeds the FIFO.  Called by the interrupt
+ * wrapper on target, by the application to simulate the interrupt on the
+ * POSIX port.  Must not be called otherwise.
+ */
+void vEDFSerialTxHandler( void );
+
+#endif /* EDF_SERIAL_H */
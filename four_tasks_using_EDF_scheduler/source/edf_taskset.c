@@ -0,0 +1,659 @@
+/*
+ * Synthetic periodic task-set generator.  See edf_taskset.h.
+ *
+ * References for the two utilisation generators:
+ *  - UUniFast: Bini and Buttazzo, "Measuring the performance of schedulability
+ *    tests", Real-Time Systems 30, 2005.
+ *  - RandFixedSum: Stafford, 2006, as used by Emberson, Stafford and Davis,
+ *    "Techniques for the synthesis of multiprocessor tasksets", WATERS 2010.
+ */
+
+/* Standard includes. */
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "edf_taskset.h"
+
+#if ( configUSE_EDF_TASKSET == 1 )
+
+#if ( configUSE_EDF_SCHEDULER != 1 ) || ( configGENERATE_RUN_TIME_STATS != 1 )
+#error "The task-set generator needs configUSE_EDF_SCHEDULER and configGENERATE_RUN_TIME_STATS set to 1"
+#endif
+
+static uint32_t ulRandomState = 0x1234567UL;
+
+/* Work arrays of RandFixedSum, w is n x ( n + 1 ) and t is ( n - 1 ) x n. */
+static double dW[ configEDF_TASKSET_MAX_TASKS ][ configEDF_TASKSET_MAX_TASKS + 1 ];
+static double dT[ configEDF_TASKSET_MAX_TASKS - 1 ][ configEDF_TASKSET_MAX_TASKS ];
+static double dS1[ configEDF_TASKSET_MAX_TASKS ];
+static double dS2[ configEDF_TASKSET_MAX_TASKS ];
+
+static double dUtilisations[ configEDF_TASKSET_MAX_TASKS ];
+
+/* Task indexes in decreasing density order, used by the partitioner. */
+static UBaseType_t uxOrder[ configEDF_TASKSET_MAX_TASKS ];
+
+/*-----------------------------------------------------------*/
+
+/* xorshift32 */
+static uint32_t prvRandom( void )
+{
+	ulRandomState ^= ulRandomState << 13;
+	ulRandomState ^= ulRandomState >> 17;
+	ulRandomState ^= ulRandomState << 5;
+	return ulRandomState;
+}
+
+/* Uniform in ( 0, 1 ]. */
+static double prvRandomUnit( void )
+{
+	return ( ( double ) ( prvRandom() >> 8 ) + 1.0 ) / 16777216.0;
+}
+
+void vEDFTaskSetSeed( uint32_t ulSeed )
+{
+	/* xorshift must never be seeded with 0. */
+	ulRandomState = ( ulSeed != 0UL ) ? ulSeed : 0x1234567UL;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvUUniFast( UBaseType_t uxTasks, double dUtilisation )
+{
+	UBaseType_t uxAttempt, uxIndex;
+	double dSum, dNext;
+	BaseType_t xValid;
+
+	for( uxAttempt = 0; uxAttempt < configEDF_TASKSET_MAX_DISCARDS; uxAttempt++ )
+	{
+		dSum = dUtilisation;
+		xValid = pdTRUE;
+
+		for( uxIndex = 1; uxIndex < uxTasks; uxIndex++ )
+		{
+			dNext = dSum * pow( prvRandomUnit(), 1.0 / ( double ) ( uxTasks - uxIndex ) );
+			dUtilisations[ uxIndex - 1 ] = dSum - dNext;
+			dSum = dNext;
+		}
+
+		dUtilisations[ uxTasks - 1 ] = dSum;
+
+		for( uxIndex = 0; uxIndex < uxTasks; uxIndex++ )
+		{
+			if( dUtilisations[ uxIndex ] > 1.0 )
+			{
+				xValid = pdFALSE;
+				break;
+			}
+		}
+
+		if( xValid == pdTRUE )
+		{
+			return pdPASS;
+		}
+	}
+
+	return pdFAIL;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRandFixedSum( UBaseType_t uxTasks, double dUtilisation )
+{
+	const int n = ( int ) uxTasks;
+	const int k = ( int ) floor( dUtilisation );
+	double s = dUtilisation, sm = 0.0, pr = 1.0, sx, dTmp1, dTmp2, dTmp3, dSwap;
+	int i, c, j, e;
+
+	if( n == 1 )
+	{
+		dUtilisations[ 0 ] = dUtilisation;
+		return;
+	}
+
+	/* Distances of s to the integer planes the simplices are cut by. */
+	for( c = 0; c < n; c++ )
+	{
+		dS1[ c ] = s - ( double ) ( k - c );
+		dS2[ c ] = ( double ) ( k + n - c ) - s;
+	}
+
+	/* Volumes of the simplices (dW) and transition probabilities between
+	 * them (dT), built up one dimension at a time. */
+	for( i = 0; i < n; i++ )
+	{
+		for( c = 0; c <= n; c++ )
+		{
+			dW[ i ][ c ] = 0.0;
+		}
+	}
+
+	dW[ 0 ][ 1 ] = DBL_MAX;
+
+	for( i = 2; i <= n; i++ )
+	{
+		for( c = 1; c <= i; c++ )
+		{
+			dTmp1 = dW[ i - 2 ][ c ] * dS1[ c - 1 ] / ( double ) i;
+			dTmp2 = dW[ i - 2 ][ c - 1 ] * dS2[ n - i + c - 1 ] / ( double ) i;
+			dW[ i - 1 ][ c ] = dTmp1 + dTmp2;
+			dTmp3 = dW[ i - 1 ][ c ] + DBL_MIN;
+
+			if( dS2[ n - i + c - 1 ] > dS1[ c - 1 ] )
+			{
+				dT[ i - 2 ][ c - 1 ] = dTmp2 / dTmp3;
+			}
+			else
+			{
+				dT[ i - 2 ][ c - 1 ] = 1.0 - dTmp1 / dTmp3;
+			}
+		}
+	}
+
+	/* Walk down the dimensions, choosing a simplex and a position in it. */
+	j = k + 1;
+
+	for( i = n - 1; i >= 1; i-- )
+	{
+		e = ( prvRandomUnit() <= dT[ i - 1 ][ j - 1 ] ) ? 1 : 0;
+		sx = pow( prvRandomUnit(), 1.0 / ( double ) i );
+		sm += ( 1.0 - sx ) * pr * s / ( double ) ( i + 1 );
+		pr *= sx;
+		dUtilisations[ n - i - 1 ] = sm + pr * ( double ) e;
+		s -= ( double ) e;
+		j -= e;
+	}
+
+	dUtilisations[ n - 1 ] = sm + pr * s;
+
+	/* The coordinates come out in a fixed order, shuffle them. */
+	for( i = n - 1; i > 0; i-- )
+	{
+		j = ( int ) ( prvRandom() % ( uint32_t ) ( i + 1 ) );
+		dSwap = dUtilisations[ i ];
+		dUtilisations[ i ] = dUtilisations[ j ];
+		dUtilisations[ j ] = dSwap;
+	}
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xEDFTaskSetGenerate( EDFTaskSet_t * pxTaskSet,
+								UBaseType_t uxTasks,
+								double dUtilisation,
+								eEDFTaskSetMethod_t eMethod,
+								TickType_t xMinPeriod,
+								TickType_t xMaxPeriod,
+								double dMinDeadlineRatio )
+{
+	UBaseType_t uxIndex;
+	EDFTaskSetTask_t * pxTask;
+	double dLogMin, dLogMax, dCompute, dDeadline;
+
+	configASSERT( pxTaskSet );
+
+	if( ( uxTasks == 0 ) || ( uxTasks > configEDF_TASKSET_MAX_TASKS ) ||
+		( dUtilisation <= 0.0 ) || ( dUtilisation >= ( double ) uxTasks ) ||
+		( xMinPeriod == 0 ) || ( xMinPeriod > xMaxPeriod ) ||
+		( dMinDeadlineRatio < 0.0 ) || ( dMinDeadlineRatio > 1.0 ) )
+	{
+		return pdFAIL;
+	}
+
+	if( eMethod == eEDFTaskSetUUniFast )
+	{
+		if( prvUUniFast( uxTasks, dUtilisation ) != pdPASS )
+		{
+			return pdFAIL;
+		}
+	}
+	else
+	{
+		prvRandFixedSum( uxTasks, dUtilisation );
+	}
+
+	/* Periods log-uniform in [ xMinPeriod, xMaxPeriod ]. */
+	dLogMin = log( ( double ) xMinPeriod );
+	dLogMax = log( ( double ) xMaxPeriod + 1.0 );
+
+	for( uxIndex = 0; uxIndex < uxTasks; uxIndex++ )
+	{
+		pxTask = &( pxTaskSet->xTasks[ uxIndex ] );
+
+		pxTask->dUtilisation = dUtilisations[ uxIndex ];
+		pxTask->xPeriod = ( TickType_t ) floor( exp( dLogMin + prvRandomUnit() * ( dLogMax - dLogMin ) ) );
+
+		if( pxTask->xPeriod > xMaxPeriod )
+		{
+			pxTask->xPeriod = xMaxPeriod;
+		}
+
+		/* A job runs for a whole number of ticks, at least one. */
+		dCompute = floor( pxTask->dUtilisation * ( double ) pxTask->xPeriod + 0.5 );
+
+		if( dCompute < 1.0 )
+		{
+			dCompute = 1.0;
+		}
+		else if( dCompute > ( double ) pxTask->xPeriod )
+		{
+			dCompute = ( double ) pxTask->xPeriod;
+		}
+
+		pxTask->xWCET = ( TickType_t ) dCompute;
+
+		/* D_i uniform in [ C_i + r * ( T_i - C_i ), T_i ]. */
+		dDeadline = dCompute + ( dMinDeadlineRatio + ( 1.0 - dMinDeadlineRatio ) * prvRandomUnit() ) *
+					( ( double ) pxTask->xPeriod - dCompute );
+		pxTask->xDeadline = ( TickType_t ) floor( dDeadline + 0.5 );
+
+		if( pxTask->xDeadline > pxTask->xPeriod )
+		{
+			pxTask->xDeadline = pxTask->xPeriod;
+		}
+
+		pxTask->xCore = 0;
+		pxTask->xSplitCore = -1;
+		pxTask->xSplitBudget = 0;
+		pxTask->xSplitDeadline = 0;
+		pxTask->xHandle = NULL;
+	}
+
+	pxTaskSet->uxTasks = uxTasks;
+
+	return pdPASS;
+}
+/*-----------------------------------------------------------*/
+
+double dEDFTaskSetDensity( const EDFTaskSet_t * pxTaskSet )
+{
+	UBaseType_t uxIndex;
+	double dDensity = 0.0;
+
+	for( uxIndex = 0; uxIndex < pxTaskSet->uxTasks; uxIndex++ )
+	{
+		dDensity += ( double ) pxTaskSet->xTasks[ uxIndex ].xWCET / ( double ) pxTaskSet->xTasks[ uxIndex ].xDeadline;
+	}
+
+	return dDensity;
+}
+/*-----------------------------------------------------------*/
+
+static double prvTaskDensity( const EDFTaskSetTask_t * pxTask )
+{
+	return ( double ) pxTask->xWCET / ( double ) pxTask->xDeadline;
+}
+
+/* Density a core accepts, with a small tolerance so a set that exactly fills a
+ * core is accepted despite the rounding of the sum. */
+#define tasksetMAX_CORE_DENSITY    ( 1.0 + DBL_EPSILON * ( double ) configEDF_TASKSET_MAX_TASKS )
+
+/* A job, or a part of a job, as seen by the processor demand test. */
+typedef struct xEDF_TASKSET_DEMAND
+{
+	TickType_t xWCET;
+	TickType_t xDeadline;
+	TickType_t xPeriod;
+} EDFTaskSetDemand_t;
+
+/* Parts on the core under test, at most two per task plus the new one. */
+static EDFTaskSetDemand_t xDemands[ ( 2 * configEDF_TASKSET_MAX_TASKS ) + 1 ];
+
+/*
+ * Processor demand test: the parts bound to xCore by the first uxAssigned
+ * tasks of uxOrder, plus pxExtra, are schedulable by EDF on one core if the
+ * demand bound function dbf( t ) does not exceed t at any absolute deadline t
+ * up to the usual bound L.  Exact for synchronous constrained deadline tasks,
+ * and pessimistic (fails) when L is above configEDF_TASKSET_DEMAND_LIMIT.
+ */
+static BaseType_t prvCoreFeasible( const EDFTaskSet_t * pxTaskSet,
+								   UBaseType_t uxAssigned,
+								   BaseType_t xCore,
+								   const EDFTaskSetDemand_t * pxExtra )
+{
+	UBaseType_t uxIndex, uxParts = 0, uxPart;
+	const EDFTaskSetTask_t * pxTask;
+	double dUtilisation = 0.0, dSlackSum = 0.0, dLimit;
+	TickType_t xMaxDeadline = 0, xTime, xDemand;
+
+	for( uxIndex = 0; uxIndex < uxAssigned; uxIndex++ )
+	{
+		pxTask = &( pxTaskSet->xTasks[ uxOrder[ uxIndex ] ] );
+
+		if( pxTask->xCore == xCore )
+		{
+			xDemands[ uxParts ].xPeriod = pxTask->xPeriod;
+
+			if( pxTask->xSplitCore < 0 )
+			{
+				xDemands[ uxParts ].xWCET = pxTask->xWCET;
+				xDemands[ uxParts ].xDeadline = pxTask->xDeadline;
+			}
+			else
+			{
+				xDemands[ uxParts ].xWCET = pxTask->xSplitBudget;
+				xDemands[ uxParts ].xDeadline = pxTask->xSplitDeadline;
+			}
+
+			uxParts++;
+		}
+
+		if( pxTask->xSplitCore == xCore )
+		{
+			xDemands[ uxParts ].xWCET = pxTask->xWCET - pxTask->xSplitBudget;
+			xDemands[ uxParts ].xDeadline = pxTask->xDeadline - pxTask->xSplitDeadline;
+			xDemands[ uxParts ].xPeriod = pxTask->xPeriod;
+			uxParts++;
+		}
+	}
+
+	xDemands[ uxParts++ ] = *pxExtra;
+
+	for( uxPart = 0; uxPart < uxParts; uxPart++ )
+	{
+		double dPartUtilisation = ( double ) xDemands[ uxPart ].xWCET / ( double ) xDemands[ uxPart ].xPeriod;
+
+		dUtilisation += dPartUtilisation;
+		dSlackSum += ( double ) ( xDemands[ uxPart ].xPeriod - xDemands[ uxPart ].xDeadline ) * dPartUtilisation;
+
+		if( xDemands[ uxPart ].xDeadline > xMaxDeadline )
+		{
+			xMaxDeadline = xDemands[ uxPart ].xDeadline;
+		}
+	}
+
+	if( dUtilisation > tasksetMAX_CORE_DENSITY )
+	{
+		return pdFAIL;
+	}
+
+	/* No deadline can be missed after L = max( D_max, sum ( T_i - D_i ) u_i / ( 1 - U ) ). */
+	if( dUtilisation < 1.0 )
+	{
+		dLimit = dSlackSum / ( 1.0 - dUtilisation );
+	}
+	else
+	{
+		dLimit = ( double ) configEDF_TASKSET_DEMAND_LIMIT + 1.0;
+	}
+
+	if( dLimit < ( double ) xMaxDeadline )
+	{
+		dLimit = ( double ) xMaxDeadline;
+	}
+
+	if( dLimit > ( double ) configEDF_TASKSET_DEMAND_LIMIT )
+	{
+		return pdFAIL;
+	}
+
+	for( uxPart = 0; uxPart < uxParts; uxPart++ )
+	{
+		for( xTime = xDemands[ uxPart ].xDeadline; ( double ) xTime <= dLimit; xTime += xDemands[ uxPart ].xPeriod )
+		{
+			xDemand = 0;
+
+			for( uxIndex = 0; uxIndex < uxParts; uxIndex++ )
+			{
+				if( xDemands[ uxIndex ].xDeadline <= xTime )
+				{
+					xDemand += ( ( ( xTime - xDemands[ uxIndex ].xDeadline ) / xDemands[ uxIndex ].xPeriod ) + 1 ) * xDemands[ uxIndex ].xWCET;
+				}
+			}
+
+			if( xDemand > xTime )
+			{
+				return pdFAIL;
+			}
+		}
+	}
+
+	return pdPASS;
+}
+
+/*
+ * Find a core for the task at position uxIndex of uxOrder with the processor
+ * demand test, first-fit, splitting it C=D style if it fits on no core whole:
+ * the first part runs for C1 ticks with C1 as local deadline, so it runs as
+ * soon as released, on the first core with room for the largest such C1.  The
+ * rest, C - C1 ticks within D - C1, goes to the first other core with room.
+ */
+static BaseType_t prvPlaceOrSplit( EDFTaskSet_t * pxTaskSet,
+								   UBaseType_t uxIndex,
+								   UBaseType_t uxCores )
+{
+	EDFTaskSetTask_t * pxTask = &( pxTaskSet->xTasks[ uxOrder[ uxIndex ] ] );
+	EDFTaskSetDemand_t xPart;
+	UBaseType_t uxCore, uxSecond;
+	TickType_t xLow, xHigh, xMiddle;
+
+	xPart.xWCET = pxTask->xWCET;
+	xPart.xDeadline = pxTask->xDeadline;
+	xPart.xPeriod = pxTask->xPeriod;
+
+	for( uxCore = 0; uxCore < uxCores; uxCore++ )
+	{
+		if( prvCoreFeasible( pxTaskSet, uxIndex, ( BaseType_t ) uxCore, &xPart ) == pdPASS )
+		{
+			pxTask->xCore = ( BaseType_t ) uxCore;
+			return pdPASS;
+		}
+	}
+
+	if( pxTask->xWCET < ( TickType_t ) 2 )
+	{
+		return pdFAIL;
+	}
+
+	for( uxCore = 0; uxCore < uxCores; uxCore++ )
+	{
+		/* Largest C1 in [ 1, C - 1 ] the core takes, by bisection. */
+		xLow = 0;
+		xHigh = pxTask->xWCET;
+
+		while( ( xHigh - xLow ) > ( TickType_t ) 1 )
+		{
+			xMiddle = xLow + ( ( xHigh - xLow ) / ( TickType_t ) 2 );
+			xPart.xWCET = xMiddle;
+			xPart.xDeadline = xMiddle;
+
+			if( prvCoreFeasible( pxTaskSet, uxIndex, ( BaseType_t ) uxCore, &xPart ) == pdPASS )
+			{
+				xLow = xMiddle;
+			}
+			else
+			{
+				xHigh = xMiddle;
+			}
+		}
+
+		if( xLow == 0 )
+		{
+			continue;
+		}
+
+		pxTask->xCore = ( BaseType_t ) uxCore;
+		pxTask->xSplitBudget = xLow;
+		pxTask->xSplitDeadline = xLow;
+		xPart.xWCET = pxTask->xWCET - xLow;
+		xPart.xDeadline = pxTask->xDeadline - xLow;
+
+		for( uxSecond = 0; uxSecond < uxCores; uxSecond++ )
+		{
+			if( ( uxSecond != uxCore ) &&
+				( prvCoreFeasible( pxTaskSet, uxIndex, ( BaseType_t ) uxSecond, &xPart ) == pdPASS ) )
+			{
+				pxTask->xSplitCore = ( BaseType_t ) uxSecond;
+				return pdPASS;
+			}
+		}
+	}
+
+	return pdFAIL;
+}
+
+BaseType_t xEDFTaskSetPartition( EDFTaskSet_t * pxTaskSet,
+								 UBaseType_t uxCores,
+								 eEDFTaskSetPartition_t ePolicy )
+{
+	double dCoreDensity[ configEDF_TASKSET_MAX_CORES ];
+	UBaseType_t uxIndex, uxSorted, uxCore;
+	BaseType_t xChosen;
+	double dDensity;
+
+	configASSERT( pxTaskSet );
+
+	if( ( uxCores == 0 ) || ( uxCores > configEDF_TASKSET_MAX_CORES ) )
+	{
+		return pdFAIL;
+	}
+
+	/* Insertion sort by decreasing density, the sets are small. */
+	for( uxIndex = 0; uxIndex < pxTaskSet->uxTasks; uxIndex++ )
+	{
+		dDensity = prvTaskDensity( &( pxTaskSet->xTasks[ uxIndex ] ) );
+
+		for( uxSorted = uxIndex; uxSorted > 0; uxSorted-- )
+		{
+			if( prvTaskDensity( &( pxTaskSet->xTasks[ uxOrder[ uxSorted - 1 ] ] ) ) >= dDensity )
+			{
+				break;
+			}
+
+			uxOrder[ uxSorted ] = uxOrder[ uxSorted - 1 ];
+		}
+
+		uxOrder[ uxSorted ] = uxIndex;
+	}
+
+	for( uxCore = 0; uxCore < uxCores; uxCore++ )
+	{
+		dCoreDensity[ uxCore ] = 0.0;
+	}
+
+	for( uxIndex = 0; uxIndex < pxTaskSet->uxTasks; uxIndex++ )
+	{
+		EDFTaskSetTask_t * pxTask = &( pxTaskSet->xTasks[ uxOrder[ uxIndex ] ] );
+
+		dDensity = prvTaskDensity( pxTask );
+		xChosen = -1;
+		pxTask->xSplitCore = -1;
+
+		if( ePolicy == eEDFPartitionSplitFirstFitDecreasing )
+		{
+			if( prvPlaceOrSplit( pxTaskSet, uxIndex, uxCores ) != pdPASS )
+			{
+				return pdFAIL;
+			}
+
+			continue;
+		}
+
+		for( uxCore = 0; uxCore < uxCores; uxCore++ )
+		{
+			if( dCoreDensity[ uxCore ] + dDensity > tasksetMAX_CORE_DENSITY )
+			{
+				continue;
+			}
+
+			if( ePolicy == eEDFPartitionFirstFitDecreasing )
+			{
+				xChosen = ( BaseType_t ) uxCore;
+				break;
+			}
+
+			if( ( xChosen < 0 ) || ( dCoreDensity[ uxCore ] < dCoreDensity[ xChosen ] ) )
+			{
+				xChosen = ( BaseType_t ) uxCore;
+			}
+		}
+
+		if( xChosen < 0 )
+		{
+			return pdFAIL;
+		}
+
+		pxTask->xCore = xChosen;
+		dCoreDensity[ xChosen ] += dDensity;
+	}
+
+	return pdPASS;
+}
+/*-----------------------------------------------------------*/
+
+static void prvTaskSetJob( void * pvParameters )
+{
+	const EDFTaskSetTask_t * pxTask = ( const EDFTaskSetTask_t * ) pvParameters;
+	TickType_t xLastWakeTime = xTaskGetTickCount();
+
+	for( ;; )
+	{
+		vTaskBusyWaitExecutionTime( pxTask->xWCET );
+		vTaskDelayUntil( &xLastWakeTime, pxTask->xPeriod );
+	}
+}
+
+BaseType_t xEDFTaskSetLaunch( EDFTaskSet_t * pxTaskSet )
+{
+	EDFTaskSetTask_t * pxTask;
+	UBaseType_t uxIndex;
+	BaseType_t xReturn = pdPASS;
+	char cName[ configMAX_TASK_NAME_LEN ];
+
+	configASSERT( pxTaskSet );
+
+	for( uxIndex = 0; uxIndex < pxTaskSet->uxTasks; uxIndex++ )
+	{
+		pxTask = &( pxTaskSet->xTasks[ uxIndex ] );
+		snprintf( cName, sizeof( cName ), "TS%u", ( unsigned ) uxIndex );
+
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_EDF_SEMI_PARTITIONED == 1 ) )
+		configASSERT( pxTask->xCore < ( BaseType_t ) configNUMBER_OF_CORES );
+		configASSERT( pxTask->xSplitCore < ( BaseType_t ) configNUMBER_OF_CORES );
+
+		if( xTaskPeriodicCreateSplit( prvTaskSetJob,
+									  cName,
+									  configEDF_TASKSET_STACK_SIZE,
+									  ( void * ) pxTask,
+									  1,
+									  &( pxTask->xHandle ),
+									  pxTask->xPeriod,
+									  pxTask->xDeadline,
+									  pxTask->xCore,
+									  pxTask->xSplitBudget,
+									  pxTask->xSplitDeadline,
+									  pxTask->xSplitCore ) != pdPASS )
+#elif ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_EDF_PARTITIONED == 1 ) )
+		configASSERT( pxTask->xCore < ( BaseType_t ) configNUMBER_OF_CORES );
+		configASSERT( pxTask->xSplitCore < 0 );
+
+		if( xTaskPeriodicCreateOnCore( prvTaskSetJob,
+									   cName,
+									   configEDF_TASKSET_STACK_SIZE,
+									   ( void * ) pxTask,
+									   1,
+									   &( pxTask->xHandle ),
+									   pxTask->xPeriod,
+									   pxTask->xDeadline,
+									   pxTask->xCore ) != pdPASS )
+#else
+		if( xTaskPeriodicCreateWithDeadline( prvTaskSetJob,
+											 cName,
+											 configEDF_TASKSET_STACK_SIZE,
+											 ( void * ) pxTask,
+											 1,
+											 &( pxTask->xHandle ),
+											 pxTask->xPeriod,
+											 pxTask->xDeadline ) != pdPASS )
+#endif
+		{
+			xReturn = pdFAIL;
+		}
+	}
+
+	return xReturn;
+}
+
+#endif /* configUSE_EDF_TASKSET */
@@ -0,0 +1,137 @@
+/*
+ * Synthetic periodic task-set generator for stressing the EDF scheduler.
+ *
+ * A task set is generated from a target total utilisation U and a task count
+ * n in three steps:
+ *  - the per-task utilisations u_i (sum u_i = U) are drawn with UUniFast
+ *    (discarding sets with a u_i > 1) or with Stafford's RandFixedSum, which
+ *    samples uniformly even for U > 1,
+ *  - the periods T_i are drawn log-uniform in [xMinPeriod, xMaxPeriod],
+ *  - the WCETs are C_i = u_i * T_i (at least one tick) and the constrained
+ *    deadlines D_i are drawn uniform in [C_i + r * ( T_i - C_i ), T_i] where r
+ *    is the requested lower bound of the D/T ratio (r = 1 gives implicit
+ *    deadlines).
+ *
+ * For partitioned EDF the set can be assigned to cores offline with first-fit
+ * or worst-fit decreasing bin-packing, using the per-core density test below.
+ * For semi-partitioned EDF the exact processor demand test is used instead and
+ * a task that fits on no core is split over two cores, C=D style: the first
+ * part gets a budget C1 equal to its local deadline, as large as its core
+ * takes, and the rest of the job must fit in D - C1 on the second core.
+ *
+ * The set is then instantiated with xTaskPeriodicCreateWithDeadline(), or
+ * xTaskPeriodicCreateOnCore() in partitioned builds.  Every job busy waits
+ * with vTaskBusyWaitExecutionTime(), so the load is C_i ticks of processor
+ * time whatever the clock or the compiler settings.
+ *
+ * The module uses floating point and is meant for test builds only.
+ */
+
+#ifndef EDF_TASKSET_H
+#define EDF_TASKSET_H
+
+/* Largest task set that can be generated. */
+#ifndef configEDF_TASKSET_MAX_TASKS
+#define configEDF_TASKSET_MAX_TASKS          32
+#endif
+
+/* Stack size in words of each generated task. */
+#ifndef configEDF_TASKSET_STACK_SIZE
+#define configEDF_TASKSET_STACK_SIZE         configMINIMAL_STACK_SIZE
+#endif
+
+/* Attempts made by UUniFast before giving up when a u_i > 1 keeps coming up. */
+#ifndef configEDF_TASKSET_MAX_DISCARDS
+#define configEDF_TASKSET_MAX_DISCARDS       1000
+#endif
+
+/* Largest time in ticks the processor demand test checks up to, a core whose
+ * bound is larger is reported as not schedulable. */
+#ifndef configEDF_TASKSET_DEMAND_LIMIT
+#define configEDF_TASKSET_DEMAND_LIMIT       100000UL
+#endif
+
+/* Largest number of cores a set can be partitioned over. */
+#ifndef configEDF_TASKSET_MAX_CORES
+#define configEDF_TASKSET_MAX_CORES          8
+#endif
+
+typedef enum
+{
+	eEDFTaskSetUUniFast = 0,  /* UUniFast-Discard. */
+	eEDFTaskSetRandFixedSum   /* Stafford's RandFixedSum. */
+} eEDFTaskSetMethod_t;
+
+typedef enum
+{
+	eEDFPartitionFirstFitDecreasing = 0,  /* Lowest numbered core the task fits on. */
+	eEDFPartitionWorstFitDecreasing,      /* Least loaded core, balances the load. */
+	eEDFPartitionSplitFirstFitDecreasing  /* First-fit on the demand test, splitting the tasks that do not fit. */
+} eEDFTaskSetPartition_t;
+
+typedef struct xEDF_TASKSET_TASK
+{
+	TickType_t xPeriod;       /* T_i in ticks. */
+	TickType_t xDeadline;     /* D_i in ticks, C_i <= D_i <= T_i. */
+	TickType_t xWCET;         /* C_i in ticks. */
+	double dUtilisation;      /* u_i as drawn, before rounding C_i to ticks. */
+	BaseType_t xCore;         /* Core the task is bound to, set by xEDFTaskSetPartition(). */
+	BaseType_t xSplitCore;    /* Second core of a split task, -1 if not split. */
+	TickType_t xSplitBudget;  /* Ticks a job of a split task runs on xCore. */
+	TickType_t xSplitDeadline;/* Local deadline of a split task on xCore. */
+	TaskHandle_t xHandle;     /* Set by xEDFTaskSetCreate(). */
+} EDFTaskSetTask_t;
+
+typedef struct xEDF_TASKSET
+{
+	UBaseType_t uxTasks;
+	EDFTaskSetTask_t xTasks[ configEDF_TASKSET_MAX_TASKS ];
+} EDFTaskSet_t;
+
+/*
+ * Seed the generator, the same seed always gives the same task set.
+ */
+void vEDFTaskSetSeed( uint32_t ulSeed );
+
+/*
+ * Fill pxTaskSet with uxTasks tasks of total utilisation dUtilisation.
+ * dMinDeadlineRatio in [0, 1] is the lower bound of D_i relative to T_i (see
+ * above).  Returns pdFAIL if the parameters are out of range or no valid set
+ * was found.
+ */
+BaseType_t xEDFTaskSetGenerate( EDFTaskSet_t * pxTaskSet,
+								UBaseType_t uxTasks,
+								double dUtilisation,
+								eEDFTaskSetMethod_t eMethod,
+								TickType_t xMinPeriod,
+								TickType_t xMaxPeriod,
+								double dMinDeadlineRatio );
+
+/*
+ * Density of the set, sum C_i / D_i after the WCETs were rounded to ticks.  A
+ * density not above 1 is sufficient for the set to be schedulable by EDF on one
+ * core.
+ */
+double dEDFTaskSetDensity( const EDFTaskSet_t * pxTaskSet );
+
+/*
+ * Assign every task of pxTaskSet to one of uxCores cores.  Tasks are placed in
+ * decreasing order of density C_i / D_i on a core whose density stays at most
+ * 1 with the task added, which is exact for implicit deadlines and sufficient
+ * for constrained ones.  Returns pdFAIL, with the assignment left incomplete,
+ * if a task fits on no core (and cannot be split with
+ * eEDFPartitionSplitFirstFitDecreasing).  Split tasks need a build with
+ * configUSE_EDF_SEMI_PARTITIONED set to 1 to be launched.
+ */
+BaseType_t xEDFTaskSetPartition( EDFTaskSet_t * pxTaskSet,
+								 UBaseType_t uxCores,
+								 eEDFTaskSetPartition_t ePolicy );
+
+/*
+ * Create every task of pxTaskSet.  Call before vTaskStartScheduler() and keep
+ * pxTaskSet in scope for as long as the tasks run.  Returns pdFAIL if a task
+ * could not be created.
+ */
+BaseType_t xEDFTaskSetLaunch( EDFTaskSet_t * pxTaskSet );
+
+#endif /* EDF_TASKSET_H */
@@ -0,0 +1,160 @@
+/*
+ * One-shot event timer.  See edf_tickless.h.
+ *
+ * ulBase is the value of timer 1 at the tick the kernel's tick count stands
+ * at, and only moves by whole ticks, so the fraction of a tick that passed
+ * before a call is counted by the next one.  An event more than half the
+ * range of the counter away is raised early, the kernel then only programs
+ * the next one.
+ */
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "edf_tickless.h"
+
+#if ( configUSE_EDF_TICKLESS_KERNEL == 1 )
+
+#if ( configUSE_EDF_BENCHMARK == 1 )
+#error "configUSE_EDF_TICKLESS_KERNEL and configUSE_EDF_BENCHMARK both set the prescaler of timer 1"
+#endif
+
+#if !defined( __unix__ ) && !defined( __APPLE__ )
+
+#include "lpc21xx.h"
+
+#define ticklessUS_PER_TICK          ( ( uint32_t ) ( 1000000UL / ( uint32_t ) configTICK_RATE_HZ ) )
+#define ticklessMAX_TICKS            ( ( uint32_t ) ( 0x7FFFFFFFUL / ticklessUS_PER_TICK ) )
+
+/* Timer 1 match register 1, interrupt on channel 5.  Timer 0 on channel 4. */
+#define ticklessMCR_MR1_INTERRUPT    ( ( unsigned long ) 0x08 )
+#define ticklessIR_MR1               ( ( unsigned long ) 0x02 )
+#define ticklessIR_T0_MR0            ( ( unsigned long ) 0x01 )
+#define ticklessVIC_TIMER0           ( ( unsigned long ) 0x10 )
+#define ticklessVIC_TIMER1           ( ( unsigned long ) 0x20 )
+#define ticklessVIC_TIMER1_CHANNEL   ( ( unsigned long ) 5 )
+#define ticklessVIC_SLOT_ENABLE      ( ( unsigned long ) 0x20 )
+
+/* The peripheral clock is the processor clock (VPBDIV is 1). */
+#define ticklessPRESCALER            ( ( unsigned long ) ( configCPU_CLOCK_HZ / 1000000UL ) - 1UL )
+
+static uint32_t ulBase = 0UL;
+
+#endif
+
+/*-----------------------------------------------------------*/
+
+void vEDFTicklessInit( void )
+{
+#if !defined( __unix__ ) && !defined( __APPLE__ )
+	{
+		portENTER_CRITICAL();
+		{
+			T1PR = ticklessPRESCALER;
+			T1IR = ticklessIR_MR1;
+
+			VICIntSelect &= ~ticklessVIC_TIMER1;
+			VICVectAddr2 = configEDF_TICKLESS_ISR_ADDRESS;
+			VICVectCntl2 = ticklessVIC_SLOT_ENABLE | ticklessVIC_TIMER1_CHANNEL;
+			VICIntEnable = ticklessVIC_TIMER1;
+		}
+		portEXIT_CRITICAL();
+	}
+#endif
+}
+/*-----------------------------------------------------------*/
+
+void vEDFTicklessStart( void )
+{
+#if !defined( __unix__ ) && !defined( __APPLE__ )
+	/* Called from the tick interrupt, which clears its own flag. */
+	VICIntEnClear = ticklessVIC_TIMER0;
+	T0TCR = 0UL;
+
+	ulBase = ( uint32_t ) T1TC;
+	T1MCR |= ticklessMCR_MR1_INTERRUPT;
+#endif
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulEDFTicklessElapsed( void )
+{
+#if defined( __unix__ ) || defined( __APPLE__ )
+	/* The tick of the port counts the time. */
+	return 0UL;
+#else
+	const uint32_t ulTicks = ( ( uint32_t ) T1TC - ulBase ) / ticklessUS_PER_TICK;
+
+	ulBase += ulTicks * ticklessUS_PER_TICK;
+
+	return ulTicks;
+#endif
+}
+/*-----------------------------------------------------------*/
+
+void vEDFTicklessSetEvent( uint32_t ulTicks )
+{
+#if defined( __unix__ ) || defined( __APPLE__ )
+	( void ) ulTicks;
+#else
+	uint32_t ulMatch;
+
+	if( ulTicks > ticklessMAX_TICKS )
+	{
+		ulTicks = ticklessMAX_TICKS;
+	}
+
+	ulMatch = ulBase + ( ulTicks * ticklessUS_PER_TICK );
+	T1MR1 = ( unsigned long ) ulMatch;
+
+	/* The counter may have passed the match value before it was written. */
+	if( ( uint32_t ) ( ( uint32_t ) T1TC - ulMatch ) < 0x80000000UL )
+	{
+		VICSoftInt = ticklessVIC_TIMER1;
+	}
+#endif
+}
+/*-----------------------------------------------------------*/
+
+void vEDFTicklessEventHandler( void )
+{
+	BaseType_t xHigherPriorityTaskWoken;
+
+#if !defined( __unix__ ) && !defined( __APPLE__ )
+	T1IR = ticklessIR_MR1;
+	VICSoftIntClear = ticklessVIC_TIMER1;
+#endif
+
+	xHigherPriorityTaskWoken = xTaskProcessTimerEvent();
+
+#if !defined( __unix__ ) && !defined( __APPLE__ )
+	VICVectAddr = 0UL;
+#endif
+
+	portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+}
+/*-----------------------------------------------------------*/
+
+#if !defined( __unix__ ) && !defined( __APPLE__ ) && defined( __GNUC__ )
+
+/* The handler can switch context, so the wrapper saves and restores it the
+ * same way as the tick interrupt of the port. */
+static void prvEventISRBody( void ) __attribute__( ( noinline ) );
+void vEDFTicklessEventISR( void ) __attribute__( ( naked ) );
+
+static void prvEventISRBody( void )
+{
+	vEDFTicklessEventHandler();
+}
+
+void vEDFTicklessEventISR( void )
+{
+	portSAVE_CONTEXT();
+	prvEventISRBody();
+	portRESTORE_CONTEXT();
+}
+
+#endif
+
+#endif /* configUSE_EDF_TICKLESS_KERNEL */
@@ -0,0 +1,61 @@
+/*
+ * One-shot event timer of the tickless EDF kernel.
+ *
+ * With configUSE_EDF_TICKLESS_KERNEL set to 1 the kernel runs without a
+ * periodic tick: it asks for a timer event at the next tick at which it has
+ * something to do through configEDF_TICKLESS_SET_EVENT(), and learns how many
+ * ticks have passed from configEDF_TICKLESS_ELAPSED() (see tasks.c).  This
+ * module provides both, and configEDF_TICKLESS_START(), which the kernel calls
+ * from the first tick of the port to stop the periodic tick.
+ *
+ * On target time is kept by timer 1, already the run time counter, with its
+ * prescaler set so it counts microseconds (edf_power.c keeps that when it
+ * changes the clock), and the event is its match register 1, raised through
+ * slot 2 of the vectored interrupt controller.  Timer 0, the tick of the port,
+ * is stopped.  An event set in the past is raised at once by a software
+ * interrupt.  On the POSIX port the tick of the port goes on and the kernel
+ * is told no time passed between ticks, so it behaves as a ticking one.
+ */
+
+#ifndef EDF_TICKLESS_H
+#define EDF_TICKLESS_H
+
+/* Address installed in slot 2 of the vectored interrupt controller for timer
+ * 1 (slot 0 is the tick, 1 UART0).  With GCC it is the wrapper of
+ * edf_tickless.c; with other compilers an assembly wrapper saving the context
+ * like the tick one of the port must call vEDFTicklessEventHandler(). */
+#if ( configUSE_EDF_TICKLESS_KERNEL == 1 ) && !defined( __unix__ ) && !defined( __APPLE__ ) && !defined( configEDF_TICKLESS_ISR_ADDRESS )
+#if defined( __GNUC__ )
+void vEDFTicklessEventISR( void );
+#define configEDF_TICKLESS_ISR_ADDRESS    ( ( unsigned long ) vEDFTicklessEventISR )
+#else
+#error "configEDF_TICKLESS_ISR_ADDRESS must be defined in FreeRTOSConfig.h"
+#endif
+#endif
+
+/*
+ * Make timer 1 count microseconds and enable its event interrupt.  Call after
+ * timer 1 has been started and before the scheduler.
+ */
+void vEDFTicklessInit( void );
+
+/* Stop the periodic tick, the time of the call is the first reference of
+ * ulEDFTicklessElapsed().  Called by the kernel only. */
+void vEDFTicklessStart( void );
+
+/* Returns the whole ticks passed since the last call, the time of which moves
+ * forward by as many ticks.  Called by the kernel only. */
+uint32_t ulEDFTicklessElapsed( void );
+
+/* Raise the event ulTicks ticks after the time of the last
+ * ulEDFTicklessElapsed(), at once if that has passed.  Replaces the event set
+ * before.  Called by the kernel only. */
+void vEDFTicklessSetEvent( uint32_t ulTicks );
+
+/*
+ * Body of the event interrupt.  Called by the interrupt wrapper on target.
+ * Must not be called otherwise.
+ */
+void vEDFTicklessEventHandler( void );
+
+#endif /* EDF_TICKLESS_H */
@@ -0,0 +1,137 @@
+/*
+ * Microsecond timebase.  See edf_timebase.h.
+ *
+ * Timer 1 counts whole microseconds from the start, so the time is T1TC as
+ * it is and wraps around with it.  The match interrupt stays enabled: a match
+ * that comes when no task is due, after the counter wrapped for instance,
+ * releases nothing.
+ */
+
+/* Standard includes. */
+#if defined( __unix__ ) || defined( __APPLE__ )
+#include <time.h>
+#endif
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "edf_timebase.h"
+
+#if ( configUSE_EDF_HIGH_RES_TIME == 1 )
+
+#if ( configUSE_EDF_BENCHMARK == 1 )
+#error "configUSE_EDF_HIGH_RES_TIME and configUSE_EDF_BENCHMARK both set the prescaler of timer 1"
+#endif
+
+#if !defined( __unix__ ) && !defined( __APPLE__ )
+
+#include "lpc21xx.h"
+
+/* Timer 1 match register 0, interrupt on channel 5. */
+#define timebaseMCR_MR0_INTERRUPT    ( ( unsigned long ) 0x01 )
+#define timebaseIR_MR0               ( ( unsigned long ) 0x01 )
+#define timebaseVIC_TIMER1           ( ( unsigned long ) 0x20 )
+#define timebaseVIC_TIMER1_CHANNEL   ( ( unsigned long ) 5 )
+#define timebaseVIC_SLOT_ENABLE      ( ( unsigned long ) 0x20 )
+
+/* The peripheral clock is the processor clock (VPBDIV is 1). */
+#define timebasePRESCALER            ( ( unsigned long ) ( configCPU_CLOCK_HZ / 1000000UL ) - 1UL )
+
+#endif
+
+/*-----------------------------------------------------------*/
+
+void vEDFTimebaseInit( void )
+{
+#if !defined( __unix__ ) && !defined( __APPLE__ )
+	{
+		portENTER_CRITICAL();
+		{
+			T1PR = timebasePRESCALER;
+			T1IR = timebaseIR_MR0;
+			T1MCR |= timebaseMCR_MR0_INTERRUPT;
+
+			VICIntSelect &= ~timebaseVIC_TIMER1;
+			VICVectAddr2 = configEDF_TIMEBASE_ISR_ADDRESS;
+			VICVectCntl2 = timebaseVIC_SLOT_ENABLE | timebaseVIC_TIMER1_CHANNEL;
+			VICIntEnable = timebaseVIC_TIMER1;
+		}
+		portEXIT_CRITICAL();
+	}
+#endif
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulEDFTimebaseNowUs( void )
+{
+#if defined( __unix__ ) || defined( __APPLE__ )
+	struct timespec xNow;
+
+	( void ) clock_gettime( CLOCK_MONOTONIC, &xNow );
+
+	return ( uint32_t ) xNow.tv_sec * 1000000UL + ( uint32_t ) ( xNow.tv_nsec / 1000L );
+#else
+	return ( uint32_t ) T1TC;
+#endif
+}
+/*-----------------------------------------------------------*/
+
+void vEDFTimebaseSetAlarmUs( uint32_t ulTimeUs )
+{
+#if defined( __unix__ ) || defined( __APPLE__ )
+	/* No alarm, the tick releases the tasks due. */
+	( void ) ulTimeUs;
+#else
+	T1MR0 = ( unsigned long ) ulTimeUs;
+
+	/* The counter may have passed the match value before it was written. */
+	if( ( uint32_t ) ( ( uint32_t ) T1TC - ulTimeUs ) < 0x80000000UL )
+	{
+		VICSoftInt = timebaseVIC_TIMER1;
+	}
+#endif
+}
+/*-----------------------------------------------------------*/
+
+void vEDFTimebaseAlarmHandler( void )
+{
+	BaseType_t xHigherPriorityTaskWoken;
+
+#if !defined( __unix__ ) && !defined( __APPLE__ )
+	T1IR = timebaseIR_MR0;
+	VICSoftIntClear = timebaseVIC_TIMER1;
+#endif
+
+	xHigherPriorityTaskWoken = xTaskHighResAlarmFromISR();
+
+#if !defined( __unix__ ) && !defined( __APPLE__ )
+	VICVectAddr = 0UL;
+#endif
+
+	portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+}
+/*-----------------------------------------------------------*/
+
+#if !defined( __unix__ ) && !defined( __APPLE__ ) && defined( __GNUC__ )
+
+/* The handler can switch context, so the wrapper saves and restores it the
+ * same way as the tick interrupt of the port. */
+static void prvAlarmISRBody( void ) __attribute__( ( noinline ) );
+void vEDFTimebaseAlarmISR( void ) __attribute__( ( naked ) );
+
+static void prvAlarmISRBody( void )
+{
+	vEDFTimebaseAlarmHandler();
+}
+
+void vEDFTimebaseAlarmISR( void )
+{
+	portSAVE_CONTEXT();
+	prvAlarmISRBody();
+	portRESTORE_CONTEXT();
+}
+
+#endif
+
+#endif /* configUSE_EDF_HIGH_RES_TIME */
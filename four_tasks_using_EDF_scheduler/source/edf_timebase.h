@@ -0,0 +1,53 @@
+/*
+ * Microsecond timebase of the EDF kernel.
+ *
+ * With configUSE_EDF_HIGH_RES_TIME set to 1 the kernel keeps the absolute
+ * deadlines in microseconds read from configEDF_TIME_US(), and releases the
+ * tasks sleeping in xTaskDelayUntilUs() from the alarm programmed with
+ * configEDF_SET_ALARM_US() (see tasks.c).  This module provides both.
+ *
+ * On target the timebase is timer 1, already the run time counter: its
+ * prescaler is set so it counts microseconds, which edf_power.c keeps when it
+ * changes the clock, and its match register 0 raises the alarm through slot 2
+ * of the vectored interrupt controller.  An alarm set in the past is raised
+ * at once by a software interrupt.  On the POSIX port the time comes from the
+ * monotonic clock and there is no alarm: the tick releases the tasks, so at
+ * the tick resolution only.
+ */
+
+#ifndef EDF_TIMEBASE_H
+#define EDF_TIMEBASE_H
+
+/* Address installed in slot 2 of the vectored interrupt controller for timer
+ * 1 (slot 0 is the tick, 1 UART0).  With GCC it is the wrapper of
+ * edf_timebase.c; with other compilers an assembly wrapper saving the context
+ * like the tick one of the port must call vEDFTimebaseAlarmHandler(). */
+#if ( configUSE_EDF_HIGH_RES_TIME == 1 ) && !defined( __unix__ ) && !defined( __APPLE__ ) && !defined( configEDF_TIMEBASE_ISR_ADDRESS )
+#if defined( __GNUC__ )
+void vEDFTimebaseAlarmISR( void );
+#define configEDF_TIMEBASE_ISR_ADDRESS    ( ( unsigned long ) vEDFTimebaseAlarmISR )
+#else
+#error "configEDF_TIMEBASE_ISR_ADDRESS must be defined in FreeRTOSConfig.h"
+#endif
+#endif
+
+/*
+ * Make timer 1 count microseconds and enable its alarm interrupt.  Call after
+ * timer 1 has been started and before the scheduler.
+ */
+void vEDFTimebaseInit( void );
+
+/* Returns the time in microseconds, wrapping around every 71 minutes. */
+uint32_t ulEDFTimebaseNowUs( void );
+
+/* Raise the alarm when the time reaches ulTimeUs, at once if it already
+ * has.  Replaces the alarm set before.  Called by the kernel only. */
+void vEDFTimebaseSetAlarmUs( uint32_t ulTimeUs );
+
+/*
+ * Body of the alarm interrupt, releases the tasks due.  Called by the
+ * interrupt wrapper on target.  Must not be called otherwise.
+ */
+void vEDFTimebaseAlarmHandler( void );
+
+#endif /* EDF_TIMEBASE_H */
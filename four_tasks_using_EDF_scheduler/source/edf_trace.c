@@ -0,0 +1,373 @@
+/*
+ * EDF scheduling trace in the Chrome Trace Event format.  See edf_trace.h.
+ *
+ * The hooks only copy a few words into the ring buffer.  Formatting and output
+ * are done by the drain task, which is a normal periodic task and so shows up
+ * in the trace itself.
+ *
+ * The ring buffer has many producers (the hooks) and one consumer (the drain
+ * task).  Producers always run with interrupts masked and the consumer only
+ * moves the tail, so no further locking is needed on a single core.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+#include <string.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "edf_trace.h"
+
+#if ( configUSE_EDF_TRACE == 1 )
+
+#if ( configUSE_TRACE_FACILITY != 1 )
+#error "The EDF trace needs configUSE_TRACE_FACILITY set to 1 for the task numbers"
+#endif
+
+#if ( configNUMBER_OF_CORES > 1 )
+#error "The EDF trace only supports one core, masking the interrupts does not serialise the producers of several cores"
+#endif
+
+#define traceLINE_LENGTH           192
+#define traceTIME_STRING_LENGTH    24
+
+/* Length of one tick in us. */
+#define traceTICK_US               ( 1000000UL / ( uint32_t ) configTICK_RATE_HZ )
+
+/* Task number used before the first context switch. */
+#define traceNO_TASK               ( ( uint32_t ) 0xffffffffUL )
+
+typedef enum
+{
+	eTraceTaskCreated = 0,
+	eTraceTaskSwitchedIn,
+	eTraceJobRelease,
+	eTraceJobComplete
+} eTraceEventType_t;
+
+typedef struct xEDF_TRACE_EVENT
+{
+	uint32_t ulTick;      /* Tick count when the event was recorded. */
+	uint32_t ulSubTick;   /* Counter counts since that tick. */
+	uint32_t ulDeadline;  /* Absolute deadline in ticks, for releases and completions. */
+	uint32_t ulTask;      /* Task number (uxTCBNumber). */
+	uint8_t ucType;       /* eTraceEventType_t. */
+} EDFTraceEvent_t;
+
+static EDFTraceEvent_t xEvents[ configEDF_TRACE_BUFFER_EVENTS ];
+static volatile UBaseType_t uxHead = 0;
+static volatile UBaseType_t uxTail = 0;
+static volatile uint32_t ulDropped = 0;
+
+/* Task names, written by the create hook and read by the drain task. */
+static char cTaskNames[ configEDF_TRACE_MAX_TASKS ][ configMAX_TASK_NAME_LEN ];
+
+/* Time base of the events. */
+static volatile uint32_t ulCurrentTick = 0;
+static volatile uint32_t ulTickCounter = 0;
+static volatile uint32_t ulCountsPerTick = 0;
+
+/* Drain task state. */
+static uint32_t ulRunningTask = traceNO_TASK;
+static BaseType_t xFirstEvent = pdTRUE;
+static uint32_t ulCharsWritten = 0;
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+static FILE * pxTraceFile = NULL;
+#endif
+
+/*-----------------------------------------------------------*/
+
+static uint32_t prvGetSubTick( void )
+{
+#ifdef configEDF_TRACE_GET_COUNTER
+	return configEDF_TRACE_GET_COUNTER() - ulTickCounter;
+#else
+	return 0;
+#endif
+}
+
+static void prvRecord( eTraceEventType_t eType, uint32_t ulTask, uint32_t ulDeadline )
+{
+	const UBaseType_t uxNext = ( uxHead + 1U ) % ( UBaseType_t ) configEDF_TRACE_BUFFER_EVENTS;
+	EDFTraceEvent_t * pxEvent;
+
+	if( uxNext == uxTail )
+	{
+		ulDropped++;
+		return;
+	}
+
+	pxEvent = &( xEvents[ uxHead ] );
+	pxEvent->ulTick = ulCurrentTick;
+	pxEvent->ulSubTick = prvGetSubTick();
+	pxEvent->ulDeadline = ulDeadline;
+	pxEvent->ulTask = ulTask;
+	pxEvent->ucType = ( uint8_t ) eType;
+
+	uxHead = uxNext;
+}
+/*-----------------------------------------------------------*/
+
+void vEDFTraceTick( uint32_t ulTickCount )
+{
+#ifdef configEDF_TRACE_GET_COUNTER
+	const uint32_t ulNow = configEDF_TRACE_GET_COUNTER();
+
+	if( ulTickCounter != 0UL )
+	{
+		ulCountsPerTick = ulNow - ulTickCounter;
+	}
+
+	ulTickCounter = ulNow;
+#endif
+
+	/* Called before the kernel increments the tick count. */
+	ulCurrentTick = ulTickCount + 1UL;
+}
+
+void vEDFTraceTaskCreated( uint32_t ulTask, const char * pcName )
+{
+	char * pcEntry = cTaskNames[ ulTask % ( uint32_t ) configEDF_TRACE_MAX_TASKS ];
+	UBaseType_t x;
+
+	/* Keep the name valid inside a JSON string. */
+	for( x = 0; x < ( UBaseType_t ) configMAX_TASK_NAME_LEN - 1U; x++ )
+	{
+		if( pcName[ x ] == '\0' )
+		{
+			break;
+		}
+
+		pcEntry[ x ] = ( ( pcName[ x ] == '"' ) || ( pcName[ x ] == '\\' ) ) ? '_' : pcName[ x ];
+	}
+
+	pcEntry[ x ] = '\0';
+
+	prvRecord( eTraceTaskCreated, ulTask, 0 );
+}
+
+void vEDFTraceTaskSwitchedIn( uint32_t ulTask )
+{
+	prvRecord( eTraceTaskSwitchedIn, ulTask, 0 );
+}
+
+void vEDFTraceJobRelease( uint32_t ulTask, uint32_t ulDeadline )
+{
+	prvRecord( eTraceJobRelease, ulTask, ulDeadline );
+}
+
+void vEDFTraceJobComplete( uint32_t ulTask, uint32_t ulDeadline )
+{
+	/* Called from the task itself, with the scheduler suspended but
+	 * interrupts enabled. */
+	taskENTER_CRITICAL();
+	{
+		prvRecord( eTraceJobComplete, ulTask, ulDeadline );
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+
+void vEDFTraceFileWrite( const char * pcLine )
+{
+	if( pxTraceFile == NULL )
+	{
+		pxTraceFile = fopen( configEDF_TRACE_FILE, "w" );
+	}
+
+	if( pxTraceFile != NULL )
+	{
+		fputs( pcLine, pxTraceFile );
+		fflush( pxTraceFile );
+	}
+}
+
+#endif
+/*-----------------------------------------------------------*/
+
+/* Time in us as a decimal string.  64 bits are needed past ~71 minutes and
+ * printf() support for them cannot be relied on. */
+static const char * prvTimeString( char * pcBuffer, uint32_t ulTick, uint32_t ulSubTick )
+{
+	uint64_t ullTime = ( uint64_t ) ulTick * ( uint64_t ) traceTICK_US;
+	char * pcDigit = &( pcBuffer[ traceTIME_STRING_LENGTH - 1 ] );
+	const uint32_t ulCounts = ulCountsPerTick;
+
+	if( ulCounts != 0UL )
+	{
+		/* Clamp, an event recorded late in the tick interrupt can see a
+		 * counter already past the next tick. */
+		if( ulSubTick >= ulCounts )
+		{
+			ulSubTick = ulCounts - 1UL;
+		}
+
+		ullTime += ( ( uint64_t ) ulSubTick * ( uint64_t ) traceTICK_US ) / ( uint64_t ) ulCounts;
+	}
+
+	*pcDigit = '\0';
+
+	do
+	{
+		pcDigit--;
+		*pcDigit = ( char ) ( '0' + ( int ) ( ullTime % 10ULL ) );
+		ullTime /= 10ULL;
+	} while( ullTime != 0ULL );
+
+	return pcDigit;
+}
+
+static void prvOutputEvent( const char * pcEvent )
+{
+	/* The first event opens the array.  The closing bracket is optional in
+	 * the trace event format, which lets the trace be cut at any time. */
+	configEDF_TRACE_OUTPUT( ( xFirstEvent == pdTRUE ) ? "[\r\n" : ",\r\n" );
+	configEDF_TRACE_OUTPUT( pcEvent );
+	xFirstEvent = pdFALSE;
+	ulCharsWritten += 3UL + ( uint32_t ) strlen( pcEvent );
+}
+
+static void prvInstant( const char * pcName, uint32_t ulTask, const char * pcTime, uint32_t ulDeadline, int32_t lLateness )
+{
+	char cLine[ traceLINE_LENGTH ];
+
+	if( lLateness > 0 )
+	{
+		snprintf( cLine, sizeof( cLine ),
+				  "{\"name\":\"%s\",\"cat\":\"edf\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%lu,\"ts\":%s,\"args\":{\"deadline\":%lu,\"lateness_ticks\":%ld}}",
+				  pcName, ( unsigned long ) ulTask, pcTime, ( unsigned long ) ulDeadline, ( long ) lLateness );
+	}
+	else
+	{
+		snprintf( cLine, sizeof( cLine ),
+				  "{\"name\":\"%s\",\"cat\":\"edf\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%lu,\"ts\":%s,\"args\":{\"deadline\":%lu}}",
+				  pcName, ( unsigned long ) ulTask, pcTime, ( unsigned long ) ulDeadline );
+	}
+
+	prvOutputEvent( cLine );
+}
+
+static void prvEmit( const EDFTraceEvent_t * pxEvent )
+{
+	char cLine[ traceLINE_LENGTH ];
+	char cTime[ traceTIME_STRING_LENGTH ];
+	char cDeadline[ traceTIME_STRING_LENGTH ];
+	const char * pcTime = prvTimeString( cTime, pxEvent->ulTick, pxEvent->ulSubTick );
+	const char * pcName = cTaskNames[ pxEvent->ulTask % ( uint32_t ) configEDF_TRACE_MAX_TASKS ];
+	int32_t lLateness;
+
+	switch( pxEvent->ucType )
+	{
+		case eTraceTaskCreated:
+			snprintf( cLine, sizeof( cLine ),
+					  "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%lu,\"args\":{\"name\":\"%s\"}}",
+					  ( unsigned long ) pxEvent->ulTask, pcName );
+			prvOutputEvent( cLine );
+			break;
+
+		case eTraceTaskSwitchedIn:
+
+			/* The kernel also reports the running task being selected
+			 * again, only a change of task is a context switch. */
+			if( pxEvent->ulTask != ulRunningTask )
+			{
+				if( ulRunningTask != traceNO_TASK )
+				{
+					snprintf( cLine, sizeof( cLine ),
+							  "{\"ph\":\"E\",\"pid\":1,\"tid\":%lu,\"ts\":%s}",
+							  ( unsigned long ) ulRunningTask, pcTime );
+					prvOutputEvent( cLine );
+				}
+
+				snprintf( cLine, sizeof( cLine ),
+						  "{\"name\":\"%s\",\"cat\":\"edf\",\"ph\":\"B\",\"pid\":1,\"tid\":%lu,\"ts\":%s}",
+						  pcName, ( unsigned long ) pxEvent->ulTask, pcTime );
+				prvOutputEvent( cLine );
+				ulRunningTask = pxEvent->ulTask;
+			}
+
+			break;
+
+		case eTraceJobRelease:
+			prvInstant( "release", pxEvent->ulTask, pcTime, pxEvent->ulDeadline, 0 );
+			prvInstant( "deadline", pxEvent->ulTask, prvTimeString( cDeadline, pxEvent->ulDeadline, 0 ), pxEvent->ulDeadline, 0 );
+			break;
+
+		case eTraceJobComplete:
+			prvInstant( "complete", pxEvent->ulTask, pcTime, pxEvent->ulDeadline, 0 );
+
+			/* Late if it completed after the start of the deadline tick. */
+			lLateness = ( int32_t ) ( pxEvent->ulTick - pxEvent->ulDeadline );
+
+			if( ( lLateness > 0 ) || ( ( lLateness == 0 ) && ( pxEvent->ulSubTick != 0UL ) ) )
+			{
+				prvInstant( "deadline_miss", pxEvent->ulTask, pcTime, pxEvent->ulDeadline, ( lLateness > 0 ) ? lLateness : 1 );
+			}
+
+			break;
+
+		default:
+			break;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvDrainTask( void * pvParameters )
+{
+	TickType_t xLastWakeTime = xTaskGetTickCount();
+	EDFTraceEvent_t xEvent;
+	uint32_t ulReportedDropped = 0;
+	char cLine[ traceLINE_LENGTH ];
+	char cTime[ traceTIME_STRING_LENGTH ];
+
+	( void ) pvParameters;
+
+	prvOutputEvent( "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"FreeRTOS EDF\"}}" );
+
+	for( ;; )
+	{
+		ulCharsWritten = 0;
+
+		/* A job writes what the output can take in half a period, so it
+		 * completes within its period.  What is left waits for the next job,
+		 * or is dropped if the buffer fills up meanwhile. */
+		while( ( uxTail != uxHead ) && ( ulCharsWritten < ( uint32_t ) configEDF_TRACE_DRAIN_CHARS ) )
+		{
+			/* Copy first, the slot can be reused as soon as the tail moves. */
+			xEvent = xEvents[ uxTail ];
+			uxTail = ( uxTail + 1U ) % ( UBaseType_t ) configEDF_TRACE_BUFFER_EVENTS;
+
+			prvEmit( &xEvent );
+		}
+
+		if( ulDropped != ulReportedDropped )
+		{
+			ulReportedDropped = ulDropped;
+			snprintf( cLine, sizeof( cLine ),
+					  "{\"name\":\"dropped_events\",\"ph\":\"C\",\"pid\":1,\"ts\":%s,\"args\":{\"dropped\":%lu}}",
+					  prvTimeString( cTime, ( uint32_t ) xTaskGetTickCount(), 0 ), ( unsigned long ) ulReportedDropped );
+			prvOutputEvent( cLine );
+		}
+
+		vTaskDelayUntil( &xLastWakeTime, configEDF_TRACE_DRAIN_PERIOD );
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vStartEDFTrace( void )
+{
+	xTaskPeriodicCreate( prvDrainTask,
+						 "TRACE",
+						 configEDF_TRACE_STACK_SIZE,
+						 NULL,
+						 1,
+						 NULL,
+						 configEDF_TRACE_DRAIN_PERIOD );
+}
+
+#endif /* configUSE_EDF_TRACE */
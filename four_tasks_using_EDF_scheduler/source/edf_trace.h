@@ -0,0 +1,104 @@
+/*
+ * EDF scheduling trace in the Chrome Trace Event format.
+ *
+ * The kernel trace macros (see the configUSE_EDF_TRACE section of
+ * FreeRTOSConfig.h) record context switches, job releases and completions into
+ * a RAM ring buffer.  A low rate drain task turns them into JSON and writes
+ * them out, over the serial port on target or to a file on the POSIX port, so
+ * nothing is ever printed from inside the scheduler.
+ *
+ * The output is a JSON array of trace events that chrome://tracing and
+ * ui.perfetto.dev open directly:
+ *  - every task is a thread, named after the task,
+ *  - the time a task runs is a duration slice,
+ *  - a release is an instant event, with the absolute deadline as argument,
+ *  - every deadline is an instant event placed at the deadline itself,
+ *  - a job completing after its deadline is a "deadline_miss" instant event.
+ * Time stamps are in us: the tick count plus, when the run time stats counter
+ * is available, the time elapsed since the last tick.
+ */
+
+#ifndef EDF_TRACE_H
+#define EDF_TRACE_H
+
+/* Number of events the ring buffer holds.  Events recorded while it is full
+ * are dropped and counted. */
+#ifndef configEDF_TRACE_BUFFER_EVENTS
+#define configEDF_TRACE_BUFFER_EVENTS    256
+#endif
+
+/* Number of task names remembered.  Task numbers are used modulo this value. */
+#ifndef configEDF_TRACE_MAX_TASKS
+#define configEDF_TRACE_MAX_TASKS        16
+#endif
+
+/* Period of the drain task in ticks. */
+#ifndef configEDF_TRACE_DRAIN_PERIOD
+#define configEDF_TRACE_DRAIN_PERIOD     100
+#endif
+
+/* Characters a job of the drain task writes, past which the events left wait
+ * for the next job (the event crossing the limit is still written whole, two
+ * lines at most).  The default is what the serial port sends at
+ * configEDF_TRACE_BAUD_RATE in half a period, so the job keeps to its period
+ * even though the output blocks. */
+#ifndef configEDF_TRACE_BAUD_RATE
+#define configEDF_TRACE_BAUD_RATE        115200UL
+#endif
+
+#ifndef configEDF_TRACE_DRAIN_CHARS
+#define configEDF_TRACE_DRAIN_CHARS      ( ( ( configEDF_TRACE_BAUD_RATE / 10UL ) * ( uint32_t ) configEDF_TRACE_DRAIN_PERIOD ) / ( 2UL * ( uint32_t ) configTICK_RATE_HZ ) )
+#endif
+
+/* Stack size in words of the drain task. */
+#ifndef configEDF_TRACE_STACK_SIZE
+#define configEDF_TRACE_STACK_SIZE       ( configMINIMAL_STACK_SIZE * 2 )
+#endif
+
+/* Counter used for the time elapsed since the last tick. */
+#ifndef configEDF_TRACE_GET_COUNTER
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+#define configEDF_TRACE_GET_COUNTER()    ( ( uint32_t ) portGET_RUN_TIME_COUNTER_VALUE() )
+#endif
+#endif
+
+/* File the trace is written to on the POSIX port. */
+#if defined( __unix__ ) || defined( __APPLE__ )
+#ifndef configEDF_TRACE_FILE
+#define configEDF_TRACE_FILE             "edf_trace.json"
+#endif
+void vEDFTraceFileWrite( const char * pcLine );
+#endif
+
+/* Where the trace goes. */
+#ifndef configEDF_TRACE_OUTPUT
+#if defined( __unix__ ) || defined( __APPLE__ )
+#define configEDF_TRACE_OUTPUT( pcLine )    vEDFTraceFileWrite( pcLine )
+#else
+#if ( configUSE_EDF_SERIAL_TX == 1 ) && ( configUSE_EDF_TRACE == 1 )
+#error "The trace goes to vSerialPutString() by default, which cannot be used once configUSE_EDF_SERIAL_TX gives UART0 to edf_serial.c; define configEDF_TRACE_OUTPUT() in FreeRTOSConfig.h"
+#endif
+#include <string.h>
+#include "serial.h"
+#define configEDF_TRACE_OUTPUT( pcLine )    vSerialPutString( ( const signed char * ) ( pcLine ), ( unsigned short ) strlen( pcLine ) )
+#endif
+#endif
+
+/*
+ * Create the drain task.  Call before vTaskStartScheduler(), events recorded
+ * before are kept.
+ */
+void vStartEDFTrace( void );
+
+/*
+ * Trace hooks, called from the kernel trace macros with interrupts masked (or
+ * from task context for vEDFTraceJobComplete()).  They must not be called from
+ * application code.
+ */
+void vEDFTraceTick( uint32_t ulTickCount );
+void vEDFTraceTaskCreated( uint32_t ulTask, const char * pcName );
+void vEDFTraceTaskSwitchedIn( uint32_t ulTask );
+void vEDFTraceJobRelease( uint32_t ulTask, uint32_t ulDeadline );
+void vEDFTraceJobComplete( uint32_t ulTask, uint32_t ulDeadline );
+
+#endif /* EDF_TRACE_H */
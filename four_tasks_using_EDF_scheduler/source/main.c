@@ -55,6 +55,7 @@
 /* Standard includes. */
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 
 /* Scheduler includes. */
 #include "FreeRTOS.h"
@@ -68,6 +69,46 @@
 #include "serial.h"
 #include "GPIO.h"
 
+#if ( configUSE_EDF_BENCHMARK == 1 )
+#include "edf_benchmark.h"
+#endif
+
+#if ( configUSE_EDF_TRACE == 1 )
+#include "edf_trace.h"
+#endif
+
+#if ( configGENERATE_RUN_TIME_STATS != 1 )
+#error "The load tasks need configGENERATE_RUN_TIME_STATS set to 1 for vTaskBusyWaitExecutionTime()"
+#endif
+
+#if ( configUSE_EDF_TASKSET == 1 )
+#include "edf_taskset.h"
+#endif
+
+#if ( configUSE_EDF_DVFS == 1 )
+#include "edf_power.h"
+#endif
+
+#if ( configUSE_EDF_MAILBOX == 1 )
+#include "edf_mailbox.h"
+#endif
+
+#if ( configUSE_EDF_SERIAL_TX == 1 )
+#include "edf_serial.h"
+#endif
+
+#if ( configUSE_EDF_GPIO_EDGE == 1 )
+#include "edf_gpio.h"
+#endif
+
+#if ( configUSE_EDF_HIGH_RES_TIME == 1 )
+#include "edf_timebase.h"
+#endif
+
+#if ( configUSE_EDF_TICKLESS_KERNEL == 1 )
+#include "edf_tickless.h"
+#endif
+
 
 /*-----------------------------------------------------------*/
 
@@ -80,13 +121,20 @@
 #define NULL_PTR                             (void*)0
 
 /* period for each task */
-#define BUTTON_1_MONITOR_TASK_PERIOD         50
+#define BUTTON_1_MONITOR_TASK_PERIOD         50  /* minimum time between edges when event driven */
 #define BUTTON_2_MONITOR_TASK_PERIOD         50
 #define PERIODIC_TRANSMITTER_TASK_PERIOD     100
 #define UART_RECEIVER_TASK_PERIOD            20
 #define LOAD_1_SIMULATION_TASK_PERIOD        10
 #define LOAD_2_SIMULATION_TASK_PERIOD        100
 
+/* execution time of the load tasks */
+#define LOAD_1_SIMULATION_EXECUTION_TIME     pdMS_TO_TICKS( 5 )
+#define LOAD_2_SIMULATION_EXECUTION_TIME     pdMS_TO_TICKS( 12 )
+
+/* worst case execution time of the other tasks, for the frequency scaling */
+#define SHORT_TASK_EXECUTION_TIME            pdMS_TO_TICKS( 1 )
+
 /* handler for each task */
 TaskHandle_t Button1Monitor_TaskHandler      = NULL;
 TaskHandle_t Button2Monitor_TaskHandler      = NULL;
@@ -95,7 +143,28 @@ TaskHandle_t UartReceiver_TaskHandler        = NULL;
 TaskHandle_t Load1Simulation_TaskHandler     = NULL;
 TaskHandle_t Load2Simulation_TaskHandler     = NULL;
 
+#if ( configUSE_EDF_TASKSET == 1 )
+/* parameters of the synthetic task set */
+#define TASKSET_TASKS                        configEDF_TASKSET_MAX_TASKS
+#define TASKSET_UTILISATION                  0.7
+#define TASKSET_MIN_PERIOD                   10
+#define TASKSET_MAX_PERIOD                   1000
+#define TASKSET_MIN_DEADLINE_RATIO           0.5
+#define TASKSET_SEED                         1
+
+static EDFTaskSet_t xTaskSet;
+#endif
+
+/* number of messages waiting to be sent via Uart */
+#define MESSAGE_QUEUE_LENGTH                 3
+
+#if ( configUSE_EDF_MAILBOX == 1 )
+/* the messages are constant strings, only pointers to them are passed */
+static EDFMailbox_t xMailbox;
+static void * pvMailboxSlots[ MESSAGE_QUEUE_LENGTH ];
+#else
 QueueHandle_t xQueue;
+#endif
 
 
 /*
@@ -106,8 +175,69 @@ QueueHandle_t xQueue;
 static void prvSetupHardware( void );
 /*-----------------------------------------------------------*/
 
+/* send a message without waiting, it is dropped if no place is left */
+static void prvSendMessage( char * pcMessage )
+{
+#if ( configUSE_EDF_MAILBOX == 1 )
+	( void ) xEDFMailboxSend( &xMailbox, ( void * ) pcMessage, ( TickType_t ) 0 );
+#else
+	if ( xQueue != 0 )
+	{
+		xQueueSend( xQueue, ( void * ) &pcMessage, ( TickType_t ) 0 );
+	}
+#endif
+}
+
+/* receive a message without waiting, returns pdPASS if there was one */
+static BaseType_t prvReceiveMessage( char ** ppcMessage )
+{
+#if ( configUSE_EDF_MAILBOX == 1 )
+	return xEDFMailboxReceive( &xMailbox, ( void ** ) ppcMessage, ( TickType_t ) 0 );
+#else
+	return xQueueReceive( xQueue, ( void * ) ppcMessage, ( TickType_t ) 0 );
+#endif
+}
+
 /* Task to be created. */
 
+#if ( configUSE_EDF_GPIO_EDGE == 1 )
+/* Description:
+   this sporadic task is released by the edges of its button pin, at most once
+	 every period, and sends a message per edge of the job
+ */
+static void prvButtonMonitor( pinX_t xPin, char * pcRisingMessage, char * pcFallingMessage )
+{
+	uint32_t ulEdges;
+
+	xEDFGpioEdgeAttach( PORT_0, xPin, NULL );
+
+	for( ;; )
+	{
+		if ( xEDFGpioEdgeWait( &ulEdges, portMAX_DELAY ) == pdPASS )
+		{
+			if ( ( ulEdges & edfGPIO_RISING_EDGE ) != 0UL )
+			{
+				prvSendMessage( pcRisingMessage );
+			}
+
+			if ( ( ulEdges & edfGPIO_FALLING_EDGE ) != 0UL )
+			{
+				prvSendMessage( pcFallingMessage );
+			}
+		}
+	}
+}
+
+void Button_1_Monitor( void * pvParameters )
+{
+	prvButtonMonitor( PIN1, "BUTTON_1_RISING_EDGE\n", "BUTTON_1_FALLING_EDGE\n" );
+}
+
+void Button_2_Monitor( void * pvParameters )
+{
+	prvButtonMonitor( PIN2, "BUTTON_2_RISING_EDGE\n", "BUTTON_2_FALLING_EDGE\n" );
+}
+#else
 /* Description:
    this task monitor button 1 (PIN1) state every 50 ms
 	 if a rising or falling edge happens on PIN1 a message will be sent to the Queue
@@ -133,31 +263,26 @@ void Button_1_Monitor( void * pvParameters )
 			/* rising edge case */
 			if ( button1_NewState == PIN_IS_HIGH )
 			{
-				/* check if the Queue have a place or not if yes store the message in it
-							     and dont't wait any ticks for a place to be empty in the Queue */
-				if ( xQueue != 0 )
-				{
-					button1_message = "BUTTON_1_RISING_EDGE\n";
-					xQueueSend( xQueue, ( void * ) &button1_message, ( TickType_t ) 0 );
-				}
+				/* store the message if there is a place for it, dont't wait any ticks
+				   for a place to be empty */
+				button1_message = "BUTTON_1_RISING_EDGE\n";
+				prvSendMessage( button1_message );
 			}
 			/* falling edge case */
 			else if ( button1_NewState == PIN_IS_LOW )
 			{
-				/* check if the Queue have a place or not if yes store the message in it
-							     and dont't wait any ticks for a place to be empty in the Queue */
-				if ( xQueue != 0 )
-				{
-					button1_message = "BUTTON_1_FALLING_EDGE\n";
-					xQueueSend( xQueue, ( void * ) &button1_message, ( TickType_t ) 0 );
-				}
+				/* store the message if there is a place for it, dont't wait any ticks
+				   for a place to be empty */
+				button1_message = "BUTTON_1_FALLING_EDGE\n";
+				prvSendMessage( button1_message );
 			}
 		}
-	}
-	/* update the old state of the button */
-	button1_OldState = button1_NewState;
 
-	vTaskDelayUntil( &xLastWakeTime, BUTTON_1_MONITOR_TASK_PERIOD );
+		/* update the old state of the button */
+		button1_OldState = button1_NewState;
+
+		vTaskDelayUntil( &xLastWakeTime, BUTTON_1_MONITOR_TASK_PERIOD );
+	}
 }
 
 /* Description:
@@ -184,32 +309,28 @@ void Button_2_Monitor( void * pvParameters )
 			/* rising edge case */
 			if ( button2_NewState == PIN_IS_HIGH )
 			{
-				/* check if the Queue have a place or not if yes store the message in it
-							     and dont't wait any ticks for a place to be empty in the Queue */
-				if ( xQueue != 0 )
-				{
-					button2_message = "BUTTON_2_RISING_EDGE\n";
-					xQueueSend( xQueue, ( void * ) &button2_message, ( TickType_t ) 0 );
-				}
+				/* store the message if there is a place for it, dont't wait any ticks
+				   for a place to be empty */
+				button2_message = "BUTTON_2_RISING_EDGE\n";
+				prvSendMessage( button2_message );
 			}
 			/* falling edge case */
 			else if ( button2_NewState == PIN_IS_LOW )
 			{
-				/* check if the Queue have a place or not if yes store the message in it
-							     and dont't wait any ticks for a place to be empty in the Queue */
-				if ( xQueue != 0 )
-				{
-					button2_message = "BUTTON_2_FALLING_EDGE\n";
-					xQueueSend( xQueue, ( void * ) &button2_message, ( TickType_t ) 0 );
-				}
+				/* store the message if there is a place for it, dont't wait any ticks
+				   for a place to be empty */
+				button2_message = "BUTTON_2_FALLING_EDGE\n";
+				prvSendMessage( button2_message );
 			}
 		}
-	}
-	/* update the old state of the button */
-	button2_OldState = button2_NewState;
 
-	vTaskDelayUntil( &xLastWakeTime, BUTTON_2_MONITOR_TASK_PERIOD );
+		/* update the old state of the button */
+		button2_OldState = button2_NewState;
+
+		vTaskDelayUntil( &xLastWakeTime, BUTTON_2_MONITOR_TASK_PERIOD );
+	}
 }
+#endif
 
 /* Description:
    this task sent a message to the Queue every 100 ms
@@ -223,15 +344,13 @@ void Periodic_Transmitter( void * pvParameters )
 
 	for( ;; )
 	{
-		/* check if the Queue have a place or not if yes store the message in it
-					 and dont't wait any ticks for a place to be empty in the Queue */
-		if ( xQueue != 0 )
-		{
-			periodic_message = "PERIODIC_TRANSIMITTER\n";
-			xQueueSend( xQueue, ( void * ) &periodic_message, ( TickType_t ) 0 );
-		}
+		/* store the message if there is a place for it, dont't wait any ticks
+		   for a place to be empty */
+		periodic_message = "PERIODIC_TRANSIMITTER\n";
+		prvSendMessage( periodic_message );
+
+		vTaskDelayUntil( &xLastWakeTime, PERIODIC_TRANSMITTER_TASK_PERIOD );
 	}
-	vTaskDelayUntil( &xLastWakeTime, PERIODIC_TRANSMITTER_TASK_PERIOD );
 }
 
 /* Description:
@@ -245,14 +364,21 @@ void Uart_Receiver( void * pvParameters )
 
 	for( ;; )
 	{
-		/* check if there is an exisitng item in the Queue if yes send it via Uart
-			     and wait no ticks for an item to be in the Queue */
-		if( xQueueReceive( xQueue,&(receive_message ),( TickType_t ) 0 ) == pdPASS )
+		/* send all the messages received since the last period via Uart,
+		   without waiting for more */
+		while( prvReceiveMessage( &receive_message ) == pdPASS )
 		{
-			vSerialPutString((const signed char *)(receive_message), 22);
+#if ( configUSE_EDF_SERIAL_TX == 1 )
+			/* the messages are constant strings, the job does not have to wait
+			   for them to be sent.  A message is dropped if too many are queued */
+			( void ) xEDFSerialWriteAsync( ( const uint8_t * ) receive_message, strlen( receive_message ), NULL );
+#else
+			vSerialPutString((const signed char *)(receive_message), (unsigned short) strlen(receive_message));
+#endif
 		}
+
+		vTaskDelayUntil( &xLastWakeTime, UART_RECEIVER_TASK_PERIOD );
 	}
-	vTaskDelayUntil( &xLastWakeTime, UART_RECEIVER_TASK_PERIOD );
 }
 
 /* Description:
@@ -260,17 +386,16 @@ void Uart_Receiver( void * pvParameters )
  */
 void Load_1_Simulation( void * pvParameters )
 {
-	uint16_t Load1Tick;
 	TickType_t xLastWakeTime;
 	xLastWakeTime = xTaskGetTickCount();
 
 	for( ;; )
 	{
-		/* do nothing for 5ms */
-		for ( Load1Tick=0; Load1Tick < 30000; Load1Tick++ );
+		/* do nothing for 5ms of processor time */
+		vTaskBusyWaitExecutionTime( LOAD_1_SIMULATION_EXECUTION_TIME );
 
+		vTaskDelayUntil( &xLastWakeTime, LOAD_1_SIMULATION_TASK_PERIOD );
 	}
-	vTaskDelayUntil( &xLastWakeTime, LOAD_1_SIMULATION_TASK_PERIOD );
 }
 
 /* Description:
@@ -278,17 +403,16 @@ void Load_1_Simulation( void * pvParameters )
  */
 void Load_2_Simulation( void * pvParameters )
 {
-	uint32_t Load2Tick;
 	TickType_t xLastWakeTime;
 	xLastWakeTime = xTaskGetTickCount();
 
 	for( ;; )
 	{
-		/* do nothing for 12ms */
-		for ( Load2Tick = 0; Load2Tick < 90500; Load2Tick++);
+		/* do nothing for 12ms of processor time */
+		vTaskBusyWaitExecutionTime( LOAD_2_SIMULATION_EXECUTION_TIME );
 
+		vTaskDelayUntil( &xLastWakeTime, LOAD_2_SIMULATION_TASK_PERIOD );
 	}
-	vTaskDelayUntil( &xLastWakeTime, LOAD_2_SIMULATION_TASK_PERIOD );
 }
 
 /* tick hook callback function */
@@ -296,6 +420,11 @@ void vApplicationTickHook( void )
 {
 	GPIO_write (PORT_0, PIN0, PIN_IS_HIGH);
 	GPIO_write (PORT_0, PIN0, PIN_IS_LOW);
+
+#if ( configUSE_EDF_GPIO_EDGE == 1 )
+	/* release the button tasks on the edges of their pins */
+	vEDFGpioEdgeTick();
+#endif
 }
 
 /* idle task callback function */
@@ -313,10 +442,56 @@ int main( void )
 	/* Setup the hardware for use with the Keil demo board. */
 	prvSetupHardware();
 
-	xQueue = xQueueCreate( 3, sizeof( char* ) );
+#if ( configUSE_EDF_TRACE == 1 )
+	/* Trace whatever runs below, the drain task writes it to the serial port */
+	vStartEDFTrace();
+#endif
+
+#if ( configUSE_EDF_BENCHMARK == 1 )
+	/* Only the benchmark workers run, so nothing else disturbs the numbers */
+	vStartEDFBenchmark();
+#elif ( configUSE_EDF_TASKSET == 1 )
+	/* Generated tasks replace the application tasks */
+	vEDFTaskSetSeed( TASKSET_SEED );
+	if( xEDFTaskSetGenerate( &xTaskSet, TASKSET_TASKS, TASKSET_UTILISATION, eEDFTaskSetRandFixedSum,
+							 TASKSET_MIN_PERIOD, TASKSET_MAX_PERIOD, TASKSET_MIN_DEADLINE_RATIO ) == pdPASS )
+	{
+		xEDFTaskSetLaunch( &xTaskSet );
+	}
+#else
+#if ( configUSE_EDF_MAILBOX == 1 )
+	vEDFMailboxInit( &xMailbox, pvMailboxSlots, MESSAGE_QUEUE_LENGTH );
+#else
+	xQueue = xQueueCreate( MESSAGE_QUEUE_LENGTH, sizeof( char* ) );
+#endif
 
 	/* Create Tasks here */
 
+#if ( configUSE_EDF_GPIO_EDGE == 1 )
+	/* The sporadic tasks first, their admission counts the periodic tasks
+	   created before them with the WCET of their whole period */
+	xTaskSporadicCreate(
+			Button_1_Monitor,                  /* Function that implements the task. */
+			"BUTTON 1 MONITOR",                /* Text name for the task. */
+			100,                               /* Stack size in words, not bytes. */
+			( void * ) 0,                      /* Parameter passed into the task. */
+			1,                                 /* Priority at which the task is created. */
+			&Button1Monitor_TaskHandler,       /* Used to pass out the created task's handle. */
+			BUTTON_1_MONITOR_TASK_PERIOD,      /* Minimum time between releases */
+			BUTTON_1_MONITOR_TASK_PERIOD,      /* Deadline of a release */
+			SHORT_TASK_EXECUTION_TIME);        /* Worst case execution time */
+
+	xTaskSporadicCreate(
+			Button_2_Monitor,                  /* Function that implements the task. */
+			"BUTTON 2 MONITOR",                /* Text name for the task. */
+			100,                               /* Stack size in words, not bytes. */
+			( void * ) 0,                      /* Parameter passed into the task. */
+			1,                                 /* Priority at which the task is created. */
+			&Button2Monitor_TaskHandler,       /* Used to pass out the created task's handle. */
+			BUTTON_2_MONITOR_TASK_PERIOD,      /* Minimum time between releases */
+			BUTTON_2_MONITOR_TASK_PERIOD,      /* Deadline of a release */
+			SHORT_TASK_EXECUTION_TIME);        /* Worst case execution time */
+#else
 	/* Create the task, storing the handle. */
 	xTaskPeriodicCreate(
 			Button_1_Monitor,                  /* Function that implements the task. */
@@ -336,6 +511,7 @@ int main( void )
 			1,                                 /* Priority at which the task is created. */
 			&Button2Monitor_TaskHandler,       /* Used to pass out the created task's handle. */
 			BUTTON_2_MONITOR_TASK_PERIOD);     /* Period for the task */
+#endif
 
 	/* Create the task, storing the handle. */
 	xTaskPeriodicCreate(
@@ -377,6 +553,26 @@ int main( void )
 			&Load2Simulation_TaskHandler,      /* Used to pass out the created task's handle. */
 			LOAD_2_SIMULATION_TASK_PERIOD); 	 /* Period for the task */
 
+#if ( ( configUSE_EDF_DVFS == 1 ) || ( configUSE_EDF_SLACK_STEALING == 1 ) || ( configUSE_EDF_SPORADIC == 1 ) || ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 ) || ( configUSE_EDF_DEFERRED_PREEMPTION == 1 ) )
+	/* The tasks run at full speed, leave no slack, and count as a full
+	   processor in the sporadic admission, until their WCET is known */
+	vTaskSetWorstCaseExecutionTime( Button1Monitor_TaskHandler, SHORT_TASK_EXECUTION_TIME );
+	vTaskSetWorstCaseExecutionTime( Button2Monitor_TaskHandler, SHORT_TASK_EXECUTION_TIME );
+	vTaskSetWorstCaseExecutionTime( PeriodicTransmitter_TaskHandler, SHORT_TASK_EXECUTION_TIME );
+	vTaskSetWorstCaseExecutionTime( UartReceiver_TaskHandler, SHORT_TASK_EXECUTION_TIME );
+	vTaskSetWorstCaseExecutionTime( Load1Simulation_TaskHandler, LOAD_1_SIMULATION_EXECUTION_TIME );
+	vTaskSetWorstCaseExecutionTime( Load2Simulation_TaskHandler, LOAD_2_SIMULATION_EXECUTION_TIME );
+#endif
+#if ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 )
+	/* Load 2 can hold off the tasks the test shows can wait for it */
+	xTaskAssignPreemptionThresholds();
+#endif
+#if ( configUSE_EDF_DEFERRED_PREEMPTION == 1 )
+	/* Load 2 can finish up to 5 ticks of its busy loop before Load 1 runs */
+	xTaskAssignNonPreemptiveRegions();
+#endif
+#endif
+
 	/* Now all the tasks have been started - start the scheduler.
 
 	NOTE : Tasks run in system mode and the scheduler runs in Supervisor mode.
@@ -400,7 +596,12 @@ void timer1Reset(void)
 
 static void ConfigTimer1(void)
 {
+#if ( configUSE_EDF_BENCHMARK == 1 )
+	/* count every PCLK cycle so the benchmark gets cycle resolution */
+	T1PR = 0;
+#else
 	T1PR = 1000;
+#endif
 	T1TCR |= 0x1;
 }
 
@@ -412,12 +613,27 @@ static void prvSetupHardware( void )
 	/* Configure UART */
 	xSerialPortInitMinimal(mainCOM_TEST_BAUD_RATE);
 
+#if ( configUSE_EDF_SERIAL_TX == 1 )
+	/* send from the transmit interrupt */
+	vEDFSerialTxInit();
+#endif
+
 	/* Configure GPIO */
 	GPIO_init();
 
 	/* Configure trace timer 1 and read TITC to get current tick */
 	ConfigTimer1();
 
+#if ( configUSE_EDF_HIGH_RES_TIME == 1 )
+	/* timer 1 counts microseconds for the deadlines and raises their alarm */
+	vEDFTimebaseInit();
+#endif
+
+#if ( configUSE_EDF_TICKLESS_KERNEL == 1 )
+	/* timer 1 counts microseconds and raises the events of the kernel */
+	vEDFTicklessInit();
+#endif
+
 	/* Setup the peripheral bus to be the same as the PLL output. */
 	VPBDIV = mainBUS_CLK_FULL;
 }
@@ -74,6 +74,148 @@ extern "C" {
  * array. */
 #define tskDEFAULT_INDEX_TO_NOTIFY     ( 0 )
 
+/* START of special for EDF */
+/* Defaults for the trace macros added by the EDF changes.  The standard trace
+ * macros get their defaults from FreeRTOS.h, these ones are kept here so the
+ * port headers do not need to be touched. */
+#ifndef traceTASK_INCREMENT_TICK_END
+#define traceTASK_INCREMENT_TICK_END( xSwitchRequired )
+#endif
+
+#ifndef traceTASK_JOB_COMPLETE
+#define traceTASK_JOB_COMPLETE( pxTCB )
+#endif
+
+/* A job of pxTCB is released, with xTaskAbsoluteDeadline set.  Only releases
+ * are reported, not the other ways a task becomes ready. */
+#ifndef traceTASK_JOB_RELEASE
+#define traceTASK_JOB_RELEASE( pxTCB )
+#endif
+
+/* Number of cores the scheduler dispatches to.  More than one core selects
+ * global EDF (G-EDF), which needs an SMP port, see tasks.c. */
+#ifndef configNUMBER_OF_CORES
+#define configNUMBER_OF_CORES    1
+#endif
+
+/* With more than one core, set to 1 for partitioned EDF (P-EDF) instead of
+ * global EDF: every task is bound to one core and each core schedules its own
+ * ready list, with its own tick, delayed lists and lock.  The port calls
+ * xTaskIncrementTick() on every core, xTaskGetTickCount() returns the tick
+ * count of the calling core.  See tasks.c. */
+#ifndef configUSE_EDF_PARTITIONED
+#define configUSE_EDF_PARTITIONED    0
+#endif
+
+/* On top of partitioned EDF, set to 1 to also allow split tasks whose jobs
+ * start on one core and migrate to a second one when their budget there is
+ * used up (semi-partitioned EDF). */
+#ifndef configUSE_EDF_SEMI_PARTITIONED
+#define configUSE_EDF_SEMI_PARTITIONED    0
+#endif
+
+/* Set to 1 for cycle-conserving EDF frequency scaling: the kernel tracks the
+ * utilisation of the task set and passes it to configEDF_DVFS_SET_SPEED(),
+ * see tasks.c. */
+#ifndef configUSE_EDF_DVFS
+#define configUSE_EDF_DVFS    0
+#endif
+
+/* Set to 1 for slack stealing: best-effort tasks run ahead of the periodic
+ * tasks while the EDF slack is above zero, see xTaskCreateSlackStealer(). */
+#ifndef configUSE_EDF_SLACK_STEALING
+#define configUSE_EDF_SLACK_STEALING    0
+#endif
+
+/* Set to 1 for sporadic tasks: jobs released by events at most once per
+ * minimum inter-arrival time, admitted by a density test, see
+ * xTaskSporadicCreate(). */
+#ifndef configUSE_EDF_SPORADIC
+#define configUSE_EDF_SPORADIC    0
+#endif
+
+/* Set to 1 to keep the delayed tasks in a hierarchical timing wheel instead
+ * of the lists ordered by wake time: delaying a task takes constant time and
+ * a tick constant time amortised, see tasks.c. */
+#ifndef configUSE_EDF_TIMING_WHEEL
+#define configUSE_EDF_TIMING_WHEEL    0
+#endif
+
+/* Set to 1 to dispatch the periodic tasks from a schedule table computed over
+ * one hyperperiod before the scheduler starts, falling back to online EDF
+ * when the tasks stray from it, see xTaskScheduleTableBuild(). */
+#ifndef configUSE_EDF_SCHEDULE_TABLE
+#define configUSE_EDF_SCHEDULE_TABLE    0
+#endif
+
+/* Set to 1 for preemption thresholds: a task is only preempted by tasks of a
+ * relative deadline lower than its threshold, which saves the context
+ * switches the schedulability test shows are not needed, see
+ * xTaskAssignPreemptionThresholds(). */
+#ifndef configUSE_EDF_PREEMPTION_THRESHOLD
+#define configUSE_EDF_PREEMPTION_THRESHOLD    0
+#endif
+
+/* Set to 1 for deferred preemption: a task can go on running for a bounded
+ * number of ticks, or up to its next vTaskPreemptionPoint(), before a job of
+ * an earlier deadline preempts it, see xTaskAssignNonPreemptiveRegions(). */
+#ifndef configUSE_EDF_DEFERRED_PREEMPTION
+#define configUSE_EDF_DEFERRED_PREEMPTION    0
+#endif
+
+/* Set to 1 to keep the absolute deadlines in microseconds of the timebase
+ * read by configEDF_TIME_US(), and let tasks be released between ticks by the
+ * alarm set by configEDF_SET_ALARM_US(), see xTaskDelayUntilUs(). */
+#ifndef configUSE_EDF_HIGH_RES_TIME
+#define configUSE_EDF_HIGH_RES_TIME    0
+#endif
+
+/* Set to 1 to run without a periodic tick: after the first tick of the port
+ * the timer set by configEDF_TICKLESS_SET_EVENT() only interrupts at the next
+ * release or end of a non-preemptive region, see xTaskProcessTimerEvent(). */
+#ifndef configUSE_EDF_TICKLESS_KERNEL
+#define configUSE_EDF_TICKLESS_KERNEL    0
+#endif
+
+/* Notification indexes the EDF modules wake tasks with, each its own, index 0
+ * being left to the application.  configTASK_NOTIFICATION_ARRAY_ENTRIES must
+ * be above the indexes of the modules built. */
+#ifndef configEDF_SPORADIC_NOTIFY_INDEX
+#define configEDF_SPORADIC_NOTIFY_INDEX    1
+#endif
+
+#ifndef configEDF_MAILBOX_NOTIFY_INDEX
+#define configEDF_MAILBOX_NOTIFY_INDEX     2
+#endif
+
+#ifndef configEDF_RING_NOTIFY_INDEX
+#define configEDF_RING_NOTIFY_INDEX        3
+#endif
+
+#ifndef configEDF_SERIAL_NOTIFY_INDEX
+#define configEDF_SERIAL_NOTIFY_INDEX      4
+#endif
+
+/* The index of each module, or a value of its own if it is not built. */
+#define tskEDF_SPORADIC_INDEX    ( ( configUSE_EDF_SPORADIC == 1 ) ? configEDF_SPORADIC_NOTIFY_INDEX : 1000 )
+#define tskEDF_MAILBOX_INDEX     ( ( configUSE_EDF_MAILBOX == 1 ) ? configEDF_MAILBOX_NOTIFY_INDEX : 1001 )
+#define tskEDF_RING_INDEX        ( ( configUSE_EDF_RING == 1 ) ? configEDF_RING_NOTIFY_INDEX : 1002 )
+#define tskEDF_SERIAL_INDEX      ( ( configUSE_EDF_SERIAL_TX == 1 ) ? configEDF_SERIAL_NOTIFY_INDEX : 1003 )
+
+#if ( ( tskEDF_SPORADIC_INDEX == tskEDF_MAILBOX_INDEX ) || ( tskEDF_SPORADIC_INDEX == tskEDF_RING_INDEX ) || \
+	( tskEDF_SPORADIC_INDEX == tskEDF_SERIAL_INDEX ) || ( tskEDF_MAILBOX_INDEX == tskEDF_RING_INDEX ) ||      \
+	( tskEDF_MAILBOX_INDEX == tskEDF_SERIAL_INDEX ) || ( tskEDF_RING_INDEX == tskEDF_SERIAL_INDEX ) )
+#error "the EDF modules built must each have a notification index of their own"
+#endif
+
+#if ( ( ( configUSE_EDF_SPORADIC == 1 ) && ( configEDF_SPORADIC_NOTIFY_INDEX >= configTASK_NOTIFICATION_ARRAY_ENTRIES ) ) || \
+	( ( configUSE_EDF_MAILBOX == 1 ) && ( configEDF_MAILBOX_NOTIFY_INDEX >= configTASK_NOTIFICATION_ARRAY_ENTRIES ) ) ||      \
+	( ( configUSE_EDF_RING == 1 ) && ( configEDF_RING_NOTIFY_INDEX >= configTASK_NOTIFICATION_ARRAY_ENTRIES ) ) ||            \
+	( ( configUSE_EDF_SERIAL_TX == 1 ) && ( configEDF_SERIAL_NOTIFY_INDEX >= configTASK_NOTIFICATION_ARRAY_ENTRIES ) ) )
+#error "configTASK_NOTIFICATION_ARRAY_ENTRIES must be above the notification indexes of the EDF modules built"
+#endif
+/* END of special for EDF */
+
 /**
  * task. h
  *
@@ -163,6 +305,14 @@ typedef struct xTASK_STATUS
 	configRUN_TIME_COUNTER_TYPE ulRunTimeCounter; /* The total run time allocated to the task so far, as defined by the run time stats clock.  See https://www.FreeRTOS.org/rtos-run-time-stats.html.  Only valid when configGENERATE_RUN_TIME_STATS is defined as 1 in FreeRTOSConfig.h. */
 	StackType_t * pxStackBase;                    /* Points to the lowest address of the task's stack area. */
 	configSTACK_DEPTH_TYPE usStackHighWaterMark;  /* The minimum amount of stack space that has remained for the task since the task was created.  The closer this value is to zero the closer the task has come to overflowing its stack. */
+	/* START of special for EDF */
+#if ( configUSE_EDF_SCHEDULER == 1 )
+	TickType_t xPeriod;                           /* The period of the task, or the minimum inter-arrival time of a sporadic task, in ticks. */
+	TickType_t xAbsoluteDeadline;                 /* The deadline of the current job, or of the last one if the task is blocked.  In microseconds if configUSE_EDF_HIGH_RES_TIME is 1. */
+	uint32_t ulJobCount;                          /* The number of jobs released since the task was created, the first one included. */
+	uint32_t ulDeadlineMisses;                    /* The number of jobs that completed after their deadline. */
+#endif
+	/* END of special for EDF */
 } TaskStatus_t;
 
 /* Possible return values for eTaskConfirmSleepModeStatus(). */
@@ -203,7 +353,15 @@ typedef enum
  * \ingroup SchedulerControl
  */
 #define taskENTER_CRITICAL()               portENTER_CRITICAL()
+/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+#define taskENTER_CRITICAL_FROM_ISR()      vTaskEnterCriticalFromISR()
+#else
+/* END of special for EDF */
 #define taskENTER_CRITICAL_FROM_ISR()      portSET_INTERRUPT_MASK_FROM_ISR()
+/* START of special for EDF */
+#endif
+/* END of special for EDF */
 
 /**
  * task. h
@@ -218,7 +376,15 @@ typedef enum
  * \ingroup SchedulerControl
  */
 #define taskEXIT_CRITICAL()                portEXIT_CRITICAL()
+/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+#define taskEXIT_CRITICAL_FROM_ISR( x )    vTaskExitCriticalFromISR( x )
+#else
+/* END of special for EDF */
 #define taskEXIT_CRITICAL_FROM_ISR( x )    portCLEAR_INTERRUPT_MASK_FROM_ISR( x )
+/* START of special for EDF */
+#endif
+/* END of special for EDF */
 
 /**
  * task. h
@@ -363,6 +529,377 @@ BaseType_t xTaskPeriodicCreate( TaskFunction_t pxTaskCode,
 		UBaseType_t uxPriority,
 		TaskHandle_t * const pxCreatedTask,
 		TickType_t uxPeriod	) PRIVILEGED_FUNCTION;
+
+/*
+ * Same as xTaskPeriodicCreate() but for a constrained deadline task: each job
+ * released at time t must complete by t + uxDeadline, with
+ * 0 < uxDeadline <= uxPeriod.  xTaskPeriodicCreate() is this function called
+ * with uxDeadline == uxPeriod.
+ */
+BaseType_t xTaskPeriodicCreateWithDeadline( TaskFunction_t pxTaskCode,
+		const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+		const configSTACK_DEPTH_TYPE usStackDepth,
+		void * const pvParameters,
+		UBaseType_t uxPriority,
+		TaskHandle_t * const pxCreatedTask,
+		TickType_t uxPeriod,
+		TickType_t uxDeadline ) PRIVILEGED_FUNCTION;
+
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_EDF_PARTITIONED == 1 ) )
+
+/*
+ * Same as xTaskPeriodicCreateWithDeadline() but the task is bound to core
+ * xCoreID, typically as chosen offline by a bin-packing assigner.  The other
+ * create functions bind the task to the calling core.
+ */
+BaseType_t xTaskPeriodicCreateOnCore( TaskFunction_t pxTaskCode,
+		const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+		const configSTACK_DEPTH_TYPE usStackDepth,
+		void * const pvParameters,
+		UBaseType_t uxPriority,
+		TaskHandle_t * const pxCreatedTask,
+		TickType_t uxPeriod,
+		TickType_t uxDeadline,
+		BaseType_t xCoreID ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_EDF_SEMI_PARTITIONED == 1 ) )
+
+/*
+ * Create a periodic task whose jobs are split over two cores.  Each job is
+ * released on xFirstCore with the local deadline uxFirstDeadline (relative to
+ * the release) and runs there for at most uxFirstBudget ticks.  When that
+ * budget is used up the job migrates to xSecondCore, where it keeps the
+ * deadline uxDeadline of the whole job.  A job completing within its budget
+ * never migrates.
+ *
+ * 0 < uxFirstBudget <= uxFirstDeadline < uxDeadline <= uxPeriod and xSecondCore
+ * must differ from xFirstCore.  A negative xSecondCore creates a task that is
+ * not split, as xTaskPeriodicCreateOnCore() does.
+ */
+BaseType_t xTaskPeriodicCreateSplit( TaskFunction_t pxTaskCode,
+		const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+		const configSTACK_DEPTH_TYPE usStackDepth,
+		void * const pvParameters,
+		UBaseType_t uxPriority,
+		TaskHandle_t * const pxCreatedTask,
+		TickType_t uxPeriod,
+		TickType_t uxDeadline,
+		BaseType_t xFirstCore,
+		TickType_t uxFirstBudget,
+		TickType_t uxFirstDeadline,
+		BaseType_t xSecondCore ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_EDF_DVFS == 1 )
+
+/* Full speed, and a utilisation of 1, in the 16.16 fixed point format used by
+ * configEDF_DVFS_SET_SPEED(). */
+#define tskEDF_SPEED_FULL    ( ( uint32_t ) 0x10000UL )
+
+#endif
+
+#if ( ( configUSE_EDF_DVFS == 1 ) || ( configUSE_EDF_SLACK_STEALING == 1 ) || ( configUSE_EDF_SPORADIC == 1 ) || ( configUSE_EDF_SCHEDULE_TABLE == 1 ) || ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 ) || ( configUSE_EDF_DEFERRED_PREEMPTION == 1 ) )
+
+/*
+ * Set the worst case execution time of a job of xTask at full speed, in ticks.
+ * The frequency scaling reserves xWCET / period for each job of the task until
+ * it completes, and the slack computation counts xWCET for each job that has
+ * not completed yet.  Tasks are created with a WCET of their whole period, so
+ * they keep the processor at full speed and leave no slack until this is
+ * called.  The admission of sporadic tasks counts xWCET / relative deadline
+ * for the task, period / relative deadline until this is called, and
+ * xTaskScheduleTableBuild() gives each job
+ * xWCET ticks of the table.  xTaskAssignPreemptionThresholds() counts xWCET
+ * as the time the task can hold off the tasks below its threshold, and
+ * xTaskAssignNonPreemptiveRegions() as the demand of its jobs.  NULL sets the
+ * WCET of the calling task.
+ */
+void vTaskSetWorstCaseExecutionTime( TaskHandle_t xTask,
+		TickType_t xWCET ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_EDF_SCHEDULE_TABLE == 1 )
+
+/*
+ * Compute the EDF schedule of the tasks created so far over one hyperperiod,
+ * the least common multiple of their periods, and record it as a table of
+ * (tick, task) switch points.  Call after the periodic tasks have been created
+ * and given their WCET, before vTaskStartScheduler().  The scheduler then
+ * dispatches from the table in constant time per tick: the task of the
+ * current switch point runs, or once its job has completed the ready job of
+ * the earliest deadline, if any.
+ *
+ * The table assumes every task releases its first job at the first tick of
+ * the scheduler and then one per period with xTaskDelayUntil(), each job
+ * taking at most its WCET.  Tasks should count their wake times from 0 (or
+ * from xTaskGetTickCount() in main() before the scheduler starts) rather than
+ * from the tick they first run at.  As soon as a task is made ready other
+ * than by the tick releasing its next job (a notification, a resume, a new
+ * task), a job is released at another time than a multiple of the period,
+ * a job runs for more than its WCET or a task is ready at a switch point where
+ * the table runs none, the table is dropped and online EDF schedules the tasks
+ * from then on.
+ *
+ * Returns pdPASS if the table was built.  Returns pdFAIL, and the tasks are
+ * scheduled online, if a task is released by a notification, the hyperperiod
+ * is longer than configEDF_SCHEDULE_TABLE_MAX_HYPERPERIOD ticks, the schedule
+ * has more than configEDF_SCHEDULE_TABLE_SIZE switch points or it misses a
+ * deadline (tasks are created with a WCET of their whole period).
+ */
+BaseType_t xTaskScheduleTableBuild( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns pdTRUE while the tasks are dispatched from the schedule table,
+ * pdFALSE once the scheduler has fallen back to online EDF.
+ */
+BaseType_t xTaskScheduleTableActive( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 )
+
+/*
+ * Let the jobs of xTask (the calling task if NULL) be preempted only by the
+ * tasks of a relative deadline lower than xThreshold, and still only by the
+ * jobs of an earlier deadline.  portMAX_DELAY, the value tasks are created
+ * with, is plain EDF.  The tasks of relative deadline from xThreshold up to
+ * that of xTask wait for the job to complete, which the schedulability of the
+ * task set must allow for, see xTaskAssignPreemptionThresholds().
+ */
+void vTaskSetPreemptionThreshold( TaskHandle_t xTask,
+		TickType_t xThreshold ) PRIVILEGED_FUNCTION;
+
+/* Returns the preemption threshold of xTask, the calling task if NULL. */
+TickType_t xTaskGetPreemptionThreshold( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+/*
+ * Give the tasks created so far the lowest preemption thresholds that keep
+ * the task set schedulable by Baker's stack resource policy test, from their
+ * relative deadlines and WCETs (see vTaskSetWorstCaseExecutionTime()).  Call
+ * after the tasks have been created and given their WCET, before
+ * vTaskStartScheduler().  The thresholds can also be computed offline and
+ * set with vTaskSetPreemptionThreshold().  Returns pdFAIL, leaving the
+ * thresholds unchanged, if there are more than configEDF_THRESHOLD_MAX_TASKS
+ * tasks or the test fails even without thresholds.
+ */
+BaseType_t xTaskAssignPreemptionThresholds( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_EDF_DEFERRED_PREEMPTION == 1 )
+
+/*
+ * Let xTask (the calling task if NULL) defer a preemption by up to xTicks
+ * ticks: a job of an earlier deadline made ready while the task runs waits
+ * until the task calls vTaskPreemptionPoint(), its job completes, or xTicks
+ * ticks have passed, whichever comes first.  0, the value tasks are created
+ * with, is plain EDF.
+ */
+void vTaskSetNonPreemptiveRegion( TaskHandle_t xTask,
+		TickType_t xTicks ) PRIVILEGED_FUNCTION;
+
+/* Returns the longest preemption xTask (the calling task if NULL) defers. */
+TickType_t xTaskGetNonPreemptiveRegion( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+/*
+ * Let a deferred preemption of the calling task happen now.  Call between
+ * the steps of a job that should not be split, for example after each pass
+ * of a hot loop.  Does nothing if no preemption is waiting.
+ */
+void vTaskPreemptionPoint( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Give each task created so far the longest non-preemptive region that keeps
+ * the jobs it holds off schedulable: the least slack t - dbf( t ) over the
+ * deadlines t of the other tasks, released together at 0, earlier than its
+ * relative deadline, capped at its WCET.  Call after the tasks have been
+ * created and given their WCET (see vTaskSetWorstCaseExecutionTime()),
+ * before vTaskStartScheduler().  Returns pdFAIL, leaving the regions
+ * unchanged, if the demand exceeds the time at one of those deadlines.
+ */
+BaseType_t xTaskAssignNonPreemptiveRegions( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_EDF_HIGH_RES_TIME == 1 )
+
+/*
+ * End the current job of the calling task and release the next one at
+ * *pulPreviousWakeTimeUs + ulTimeIncrementUs microseconds, which becomes the
+ * new *pulPreviousWakeTimeUs.  Same as xTaskDelayUntil() to the microsecond:
+ * the task sleeps until the alarm of the timebase rather than the next tick,
+ * and its job is due its relative deadline in microseconds after the wake
+ * time.  Initialise *pulPreviousWakeTimeUs with ulTaskGetTimeUs().  Returns
+ * pdFALSE if the wake time has already passed, the job is then released at
+ * once.
+ */
+BaseType_t xTaskDelayUntilUs( uint32_t * const pulPreviousWakeTimeUs,
+		const uint32_t ulTimeIncrementUs ) PRIVILEGED_FUNCTION;
+
+/*
+ * Set the relative deadline of xTask (the calling task if NULL) in
+ * microseconds, from the next job on.  Tasks are created with their relative
+ * deadline in ticks converted.  Must be below 2^29 us (about 9 minutes).
+ */
+void vTaskSetRelativeDeadlineUs( TaskHandle_t xTask,
+		uint32_t ulDeadlineUs ) PRIVILEGED_FUNCTION;
+
+/* Returns the time of the timebase, in microseconds. */
+uint32_t ulTaskGetTimeUs( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Release the tasks whose xTaskDelayUntilUs() wake time has come.  Called by
+ * the interrupt of the alarm set by configEDF_SET_ALARM_US() only.  Returns
+ * pdTRUE if the interrupt must switch context (portYIELD_FROM_ISR()).
+ */
+BaseType_t xTaskHighResAlarmFromISR( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_EDF_TICKLESS_KERNEL == 1 )
+
+/*
+ * Take the place of xTaskIncrementTick() for the one-shot timer event: count
+ * the ticks reported by configEDF_TICKLESS_ELAPSED(), release the jobs due and
+ * program the next event.  Called by the interrupt of the event only.
+ * Returns pdTRUE if the interrupt must switch context (portYIELD_FROM_ISR()).
+ */
+BaseType_t xTaskProcessTimerEvent( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_EDF_SLACK_STEALING == 1 )
+
+/*
+ * Create a slack stealer, a best-effort task (log flushing, self tests...)
+ * that runs ahead of every periodic task for as long as the EDF slack is above
+ * zero, so as early as possible without making any deadline be missed, and
+ * does not run at all while there is no slack.  Slack stealers run in turn in
+ * the order they became ready, and typically block on a queue or a
+ * notification while they have nothing to do.  They must not call
+ * xTaskDelayUntil().
+ */
+BaseType_t xTaskCreateSlackStealer( TaskFunction_t pxTaskCode,
+		const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+		const configSTACK_DEPTH_TYPE usStackDepth,
+		void * const pvParameters,
+		TaskHandle_t * const pxCreatedTask ) PRIVILEGED_FUNCTION;
+
+/*
+ * Ticks the periodic tasks can currently be delayed by without missing a
+ * deadline, as last computed by the kernel.
+ */
+TickType_t xTaskGetSlack( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_EDF_SPORADIC == 1 )
+
+/*
+ * Create a sporadic task: its jobs are released by xTaskReleaseSporadic(),
+ * typically from an interrupt, at least xMinInterArrival ticks apart, and each
+ * must complete within xDeadline ticks of its arrival, having run for at most
+ * xWCET ticks.  0 < xWCET <= xDeadline <= xMinInterArrival.
+ *
+ * The task is only created if the density xWCET / xDeadline, added to that of
+ * the sporadic tasks already admitted and of the tasks whose WCET was set with
+ * vTaskSetWorstCaseExecutionTime(), does not exceed 1, the sufficient EDF
+ * test for constrained deadlines.  Returns pdFAIL otherwise.
+ *
+ * Like every task it starts with a job, it then calls
+ * xTaskWaitSporadicRelease() for each next one.  It must not use the
+ * notification at configEDF_SPORADIC_NOTIFY_INDEX for anything else.
+ */
+BaseType_t xTaskSporadicCreate( TaskFunction_t pxTaskCode,
+		const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+		const configSTACK_DEPTH_TYPE usStackDepth,
+		void * const pvParameters,
+		UBaseType_t uxPriority,
+		TaskHandle_t * const pxCreatedTask,
+		TickType_t xMinInterArrival,
+		TickType_t xDeadline,
+		TickType_t xWCET ) PRIVILEGED_FUNCTION;
+
+/*
+ * Signal an arrival of xTask.  If at least the minimum inter-arrival time
+ * passed since the last job was released a job is released now, with its
+ * deadline counted from now, and pdPASS is returned.  Otherwise the arrival
+ * is counted as early and deferred: the tick releases it as soon as the
+ * minimum inter-arrival time has passed, and pdFAIL is returned.  An arrival
+ * is also deferred while configEDF_SPORADIC_MAX_PENDING jobs are released
+ * and not taken by xTaskWaitSporadicRelease() yet, without counting as early.
+ */
+BaseType_t xTaskReleaseSporadic( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+/*
+ * Same as xTaskReleaseSporadic() from an interrupt.  *pxHigherPriorityTaskWoken
+ * is set to pdTRUE if a context switch should be requested before the
+ * interrupt exits.
+ */
+BaseType_t xTaskReleaseSporadicFromISR( TaskHandle_t xTask,
+		BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/*
+ * Complete the current job of the calling sporadic task and wait up to
+ * xTicksToWait for the next one.  Returns pdPASS if a job was released.
+ */
+BaseType_t xTaskWaitSporadicRelease( TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * Number of arrivals of xTask that came early and had to be deferred since
+ * the task was created.  NULL for the calling task.
+ */
+UBaseType_t uxTaskGetSporadicEarlyArrivals( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Absolute deadline of the current job of xTask, or of the last one if xTask
+ * is blocked, in microseconds if configUSE_EDF_HIGH_RES_TIME is 1.  NULL
+ * returns the deadline of the calling task.  Used to serve the tasks waiting
+ * on a resource earliest deadline first.
+ */
+TickType_t xTaskGetDeadline( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+
+/* uxIndexToWait of vTaskSetReleaseOnNotify() for tasks released by the tick
+ * only, the default. */
+#define tskEDF_NO_RELEASE_ON_NOTIFY    ( ( UBaseType_t ) configTASK_NOTIFICATION_ARRAY_ENTRIES )
+
+/*
+ * Make a notification at index uxIndexToWait release a new job of xTask, with
+ * a deadline of the relative deadline of the task from then, when it unblocks
+ * xTask or when xTask waits for it while it is already pending.  This is how
+ * event driven tasks (interrupts) get a deadline per event instead of keeping
+ * the one of their last periodic release.
+ */
+void vTaskSetReleaseOnNotify( TaskHandle_t xTask,
+		UBaseType_t uxIndexToWait ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+
+/*
+ * Busy wait until the calling task has been in the Running state for xTicks
+ * ticks (or ulMicroseconds us), time spent preempted is not counted.  Used to
+ * simulate a job with a known execution time whatever the compiler or clock.
+ *
+ * Execution time is measured with the run time stats counter, so
+ * configGENERATE_RUN_TIME_STATS must be 1.  The number of counts per tick is
+ * measured by the tick interrupt over the first ticks after the scheduler
+ * starts, unless configRUN_TIME_COUNTS_PER_TICK is defined; calls made before
+ * that spin until the measurement is done.
+ */
+void vTaskBusyWaitExecutionTime( TickType_t xTicks ) PRIVILEGED_FUNCTION;
+void vTaskBusyWaitExecutionTimeUs( uint32_t ulMicroseconds ) PRIVILEGED_FUNCTION;
+
+#endif
 #endif
 
 /**
@@ -1504,7 +2041,11 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) PRIVILEGED_FUNCTION; /*lint !e
  * @endcode
  *
  * NOTE:  This function takes a relatively long time to complete and should be
- * used sparingly.
+ * used sparingly, unless configTASK_NAME_REGISTRY_SIZE is set in
+ * FreeRTOSConfig.h.  The tasks are then kept in a hash table of that many
+ * slots, which must be more than the number of tasks, and the lookup takes
+ * constant time on average without suspending the scheduler.  A deleted task
+ * is then no longer found, even before the idle task frees it.
  *
  * @return The handle of the task that has the human readable name pcNameToQuery.
  * NULL is returned if no matching name is found.  INCLUDE_xTaskGetHandle
@@ -1834,6 +2375,9 @@ UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray,
  * Tasks are reported as blocked ('B'), ready ('R'), deleted ('D') or
  * suspended ('S').
  *
+ * With the EDF scheduler each line also gives the period, the absolute
+ * deadline of the current job, the jobs released and the deadlines missed.
+ *
  * PLEASE NOTE:
  *
  * This function is provided for convenience only, and is used by many of the
@@ -1859,7 +2403,7 @@ UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray,
  * @param pcWriteBuffer A buffer into which the above mentioned details
  * will be written, in ASCII form.  This buffer is assumed to be large
  * enough to contain the generated report.  Approximately 40 bytes per
- * task should be sufficient.
+ * task should be sufficient, 80 with the EDF scheduler.
  *
  * \defgroup vTaskList vTaskList
  * \ingroup TaskUtils
@@ -3019,6 +3563,24 @@ void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
  */
 portDONT_DISCARD void vTaskSwitchContext( void ) PRIVILEGED_FUNCTION;
 
+/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+
+/*
+ * THESE FUNCTIONS MUST NOT BE USED FROM APPLICATION CODE.  THEY IMPLEMENT
+ * taskENTER_CRITICAL_FROM_ISR() AND taskEXIT_CRITICAL_FROM_ISR() WITH MORE THAN
+ * ONE CORE.
+ *
+ * Mask the interrupts of the calling core and take the ISR lock, so the
+ * section also holds off the kernel on the other cores.  The kernel files
+ * must use the task.h macros, not portSET_INTERRUPT_MASK_FROM_ISR().
+ */
+UBaseType_t vTaskEnterCriticalFromISR( void ) PRIVILEGED_FUNCTION;
+void vTaskExitCriticalFromISR( UBaseType_t uxSavedInterruptStatus ) PRIVILEGED_FUNCTION;
+
+#endif
+/* END of special for EDF */
+
 /*
  * THESE FUNCTIONS MUST NOT BE USED FROM APPLICATION CODE.  THEY ARE USED BY
  * THE EVENT BITS MODULE.
@@ -226,4733 +226,10204 @@
 		listINSERT_END( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) ); \
 		tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB )
 #else /*START of special for EDF */
-#define prvAddTaskToReadyList( pxTCB ) /*xGenericListIteam must contain the deadline value */ \
+#define prvAddTaskToReadyList( pxTCB ) /* queued under taskEDF_KEY(), the list item value is the wake time while delayed */ \
+		taskEDF_TABLE_DEVIATION();																				\
+		listSET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ), taskEDF_KEY( pxTCB ) );						\
 		traceMOVED_TASK_TO_READY_STATE( pxTCB );																\
-		vListInsert( &xReadyTasksListEDF, &( ( pxTCB )->xStateListItem ) );										\
+		vListInsert( taskEDF_READY_LIST( pxTCB ), &( ( pxTCB )->xStateListItem ) );								\
 		tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB )
 #endif /* END of special for EDF */
 
-		/*-----------------------------------------------------------*/
-
+		/* START of special for EDF */
 		/*
-		 * Several functions take a TaskHandle_t parameter that can optionally be NULL,
-		 * where NULL is used to indicate that the handle of the currently executing
-		 * task should be used in place of the parameter.  This macro simply checks to
-		 * see if the parameter is NULL and returns a pointer to the appropriate TCB.
+		 * Global EDF on configNUMBER_OF_CORES cores.  All the cores share
+		 * xReadyTasksListEDF, the tasks running are the configNUMBER_OF_CORES
+		 * earliest deadlines of that list.  Every path making a task ready (the
+		 * tick, an event, a notification, a resume, the pending ready list)
+		 * picks the core to preempt with prvEDFPreemptCoreFor().
+		 *
+		 * The ready lists, the delayed lists and the tick count belong to a
+		 * partition, the cores scheduling from them.  Global EDF has a single
+		 * partition with all the cores, partitioned EDF (configUSE_EDF_PARTITIONED)
+		 * one per core, each with its own tick count, pended ticks and delayed
+		 * lists.  The scheduler suspension, the yield pending flag, the critical
+		 * nesting and the pending ready list are per core, the rest of the
+		 * kernel state is shared.  Three kinds of lock,
+		 * all recursive and taken with interrupts masked, guard it:
+		 *  - the lock of a partition guards its ready and delayed lists, its
+		 *    tick count, the state list items and xTaskRunState of its tasks
+		 *    and pxCurrentTCBs[] of its cores.  The tick and the task switch
+		 *    only take this one.
+		 *  - the ISR lock guards the event lists, the pending ready lists, the
+		 *    suspended list and the other state a critical section guards.
+		 *    The event list item of a delayed task only changes list with the
+		 *    ISR lock and the lock of its partition held, so the tick can tell
+		 *    whether it needs the ISR lock from its partition alone.
+		 *  - the task lock is taken by the task level critical sections and
+		 *    held while the scheduler is suspended, so the scheduler is only
+		 *    ever suspended on one core at a time.
+		 * They are taken in that order, the partition locks by increasing index.
+		 * The ticks of a partition are pended while one of its cores has the
+		 * scheduler suspended.
+		 *
+		 * Besides, the port must provide:
+		 *  - portGET_CORE_ID(), the index of the calling core,
+		 *  - portYIELD_CORE( xCoreID ), an interrupt that makes xCoreID call
+		 *    vTaskSwitchContext(),
+		 *  - portGET_TASK_LOCK(), portGET_ISR_LOCK(), portGET_PARTITION_LOCK( x )
+		 *    and their portRELEASE_ counterparts, recursive spin locks,
+		 *  - portSET_INTERRUPT_MASK() and portCLEAR_INTERRUPT_MASK( x ), masking
+		 *    the interrupts of the calling core from a task as well as an ISR,
+		 *  - portENTER_CRITICAL() and portEXIT_CRITICAL() calling
+		 *    vTaskEnterCritical() and vTaskExitCritical(),
+		 * and must call xTaskIncrementTick() from one core of each partition,
+		 * that is from one core with global EDF and from every core with
+		 * partitioned EDF.
 		 */
-#define prvGetTCBFromHandle( pxHandle )    ( ( ( pxHandle ) == NULL ) ? pxCurrentTCB : ( pxHandle ) )
+#if ( configNUMBER_OF_CORES > 1 )
 
-		/* The item value of the event list item is normally used to hold the priority
-		 * of the task to which it belongs (coded to allow it to be held in reverse
-		 * priority order).  However, it is occasionally borrowed for other purposes.  It
-		 * is important its value is not updated due to a task priority change while it is
-		 * being used for another purpose.  The following bit definition is used to inform
-		 * the scheduler that the value should not be changed - in which case it is the
-		 * responsibility of whichever module is using the value to ensure it gets set back
-		 * to its original value when it is released. */
-#if ( configUSE_16_BIT_TICKS == 1 )
-#define taskEVENT_LIST_ITEM_VALUE_IN_USE    0x8000U
-#else
-#define taskEVENT_LIST_ITEM_VALUE_IN_USE    0x80000000UL
+#if ( configUSE_EDF_SCHEDULER != 1 )
+#error "configNUMBER_OF_CORES > 1 is only supported by the EDF scheduler (configUSE_EDF_SCHEDULER == 1)"
 #endif
 
-		/*
-		 * Task control block.  A task control block (TCB) is allocated for each task,
-		 * and stores task state information, including a pointer to the task's context
-		 * (the task's run time environment, including register values)
-		 */
-		typedef struct tskTaskControlBlock       /* The old naming convention is used to prevent breaking kernel aware debuggers. */
-		{
-			volatile StackType_t * pxTopOfStack; /*< Points to the location of the last item placed on the tasks stack.  THIS MUST BE THE FIRST MEMBER OF THE TCB STRUCT. */
+#ifndef portGET_CORE_ID
+#error "portGET_CORE_ID() must be defined by the port when configNUMBER_OF_CORES > 1"
+#endif
 
-#if ( portUSING_MPU_WRAPPERS == 1 )
-			xMPU_SETTINGS xMPUSettings; /*< The MPU settings are defined as part of the port layer.  THIS MUST BE THE SECOND MEMBER OF THE TCB STRUCT. */
+#ifndef portYIELD_CORE
+#error "portYIELD_CORE() must be defined by the port when configNUMBER_OF_CORES > 1"
 #endif
 
-			ListItem_t xStateListItem;                  /*< The list that the state list item of a task is reference from denotes the state of that task (Ready, Blocked, Suspended ). */
-			ListItem_t xEventListItem;                  /*< Used to reference a task from an event list. */
-			UBaseType_t uxPriority;                     /*< The priority of the task.  0 is the lowest priority. */
-			StackType_t * pxStack;                      /*< Points to the start of the stack. */
-			char pcTaskName[ configMAX_TASK_NAME_LEN ]; /*< Descriptive name given to the task when created.  Facilitates debugging only. */ /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+#if !defined( portGET_TASK_LOCK ) || !defined( portRELEASE_TASK_LOCK ) || !defined( portGET_ISR_LOCK ) || !defined( portRELEASE_ISR_LOCK )
+#error "portGET_TASK_LOCK(), portRELEASE_TASK_LOCK(), portGET_ISR_LOCK() and portRELEASE_ISR_LOCK() must be defined by the port when configNUMBER_OF_CORES > 1"
+#endif
 
-			/* START of special for EDF */
-			/* E.C. : the period of a task */
-#if ( configUSE_EDF_SCHEDULER == 1 )
-			TickType_t xTaskPeriod; /*< Stores the period in tick of the task. > */
+#if !defined( portGET_PARTITION_LOCK ) || !defined( portRELEASE_PARTITION_LOCK )
+#error "portGET_PARTITION_LOCK() and portRELEASE_PARTITION_LOCK() must be defined by the port when configNUMBER_OF_CORES > 1"
 #endif
-			/* END of special for EDF */
 
-#if ( ( portSTACK_GROWTH > 0 ) || ( configRECORD_STACK_HIGH_ADDRESS == 1 ) )
-			StackType_t * pxEndOfStack; /*< Points to the highest valid address for the stack. */
+#if !defined( portSET_INTERRUPT_MASK ) || !defined( portCLEAR_INTERRUPT_MASK )
+#error "portSET_INTERRUPT_MASK() and portCLEAR_INTERRUPT_MASK() must be defined by the port when configNUMBER_OF_CORES > 1"
 #endif
 
 #if ( portCRITICAL_NESTING_IN_TCB == 1 )
-			UBaseType_t uxCriticalNesting; /*< Holds the critical section nesting depth for ports that do not maintain their own count in the port layer. */
+#error "The critical nesting is kept per core when configNUMBER_OF_CORES > 1, portCRITICAL_NESTING_IN_TCB must be 0"
 #endif
 
-#if ( configUSE_TRACE_FACILITY == 1 )
-			UBaseType_t uxTCBNumber;  /*< Stores a number that increments each time a TCB is created.  It allows debuggers to determine when a task has been deleted and then recreated. */
-			UBaseType_t uxTaskNumber; /*< Stores a number specifically for use by third party trace code. */
+#if ( configUSE_TICKLESS_IDLE != 0 )
+#error "configUSE_TICKLESS_IDLE only supports one core"
 #endif
 
-#if ( configUSE_MUTEXES == 1 )
-			UBaseType_t uxBasePriority; /*< The priority last assigned to the task - used by the priority inheritance mechanism. */
-			UBaseType_t uxMutexesHeld;
-#endif
+		/* xTaskRunState of a task that no core is running. */
+#define taskTASK_NOT_RUNNING    ( ( BaseType_t ) -1 )
 
-#if ( configUSE_APPLICATION_TASK_TAG == 1 )
-			TaskHookFunction_t pxTaskTag;
+#if ( ( configUSE_EDF_SEMI_PARTITIONED == 1 ) && ( configUSE_EDF_PARTITIONED != 1 ) )
+#error "configUSE_EDF_SEMI_PARTITIONED needs configUSE_EDF_PARTITIONED set to 1"
 #endif
 
-#if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS > 0 )
-			void * pvThreadLocalStoragePointers[ configNUM_THREAD_LOCAL_STORAGE_POINTERS ];
-#endif
+		/* xTaskSplitCore of a task that is not split. */
+#define taskTASK_NOT_SPLIT      ( ( BaseType_t ) -1 )
 
-#if ( configGENERATE_RUN_TIME_STATS == 1 )
-			configRUN_TIME_COUNTER_TYPE ulRunTimeCounter; /*< Stores the amount of time the task has spent in the Running state. */
+		/* The partitions, the one of a core, of the calling core and of a task.
+		 * Partitioned EDF has one partition per core. */
+#if ( configUSE_EDF_PARTITIONED == 1 )
+#define taskEDF_PARTITIONS                  ( ( BaseType_t ) configNUMBER_OF_CORES )
+#define taskEDF_CORE_PARTITION( xCoreID )   ( xCoreID )
+#define taskEDF_TASK_PARTITION( pxTCB )     ( ( pxTCB )->xTaskCore )
+#else
+#define taskEDF_PARTITIONS                  ( ( BaseType_t ) 1 )
+#define taskEDF_CORE_PARTITION( xCoreID )   ( ( BaseType_t ) 0 )
+#define taskEDF_TASK_PARTITION( pxTCB )     ( ( BaseType_t ) 0 )
 #endif
+#define taskEDF_PARTITION                   taskEDF_CORE_PARTITION( portGET_CORE_ID() )
 
-#if ( configUSE_NEWLIB_REENTRANT == 1 )
+		/* Locks the partitions pxTCB can be queued in, with interrupts masked. */
+#define taskEDF_LOCK_PARTITIONS_OF( pxTCB )      prvEDFLockPartitionsOf( pxTCB )
+#define taskEDF_UNLOCK_PARTITIONS_OF( pxTCB )    prvEDFUnlockPartitionsOf( pxTCB )
 
-			/* Allocate a Newlib reent structure that is specific to this task.
-			 * Note Newlib support has been included by popular demand, but is not
-			 * used by the FreeRTOS maintainers themselves.  FreeRTOS is not
-			 * responsible for resulting newlib operation.  User must be familiar with
-			 * newlib and must provide system-wide implementations of the necessary
-			 * stubs. Be warned that (at the time of writing) the current newlib design
-			 * implements a system-wide malloc() that must be provided with locks.
-			 *
-			 * See the third party link http://www.nadler.com/embedded/newlibAndFreeRTOS.html
-			 * for additional information. */
-			struct  _reent xNewLib_reent;
-#endif
+#else
 
-#if ( configUSE_TASK_NOTIFICATIONS == 1 )
-			volatile uint32_t ulNotifiedValue[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
-			volatile uint8_t ucNotifyState[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
+#define taskEDF_LOCK_PARTITIONS_OF( pxTCB )
+#define taskEDF_UNLOCK_PARTITIONS_OF( pxTCB )
+
+#endif /* configNUMBER_OF_CORES */
+
+		/* Tick count and delayed lists of the partition pxTCB is queued in,
+		 * which may not be the one of the calling core. */
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_EDF_PARTITIONED == 1 ) )
+#define taskEDF_TASK_TICK_COUNT( pxTCB )                 ( xTickCounts[ taskEDF_TASK_PARTITION( pxTCB ) ] )
+#define taskEDF_TASK_DELAYED_LIST( pxTCB )               ( pxDelayedTaskLists[ taskEDF_TASK_PARTITION( pxTCB ) ] )
+#define taskEDF_TASK_OVERFLOW_DELAYED_LIST( pxTCB )      ( pxOverflowDelayedTaskLists[ taskEDF_TASK_PARTITION( pxTCB ) ] )
+#else
+#define taskEDF_TASK_TICK_COUNT( pxTCB )                 ( xTickCount )
+#define taskEDF_TASK_DELAYED_LIST( pxTCB )               ( pxDelayedTaskList )
+#define taskEDF_TASK_OVERFLOW_DELAYED_LIST( pxTCB )      ( pxOverflowDelayedTaskList )
 #endif
 
-			/* See the comments in FreeRTOS.h with the definition of
-			 * tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE. */
-#if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e731 !e9029 Macro has been consolidated for readability reasons. */
-			uint8_t ucStaticallyAllocated;                     /*< Set to pdTRUE if the task is a statically allocated to ensure no attempt is made to free the memory. */
+		/*
+		 * Cycle-conserving EDF (Pillai and Shin, 2001).  A released job reserves
+		 * its WCET over the period of its task, a completed job only the work it
+		 * actually did, and the processor runs at the sum of the reservations:
+		 * configEDF_DVFS_SET_SPEED( ulUtilisation ) is called with that sum (16.16
+		 * fixed point, at most tskEDF_SPEED_FULL) whenever it changes, from the
+		 * tick interrupt or a critical section, and returns the speed actually
+		 * set, at least ulUtilisation.  The work of a job is its run time scaled
+		 * by the speed, so the run time counter must count at a constant rate
+		 * whatever the processor frequency.
+		 */
+#if ( configUSE_EDF_DVFS == 1 )
+
+#if ( ( configUSE_EDF_SCHEDULER != 1 ) || ( configGENERATE_RUN_TIME_STATS != 1 ) )
+#error "configUSE_EDF_DVFS needs configUSE_EDF_SCHEDULER and configGENERATE_RUN_TIME_STATS set to 1"
 #endif
 
-#if ( INCLUDE_xTaskAbortDelay == 1 )
-			uint8_t ucDelayAborted;
+#if ( configNUMBER_OF_CORES > 1 )
+#error "configUSE_EDF_DVFS only supports one core"
 #endif
 
-#if ( configUSE_POSIX_ERRNO == 1 )
-			int iTaskErrno;
+#ifndef configEDF_DVFS_SET_SPEED
+#error "configEDF_DVFS_SET_SPEED() must be defined when configUSE_EDF_DVFS is 1"
 #endif
-		} tskTCB;
 
-		/* The old tskTCB name is maintained above then typedefed to the new TCB_t name
-		 * below to enable the use of older kernel aware debuggers. */
-		typedef tskTCB TCB_t;
+#endif /* configUSE_EDF_DVFS */
 
-		/*lint -save -e956 A manual analysis and inspection has been used to determine
-		 * which static variables must be declared volatile. */
-		PRIVILEGED_DATA TCB_t * volatile pxCurrentTCB = NULL;
+		/* The WCET of the tasks is known to the kernel. */
+#define taskEDF_USE_WCET    ( ( configUSE_EDF_DVFS == 1 ) || ( configUSE_EDF_SLACK_STEALING == 1 ) || ( configUSE_EDF_SPORADIC == 1 ) || ( configUSE_EDF_SCHEDULE_TABLE == 1 ) || ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 ) || ( configUSE_EDF_DEFERRED_PREEMPTION == 1 ) )
 
-		/* Lists for ready and blocked tasks. --------------------
-		 * xDelayedTaskList1 and xDelayedTaskList2 could be moved to function scope but
-		 * doing so breaks some kernel aware debuggers and debuggers that rely on removing
-		 * the static qualifier. */
-		PRIVILEGED_DATA static List_t pxReadyTasksLists[ configMAX_PRIORITIES ]; /*< Prioritised ready tasks. */
-		PRIVILEGED_DATA static List_t xDelayedTaskList1;                         /*< Delayed tasks. */
-		PRIVILEGED_DATA static List_t xDelayedTaskList2;                         /*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
-		PRIVILEGED_DATA static List_t * volatile pxDelayedTaskList;              /*< Points to the delayed task list currently being used. */
-		PRIVILEGED_DATA static List_t * volatile pxOverflowDelayedTaskList;      /*< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
-		PRIVILEGED_DATA static List_t xPendingReadyList;                         /*< Tasks that have been readied while the scheduler was suspended.  They will be moved to the ready list when the scheduler is resumed. */
+		/*
+		 * Sporadic tasks.  A sporadic task is a periodic task whose xTaskPeriod
+		 * is the minimum inter-arrival time and whose jobs are released by the
+		 * notification at configEDF_SPORADIC_NOTIFY_INDEX instead of a delay.
+		 * An arrival less than xTaskPeriod after the last release is deferred:
+		 * the tick releases it once xTaskPeriod has passed.  The deadline of a
+		 * job is counted from its release, kept until the task takes the job.
+		 * Tasks are admitted while the sum of the densities WCET / relative
+		 * deadline of all the tasks, periodic ones included, stays at most 1.
+		 * A task is counted from its creation, with a WCET of its whole period
+		 * until vTaskSetWorstCaseExecutionTime() sets it; the idle task and the
+		 * slack stealers only take the time left over and are not counted.
+		 */
+#if ( configUSE_EDF_SPORADIC == 1 )
 
-		/* START of special for EDF */
-		/* E.C. : the new RedyList */
-#if ( configUSE_EDF_SCHEDULER == 1 )
+#if ( ( configUSE_EDF_SCHEDULER != 1 ) || ( configUSE_TASK_NOTIFICATIONS != 1 ) )
+#error "configUSE_EDF_SPORADIC needs configUSE_EDF_SCHEDULER and configUSE_TASK_NOTIFICATIONS set to 1"
+#endif
 
-		PRIVILEGED_DATA static List_t xReadyTasksListEDF; /*< Ready tasks ordered by their deadline. */
-		PRIVILEGED_DATA static TickType_t volatile xIDLEPeriod =0;
+		/* Sporadic tasks the tick can release deferred arrivals of. */
+#ifndef configEDF_SPORADIC_MAX_TASKS
+#define configEDF_SPORADIC_MAX_TASKS    8
+#endif
 
+		/* Jobs of a sporadic task released and not taken yet whose release
+		 * times are kept.  Further arrivals stay deferred until the task takes
+		 * one. */
+#ifndef configEDF_SPORADIC_MAX_PENDING
+#define configEDF_SPORADIC_MAX_PENDING    4
 #endif
-		/* END of special for EDF */
 
-#if ( INCLUDE_vTaskDelete == 1 )
+		/* A density of 1, 16.16.  The density of a task is kept at most
+		 * taskEDF_DENSITY_OVER, which fails the admission on its own, so the
+		 * sum of the densities does not overflow. */
+#define taskEDF_DENSITY_FULL    ( ( uint32_t ) 0x10000UL )
+#define taskEDF_DENSITY_OVER    ( taskEDF_DENSITY_FULL + 1UL )
 
-		PRIVILEGED_DATA static List_t xTasksWaitingTermination; /*< Tasks that have been deleted - but their memory not yet freed. */
-		PRIVILEGED_DATA static volatile UBaseType_t uxDeletedTasksWaitingCleanUp = ( UBaseType_t ) 0U;
+#endif /* configUSE_EDF_SPORADIC */
 
+		/*
+		 * Name registry.  An open addressing table of configTASK_NAME_REGISTRY_SIZE
+		 * slots maps the names to the tasks.  A task is in the first free slot
+		 * from the one picked by the FNV-1a hash of its name, so xTaskGetHandle()
+		 * compares the name with a few tasks instead of searching every task
+		 * list.  The size must be larger than the number of tasks, and a third
+		 * more keeps the probe sequences short.  0 keeps the search.
+		 *
+		 * Slots are filled by prvInitialiseNewTask() and emptied by vTaskDelete()
+		 * in critical sections that make uxTaskNameRegistrySeq odd while they
+		 * change the table.  A lookup neither suspends the scheduler nor masks
+		 * interrupts: it repeats itself if the sequence was odd or changed
+		 * meanwhile.  A deleted slot holds taskNAME_SLOT_DELETED rather than
+		 * NULL, as it may be in the middle of the probe sequence of another name.
+		 */
+#ifndef configTASK_NAME_REGISTRY_SIZE
+#define configTASK_NAME_REGISTRY_SIZE    0
 #endif
 
-#if ( INCLUDE_vTaskSuspend == 1 )
+#define taskUSE_NAME_REGISTRY    ( ( INCLUDE_xTaskGetHandle == 1 ) && ( configTASK_NAME_REGISTRY_SIZE > 0 ) )
 
-		PRIVILEGED_DATA static List_t xSuspendedTaskList; /*< Tasks that are currently suspended. */
+#if ( taskUSE_NAME_REGISTRY == 1 )
 
-#endif
+#define taskNAME_SLOT_DELETED    ( ( TCB_t * ) &( ucTaskNameSlotDeleted ) )
 
-		/* Global POSIX errno. Its value is changed upon context switching to match
-		 * the errno of the currently running task. */
-#if ( configUSE_POSIX_ERRNO == 1 )
-		int FreeRTOS_errno = 0;
+		/* Orders the table accesses and the sequence accesses.  On one core
+		 * only the compiler has to be stopped from reordering them. */
+#if defined( __GNUC__ ) && ( configNUMBER_OF_CORES > 1 )
+#define taskNAME_REGISTRY_BARRIER()    __sync_synchronize()
+#elif defined( __GNUC__ )
+#define taskNAME_REGISTRY_BARRIER()    __asm volatile ( "" ::: "memory" )
+#else
+#define taskNAME_REGISTRY_BARRIER()    portMEMORY_BARRIER()
 #endif
 
-		/* Other file private variables. --------------------------------*/
-		PRIVILEGED_DATA static volatile UBaseType_t uxCurrentNumberOfTasks = ( UBaseType_t ) 0U;
-		PRIVILEGED_DATA static volatile TickType_t xTickCount = ( TickType_t ) configINITIAL_TICK_COUNT;
-		PRIVILEGED_DATA static volatile UBaseType_t uxTopReadyPriority = tskIDLE_PRIORITY;
-		PRIVILEGED_DATA static volatile BaseType_t xSchedulerRunning = pdFALSE;
-		PRIVILEGED_DATA static volatile TickType_t xPendedTicks = ( TickType_t ) 0U;
-		PRIVILEGED_DATA static volatile BaseType_t xYieldPending = pdFALSE;
-		PRIVILEGED_DATA static volatile BaseType_t xNumOfOverflows = ( BaseType_t ) 0;
-		PRIVILEGED_DATA static UBaseType_t uxTaskNumber = ( UBaseType_t ) 0U;
-		PRIVILEGED_DATA static volatile TickType_t xNextTaskUnblockTime = ( TickType_t ) 0U; /* Initialised to portMAX_DELAY before the scheduler starts. */
-		PRIVILEGED_DATA static TaskHandle_t xIdleTaskHandle = NULL;                          /*< Holds the handle of the idle task.  The idle task is created automatically when the scheduler is started. */
+#endif /* taskUSE_NAME_REGISTRY */
 
-		/* Improve support for OpenOCD. The kernel tracks Ready tasks via priority lists.
-		 * For tracking the state of remote threads, OpenOCD uses uxTopUsedPriority
-		 * to determine the number of priority lists to read back from the remote target. */
-		const volatile UBaseType_t uxTopUsedPriority = configMAX_PRIORITIES - 1U;
+		/*
+		 * Timing wheel.  The delayed tasks are kept in a hierarchical timing
+		 * wheel instead of the two delayed lists ordered by wake time, so
+		 * delaying a task is a constant time insert.  Level L of the wheel has
+		 * taskWHEEL_SLOTS unsorted lists, the slot of a task being bits
+		 * L * configEDF_WHEEL_SLOT_BITS and up of its wake time.  A task goes to
+		 * the lowest level whose slots span its delay, or to the far list if
+		 * the wheel does not span it.
+		 *
+		 * When the tick count crosses the start of a slot of level L the tasks
+		 * of that slot are moved down to the levels below, from the top level
+		 * down, and the far list is looked at each time the whole wheel has
+		 * turned.  The level 0 slot of the tick then holds exactly the tasks
+		 * waking at this tick.  A task is moved down at most once per level,
+		 * so a tick costs O(1) amortised.  The wake times are compared modulo
+		 * the tick range, so the tick overflow needs no list switch.
+		 *
+		 * Every tick has to be processed one by one, which rules out tickless
+		 * idle.
+		 */
+#if ( configUSE_EDF_TIMING_WHEEL == 1 )
 
-		/* Context switches are held pending while the scheduler is suspended.  Also,
-		 * interrupts must not manipulate the xStateListItem of a TCB, or any of the
-		 * lists the xStateListItem can be referenced from, if the scheduler is suspended.
-		 * If an interrupt needs to unblock a task while the scheduler is suspended then it
-		 * moves the task's event list item into the xPendingReadyList, ready for the
-		 * kernel to move the task from the pending ready list into the real ready list
-		 * when the scheduler is unsuspended.  The pending ready list itself can only be
-		 * accessed from a critical section. */
-		PRIVILEGED_DATA static volatile UBaseType_t uxSchedulerSuspended = ( UBaseType_t ) pdFALSE;
+#if ( configUSE_TICKLESS_IDLE != 0 )
+#error "The timing wheel needs every tick, configUSE_TICKLESS_IDLE must be 0"
+#endif
 
-#if ( configGENERATE_RUN_TIME_STATS == 1 )
+#if ( configNUMBER_OF_CORES > 1 )
+#error "configUSE_EDF_TIMING_WHEEL only supports one core"
+#endif
 
-		/* Do not move these variables to function scope as doing so prevents the
-		 * code working with debuggers that need to remove the static qualifier. */
-		PRIVILEGED_DATA static configRUN_TIME_COUNTER_TYPE ulTaskSwitchedInTime = 0UL;    /*< Holds the value of a timer/counter the last time a task was switched in. */
-		PRIVILEGED_DATA static volatile configRUN_TIME_COUNTER_TYPE ulTotalRunTime = 0UL; /*< Holds the total amount of execution time as defined by the run time counter clock. */
+#ifndef configEDF_WHEEL_SLOT_BITS
+#define configEDF_WHEEL_SLOT_BITS    4
+#endif
 
+#ifndef configEDF_WHEEL_LEVELS
+#define configEDF_WHEEL_LEVELS       3
 #endif
 
-		/*lint -restore */
+#define taskWHEEL_SPAN_BITS    ( configEDF_WHEEL_SLOT_BITS * configEDF_WHEEL_LEVELS )
 
-		/*-----------------------------------------------------------*/
+#if ( ( configUSE_16_BIT_TICKS == 1 ) && ( taskWHEEL_SPAN_BITS >= 16 ) ) || ( taskWHEEL_SPAN_BITS >= 32 )
+#error "The timing wheel spans more than the tick range, lower configEDF_WHEEL_SLOT_BITS or configEDF_WHEEL_LEVELS"
+#endif
 
-		/* File private functions. --------------------------------*/
+#define taskWHEEL_SLOTS       ( ( UBaseType_t ) 1U << configEDF_WHEEL_SLOT_BITS )
+#define taskWHEEL_MASK        ( ( TickType_t ) taskWHEEL_SLOTS - ( TickType_t ) 1U )
+#define taskWHEEL_FAR_LIST    ( ( UBaseType_t ) configEDF_WHEEL_LEVELS * taskWHEEL_SLOTS )
+#define taskWHEEL_LISTS       ( taskWHEEL_FAR_LIST + ( UBaseType_t ) 1U )
 
-		/**
-		 * Utility task that simply returns pdTRUE if the task referenced by xTask is
-		 * currently in the Suspended state, or pdFALSE if the task referenced by xTask
-		 * is in any other state.
-		 */
-#if ( INCLUDE_vTaskSuspend == 1 )
+		/* Ticks since the start of the current slot of level uxLevel. */
+#define taskWHEEL_LEVEL_OFFSET( xTime, uxLevel )    ( ( xTime ) & ( ( ( TickType_t ) 1U << ( ( uxLevel ) * configEDF_WHEEL_SLOT_BITS ) ) - ( TickType_t ) 1U ) )
 
-		static BaseType_t prvTaskIsTaskSuspended( const TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+		/* The tasks waking at this tick, and whether there are any. */
+#define taskDELAYED_DUE_LIST()               ( &( xWheelLists[ ( UBaseType_t ) ( xTickCount & taskWHEEL_MASK ) ] ) )
+#define taskDELAYED_TASKS_DUE( xConstTickCount )    ( prvWheelAdvance( xConstTickCount ) != pdFALSE )
 
-#endif /* INCLUDE_vTaskSuspend */
+#else /* configUSE_EDF_TIMING_WHEEL */
 
-		/*
-		 * Utility to ready all the lists used by the scheduler.  This is called
-		 * automatically upon the creation of the first task.
-		 */
-		static void prvInitialiseTaskLists( void ) PRIVILEGED_FUNCTION;
+#define taskDELAYED_DUE_LIST()               ( pxDelayedTaskList )
+#define taskDELAYED_TASKS_DUE( xConstTickCount )    ( ( xConstTickCount ) >= xNextTaskUnblockTime )
 
-		/*
-		 * The idle task, which as all tasks is implemented as a never ending loop.
-		 * The idle task is automatically created and added to the ready lists upon
-		 * creation of the first user task.
-		 *
-		 * The portTASK_FUNCTION_PROTO() macro is used to allow port/compiler specific
-		 * language extensions.  The equivalent prototype for this function is:
-		 *
-		 * void prvIdleTask( void *pvParameters );
-		 *
-		 */
-		static portTASK_FUNCTION_PROTO( prvIdleTask, pvParameters ) PRIVILEGED_FUNCTION;
+#endif /* configUSE_EDF_TIMING_WHEEL */
 
 		/*
-		 * Utility to free all memory allocated by the scheduler to hold a TCB,
-		 * including the stack pointed to by the TCB.
-		 *
-		 * This does not free memory allocated by the task itself (i.e. memory
-		 * allocated by calls to pvPortMalloc from within the tasks application code).
+		 * Batched release.  The tasks a tick releases are first sorted by
+		 * deadline in a list of their own, then merged into the ready list in a
+		 * single walk of it, and only the earliest of them is compared with the
+		 * running task.  On a hyperperiod boundary this replaces one sorted
+		 * insert from the head of the ready list and one preemption test per
+		 * task.  With several cores every task released may preempt a different
+		 * core, so they are added one by one.
 		 */
-#if ( INCLUDE_vTaskDelete == 1 )
-
-		static void prvDeleteTCB( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
-
+#ifndef configUSE_EDF_BATCH_RELEASE
+#define configUSE_EDF_BATCH_RELEASE    1
 #endif
 
-		/*
-		 * Used only by the idle task.  This checks to see if anything has been placed
-		 * in the list of tasks waiting to be deleted.  If so the task is cleaned up
-		 * and its TCB deleted.
-		 */
-		static void prvCheckTasksWaitingTermination( void ) PRIVILEGED_FUNCTION;
+#define taskEDF_BATCH_RELEASE    ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_BATCH_RELEASE == 1 ) && ( configNUMBER_OF_CORES == 1 ) )
 
 		/*
-		 * The currently executing task is entering the Blocked state.  Add the task to
-		 * either the current or the overflow delayed task list.
+		 * Schedule table.  xTaskScheduleTableBuild() runs EDF over one
+		 * hyperperiod with every job taking its WCET and records the switch
+		 * points, the ticks from the start of the hyperperiod at which another
+		 * task (or none) runs.  While the table is active the tick releases the
+		 * jobs at the end of the ready list, unsorted, and moves on to the next
+		 * switch point when its tick comes; the task switch runs the task of
+		 * the last switch point if it is ready.  If its job completed before the
+		 * end of the slot, the ready job of the earliest deadline runs in the
+		 * time left, it can only complete earlier than in the table.  Any other
+		 * way of making a task ready, the tick releasing a job at another time
+		 * than a multiple of the period of its task, a job running for more than
+		 * its WCET or a task ready in a slot the table leaves idle is a deviation
+		 * from the table: the ready list is sorted again and EDF takes over for
+		 * good.
 		 */
-		static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
-				const BaseType_t xCanBlockIndefinitely ) PRIVILEGED_FUNCTION;
+#if ( configUSE_EDF_SCHEDULE_TABLE == 1 )
 
-		/*
-		 * Fills an TaskStatus_t structure with information on each task that is
-		 * referenced from the pxList list (which may be a ready list, a delayed list,
-		 * a suspended list, etc.).
-		 *
-		 * THIS FUNCTION IS INTENDED FOR DEBUGGING ONLY, AND SHOULD NOT BE CALLED FROM
-		 * NORMAL APPLICATION CODE.
-		 */
-#if ( configUSE_TRACE_FACILITY == 1 )
+#if ( ( configUSE_EDF_SCHEDULER != 1 ) || ( configUSE_EDF_BATCH_RELEASE != 1 ) || ( configUSE_PREEMPTION != 1 ) )
+#error "configUSE_EDF_SCHEDULE_TABLE needs configUSE_EDF_SCHEDULER, configUSE_EDF_BATCH_RELEASE and configUSE_PREEMPTION set to 1"
+#endif
 
-		static UBaseType_t prvListTasksWithinSingleList( TaskStatus_t * pxTaskStatusArray,
-				List_t * pxList,
-				eTaskState eState ) PRIVILEGED_FUNCTION;
+#if ( configNUMBER_OF_CORES > 1 )
+#error "configUSE_EDF_SCHEDULE_TABLE only supports one core"
+#endif
 
+#if ( ( configUSE_EDF_SLACK_STEALING == 1 ) || ( configUSE_EDF_SPORADIC == 1 ) )
+#error "configUSE_EDF_SCHEDULE_TABLE cannot be used with slack stealers or sporadic tasks"
 #endif
 
-		/*
-		 * Searches pxList for a task with name pcNameToQuery - returning a handle to
-		 * the task if it is found, or NULL if the task is not found.
-		 */
-#if ( INCLUDE_xTaskGetHandle == 1 )
+		/* Switch points the table can hold. */
+#ifndef configEDF_SCHEDULE_TABLE_SIZE
+#define configEDF_SCHEDULE_TABLE_SIZE               64
+#endif
 
-		static TCB_t * prvSearchForNameWithinSingleList( List_t * pxList,
-				const char pcNameToQuery[] ) PRIVILEGED_FUNCTION;
+		/* Tasks the table can be built for. */
+#ifndef configEDF_SCHEDULE_TABLE_MAX_TASKS
+#define configEDF_SCHEDULE_TABLE_MAX_TASKS          8
+#endif
 
+		/* Longest hyperperiod simulated, in ticks. */
+#ifndef configEDF_SCHEDULE_TABLE_MAX_HYPERPERIOD
+#define configEDF_SCHEDULE_TABLE_MAX_HYPERPERIOD    ( ( TickType_t ) 10000 )
 #endif
 
+		/* No task runs, in the simulation of the schedule. */
+#define taskEDF_TABLE_IDLE    ( ( UBaseType_t ) configEDF_SCHEDULE_TABLE_MAX_TASKS )
+
+		/* Called before a task is added to the ready list other than by the tick
+		 * releasing its job. */
+#define taskEDF_TABLE_DEVIATION()      \
+		if( xEDFTableActive != pdFALSE ) \
+		{                                \
+			prvEDFTableStop();           \
+		}
+
+#else
+
+#define taskEDF_TABLE_DEVIATION()
+
+#endif /* configUSE_EDF_SCHEDULE_TABLE */
+
 		/*
-		 * When a task is created, the stack of the task is filled with a known value.
-		 * This function determines the 'high water mark' of the task stack by
-		 * determining how much of the stack remains at the original preset value.
+		 * Preemption thresholds.  A job released while another runs preempts it
+		 * if its deadline is not later and, in addition, the relative deadline
+		 * of its task is lower than the threshold of the running task, so a task
+		 * is not preempted by the tasks of relative deadline between its
+		 * threshold and its own.  The threshold of a task is portMAX_DELAY, plain
+		 * EDF, until set.  xTaskAssignPreemptionThresholds() lowers each one as
+		 * far as Baker's stack resource policy test for EDF allows: for every
+		 * task k, by increasing relative deadline D,
+		 *   sum over the tasks i with Di <= Dk of Ci / Di  +  Bk / Dk  <=  1
+		 * where Bk is the longest WCET of the tasks of later relative deadline
+		 * whose threshold keeps k from preempting them.
 		 */
-#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) )
+#if ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 )
 
-		static configSTACK_DEPTH_TYPE prvTaskCheckFreeStackSpace( const uint8_t * pucStackByte ) PRIVILEGED_FUNCTION;
+#if ( configUSE_EDF_SCHEDULER != 1 )
+#error "configUSE_EDF_PREEMPTION_THRESHOLD needs configUSE_EDF_SCHEDULER set to 1"
+#endif
 
+#if ( configNUMBER_OF_CORES > 1 )
+#error "configUSE_EDF_PREEMPTION_THRESHOLD only supports one core"
 #endif
 
-		/*
-		 * Return the amount of time, in ticks, that will pass before the kernel will
-		 * next move a task from the Blocked state to the Running state.
-		 *
-		 * This conditional compilation should use inequality to 0, not equality to 1.
-		 * This is to ensure portSUPPRESS_TICKS_AND_SLEEP() can be called when user
-		 * defined low power mode implementations require configUSE_TICKLESS_IDLE to be
-		 * set to a value other than 1.
-		 */
-#if ( configUSE_TICKLESS_IDLE != 0 )
-
-		static TickType_t prvGetExpectedIdleTime( void ) PRIVILEGED_FUNCTION;
-
+		/* Tasks xTaskAssignPreemptionThresholds() can handle. */
+#ifndef configEDF_THRESHOLD_MAX_TASKS
+#define configEDF_THRESHOLD_MAX_TASKS    16
 #endif
 
-		/*
-		 * Set xNextTaskUnblockTime to the time at which the next Blocked state task
-		 * will exit the Blocked state.
-		 */
-		static void prvResetNextTaskUnblockTime( void ) PRIVILEGED_FUNCTION;
+		/* A density of 1, 16.16. */
+#define taskEDF_THRESHOLD_FULL    ( ( uint32_t ) 0x10000UL )
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
+#endif /* configUSE_EDF_PREEMPTION_THRESHOLD */
 
 		/*
-		 * Helper function used to pad task names with spaces when printing out
-		 * human readable tables of task information.
+		 * Deferred preemption, floating non-preemptive regions.  A preemption
+		 * of a task with xTaskNonPreemptiveTicks Q above 0 does not happen
+		 * straight away: it opens a region of up to Q ticks in which the task
+		 * goes on running, closed by the tick Q ticks later, by the task calling
+		 * vTaskPreemptionPoint(), or by the job completing.  The task switch at
+		 * the end of the region picks the earliest deadline as usual.  Q bounds
+		 * the time the task can hold off a job of an earlier deadline, which
+		 * xTaskAssignNonPreemptiveRegions() keeps below the least slack
+		 *   t - dbf( t )
+		 * over the absolute deadlines t earlier than the relative deadline of
+		 * the task, dbf( t ) being the demand of the jobs due by t.
 		 */
-		static char * prvWriteNameToBuffer( char * pcBuffer,
-				const char * pcTaskName ) PRIVILEGED_FUNCTION;
+#if ( configUSE_EDF_DEFERRED_PREEMPTION == 1 )
 
+#if ( configUSE_EDF_SCHEDULER != 1 )
+#error "configUSE_EDF_DEFERRED_PREEMPTION needs configUSE_EDF_SCHEDULER set to 1"
 #endif
 
-		/*
-		 * Called after a Task_t structure has been allocated either statically or
-		 * dynamically to fill in the structure's members.
-		 */
-		static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
-				const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
-				const uint32_t ulStackDepth,
-				void * const pvParameters,
-				UBaseType_t uxPriority,
-				TaskHandle_t * const pxCreatedTask,
-				TCB_t * pxNewTCB,
-				const MemoryRegion_t * const xRegions ) PRIVILEGED_FUNCTION;
+#if ( configNUMBER_OF_CORES > 1 )
+#error "configUSE_EDF_DEFERRED_PREEMPTION only supports one core"
+#endif
 
-		/*
-		 * Called after a new task has been created and initialised to place the task
-		 * under the control of the scheduler.
-		 */
-		static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
+#endif /* configUSE_EDF_DEFERRED_PREEMPTION */
 
 		/*
-		 * freertos_tasks_c_additions_init() should only be called if the user definable
-		 * macro FREERTOS_TASKS_C_ADDITIONS_INIT() is defined, as that is the only macro
-		 * called by the function.
+		 * Microsecond deadlines.  xTaskAbsoluteDeadline of every task is in
+		 * microseconds of configEDF_TIME_US(), a free-running 32 bit counter,
+		 * and so is the key of the ready list.  A job released by the tick is
+		 * due xTaskRelativeDeadlineUs after the tick, one released by the
+		 * alarm of xTaskDelayUntilUs() that long after its wake time.  The tasks
+		 * waiting in xTaskDelayUntilUs() are kept in xEDFTimerList by wake
+		 * time, and configEDF_SET_ALARM_US() is given the earliest one each
+		 * time it changes.
+		 *
+		 * Keys and wake times are counted from xEDFEpochUs, so they keep their
+		 * order when the counter wraps (every 71 minutes): once the counter is
+		 * taskEDF_EPOCH_REBASE past the epoch, the tick moves the epoch to
+		 * taskEDF_EPOCH_LAG behind the counter and lowers the values of the two
+		 * lists by as much.  Deadlines before the epoch all count as 0.  The
+		 * relative deadlines and periods must be below taskEDF_EPOCH_LAG, so
+		 * no key or wake time gets past taskEDF_TIME_BEFORE.
 		 */
-#ifdef FREERTOS_TASKS_C_ADDITIONS_INIT
+#if ( configUSE_EDF_HIGH_RES_TIME == 1 )
 
-		static void freertos_tasks_c_additions_init( void ) PRIVILEGED_FUNCTION;
+#if ( ( configUSE_EDF_SCHEDULER != 1 ) || ( configUSE_16_BIT_TICKS != 0 ) )
+#error "configUSE_EDF_HIGH_RES_TIME needs configUSE_EDF_SCHEDULER set to 1 and 32 bit ticks"
+#endif
 
+#if ( configNUMBER_OF_CORES > 1 )
+#error "configUSE_EDF_HIGH_RES_TIME only supports one core"
 #endif
 
-		/*-----------------------------------------------------------*/
+#if ( ( configUSE_EDF_SLACK_STEALING == 1 ) || ( configUSE_EDF_SPORADIC == 1 ) || ( configUSE_EDF_SCHEDULE_TABLE == 1 ) || ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 ) )
+#error "configUSE_EDF_HIGH_RES_TIME cannot be used with slack stealers, sporadic tasks, the schedule table or preemption thresholds, which count deadlines in ticks"
+#endif
 
-#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+#if !defined( configEDF_TIME_US ) || !defined( configEDF_SET_ALARM_US )
+#error "configEDF_TIME_US() and configEDF_SET_ALARM_US() must be defined when configUSE_EDF_HIGH_RES_TIME is 1"
+#endif
 
-		TaskHandle_t xTaskCreateStatic( TaskFunction_t pxTaskCode,
-				const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
-				const uint32_t ulStackDepth,
-				void * const pvParameters,
-				UBaseType_t uxPriority,
-				StackType_t * const puxStackBuffer,
-				StaticTask_t * const pxTaskBuffer )
-		{
-			TCB_t * pxNewTCB;
-			TaskHandle_t xReturn;
+#define taskEDF_US_PER_TICK        ( ( TickType_t ) ( 1000000UL / ( uint32_t ) configTICK_RATE_HZ ) )
+#define taskEDF_EPOCH_LAG          ( ( TickType_t ) 0x20000000UL )
+#define taskEDF_EPOCH_REBASE       ( ( TickType_t ) 0x40000000UL )
+#define taskEDF_TIME_BEFORE        ( ( TickType_t ) 0x80000000UL ) /* Differences from here on are negative. */
 
-			configASSERT( puxStackBuffer != NULL );
-			configASSERT( pxTaskBuffer != NULL );
+#define taskEDF_NOW()              ( ( TickType_t ) configEDF_TIME_US() )
+#define taskEDF_RELEASE_DEADLINE( pxTCB, xReleaseTime )    ( ( void ) ( xReleaseTime ), taskEDF_NOW() + ( pxTCB )->xTaskRelativeDeadlineUs )
+#define taskEDF_DEADLINE_AFTER( xTicks )                   ( taskEDF_NOW() + ( ( xTicks ) * taskEDF_US_PER_TICK ) )
 
-#if ( configASSERT_DEFINED == 1 )
-			{
-				/* Sanity check that the size of the structure used to declare a
-				 * variable of type StaticTask_t equals the size of the real task
-				 * structure. */
-				volatile size_t xSize = sizeof( StaticTask_t );
-				configASSERT( xSize == sizeof( TCB_t ) );
-				( void ) xSize; /* Prevent lint warning when configASSERT() is not used. */
-			}
-#endif /* configASSERT_DEFINED */
+#else
 
-			if( ( pxTaskBuffer != NULL ) && ( puxStackBuffer != NULL ) )
-			{
-				/* The memory used for the task's TCB and stack are passed into this
-				 * function - use them. */
-				pxNewTCB = ( TCB_t * ) pxTaskBuffer; /*lint !e740 !e9087 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked by an assert. */
-				pxNewTCB->pxStack = ( StackType_t * ) puxStackBuffer;
+#define taskEDF_NOW()              ( xTickCount )
+#define taskEDF_RELEASE_DEADLINE( pxTCB, xReleaseTime )    ( ( xReleaseTime ) + ( pxTCB )->xTaskRelativeDeadline )
+#define taskEDF_DEADLINE_AFTER( xTicks )                   ( xTickCount + ( xTicks ) )
 
-#if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e731 !e9029 Macro has been consolidated for readability reasons. */
-				{
-					/* Tasks can be created statically or dynamically, so note this
-					 * task was created statically in case the task is later deleted. */
-					pxNewTCB->ucStaticallyAllocated = tskSTATICALLY_ALLOCATED_STACK_AND_TCB;
-				}
-#endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
+#endif /* configUSE_EDF_HIGH_RES_TIME */
 
-				prvInitialiseNewTask( pxTaskCode, pcName, ulStackDepth, pvParameters, uxPriority, &xReturn, pxNewTCB, NULL );
-				prvAddNewTaskToReadyList( pxNewTCB );
-			}
-			else
-			{
-				xReturn = NULL;
-			}
+		/*
+		 * Tickless kernel.  The port's periodic tick is replaced after its first
+		 * interrupt by a one-shot timer event, programmed for the next tick at
+		 * which the kernel has something to do: the earliest release
+		 * (xNextTaskUnblockTime) or the end of a non-preemptive region.  With
+		 * nothing to release the event is as far as the timer allows.  The
+		 * event calls xTaskProcessTimerEvent(), which moves xTickCount over the
+		 * ticks that passed in one jump up to the tick before the next release
+		 * and hands the remaining ones to xTaskIncrementTick(), so an event
+		 * costs the same whatever the time since the last one.  A deadline needs
+		 * no event: misses are counted when the job completes.
+		 *
+		 * Between events xTickCount lags behind the time.  The functions that
+		 * read it on behalf of a task (xTaskGetTickCount(), vTaskSuspendAll(),
+		 * the time outs and prvAddCurrentTaskToDelayedList() for every block)
+		 * first bring it up to date, and if that releases a job that preempts
+		 * the running task they request an immediate event to switch to it.
+		 * The ticks that pass while the scheduler is suspended are pended, so
+		 * the tick count does not move under a suspended caller.
+		 *
+		 * The timer is the application's, through configEDF_TICKLESS_START(),
+		 * configEDF_TICKLESS_ELAPSED() (whole ticks since the last call, or the
+		 * start) and configEDF_TICKLESS_SET_EVENT() (one-shot event that many
+		 * ticks after the time of the last call, at once if already passed).
+		 */
+#if ( configUSE_EDF_TICKLESS_KERNEL == 1 )
 
-			return xReturn;
-		}
+#if ( configUSE_EDF_SCHEDULER != 1 )
+#error "configUSE_EDF_TICKLESS_KERNEL needs configUSE_EDF_SCHEDULER set to 1"
+#endif
 
-#endif /* SUPPORT_STATIC_ALLOCATION */
-		/*-----------------------------------------------------------*/
+#if ( configNUMBER_OF_CORES > 1 )
+#error "configUSE_EDF_TICKLESS_KERNEL only supports one core"
+#endif
 
-#if ( ( portUSING_MPU_WRAPPERS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+#if ( configUSE_TICKLESS_IDLE != 0 )
+#error "configUSE_EDF_TICKLESS_KERNEL has no tick to suppress, configUSE_TICKLESS_IDLE must be 0"
+#endif
 
-		BaseType_t xTaskCreateRestrictedStatic( const TaskParameters_t * const pxTaskDefinition,
-				TaskHandle_t * pxCreatedTask )
-		{
-			TCB_t * pxNewTCB;
-			BaseType_t xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+#if ( configUSE_EDF_TIMING_WHEEL == 1 )
+#error "The timing wheel needs every tick, it cannot be used with configUSE_EDF_TICKLESS_KERNEL"
+#endif
 
-			configASSERT( pxTaskDefinition->puxStackBuffer != NULL );
-			configASSERT( pxTaskDefinition->pxTaskBuffer != NULL );
+#if ( ( configUSE_EDF_SLACK_STEALING == 1 ) || ( configUSE_EDF_SPORADIC == 1 ) || ( configUSE_EDF_SCHEDULE_TABLE == 1 ) || ( configUSE_EDF_HIGH_RES_TIME == 1 ) )
+#error "configUSE_EDF_TICKLESS_KERNEL cannot be used with slack stealers, sporadic tasks, the schedule table or configUSE_EDF_HIGH_RES_TIME, which act on every tick"
+#endif
 
-			if( ( pxTaskDefinition->puxStackBuffer != NULL ) && ( pxTaskDefinition->pxTaskBuffer != NULL ) )
-			{
-				/* Allocate space for the TCB.  Where the memory comes from depends
-				 * on the implementation of the port malloc function and whether or
-				 * not static allocation is being used. */
-				pxNewTCB = ( TCB_t * ) pxTaskDefinition->pxTaskBuffer;
+#if ( configGENERATE_RUN_TIME_STATS == 1 ) && !defined( configRUN_TIME_COUNTS_PER_TICK )
+#error "The run time counter cannot be calibrated against the ticks of a tickless kernel, configRUN_TIME_COUNTS_PER_TICK must be defined"
+#endif
 
-				/* Store the stack location in the TCB. */
-				pxNewTCB->pxStack = pxTaskDefinition->puxStackBuffer;
+#if !defined( configEDF_TICKLESS_START ) || !defined( configEDF_TICKLESS_ELAPSED ) || !defined( configEDF_TICKLESS_SET_EVENT )
+#error "configEDF_TICKLESS_START(), configEDF_TICKLESS_ELAPSED() and configEDF_TICKLESS_SET_EVENT() must be defined when configUSE_EDF_TICKLESS_KERNEL is 1"
+#endif
 
-#if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
-				{
-					/* Tasks can be created statically or dynamically, so note this
-					 * task was created statically in case the task is later deleted. */
-					pxNewTCB->ucStaticallyAllocated = tskSTATICALLY_ALLOCATED_STACK_AND_TCB;
-				}
-#endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
+#define taskEDF_TICKLESS_CATCH_UP()    prvEDFTicklessCatchUp()
 
-				prvInitialiseNewTask( pxTaskDefinition->pvTaskCode,
-						pxTaskDefinition->pcName,
-						( uint32_t ) pxTaskDefinition->usStackDepth,
-						pxTaskDefinition->pvParameters,
-						pxTaskDefinition->uxPriority,
-						pxCreatedTask, pxNewTCB,
-						pxTaskDefinition->xRegions );
+#else
 
-				prvAddNewTaskToReadyList( pxNewTCB );
-				xReturn = pdPASS;
-			}
+#define taskEDF_TICKLESS_CATCH_UP()
 
-			return xReturn;
-		}
+#endif /* configUSE_EDF_TICKLESS_KERNEL */
 
-#endif /* ( portUSING_MPU_WRAPPERS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
-		/*-----------------------------------------------------------*/
+		/*
+		 * Slack stealing.  The slack is the time the periodic jobs can be
+		 * delayed by without missing a deadline:
+		 *   min over the deadlines d up to now + configEDF_SLACK_HORIZON of
+		 *   d - now - ( work left in the jobs due by d, at their WCET )
+		 * bounded by the demand over the horizon for the later deadlines.  The
+		 * jobs to come are counted from the earliest time they can be released,
+		 * so a release does not lower the slack, and the periodic tasks running
+		 * do not change it either.  In between the computations it goes down by
+		 * one on every tick the processor runs a slack stealer or the idle task,
+		 * all the tick does.  It is computed again when a job completes (an
+		 * early completion gives its unused WCET back) or the task set changes,
+		 * from the task doing it with the scheduler suspended: the state of the
+		 * tasks is copied one task at a time in a critical section, the cost,
+		 * bounded by the number of deadlines in the horizon, is paid with
+		 * interrupts enabled.  While the slack is above zero the slack stealers
+		 * have a deadline of 0, ahead of every task, otherwise portMAX_DELAY,
+		 * behind the idle task.
+		 */
+#if ( configUSE_EDF_SLACK_STEALING == 1 )
 
-#if ( ( portUSING_MPU_WRAPPERS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+#if ( ( configUSE_EDF_SCHEDULER != 1 ) || ( configGENERATE_RUN_TIME_STATS != 1 ) )
+#error "configUSE_EDF_SLACK_STEALING needs configUSE_EDF_SCHEDULER and configGENERATE_RUN_TIME_STATS set to 1"
+#endif
 
-		BaseType_t xTaskCreateRestricted( const TaskParameters_t * const pxTaskDefinition,
-				TaskHandle_t * pxCreatedTask )
-		{
-			TCB_t * pxNewTCB;
-			BaseType_t xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+#if ( configNUMBER_OF_CORES > 1 )
+#error "configUSE_EDF_SLACK_STEALING only supports one core"
+#endif
 
-			configASSERT( pxTaskDefinition->puxStackBuffer );
+		/* Ticks ahead the slack is computed over. */
+#ifndef configEDF_SLACK_HORIZON
+#define configEDF_SLACK_HORIZON        ( ( TickType_t ) 1000 )
+#endif
 
-			if( pxTaskDefinition->puxStackBuffer != NULL )
-			{
-				/* Allocate space for the TCB.  Where the memory comes from depends
-				 * on the implementation of the port malloc function and whether or
-				 * not static allocation is being used. */
-				pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+		/* Periodic tasks and slack stealers the slack computation can track. */
+#ifndef configEDF_SLACK_MAX_TASKS
+#define configEDF_SLACK_MAX_TASKS      16
+#endif
 
-				if( pxNewTCB != NULL )
-				{
-					/* Store the stack location in the TCB. */
-					pxNewTCB->pxStack = pxTaskDefinition->puxStackBuffer;
+#ifndef configEDF_SLACK_MAX_STEALERS
+#define configEDF_SLACK_MAX_STEALERS   4
+#endif
 
-#if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
-					{
-						/* Tasks can be created statically or dynamically, so note
-						 * this task had a statically allocated stack in case it is
-						 * later deleted.  The TCB was allocated dynamically. */
-						pxNewTCB->ucStaticallyAllocated = tskSTATICALLY_ALLOCATED_STACK_ONLY;
-					}
-#endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
+#endif /* configUSE_EDF_SLACK_STEALING */
 
-					prvInitialiseNewTask( pxTaskDefinition->pvTaskCode,
-							pxTaskDefinition->pcName,
-							( uint32_t ) pxTaskDefinition->usStackDepth,
-							pxTaskDefinition->pvParameters,
-							pxTaskDefinition->uxPriority,
-							pxCreatedTask, pxNewTCB,
-							pxTaskDefinition->xRegions );
+		/*
+		 * Key a task is queued under in the ready list: the absolute deadline of
+		 * its current job, kept in xTaskAbsoluteDeadline as the value of
+		 * xStateListItem is the wake time while the task is delayed, or for a
+		 * slack stealer the value matching the slack.
+		 */
+#if ( configUSE_EDF_SLACK_STEALING == 1 )
+#define taskEDF_KEY( pxTCB )                                                      \
+		( ( ( pxTCB )->xTaskSlackStealer != pdFALSE ) ?                               \
+		  ( ( xEDFSlack > 0U ) ? ( TickType_t ) 0U : ( TickType_t ) portMAX_DELAY ) : \
+		  ( pxTCB )->xTaskAbsoluteDeadline )
+#elif ( configUSE_EDF_HIGH_RES_TIME == 1 )
+#define taskEDF_KEY( pxTCB )                                                                   \
+		( ( ( TickType_t ) ( ( pxTCB )->xTaskAbsoluteDeadline - xEDFEpochUs ) < taskEDF_TIME_BEFORE ) ? \
+		  ( TickType_t ) ( ( pxTCB )->xTaskAbsoluteDeadline - xEDFEpochUs ) : ( TickType_t ) 0U )
+#else
+#define taskEDF_KEY( pxTCB )    ( ( pxTCB )->xTaskAbsoluteDeadline )
+#endif
 
-					prvAddNewTaskToReadyList( pxNewTCB );
-					xReturn = pdPASS;
-				}
-			}
+		/*
+		 * Partitioned EDF: every task is bound to one core (xTaskCore) and each
+		 * core has its own ready list, so a core only ever reads its own list to
+		 * pick the next task and only the core a task is bound to is preempted
+		 * by its release.
+		 *
+		 * The cores only have their ready lists to themselves: they still form
+		 * the single partition of global EDF, with its tick count, delayed
+		 * lists and lock, and one core runs the tick for all of them.
+		 *
+		 * Semi-partitioned EDF adds split tasks.  A job of a split task is
+		 * released on its first core with a local sub-deadline and budget.  The
+		 * tick charges the budget and, when it is used up, moves the job to the
+		 * ready list of the second core with the deadline of the whole job
+		 * (xTaskCore is where the current job is queued).  The second core
+		 * only picks the job up once the first core switched it out.
+		 */
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_EDF_PARTITIONED == 1 ) )
+#define taskEDF_READY_LIST( pxTCB )           ( &( xReadyTasksListsEDF[ ( pxTCB )->xTaskCore ] ) )
+#define taskEDF_CORE_READY_LIST( xCoreID )    ( &( xReadyTasksListsEDF[ ( xCoreID ) ] ) )
+#define taskEDF_READY_LISTS                   ( ( BaseType_t ) configNUMBER_OF_CORES )
+#else
+#define taskEDF_READY_LIST( pxTCB )           ( &xReadyTasksListEDF )
+#define taskEDF_CORE_READY_LIST( xCoreID )    ( &xReadyTasksListEDF )
+#define taskEDF_READY_LISTS                   ( ( BaseType_t ) 1 )
+#endif
 
-			return xReturn;
+		/*
+		 * A job of pxTCB completes, count it as missed if its deadline has
+		 * passed.  Completing during the tick of the deadline is in time.
+		 */
+#if ( configUSE_EDF_SCHEDULER == 1 )
+#define taskEDF_JOB_COMPLETE( pxTCB )                                                                         \
+		if( ( TickType_t ) ( ( TickType_t ) ( taskEDF_NOW() - ( pxTCB )->xTaskAbsoluteDeadline ) - 1U ) < ( portMAX_DELAY >> 1 ) ) \
+		{                                                                                                         \
+			( pxTCB )->ulTaskDeadlineMisses++;                                                                    \
 		}
+#else
+#define taskEDF_JOB_COMPLETE( pxTCB )
+#endif
 
-#endif /* portUSING_MPU_WRAPPERS */
-		/*-----------------------------------------------------------*/
+		/*
+		 * A task made ready preempts the running task if its deadline is not
+		 * later, it is not held off by the threshold of the running task, and
+		 * the running task does not defer the preemption.
+		 */
+#if ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 )
+#define taskEDF_THRESHOLD_PASSED( pxTCB )    ( ( pxTCB )->xTaskRelativeDeadline < pxCurrentTCB->xTaskPreemptionThreshold )
+#else
+#define taskEDF_THRESHOLD_PASSED( pxTCB )    ( pdTRUE )
+#endif
 
-#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 && configUSE_EDF_SCHEDULER == 0 )
+#if ( configUSE_EDF_DEFERRED_PREEMPTION == 1 )
+#define taskEDF_PREEMPT_NOW()                ( prvEDFPreemptNow() != pdFALSE )
+#else
+#define taskEDF_PREEMPT_NOW()                ( pdTRUE )
+#endif
 
-		BaseType_t xTaskCreate( TaskFunction_t pxTaskCode,
-				const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
-				const configSTACK_DEPTH_TYPE usStackDepth,
-				void * const pvParameters,
-				UBaseType_t uxPriority,
-				TaskHandle_t * const pxCreatedTask )
-		{
-			TCB_t * pxNewTCB;
-			BaseType_t xReturn;
+#define taskEDF_PREEMPTS( pxTCB )                                   \
+		( ( taskEDF_KEY( pxTCB ) <= taskEDF_KEY( pxCurrentTCB ) ) && \
+		  taskEDF_THRESHOLD_PASSED( pxTCB ) &&                      \
+		  taskEDF_PREEMPT_NOW() )
 
-			/* If the stack grows down then allocate the stack then the TCB so the stack
-			 * does not grow into the TCB.  Likewise if the stack grows up then allocate
-			 * the TCB then the stack. */
-#if ( portSTACK_GROWTH > 0 )
-			{
-				/* Allocate space for the TCB.  Where the memory comes from depends on
-				 * the implementation of the port malloc function and whether or not static
-				 * allocation is being used. */
-				pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+		/*
+		 * A task woken other than by the tick preempts the running task if its
+		 * deadline is not later, on another core the one running the latest
+		 * deadline.
+		 */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configNUMBER_OF_CORES == 1 ) )
+#define taskEDF_WOKEN_TASK_PREEMPTS( pxTCB )    taskEDF_PREEMPTS( pxTCB )
+#elif ( configUSE_EDF_SCHEDULER == 1 )
+#define taskEDF_WOKEN_TASK_PREEMPTS( pxTCB )    ( prvEDFPreemptCoreFor( ( pxTCB ), NULL ) != pdFALSE )
+#else
+#define taskEDF_WOKEN_TASK_PREEMPTS( pxTCB )    ( ( pxTCB )->uxPriority > pxCurrentTCB->uxPriority )
+#endif
 
-				if( pxNewTCB != NULL )
-				{
-					/* Allocate space for the stack used by the task being created.
-					 * The base of the stack memory stored in the TCB so the task can
-					 * be deleted later if required. */
-					pxNewTCB->pxStack = ( StackType_t * ) pvPortMallocStack( ( ( ( size_t ) usStackDepth ) * sizeof( StackType_t ) ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+		/* Same for a task resumed, which also preempts a task of its own
+		 * priority. */
+#if ( configUSE_EDF_SCHEDULER == 1 )
+#define taskEDF_RESUMED_TASK_PREEMPTS( pxTCB )    taskEDF_WOKEN_TASK_PREEMPTS( pxTCB )
+#else
+#define taskEDF_RESUMED_TASK_PREEMPTS( pxTCB )    ( ( pxTCB )->uxPriority >= pxCurrentTCB->uxPriority )
+#endif
 
-					if( pxNewTCB->pxStack == NULL )
-					{
-						/* Could not allocate the stack.  Delete the allocated TCB. */
-						vPortFree( pxNewTCB );
-						pxNewTCB = NULL;
-					}
-				}
-			}
+		/*
+		 * A notification at uxIndex releases a job of pxTCB if it was set up
+		 * with vTaskSetReleaseOnNotify().
+		 */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_TASK_NOTIFICATIONS == 1 ) )
+#define taskEDF_NOTIFY_RELEASE( pxTCB, uxIndex )                  \
+		if( ( pxTCB )->uxTaskReleaseNotifyIndex == ( uxIndex ) )      \
+		{                                                             \
+			prvEDFNotifyRelease( pxTCB );                             \
+		}
+#else
+#define taskEDF_NOTIFY_RELEASE( pxTCB, uxIndex )
+#endif
+		/* END of special for EDF */
+
+		/*-----------------------------------------------------------*/
+
+		/*
+		 * Several functions take a TaskHandle_t parameter that can optionally be NULL,
+		 * where NULL is used to indicate that the handle of the currently executing
+		 * task should be used in place of the parameter.  This macro simply checks to
+		 * see if the parameter is NULL and returns a pointer to the appropriate TCB.
+		 */
+#define prvGetTCBFromHandle( pxHandle )    ( ( ( pxHandle ) == NULL ) ? pxCurrentTCB : ( pxHandle ) )
+
+		/* The item value of the event list item is normally used to hold the priority
+		 * of the task to which it belongs (coded to allow it to be held in reverse
+		 * priority order).  However, it is occasionally borrowed for other purposes.  It
+		 * is important its value is not updated due to a task priority change while it is
+		 * being used for another purpose.  The following bit definition is used to inform
+		 * the scheduler that the value should not be changed - in which case it is the
+		 * responsibility of whichever module is using the value to ensure it gets set back
+		 * to its original value when it is released. */
+#if ( configUSE_16_BIT_TICKS == 1 )
+#define taskEVENT_LIST_ITEM_VALUE_IN_USE    0x8000U
+#else
+#define taskEVENT_LIST_ITEM_VALUE_IN_USE    0x80000000UL
+#endif
+
+		/*
+		 * Task control block.  A task control block (TCB) is allocated for each task,
+		 * and stores task state information, including a pointer to the task's context
+		 * (the task's run time environment, including register values)
+		 */
+		typedef struct tskTaskControlBlock       /* The old naming convention is used to prevent breaking kernel aware debuggers. */
+		{
+			volatile StackType_t * pxTopOfStack; /*< Points to the location of the last item placed on the tasks stack.  THIS MUST BE THE FIRST MEMBER OF THE TCB STRUCT. */
+
+#if ( portUSING_MPU_WRAPPERS == 1 )
+			xMPU_SETTINGS xMPUSettings; /*< The MPU settings are defined as part of the port layer.  THIS MUST BE THE SECOND MEMBER OF THE TCB STRUCT. */
+#endif
+
+			ListItem_t xStateListItem;                  /*< The list that the state list item of a task is reference from denotes the state of that task (Ready, Blocked, Suspended ). */
+			ListItem_t xEventListItem;                  /*< Used to reference a task from an event list. */
+			UBaseType_t uxPriority;                     /*< The priority of the task.  0 is the lowest priority. */
+			StackType_t * pxStack;                      /*< Points to the start of the stack. */
+			char pcTaskName[ configMAX_TASK_NAME_LEN ]; /*< Descriptive name given to the task when created.  Facilitates debugging only. */ /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+
+			/* START of special for EDF */
+			/* E.C. : the period of a task */
+#if ( configUSE_EDF_SCHEDULER == 1 )
+			TickType_t xTaskPeriod; /*< Stores the period in tick of the task. > */
+			TickType_t xTaskRelativeDeadline; /*< Stores the relative deadline in tick of the task, never larger than the period. > */
+			TickType_t xTaskAbsoluteDeadline; /*< Deadline of the current job, the task is queued under it while ready. > */
+			uint32_t ulTaskJobs;              /*< Jobs released since the task was created. > */
+			uint32_t ulTaskDeadlineMisses;    /*< Jobs completed after their deadline. > */
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+			UBaseType_t uxTaskReleaseNotifyIndex; /*< Notification releasing the jobs, or tskEDF_NO_RELEASE_ON_NOTIFY. > */
+#endif
+#if ( configNUMBER_OF_CORES > 1 )
+			volatile BaseType_t xTaskRunState; /*< Core running the task, or taskTASK_NOT_RUNNING. > */
+#endif
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_EDF_PARTITIONED == 1 ) )
+			BaseType_t xTaskCore; /*< Core the task is bound to. > */
+#endif
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_EDF_SEMI_PARTITIONED == 1 ) )
+			BaseType_t xTaskFirstCore;      /*< Core the jobs are released on. > */
+			BaseType_t xTaskSplitCore;      /*< Core the jobs migrate to, or taskTASK_NOT_SPLIT. > */
+			TickType_t xTaskSplitBudget;    /*< Ticks a job may run on the first core. > */
+			TickType_t xTaskSplitDeadline;  /*< Relative deadline of a job on the first core. > */
+			TickType_t xTaskBudgetLeft;     /*< Ticks the current job has left on the first core. > */
+			TickType_t xTaskJobDeadline;    /*< Absolute deadline of the current job. > */
+#endif
+#if ( taskEDF_USE_WCET )
+			TickType_t xTaskWCET;                     /*< Worst case execution time of a job at full speed, in ticks. > */
+#endif
+#if ( configUSE_EDF_SLACK_STEALING == 1 )
+			BaseType_t xTaskSlackStealer;             /*< pdTRUE for a slack stealer. > */
+			BaseType_t xTaskJobActive;                /*< pdTRUE from the release of a job to its completion. > */
+			TickType_t xTaskNextRelease;              /*< Release time of the next job. > */
+			configRUN_TIME_COUNTER_TYPE ulJobStartRunTime; /*< ulRunTimeCounter at the release of the current job. > */
+#endif
+#if ( configUSE_EDF_SPORADIC == 1 )
+			BaseType_t xTaskSporadic;                 /*< pdTRUE for a sporadic task, xTaskPeriod is then its minimum inter-arrival time. > */
+			TickType_t xTaskLastArrival;              /*< Release time of the last job of a sporadic task. > */
+			UBaseType_t uxTaskDeferredArrivals;       /*< Arrivals waiting for the minimum inter-arrival time to pass. > */
+			UBaseType_t uxTaskEarlyArrivals;          /*< Arrivals that were deferred since the task was created. > */
+			TickType_t xTaskPendingReleases[ configEDF_SPORADIC_MAX_PENDING ]; /*< Release times of the jobs not taken yet, a FIFO. > */
+			UBaseType_t uxTaskPendingHead;            /*< Oldest entry of xTaskPendingReleases. > */
+			UBaseType_t uxTaskPendingCount;           /*< Entries in xTaskPendingReleases. > */
+			uint32_t ulTaskDensity;                   /*< WCET / relative deadline counted by the admission, 16.16. > */
+#endif
+#if ( configUSE_EDF_DVFS == 1 )
+			uint32_t ulTaskUtilisation;               /*< Utilisation reserved for the current job, 16.16. > */
+			configRUN_TIME_COUNTER_TYPE ulJobCycles;  /*< Run time of the current job scaled to full speed. > */
+#endif
+#if ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 )
+			TickType_t xTaskPreemptionThreshold;      /*< Only tasks of a lower relative deadline preempt the task. > */
+#endif
+#if ( configUSE_EDF_DEFERRED_PREEMPTION == 1 )
+			TickType_t xTaskNonPreemptiveTicks;       /*< Ticks a preemption of the task can be deferred by, 0 for none. > */
+#endif
+#if ( configUSE_EDF_SCHEDULE_TABLE == 1 )
+			TickType_t xTaskTableRun;                 /*< Ticks the current job has run for while the table is active. > */
+#endif
+#if ( configUSE_EDF_HIGH_RES_TIME == 1 )
+			TickType_t xTaskRelativeDeadlineUs;       /*< Relative deadline in microseconds, xTaskAbsoluteDeadline is in microseconds too. > */
+#endif
+#endif
+#if ( taskUSE_NAME_REGISTRY == 1 )
+			UBaseType_t uxTaskNameSlot; /*< Slot of the task in the name registry. > */
+#endif
+			/* END of special for EDF */
+
+#if ( ( portSTACK_GROWTH > 0 ) || ( configRECORD_STACK_HIGH_ADDRESS == 1 ) )
+			StackType_t * pxEndOfStack; /*< Points to the highest valid address for the stack. */
+#endif
+
+#if ( portCRITICAL_NESTING_IN_TCB == 1 )
+			UBaseType_t uxCriticalNesting; /*< Holds the critical section nesting depth for ports that do not maintain their own count in the port layer. */
+#endif
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+			UBaseType_t uxTCBNumber;  /*< Stores a number that increments each time a TCB is created.  It allows debuggers to determine when a task has been deleted and then recreated. */
+			UBaseType_t uxTaskNumber; /*< Stores a number specifically for use by third party trace code. */
+#endif
+
+#if ( configUSE_MUTEXES == 1 )
+			UBaseType_t uxBasePriority; /*< The priority last assigned to the task - used by the priority inheritance mechanism. */
+			UBaseType_t uxMutexesHeld;
+#endif
+
+#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+			TaskHookFunction_t pxTaskTag;
+#endif
+
+#if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS > 0 )
+			void * pvThreadLocalStoragePointers[ configNUM_THREAD_LOCAL_STORAGE_POINTERS ];
+#endif
+
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+			configRUN_TIME_COUNTER_TYPE ulRunTimeCounter; /*< Stores the amount of time the task has spent in the Running state. */
+#endif
+
+#if ( configUSE_NEWLIB_REENTRANT == 1 )
+
+			/* Allocate a Newlib reent structure that is specific to this task.
+			 * Note Newlib support has been included by popular demand, but is not
+			 * used by the FreeRTOS maintainers themselves.  FreeRTOS is not
+			 * responsible for resulting newlib operation.  User must be familiar with
+			 * newlib and must provide system-wide implementations of the necessary
+			 * stubs. Be warned that (at the time of writing) the current newlib design
+			 * implements a system-wide malloc() that must be provided with locks.
+			 *
+			 * See the third party link http://www.nadler.com/embedded/newlibAndFreeRTOS.html
+			 * for additional information. */
+			struct  _reent xNewLib_reent;
+#endif
+
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+			volatile uint32_t ulNotifiedValue[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
+			volatile uint8_t ucNotifyState[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
+#endif
+
+			/* See the comments in FreeRTOS.h with the definition of
+			 * tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE. */
+#if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e731 !e9029 Macro has been consolidated for readability reasons. */
+			uint8_t ucStaticallyAllocated;                     /*< Set to pdTRUE if the task is a statically allocated to ensure no attempt is made to free the memory. */
+#endif
+
+#if ( INCLUDE_xTaskAbortDelay == 1 )
+			uint8_t ucDelayAborted;
+#endif
+
+#if ( configUSE_POSIX_ERRNO == 1 )
+			int iTaskErrno;
+#endif
+		} tskTCB;
+
+		/* The old tskTCB name is maintained above then typedefed to the new TCB_t name
+		 * below to enable the use of older kernel aware debuggers. */
+		typedef tskTCB TCB_t;
+
+		/*lint -save -e956 A manual analysis and inspection has been used to determine
+		 * which static variables must be declared volatile. */
+		/* START of special for EDF */
+#if ( configNUMBER_OF_CORES == 1 )
+		PRIVILEGED_DATA TCB_t * volatile pxCurrentTCB = NULL;
+#else
+		PRIVILEGED_DATA TCB_t * volatile pxCurrentTCBs[ configNUMBER_OF_CORES ] = { NULL }; /*< Task running on each core. */
+
+		/* The kernel code written for one core uses the task running on the
+		 * calling core.  Outside of a critical section a task can migrate right
+		 * after reading the core ID, so task level code must only use it with
+		 * interrupts masked. */
+#define pxCurrentTCB    pxCurrentTCBs[ portGET_CORE_ID() ]
+#endif
+		/* END of special for EDF */
+
+		/* Lists for ready and blocked tasks. --------------------
+		 * xDelayedTaskList1 and xDelayedTaskList2 could be moved to function scope but
+		 * doing so breaks some kernel aware debuggers and debuggers that rely on removing
+		 * the static qualifier. */
+		PRIVILEGED_DATA static List_t pxReadyTasksLists[ configMAX_PRIORITIES ]; /*< Prioritised ready tasks. */
+		/* START of special for EDF */
+#if ( configUSE_EDF_TIMING_WHEEL == 1 )
+		PRIVILEGED_DATA static List_t xWheelLists[ taskWHEEL_LISTS ];            /*< Delayed tasks, the slots of each level of the wheel then the far list. */
+#elif ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_EDF_PARTITIONED == 1 ) )
+		PRIVILEGED_DATA static List_t xDelayedTaskLists1[ configNUMBER_OF_CORES ];                    /*< Delayed tasks of each partition. */
+		PRIVILEGED_DATA static List_t xDelayedTaskLists2[ configNUMBER_OF_CORES ];                    /*< Delayed tasks of each partition that have overflowed its tick count. */
+		PRIVILEGED_DATA static List_t * volatile pxDelayedTaskLists[ configNUMBER_OF_CORES ];         /*< Delayed task list of each partition currently being used. */
+		PRIVILEGED_DATA static List_t * volatile pxOverflowDelayedTaskLists[ configNUMBER_OF_CORES ]; /*< Overflow delayed task list of each partition currently being used. */
+
+		/* The kernel code written for one core uses the partition of the
+		 * calling core, see taskEDF_TASK_DELAYED_LIST() for the one of a task. */
+#define pxDelayedTaskList            pxDelayedTaskLists[ taskEDF_PARTITION ]
+#define pxOverflowDelayedTaskList    pxOverflowDelayedTaskLists[ taskEDF_PARTITION ]
+#else
+		/* END of special for EDF */
+		PRIVILEGED_DATA static List_t xDelayedTaskList1;                         /*< Delayed tasks. */
+		PRIVILEGED_DATA static List_t xDelayedTaskList2;                         /*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
+		PRIVILEGED_DATA static List_t * volatile pxDelayedTaskList;              /*< Points to the delayed task list currently being used. */
+		PRIVILEGED_DATA static List_t * volatile pxOverflowDelayedTaskList;      /*< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
+#endif
+		/* START of special for EDF */
+#if ( configNUMBER_OF_CORES == 1 )
+		/* END of special for EDF */
+		PRIVILEGED_DATA static List_t xPendingReadyList;                         /*< Tasks that have been readied while the scheduler was suspended.  They will be moved to the ready list when the scheduler is resumed. */
+		/* START of special for EDF */
+#else
+		PRIVILEGED_DATA static List_t xPendingReadyLists[ configNUMBER_OF_CORES ]; /*< Tasks readied while the scheduler was suspended on each core. */
+#define xPendingReadyList    xPendingReadyLists[ portGET_CORE_ID() ]
+#endif
+		/* END of special for EDF */
+
+		/* START of special for EDF */
+		/* E.C. : the new RedyList */
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_EDF_PARTITIONED == 1 ) )
+		PRIVILEGED_DATA static List_t xReadyTasksListsEDF[ configNUMBER_OF_CORES ]; /*< Ready tasks bound to each core ordered by their deadline. */
+#else
+		PRIVILEGED_DATA static List_t xReadyTasksListEDF; /*< Ready tasks ordered by their deadline. */
+#endif
+		PRIVILEGED_DATA static TickType_t volatile xIDLEPeriod =0;
+#if ( configNUMBER_OF_CORES > 1 )
+		PRIVILEGED_DATA static TaskHandle_t xIdleTaskHandles[ configNUMBER_OF_CORES ]; /*< One idle task per core, xIdleTaskHandle is the one of core 0. */
+#endif
+
+#endif
+		/* END of special for EDF */
+
+		/* START of special for EDF */
+#if ( taskUSE_NAME_REGISTRY == 1 )
+		typedef struct xTASK_NAME_SLOT
+		{
+			uint32_t ulHash;       /*< Hash of the name of the task, compared before the name. */
+			TCB_t * volatile pxTCB; /*< The task, NULL if never used or taskNAME_SLOT_DELETED. */
+		} TaskNameSlot_t;
+
+		PRIVILEGED_DATA static TaskNameSlot_t xTaskNameRegistry[ configTASK_NAME_REGISTRY_SIZE ]; /*< Tasks by the hash of their name. */
+		PRIVILEGED_DATA static volatile UBaseType_t uxTaskNameRegistrySeq = ( UBaseType_t ) 0U; /*< Odd while the registry is being changed. */
+		PRIVILEGED_DATA static uint8_t ucTaskNameSlotDeleted; /*< Only its address is used. */
+#endif
+		/* END of special for EDF */
+
+#if ( INCLUDE_vTaskDelete == 1 )
+
+		PRIVILEGED_DATA static List_t xTasksWaitingTermination; /*< Tasks that have been deleted - but their memory not yet freed. */
+		PRIVILEGED_DATA static volatile UBaseType_t uxDeletedTasksWaitingCleanUp = ( UBaseType_t ) 0U;
+
+#endif
+
+#if ( INCLUDE_vTaskSuspend == 1 )
+
+		PRIVILEGED_DATA static List_t xSuspendedTaskList; /*< Tasks that are currently suspended. */
+
+#endif
+
+		/* Global POSIX errno. Its value is changed upon context switching to match
+		 * the errno of the currently running task. */
+#if ( configUSE_POSIX_ERRNO == 1 )
+		int FreeRTOS_errno = 0;
+#endif
+
+		/* Other file private variables. --------------------------------*/
+		PRIVILEGED_DATA static volatile UBaseType_t uxCurrentNumberOfTasks = ( UBaseType_t ) 0U;
+		/* START of special for EDF */
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_EDF_PARTITIONED == 1 ) )
+		/* Each partition has its tick, see prvInitialiseTaskLists() for the
+		 * initial count. */
+		PRIVILEGED_DATA static volatile TickType_t xTickCounts[ configNUMBER_OF_CORES ];                                      /*< Tick count of each partition. */
+		PRIVILEGED_DATA static volatile TickType_t xPendedTickCounts[ configNUMBER_OF_CORES ] = { ( TickType_t ) 0U };        /*< Ticks of each partition pended while its core has the scheduler suspended. */
+		PRIVILEGED_DATA static volatile BaseType_t xNumsOfOverflows[ configNUMBER_OF_CORES ] = { ( BaseType_t ) 0 };          /*< Overflows of the tick count of each partition. */
+		PRIVILEGED_DATA static volatile TickType_t xNextTaskUnblockTimes[ configNUMBER_OF_CORES ] = { ( TickType_t ) 0U };   /*< Next unblock time of each partition, portMAX_DELAY once the scheduler starts. */
+#define xTickCount              xTickCounts[ taskEDF_PARTITION ]
+#define xPendedTicks            xPendedTickCounts[ taskEDF_PARTITION ]
+#define xNumOfOverflows         xNumsOfOverflows[ taskEDF_PARTITION ]
+#define xNextTaskUnblockTime    xNextTaskUnblockTimes[ taskEDF_PARTITION ]
+#else
+		/* END of special for EDF */
+		PRIVILEGED_DATA static volatile TickType_t xTickCount = ( TickType_t ) configINITIAL_TICK_COUNT;
+		/* START of special for EDF */
+#endif
+		/* END of special for EDF */
+		PRIVILEGED_DATA static volatile UBaseType_t uxTopReadyPriority = tskIDLE_PRIORITY;
+		PRIVILEGED_DATA static volatile BaseType_t xSchedulerRunning = pdFALSE;
+		/* START of special for EDF */
+#if ( ( configNUMBER_OF_CORES == 1 ) || ( configUSE_EDF_PARTITIONED == 0 ) )
+		/* END of special for EDF */
+		PRIVILEGED_DATA static volatile TickType_t xPendedTicks = ( TickType_t ) 0U;
+		/* START of special for EDF */
+#endif
+		/* END of special for EDF */
+		/* START of special for EDF */
+#if ( configNUMBER_OF_CORES == 1 )
+		PRIVILEGED_DATA static volatile BaseType_t xYieldPending = pdFALSE;
+#else
+		PRIVILEGED_DATA static volatile BaseType_t xYieldPendings[ configNUMBER_OF_CORES ] = { pdFALSE }; /*< A switch held pending on each core. */
+#define xYieldPending    xYieldPendings[ portGET_CORE_ID() ]
+#endif
+		/* END of special for EDF */
+		/* START of special for EDF */
+#if ( ( configNUMBER_OF_CORES == 1 ) || ( configUSE_EDF_PARTITIONED == 0 ) )
+		/* END of special for EDF */
+		PRIVILEGED_DATA static volatile BaseType_t xNumOfOverflows = ( BaseType_t ) 0;
+		/* START of special for EDF */
+#endif
+		/* END of special for EDF */
+		PRIVILEGED_DATA static UBaseType_t uxTaskNumber = ( UBaseType_t ) 0U;
+		/* START of special for EDF */
+#if ( ( configNUMBER_OF_CORES == 1 ) || ( configUSE_EDF_PARTITIONED == 0 ) )
+		/* END of special for EDF */
+		PRIVILEGED_DATA static volatile TickType_t xNextTaskUnblockTime = ( TickType_t ) 0U; /* Initialised to portMAX_DELAY before the scheduler starts. */
+		/* START of special for EDF */
+#endif
+		/* END of special for EDF */
+		PRIVILEGED_DATA static TaskHandle_t xIdleTaskHandle = NULL;                          /*< Holds the handle of the idle task.  The idle task is created automatically when the scheduler is started. */
+
+		/* Improve support for OpenOCD. The kernel tracks Ready tasks via priority lists.
+		 * For tracking the state of remote threads, OpenOCD uses uxTopUsedPriority
+		 * to determine the number of priority lists to read back from the remote target. */
+		const volatile UBaseType_t uxTopUsedPriority = configMAX_PRIORITIES - 1U;
+
+		/* Context switches are held pending while the scheduler is suspended.  Also,
+		 * interrupts must not manipulate the xStateListItem of a TCB, or any of the
+		 * lists the xStateListItem can be referenced from, if the scheduler is suspended.
+		 * If an interrupt needs to unblock a task while the scheduler is suspended then it
+		 * moves the task's event list item into the xPendingReadyList, ready for the
+		 * kernel to move the task from the pending ready list into the real ready list
+		 * when the scheduler is unsuspended.  The pending ready list itself can only be
+		 * accessed from a critical section. */
+		/* START of special for EDF */
+#if ( configNUMBER_OF_CORES == 1 )
+		PRIVILEGED_DATA static volatile UBaseType_t uxSchedulerSuspended = ( UBaseType_t ) pdFALSE;
+#else
+		PRIVILEGED_DATA static volatile UBaseType_t uxSchedulerSuspendeds[ configNUMBER_OF_CORES ] = { ( UBaseType_t ) pdFALSE }; /*< Suspension nesting of each core. */
+#define uxSchedulerSuspended    uxSchedulerSuspendeds[ portGET_CORE_ID() ]
+
+		/* Critical nesting of each core, see vTaskEnterCritical(). */
+		PRIVILEGED_DATA static UBaseType_t uxCriticalNestings[ configNUMBER_OF_CORES ] = { 0U };
+#endif
+		/* END of special for EDF */
+
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+
+		/* Do not move these variables to function scope as doing so prevents the
+		 * code working with debuggers that need to remove the static qualifier. */
+		/* START of special for EDF */
+#if ( configNUMBER_OF_CORES == 1 )
+		PRIVILEGED_DATA static configRUN_TIME_COUNTER_TYPE ulTaskSwitchedInTime = 0UL;    /*< Holds the value of a timer/counter the last time a task was switched in. */
+#else
+		PRIVILEGED_DATA static configRUN_TIME_COUNTER_TYPE ulTaskSwitchedInTimes[ configNUMBER_OF_CORES ] = { 0UL }; /*< Holds the value of a timer/counter the last time a task was switched in on each core. */
+#define ulTaskSwitchedInTime    ulTaskSwitchedInTimes[ portGET_CORE_ID() ]
+#endif
+#if ( configNUMBER_OF_CORES == 1 )
+		/* END of special for EDF */
+		PRIVILEGED_DATA static volatile configRUN_TIME_COUNTER_TYPE ulTotalRunTime = 0UL; /*< Holds the total amount of execution time as defined by the run time counter clock. */
+		/* START of special for EDF */
+#else
+		PRIVILEGED_DATA static volatile configRUN_TIME_COUNTER_TYPE ulTotalRunTimes[ configNUMBER_OF_CORES ] = { 0UL }; /*< The run time counter of each core when it last switched. */
+#define ulTotalRunTime    ulTotalRunTimes[ portGET_CORE_ID() ]
+#endif
+		/* END of special for EDF */
+
+#endif
+
+		/* START of special for EDF */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configGENERATE_RUN_TIME_STATS == 1 ) )
+
+		/* Number of ticks the run time counter is calibrated over at start up. */
+#define taskRUN_TIME_CALIBRATION_TICKS    ( ( TickType_t ) 10 )
+
+#ifdef configRUN_TIME_COUNTS_PER_TICK
+		PRIVILEGED_DATA static volatile configRUN_TIME_COUNTER_TYPE ulRunTimeCountsPerTick = ( configRUN_TIME_COUNTER_TYPE ) configRUN_TIME_COUNTS_PER_TICK; /*< Run time counter counts in one tick, as given by the application. */
+#else
+		PRIVILEGED_DATA static volatile configRUN_TIME_COUNTER_TYPE ulRunTimeCountsPerTick = 0UL; /*< Run time counter counts in one tick, measured by the tick interrupt at start up.  0 until then. */
+		PRIVILEGED_DATA static configRUN_TIME_COUNTER_TYPE ulCalibrationStartTime = 0UL;             /*< Run time counter value at the first calibration tick. */
+		PRIVILEGED_DATA static TickType_t xCalibrationStartTick = ( TickType_t ) 0U;                  /*< Tick count at the first calibration tick. */
+		PRIVILEGED_DATA static BaseType_t xCalibrationStarted = pdFALSE;                              /*< pdTRUE once the first calibration tick was taken. */
+#endif
+
+#endif
+
+#if ( configUSE_EDF_DVFS == 1 )
+		PRIVILEGED_DATA static uint32_t ulEDFActiveUtilisation = 0UL;                          /*< Sum of the utilisations reserved by the tasks, 16.16. */
+		PRIVILEGED_DATA static uint32_t ulEDFSpeed = tskEDF_SPEED_FULL;                         /*< Speed returned by configEDF_DVFS_SET_SPEED(), 16.16. */
+		PRIVILEGED_DATA static configRUN_TIME_COUNTER_TYPE ulEDFCyclesAccountedTime = 0UL;   /*< Run time counter when the work of the running task was last accounted. */
+#endif
+
+#if ( configUSE_EDF_SLACK_STEALING == 1 )
+		PRIVILEGED_DATA static volatile TickType_t xEDFSlack = 0U;                                  /*< Current slack in ticks. */
+		PRIVILEGED_DATA static TCB_t * pxEDFSlackTasks[ configEDF_SLACK_MAX_TASKS ];              /*< Periodic tasks the slack is computed for. */
+		PRIVILEGED_DATA static UBaseType_t uxEDFSlackTasks = 0U;
+		PRIVILEGED_DATA static TCB_t * pxEDFSlackStealers[ configEDF_SLACK_MAX_STEALERS ];        /*< Slack stealers. */
+		PRIVILEGED_DATA static UBaseType_t uxEDFSlackStealers = 0U;
+		PRIVILEGED_DATA static TickType_t xEDFSlackLeft[ configEDF_SLACK_MAX_TASKS ];             /*< Scratch: work left in the current job of each task. */
+		PRIVILEGED_DATA static TickType_t xEDFSlackNext[ configEDF_SLACK_MAX_TASKS ];             /*< Scratch: next release of each task, relative to now. */
+		PRIVILEGED_DATA static TickType_t xEDFSlackDeadline[ configEDF_SLACK_MAX_TASKS ];         /*< Scratch: deadline of the current job of each task, relative to now. */
+		PRIVILEGED_DATA static BaseType_t xEDFSlackActive[ configEDF_SLACK_MAX_TASKS ];           /*< Scratch: xTaskJobActive of each task. */
+#endif
+
+#if ( configUSE_EDF_SPORADIC == 1 )
+		PRIVILEGED_DATA static uint32_t ulEDFDensity = 0UL;                                       /*< Sum of the densities of the admitted tasks, 16.16. */
+		PRIVILEGED_DATA static TCB_t * pxEDFSporadicTasks[ configEDF_SPORADIC_MAX_TASKS ];        /*< Sporadic tasks. */
+		PRIVILEGED_DATA static UBaseType_t uxEDFSporadicTasks = 0U;
+		PRIVILEGED_DATA static volatile UBaseType_t uxEDFSporadicDeferred = 0U;                   /*< Deferred arrivals of all the sporadic tasks. */
+#endif
+
+#if ( configUSE_EDF_SCHEDULE_TABLE == 1 )
+		typedef struct xEDF_TABLE_ENTRY
+		{
+			TickType_t xTick; /*< Ticks from the start of the hyperperiod. */
+			TCB_t * pxTask;   /*< Task running from xTick, NULL for none. */
+		} EDFTableEntry_t;
+
+		PRIVILEGED_DATA static EDFTableEntry_t xEDFTable[ configEDF_SCHEDULE_TABLE_SIZE ];         /*< Switch points of one hyperperiod, the first one at tick 0. */
+		PRIVILEGED_DATA static UBaseType_t uxEDFTableEntries = 0U;                                /*< 0 until a table is built. */
+		PRIVILEGED_DATA static TickType_t xEDFTableHyperperiod = 0U;
+		PRIVILEGED_DATA static volatile BaseType_t xEDFTableActive = pdFALSE;                     /*< pdTRUE while the tasks are dispatched from the table. */
+		PRIVILEGED_DATA static TickType_t xEDFTableOffset = 0U;                                   /*< Ticks from the start of the hyperperiod. */
+		PRIVILEGED_DATA static UBaseType_t uxEDFTableNext = 0U;                                   /*< Next switch point. */
+		PRIVILEGED_DATA static TCB_t * pxEDFTableTask = NULL;                                     /*< Task of the last switch point. */
+		PRIVILEGED_DATA static TCB_t * pxEDFTableTasks[ configEDF_SCHEDULE_TABLE_MAX_TASKS ];     /*< Scratch: tasks the table is built for. */
+		PRIVILEGED_DATA static TickType_t xEDFTableLeft[ configEDF_SCHEDULE_TABLE_MAX_TASKS ];    /*< Scratch: work left in the current job of each task. */
+		PRIVILEGED_DATA static TickType_t xEDFTableDeadline[ configEDF_SCHEDULE_TABLE_MAX_TASKS ]; /*< Scratch: deadline of the current job of each task. */
+#endif
+
+#if ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 )
+		PRIVILEGED_DATA static TCB_t * pxEDFThresholdTasks[ configEDF_THRESHOLD_MAX_TASKS ];       /*< Scratch: tasks by increasing relative deadline. */
+		PRIVILEGED_DATA static uint32_t ulEDFThresholdDensity[ configEDF_THRESHOLD_MAX_TASKS ];    /*< Scratch: density of the tasks of relative deadline up to that of each task, 16.16. */
+		PRIVILEGED_DATA static TickType_t xEDFThresholdBlocking[ configEDF_THRESHOLD_MAX_TASKS ];  /*< Scratch: longest WCET blocking each task. */
+#endif
+
+#if ( configUSE_EDF_DEFERRED_PREEMPTION == 1 )
+		PRIVILEGED_DATA static volatile BaseType_t xEDFPreemptionDeferred = pdFALSE;              /*< pdTRUE while the running task is in a non-preemptive region. */
+		PRIVILEGED_DATA static TickType_t xEDFDeferredSince = 0U;                                 /*< Tick the region was opened at. */
+#endif
+
+#if ( configUSE_EDF_HIGH_RES_TIME == 1 )
+		PRIVILEGED_DATA static List_t xEDFTimerList;                                              /*< Tasks waiting in xTaskDelayUntilUs(), by wake time. */
+		PRIVILEGED_DATA static volatile TickType_t xEDFEpochUs = 0U;                              /*< Time the keys and wake times are counted from. */
+#endif
+
+#if ( configUSE_EDF_TICKLESS_KERNEL == 1 )
+		PRIVILEGED_DATA static volatile BaseType_t xEDFTicklessStarted = pdFALSE;                /*< pdTRUE once the one-shot timer has replaced the tick. */
+		PRIVILEGED_DATA static volatile BaseType_t xEDFTicklessEventSet = pdFALSE;               /*< pdTRUE while the event programmed is for xEDFTicklessEvent. */
+		PRIVILEGED_DATA static volatile TickType_t xEDFTicklessEvent = 0U;                       /*< Tick of the event programmed. */
+#endif
+
+		/* END of special for EDF */
+
+		/*lint -restore */
+
+		/*-----------------------------------------------------------*/
+
+		/* File private functions. --------------------------------*/
+
+		/**
+		 * Utility task that simply returns pdTRUE if the task referenced by xTask is
+		 * currently in the Suspended state, or pdFALSE if the task referenced by xTask
+		 * is in any other state.
+		 */
+#if ( INCLUDE_vTaskSuspend == 1 )
+
+		static BaseType_t prvTaskIsTaskSuspended( const TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+#endif /* INCLUDE_vTaskSuspend */
+
+		/*
+		 * Utility to ready all the lists used by the scheduler.  This is called
+		 * automatically upon the creation of the first task.
+		 */
+		static void prvInitialiseTaskLists( void ) PRIVILEGED_FUNCTION;
+
+		/*
+		 * The idle task, which as all tasks is implemented as a never ending loop.
+		 * The idle task is automatically created and added to the ready lists upon
+		 * creation of the first user task.
+		 *
+		 * The portTASK_FUNCTION_PROTO() macro is used to allow port/compiler specific
+		 * language extensions.  The equivalent prototype for this function is:
+		 *
+		 * void prvIdleTask( void *pvParameters );
+		 *
+		 */
+		static portTASK_FUNCTION_PROTO( prvIdleTask, pvParameters ) PRIVILEGED_FUNCTION;
+
+		/*
+		 * Utility to free all memory allocated by the scheduler to hold a TCB,
+		 * including the stack pointed to by the TCB.
+		 *
+		 * This does not free memory allocated by the task itself (i.e. memory
+		 * allocated by calls to pvPortMalloc from within the tasks application code).
+		 */
+#if ( INCLUDE_vTaskDelete == 1 )
+
+		static void prvDeleteTCB( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+		/*
+		 * Used only by the idle task.  This checks to see if anything has been placed
+		 * in the list of tasks waiting to be deleted.  If so the task is cleaned up
+		 * and its TCB deleted.
+		 */
+		static void prvCheckTasksWaitingTermination( void ) PRIVILEGED_FUNCTION;
+
+		/*
+		 * The currently executing task is entering the Blocked state.  Add the task to
+		 * either the current or the overflow delayed task list.
+		 */
+		static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
+				const BaseType_t xCanBlockIndefinitely ) PRIVILEGED_FUNCTION;
+
+		/*
+		 * Fills an TaskStatus_t structure with information on each task that is
+		 * referenced from the pxList list (which may be a ready list, a delayed list,
+		 * a suspended list, etc.).
+		 *
+		 * THIS FUNCTION IS INTENDED FOR DEBUGGING ONLY, AND SHOULD NOT BE CALLED FROM
+		 * NORMAL APPLICATION CODE.
+		 */
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+		static UBaseType_t prvListTasksWithinSingleList( TaskStatus_t * pxTaskStatusArray,
+				List_t * pxList,
+				eTaskState eState ) PRIVILEGED_FUNCTION;
+
+#endif
+
+		/*
+		 * Searches pxList for a task with name pcNameToQuery - returning a handle to
+		 * the task if it is found, or NULL if the task is not found.
+		 */
+#if ( ( INCLUDE_xTaskGetHandle == 1 ) && ( taskUSE_NAME_REGISTRY == 0 ) )
+
+		static TCB_t * prvSearchForNameWithinSingleList( List_t * pxList,
+				const char pcNameToQuery[] ) PRIVILEGED_FUNCTION;
+
+#endif
+
+		/* START of special for EDF */
+		/*
+		 * Hash of a task name, and adding a task to the name registry and
+		 * removing it.
+		 */
+#if ( taskUSE_NAME_REGISTRY == 1 )
+
+		static uint32_t prvTaskNameHash( const char * pcName ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+
+		static void prvTaskNameRegistryAdd( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+		static void prvTaskNameRegistryRemove( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+		/* END of special for EDF */
+
+		/*
+		 * When a task is created, the stack of the task is filled with a known value.
+		 * This function determines the 'high water mark' of the task stack by
+		 * determining how much of the stack remains at the original preset value.
+		 */
+#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) )
+
+		static configSTACK_DEPTH_TYPE prvTaskCheckFreeStackSpace( const uint8_t * pucStackByte ) PRIVILEGED_FUNCTION;
+
+#endif
+
+		/*
+		 * Return the amount of time, in ticks, that will pass before the kernel will
+		 * next move a task from the Blocked state to the Running state.
+		 *
+		 * This conditional compilation should use inequality to 0, not equality to 1.
+		 * This is to ensure portSUPPRESS_TICKS_AND_SLEEP() can be called when user
+		 * defined low power mode implementations require configUSE_TICKLESS_IDLE to be
+		 * set to a value other than 1.
+		 */
+#if ( configUSE_TICKLESS_IDLE != 0 )
+
+		static TickType_t prvGetExpectedIdleTime( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+		/*
+		 * Set xNextTaskUnblockTime to the time at which the next Blocked state task
+		 * will exit the Blocked state.
+		 */
+		static void prvResetNextTaskUnblockTime( void ) PRIVILEGED_FUNCTION;
+
+		/* START of special for EDF */
+		/*
+		 * Put the delayed task of pxItem, whose value is its wake time, in the
+		 * timing wheel; move the tasks of pxList that the wheel spans from xNow
+		 * to their slot; and move the slots the tick count xNow enters down,
+		 * returning pdTRUE if tasks wake at xNow.
+		 */
+#if ( configUSE_EDF_TIMING_WHEEL == 1 )
+
+		static void prvWheelInsert( ListItem_t * pxItem,
+				const TickType_t xNow ) PRIVILEGED_FUNCTION;
+
+		static void prvWheelCascade( List_t * pxList,
+				const TickType_t xNow ) PRIVILEGED_FUNCTION;
+
+		static BaseType_t prvWheelAdvance( const TickType_t xNow ) PRIVILEGED_FUNCTION;
+
+#endif
+		/* END of special for EDF */
+
+		/* START of special for EDF */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configGENERATE_RUN_TIME_STATS == 1 ) )
+
+#ifndef configRUN_TIME_COUNTS_PER_TICK
+
+		/*
+		 * Called from the tick interrupt until the number of run time counter
+		 * counts per tick is known.
+		 */
+		static void prvCalibrateRunTimeCounter( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+		/*
+		 * Time the calling task has spent in the Running state, in run time
+		 * counter counts, including the time since it was last switched in.
+		 */
+		static configRUN_TIME_COUNTER_TYPE prvGetCurrentTaskRunTime( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_EDF_DVFS == 1 )
+
+		/*
+		 * Add the work done by the running task since the last call, its run time
+		 * scaled by the speed, to its job.  Called before every change of speed
+		 * or of running task.
+		 */
+		static void prvEDFDvfsAccountCycles( void ) PRIVILEGED_FUNCTION;
+
+		/*
+		 * Make pxTCB reserve ulUtilisation, and set the speed if the sum
+		 * changed.  Called from a critical section.
+		 */
+		static void prvEDFDvfsSetUtilisation( TCB_t * pxTCB,
+				uint32_t ulUtilisation ) PRIVILEGED_FUNCTION;
+
+		/*
+		 * A job of pxTCB was released, reserve its WCET.  Called from a critical
+		 * section.
+		 */
+		static void prvEDFDvfsRelease( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+		/*
+		 * The running job of pxTCB completed, only keep the work it did reserved.
+		 * Called from a critical section.
+		 */
+		static void prvEDFDvfsComplete( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_EDF_SLACK_STEALING == 1 )
+
+		/*
+		 * A job of the periodic task pxTCB was released at xReleaseTime.
+		 * Called from a critical section.
+		 */
+		static void prvEDFSlackRelease( TCB_t * pxTCB,
+				TickType_t xReleaseTime ) PRIVILEGED_FUNCTION;
+
+		/*
+		 * Compute the slack again, see the top of the file, and move the slack
+		 * stealers ahead of or behind the periodic tasks if it went from or to
+		 * zero, leaving a yield pending if the running task has to change then.
+		 * Called with the scheduler suspended, not from a critical section.
+		 */
+		static void prvEDFSlackUpdate( void ) PRIVILEGED_FUNCTION;
+
+		/*
+		 * Give the slack stealers the deadline matching the slack, called when
+		 * it went from or to zero.  Returns pdTRUE if the running task has to
+		 * change.
+		 */
+		static BaseType_t prvEDFSlackMoveStealers( void ) PRIVILEGED_FUNCTION;
+
+		/*
+		 * Stop tracking pxTCB, which is being deleted.
+		 */
+		static void prvEDFSlackRemoveTask( const TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_EDF_SPORADIC == 1 )
+
+		/*
+		 * An event arrived for the sporadic task pxTCB.  Returns pdTRUE if a job
+		 * can be released now, after recording the release time, otherwise
+		 * defers the arrival and returns pdFALSE.  Called from a critical
+		 * section.
+		 */
+		static BaseType_t prvEDFSporadicArrival( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+		/*
+		 * Release the deferred arrivals whose minimum inter-arrival time has
+		 * passed.  Called by the tick, returns pdTRUE if the running task has to
+		 * change.
+		 */
+		static BaseType_t prvEDFSporadicReleaseDeferred( void ) PRIVILEGED_FUNCTION;
+
+		/*
+		 * Stop tracking pxTCB, which is being deleted, and give its density
+		 * back.  Called from a critical section.
+		 */
+		static void prvEDFSporadicRemoveTask( const TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+		/*
+		 * Returns xWCET / xDeadline, 16.16, rounded up as the test must not
+		 * admit a task set it cannot schedule, at most taskEDF_DENSITY_OVER.
+		 */
+		static uint32_t prvEDFDensity( TickType_t xWCET,
+				TickType_t xDeadline ) PRIVILEGED_FUNCTION;
+
+		/* Count pxTCB with ulDensity.  Called from a critical section. */
+		static void prvEDFSetDensity( TCB_t * pxTCB,
+				uint32_t ulDensity ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_TASK_NOTIFICATIONS == 1 ) )
+
+		/*
+		 * Release a job of pxTCB now, from a notification.  Sets the deadline of
+		 * the job, pxTCB must not be in a ready list.  Called from a critical
+		 * section.
+		 */
+		static void prvEDFNotifyRelease( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+		/*
+		 * Called by the calling task when it waits for the notification at
+		 * uxIndexToWait while one is already pending.  If that releases a job,
+		 * move the task to its new deadline and yield.  Called from a critical
+		 * section.
+		 */
+		static void prvEDFNotifyReleasePending( UBaseType_t uxIndexToWait ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( taskEDF_BATCH_RELEASE == 1 )
+
+		/*
+		 * Move the tasks of pxReleased, sorted by deadline, to the ready list.
+		 * Returns pdTRUE if the earliest of them preempts the running task.
+		 * Called from the tick.
+		 */
+		static BaseType_t prvEDFReleaseBatch( List_t * pxReleased ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_EDF_SCHEDULE_TABLE == 1 )
+
+		/*
+		 * Count the tick against the job running, dropping the table if the job
+		 * has overrun its WCET, and move to the next switch point of the table
+		 * if it is due.  Returns pdTRUE if a task switch is needed.  Called from
+		 * the tick.
+		 */
+		static BaseType_t prvEDFTableTick( void ) PRIVILEGED_FUNCTION;
+
+		/*
+		 * Drop the table: sort the ready list by deadline again and leave the
+		 * choice of the next task to EDF.  Called from a critical section or the
+		 * tick.
+		 */
+		static void prvEDFTableStop( void ) PRIVILEGED_FUNCTION;
+
+		/*
+		 * Pick the task to run from the table.  Called from the task switch.
+		 */
+		static void prvEDFTableSelect( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 )
+
+		/*
+		 * Pick the task to run: the running task if it is still ready and no
+		 * task ahead of it passes its threshold, the head of the ready list
+		 * otherwise.  Called from the task switch.
+		 */
+		static void prvEDFThresholdSelect( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_EDF_DEFERRED_PREEMPTION == 1 )
+
+		/*
+		 * Called when a task made ready would preempt the running task.  Returns
+		 * pdTRUE if it does, pdFALSE if the running task opens, or is in, a
+		 * non-preemptive region.  Called from a critical section or the tick.
+		 */
+		static BaseType_t prvEDFPreemptNow( void ) PRIVILEGED_FUNCTION;
+
+		/*
+		 * Returns pdTRUE if the running task goes on in its non-preemptive
+		 * region, otherwise closes the region.  Called from the task switch.
+		 */
+		static BaseType_t prvEDFPreemptionDeferred( void ) PRIVILEGED_FUNCTION;
+
+		/*
+		 * Demand of the jobs of the tasks created so far released at 0 and due
+		 * by xTime.
+		 */
+		static TickType_t prvEDFDemandBound( TickType_t xTime ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_EDF_HIGH_RES_TIME == 1 )
+
+		/*
+		 * Release the tasks of xEDFTimerList whose wake time has come and
+		 * program the alarm for the next one if any was released.  Returns
+		 * pdTRUE if a task released preempts the running task.  Called from the
+		 * alarm or the tick with the scheduler not suspended.
+		 */
+		static BaseType_t prvEDFTimerReleaseDue( void ) PRIVILEGED_FUNCTION;
+
+		/*
+		 * Move the epoch up when the time gets too far past it.  Called from the
+		 * tick.
+		 */
+		static void prvEDFRebase( void ) PRIVILEGED_FUNCTION;
+
+		/* Lower the values of the items of pxList by xDelta, down to 0. */
+		static void prvEDFRebaseList( List_t * pxList,
+				TickType_t xDelta ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_EDF_TICKLESS_KERNEL == 1 )
+
+		/*
+		 * Account for the ticks that passed since the last call, releasing the
+		 * jobs due, and program the next event.  Returns pdTRUE if the running
+		 * task is preempted.  Called with interrupts masked.
+		 */
+		static BaseType_t prvEDFTicklessAdvance( void ) PRIVILEGED_FUNCTION;
+
+		/*
+		 * Program the event for the next release or end of a non-preemptive
+		 * region, unless it already is or xForce is pdFALSE.  Called with
+		 * interrupts masked.
+		 */
+		static void prvEDFTicklessProgram( BaseType_t xForce ) PRIVILEGED_FUNCTION;
+
+		/* Bring xTickCount up to date from a task. */
+		static void prvEDFTicklessCatchUp( void ) PRIVILEGED_FUNCTION;
+
+#endif
+		/* END of special for EDF */
+
+		/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+
+		/*
+		 * Lock and unlock the partitions pxTCB can be queued in, in increasing
+		 * order.  Called with interrupts masked.
+		 */
+		static void prvEDFLockPartitionsOf( const TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+		static void prvEDFUnlockPartitionsOf( const TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+		/* Same for all the partitions. */
+		static void prvEDFLockAllPartitions( void ) PRIVILEGED_FUNCTION;
+		static void prvEDFUnlockAllPartitions( void ) PRIVILEGED_FUNCTION;
+
+		/*
+		 * pdTRUE if a core of xPartition has the scheduler suspended.  Called
+		 * with the lock of the partition held.
+		 */
+		static BaseType_t prvEDFPartitionSuspended( BaseType_t xPartition ) PRIVILEGED_FUNCTION;
+
+		/*
+		 * pdTRUE if the next tick of the calling core's partition wakes a task
+		 * that is also in an event list, so the tick needs the ISR lock.
+		 * Called with the lock of the partition held.
+		 */
+		static BaseType_t prvEDFTickNeedsEventLists( void ) PRIVILEGED_FUNCTION;
+
+#if ( configUSE_EDF_SEMI_PARTITIONED == 1 )
+
+		/*
+		 * pdTRUE if the next tick of the calling core moves a split job to
+		 * another partition: the job running here uses up its budget, or a job
+		 * woken here is released on its first core.  The tick then locks all
+		 * the partitions.  Called with the lock of the partition held.
+		 */
+		static BaseType_t prvEDFTickMovesSplitJob( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+		/*
+		 * Make xCoreID run the earliest deadline ready task that no other core
+		 * runs.  Called with the lock of the partition of xCoreID held.
+		 */
+		static void prvEDFSelectTaskForCore( BaseType_t xCoreID ) PRIVILEGED_FUNCTION;
+
+		/*
+		 * Called with the partitions of pxTCB locked when it was made ready.  If pxTCB
+		 * has to preempt a core, that is an idle core or else the core running
+		 * the latest deadline, later than the one of pxTCB.  Returns pdTRUE if
+		 * that is the calling core, otherwise interrupts the core and returns
+		 * pdFALSE.  Cores whose bit is set in *puxCoresYielding were already
+		 * interrupted and are skipped; the bit of the core chosen is set.
+		 * puxCoresYielding can be NULL.
+		 */
+		static BaseType_t prvEDFPreemptCoreFor( const TCB_t * pxTCB,
+				UBaseType_t * puxCoresYielding ) PRIVILEGED_FUNCTION;
+
+#if ( configUSE_EDF_SEMI_PARTITIONED == 1 )
+
+		/*
+		 * Called when a job of pxTCB is released, after its item value was set
+		 * to the deadline of the job and before it is added to a ready list.  If
+		 * the task is split, queue the job on the first core with the local
+		 * deadline and a full budget.
+		 */
+		static void prvEDFSplitRelease( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+		/*
+		 * Called from the tick of each core.  Charge the tick to the split job
+		 * running on the calling core, if any, and migrate it to its second core
+		 * when its budget is used up.  Returns pdTRUE if the calling core has to
+		 * switch context, like prvEDFPreemptCoreFor().
+		 */
+		static BaseType_t prvEDFSplitCharge( UBaseType_t * puxCoresYielding ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#endif
+		/* END of special for EDF */
+
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
+
+		/*
+		 * Helper function used to pad task names with spaces when printing out
+		 * human readable tables of task information.
+		 */
+		static char * prvWriteNameToBuffer( char * pcBuffer,
+				const char * pcTaskName ) PRIVILEGED_FUNCTION;
+
+#endif
+
+		/*
+		 * Called after a Task_t structure has been allocated either statically or
+		 * dynamically to fill in the structure's members.
+		 */
+		static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
+				const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+				const uint32_t ulStackDepth,
+				void * const pvParameters,
+				UBaseType_t uxPriority,
+				TaskHandle_t * const pxCreatedTask,
+				TCB_t * pxNewTCB,
+				const MemoryRegion_t * const xRegions ) PRIVILEGED_FUNCTION;
+
+		/*
+		 * Called after a new task has been created and initialised to place the task
+		 * under the control of the scheduler.
+		 */
+		static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
+
+		/*
+		 * freertos_tasks_c_additions_init() should only be called if the user definable
+		 * macro FREERTOS_TASKS_C_ADDITIONS_INIT() is defined, as that is the only macro
+		 * called by the function.
+		 */
+#ifdef FREERTOS_TASKS_C_ADDITIONS_INIT
+
+		static void freertos_tasks_c_additions_init( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+		/*-----------------------------------------------------------*/
+
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+		TaskHandle_t xTaskCreateStatic( TaskFunction_t pxTaskCode,
+				const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+				const uint32_t ulStackDepth,
+				void * const pvParameters,
+				UBaseType_t uxPriority,
+				StackType_t * const puxStackBuffer,
+				StaticTask_t * const pxTaskBuffer )
+		{
+			TCB_t * pxNewTCB;
+			TaskHandle_t xReturn;
+
+			configASSERT( puxStackBuffer != NULL );
+			configASSERT( pxTaskBuffer != NULL );
+
+#if ( configASSERT_DEFINED == 1 )
+			{
+				/* Sanity check that the size of the structure used to declare a
+				 * variable of type StaticTask_t equals the size of the real task
+				 * structure. */
+				volatile size_t xSize = sizeof( StaticTask_t );
+				configASSERT( xSize == sizeof( TCB_t ) );
+				( void ) xSize; /* Prevent lint warning when configASSERT() is not used. */
+			}
+#endif /* configASSERT_DEFINED */
+
+			if( ( pxTaskBuffer != NULL ) && ( puxStackBuffer != NULL ) )
+			{
+				/* The memory used for the task's TCB and stack are passed into this
+				 * function - use them. */
+				pxNewTCB = ( TCB_t * ) pxTaskBuffer; /*lint !e740 !e9087 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked by an assert. */
+				pxNewTCB->pxStack = ( StackType_t * ) puxStackBuffer;
+
+#if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e731 !e9029 Macro has been consolidated for readability reasons. */
+				{
+					/* Tasks can be created statically or dynamically, so note this
+					 * task was created statically in case the task is later deleted. */
+					pxNewTCB->ucStaticallyAllocated = tskSTATICALLY_ALLOCATED_STACK_AND_TCB;
+				}
+#endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
+
+				prvInitialiseNewTask( pxTaskCode, pcName, ulStackDepth, pvParameters, uxPriority, &xReturn, pxNewTCB, NULL );
+				prvAddNewTaskToReadyList( pxNewTCB );
+			}
+			else
+			{
+				xReturn = NULL;
+			}
+
+			return xReturn;
+		}
+
+#endif /* SUPPORT_STATIC_ALLOCATION */
+		/*-----------------------------------------------------------*/
+
+#if ( ( portUSING_MPU_WRAPPERS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+
+		BaseType_t xTaskCreateRestrictedStatic( const TaskParameters_t * const pxTaskDefinition,
+				TaskHandle_t * pxCreatedTask )
+		{
+			TCB_t * pxNewTCB;
+			BaseType_t xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+
+			configASSERT( pxTaskDefinition->puxStackBuffer != NULL );
+			configASSERT( pxTaskDefinition->pxTaskBuffer != NULL );
+
+			if( ( pxTaskDefinition->puxStackBuffer != NULL ) && ( pxTaskDefinition->pxTaskBuffer != NULL ) )
+			{
+				/* Allocate space for the TCB.  Where the memory comes from depends
+				 * on the implementation of the port malloc function and whether or
+				 * not static allocation is being used. */
+				pxNewTCB = ( TCB_t * ) pxTaskDefinition->pxTaskBuffer;
+
+				/* Store the stack location in the TCB. */
+				pxNewTCB->pxStack = pxTaskDefinition->puxStackBuffer;
+
+#if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
+				{
+					/* Tasks can be created statically or dynamically, so note this
+					 * task was created statically in case the task is later deleted. */
+					pxNewTCB->ucStaticallyAllocated = tskSTATICALLY_ALLOCATED_STACK_AND_TCB;
+				}
+#endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
+
+				prvInitialiseNewTask( pxTaskDefinition->pvTaskCode,
+						pxTaskDefinition->pcName,
+						( uint32_t ) pxTaskDefinition->usStackDepth,
+						pxTaskDefinition->pvParameters,
+						pxTaskDefinition->uxPriority,
+						pxCreatedTask, pxNewTCB,
+						pxTaskDefinition->xRegions );
+
+				prvAddNewTaskToReadyList( pxNewTCB );
+				xReturn = pdPASS;
+			}
+
+			return xReturn;
+		}
+
+#endif /* ( portUSING_MPU_WRAPPERS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
+		/*-----------------------------------------------------------*/
+
+#if ( ( portUSING_MPU_WRAPPERS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+		BaseType_t xTaskCreateRestricted( const TaskParameters_t * const pxTaskDefinition,
+				TaskHandle_t * pxCreatedTask )
+		{
+			TCB_t * pxNewTCB;
+			BaseType_t xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+
+			configASSERT( pxTaskDefinition->puxStackBuffer );
+
+			if( pxTaskDefinition->puxStackBuffer != NULL )
+			{
+				/* Allocate space for the TCB.  Where the memory comes from depends
+				 * on the implementation of the port malloc function and whether or
+				 * not static allocation is being used. */
+				pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+
+				if( pxNewTCB != NULL )
+				{
+					/* Store the stack location in the TCB. */
+					pxNewTCB->pxStack = pxTaskDefinition->puxStackBuffer;
+
+#if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
+					{
+						/* Tasks can be created statically or dynamically, so note
+						 * this task had a statically allocated stack in case it is
+						 * later deleted.  The TCB was allocated dynamically. */
+						pxNewTCB->ucStaticallyAllocated = tskSTATICALLY_ALLOCATED_STACK_ONLY;
+					}
+#endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
+
+					prvInitialiseNewTask( pxTaskDefinition->pvTaskCode,
+							pxTaskDefinition->pcName,
+							( uint32_t ) pxTaskDefinition->usStackDepth,
+							pxTaskDefinition->pvParameters,
+							pxTaskDefinition->uxPriority,
+							pxCreatedTask, pxNewTCB,
+							pxTaskDefinition->xRegions );
+
+					prvAddNewTaskToReadyList( pxNewTCB );
+					xReturn = pdPASS;
+				}
+			}
+
+			return xReturn;
+		}
+
+#endif /* portUSING_MPU_WRAPPERS */
+		/*-----------------------------------------------------------*/
+
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 && configUSE_EDF_SCHEDULER == 0 )
+
+		BaseType_t xTaskCreate( TaskFunction_t pxTaskCode,
+				const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+				const configSTACK_DEPTH_TYPE usStackDepth,
+				void * const pvParameters,
+				UBaseType_t uxPriority,
+				TaskHandle_t * const pxCreatedTask )
+		{
+			TCB_t * pxNewTCB;
+			BaseType_t xReturn;
+
+			/* If the stack grows down then allocate the stack then the TCB so the stack
+			 * does not grow into the TCB.  Likewise if the stack grows up then allocate
+			 * the TCB then the stack. */
+#if ( portSTACK_GROWTH > 0 )
+			{
+				/* Allocate space for the TCB.  Where the memory comes from depends on
+				 * the implementation of the port malloc function and whether or not static
+				 * allocation is being used. */
+				pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+
+				if( pxNewTCB != NULL )
+				{
+					/* Allocate space for the stack used by the task being created.
+					 * The base of the stack memory stored in the TCB so the task can
+					 * be deleted later if required. */
+					pxNewTCB->pxStack = ( StackType_t * ) pvPortMallocStack( ( ( ( size_t ) usStackDepth ) * sizeof( StackType_t ) ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+					if( pxNewTCB->pxStack == NULL )
+					{
+						/* Could not allocate the stack.  Delete the allocated TCB. */
+						vPortFree( pxNewTCB );
+						pxNewTCB = NULL;
+					}
+				}
+			}
+#else /* portSTACK_GROWTH */
+			{
+				StackType_t * pxStack;
+
+				/* Allocate space for the stack used by the task being created. */
+				pxStack = pvPortMallocStack( ( ( ( size_t ) usStackDepth ) * sizeof( StackType_t ) ) ); /*lint !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack and this allocation is the stack. */
+
+				if( pxStack != NULL )
+				{
+					/* Allocate space for the TCB. */
+					pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) ); /*lint !e9087 !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack, and the first member of TCB_t is always a pointer to the task's stack. */
+
+					if( pxNewTCB != NULL )
+					{
+						/* Store the stack location in the TCB. */
+						pxNewTCB->pxStack = pxStack;
+					}
+					else
+					{
+						/* The stack cannot be used as the TCB was not created.  Free
+						 * it again. */
+						vPortFreeStack( pxStack );
+					}
+				}
+				else
+				{
+					pxNewTCB = NULL;
+				}
+			}
+#endif /* portSTACK_GROWTH */
+
+			if( pxNewTCB != NULL )
+			{
+#if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e9029 !e731 Macro has been consolidated for readability reasons. */
+				{
+					/* Tasks can be created statically or dynamically, so note this
+					 * task was created dynamically in case it is later deleted. */
+					pxNewTCB->ucStaticallyAllocated = tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB;
+				}
+#endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
+
+				prvInitialiseNewTask( pxTaskCode, pcName, ( uint32_t ) usStackDepth, pvParameters, uxPriority, pxCreatedTask, pxNewTCB, NULL );
+				prvAddNewTaskToReadyList( pxNewTCB );
+				xReturn = pdPASS;
+			}
+			else
+			{
+				xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+			}
+
+			return xReturn;
+		}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+		/*-----------------------------------------------------------*/
+		/* START of special for EDF */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 && configUSE_EDF_SCHEDULER == 1 ) 
+
+		BaseType_t xTaskPeriodicCreate( TaskFunction_t pxTaskCode,
+				const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+				const configSTACK_DEPTH_TYPE usStackDepth,
+				void * const pvParameters,
+				UBaseType_t uxPriority,
+				TaskHandle_t * const pxCreatedTask,
+				TickType_t uxPeriod	)
+		{
+			/* Implicit deadline, the deadline of each job is the next release. */
+			return xTaskPeriodicCreateWithDeadline( pxTaskCode, pcName, usStackDepth, pvParameters, uxPriority, pxCreatedTask, uxPeriod, uxPeriod );
+		}
+		/*-----------------------------------------------------------*/
+
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_EDF_PARTITIONED == 1 ) )
+		BaseType_t xTaskPeriodicCreateWithDeadline( TaskFunction_t pxTaskCode,
+				const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+				const configSTACK_DEPTH_TYPE usStackDepth,
+				void * const pvParameters,
+				UBaseType_t uxPriority,
+				TaskHandle_t * const pxCreatedTask,
+				TickType_t uxPeriod,
+				TickType_t uxDeadline )
+		{
+			BaseType_t xCoreID;
+
+			/* Bound to the calling core, which is core 0 before the scheduler
+			 * is started. */
+			taskENTER_CRITICAL();
+			{
+				xCoreID = ( BaseType_t ) portGET_CORE_ID();
+			}
+			taskEXIT_CRITICAL();
+
+			return xTaskPeriodicCreateOnCore( pxTaskCode, pcName, usStackDepth, pvParameters, uxPriority, pxCreatedTask, uxPeriod, uxDeadline, xCoreID );
+		}
+		/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SEMI_PARTITIONED == 1 )
+		BaseType_t xTaskPeriodicCreateOnCore( TaskFunction_t pxTaskCode,
+				const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+				const configSTACK_DEPTH_TYPE usStackDepth,
+				void * const pvParameters,
+				UBaseType_t uxPriority,
+				TaskHandle_t * const pxCreatedTask,
+				TickType_t uxPeriod,
+				TickType_t uxDeadline,
+				BaseType_t xCoreID )
+		{
+			return xTaskPeriodicCreateSplit( pxTaskCode, pcName, usStackDepth, pvParameters, uxPriority, pxCreatedTask, uxPeriod, uxDeadline, xCoreID, 0, 0, taskTASK_NOT_SPLIT );
+		}
+		/*-----------------------------------------------------------*/
+
+		BaseType_t xTaskPeriodicCreateSplit( TaskFunction_t pxTaskCode,
+				const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+				const configSTACK_DEPTH_TYPE usStackDepth,
+				void * const pvParameters,
+				UBaseType_t uxPriority,
+				TaskHandle_t * const pxCreatedTask,
+				TickType_t uxPeriod,
+				TickType_t uxDeadline,
+				BaseType_t xCoreID,
+				TickType_t uxFirstBudget,
+				TickType_t uxFirstDeadline,
+				BaseType_t xSecondCore )
+#else
+		BaseType_t xTaskPeriodicCreateOnCore( TaskFunction_t pxTaskCode,
+				const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+				const configSTACK_DEPTH_TYPE usStackDepth,
+				void * const pvParameters,
+				UBaseType_t uxPriority,
+				TaskHandle_t * const pxCreatedTask,
+				TickType_t uxPeriod,
+				TickType_t uxDeadline,
+				BaseType_t xCoreID )
+#endif
+#else
+		BaseType_t xTaskPeriodicCreateWithDeadline( TaskFunction_t pxTaskCode,
+				const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+				const configSTACK_DEPTH_TYPE usStackDepth,
+				void * const pvParameters,
+				UBaseType_t uxPriority,
+				TaskHandle_t * const pxCreatedTask,
+				TickType_t uxPeriod,
+				TickType_t uxDeadline )
+#endif
+		{
+			TCB_t * pxNewTCB;
+			BaseType_t xReturn;
+
+			/* Only implicit and constrained deadlines are supported. */
+			configASSERT( ( uxDeadline > ( TickType_t ) 0U ) && ( uxDeadline <= uxPeriod ) );
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_EDF_PARTITIONED == 1 ) )
+			configASSERT( ( xCoreID >= 0 ) && ( xCoreID < ( BaseType_t ) configNUMBER_OF_CORES ) );
+#endif
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_EDF_SEMI_PARTITIONED == 1 ) )
+			configASSERT( ( xSecondCore < 0 ) ||
+						  ( ( xSecondCore >= 0 ) && ( xSecondCore < ( BaseType_t ) configNUMBER_OF_CORES ) && ( xSecondCore != xCoreID ) &&
+							( uxFirstBudget > ( TickType_t ) 0U ) && ( uxFirstBudget <= uxFirstDeadline ) && ( uxFirstDeadline < uxDeadline ) ) );
+#endif
+
+			/* If the stack grows down then allocate the stack then the TCB so the stack
+			 * does not grow into the TCB.  Likewise if the stack grows up then allocate
+			 * the TCB then the stack. */
+#if ( portSTACK_GROWTH > 0 )
+			{
+				/* Allocate space for the TCB.  Where the memory comes from depends on
+				 * the implementation of the port malloc function and whether or not static
+				 * allocation is being used. */
+				pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+
+				if( pxNewTCB != NULL )
+				{
+					/* Allocate space for the stack used by the task being created.
+					 * The base of the stack memory stored in the TCB so the task can
+					 * be deleted later if required. */
+					pxNewTCB->pxStack = ( StackType_t * ) pvPortMallocStack( ( ( ( size_t ) usStackDepth ) * sizeof( StackType_t ) ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+					if( pxNewTCB->pxStack == NULL )
+					{
+						/* Could not allocate the stack.  Delete the allocated TCB. */
+						vPortFree( pxNewTCB );
+						pxNewTCB = NULL;
+					}
+				}
+			}
+#else /* portSTACK_GROWTH */
+			{
+				StackType_t * pxStack;
+
+				/* Allocate space for the stack used by the task being created. */
+				pxStack = pvPortMallocStack( ( ( ( size_t ) usStackDepth ) * sizeof( StackType_t ) ) ); /*lint !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack and this allocation is the stack. */
+
+				if( pxStack != NULL )
+				{
+					/* Allocate space for the TCB. */
+					pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) ); /*lint !e9087 !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack, and the first member of TCB_t is always a pointer to the task's stack. */
+
+					if( pxNewTCB != NULL )
+					{
+						/* Store the stack location in the TCB. */
+						pxNewTCB->pxStack = pxStack;
+					}
+					else
+					{
+						/* The stack cannot be used as the TCB was not created.  Free
+						 * it again. */
+						vPortFreeStack( pxStack );
+					}
+				}
+				else
+				{
+					pxNewTCB = NULL;
+				}
+			}
+#endif /* portSTACK_GROWTH */
+
+			if( pxNewTCB != NULL )
+			{
+#if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e9029 !e731 Macro has been consolidated for readability reasons. */
+				{
+					/* Tasks can be created statically or dynamically, so note this
+					 * task was created dynamically in case it is later deleted. */
+					pxNewTCB->ucStaticallyAllocated = tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB;
+				}
+#endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
+
+				prvInitialiseNewTask( pxTaskCode, pcName, ( uint32_t ) usStackDepth, pvParameters, uxPriority, pxCreatedTask, pxNewTCB, NULL );
+
+				/* start of special for EDF */
+				pxNewTCB->xTaskPeriod = uxPeriod;
+				pxNewTCB->xTaskRelativeDeadline = uxDeadline;
+#if ( configUSE_EDF_HIGH_RES_TIME == 1 )
+				pxNewTCB->xTaskRelativeDeadlineUs = uxDeadline * taskEDF_US_PER_TICK;
+				configASSERT( pxNewTCB->xTaskRelativeDeadlineUs < taskEDF_EPOCH_LAG );
+#endif
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_EDF_PARTITIONED == 1 ) )
+				/* First, the first deadline counts from the tick of the core. */
+				pxNewTCB->xTaskCore = xCoreID;
+#endif
+				pxNewTCB->xTaskAbsoluteDeadline = taskEDF_RELEASE_DEADLINE( pxNewTCB, taskEDF_TASK_TICK_COUNT( pxNewTCB ) );
+				pxNewTCB->ulTaskJobs = 1UL;
+				pxNewTCB->ulTaskDeadlineMisses = 0UL;
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+				pxNewTCB->uxTaskReleaseNotifyIndex = tskEDF_NO_RELEASE_ON_NOTIFY;
+#endif
+#if ( configNUMBER_OF_CORES > 1 )
+				pxNewTCB->xTaskRunState = taskTASK_NOT_RUNNING;
+#endif
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_EDF_SEMI_PARTITIONED == 1 ) )
+				pxNewTCB->xTaskFirstCore = xCoreID;
+				pxNewTCB->xTaskSplitCore = ( xSecondCore < 0 ) ? taskTASK_NOT_SPLIT : xSecondCore;
+				pxNewTCB->xTaskSplitBudget = uxFirstBudget;
+				pxNewTCB->xTaskSplitDeadline = uxFirstDeadline;
+				prvEDFSplitRelease( pxNewTCB );
+#endif
+#if ( taskEDF_USE_WCET )
+				pxNewTCB->xTaskWCET = uxPeriod;
+#endif
+#if ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 )
+				pxNewTCB->xTaskPreemptionThreshold = portMAX_DELAY;
+#endif
+#if ( configUSE_EDF_DEFERRED_PREEMPTION == 1 )
+				pxNewTCB->xTaskNonPreemptiveTicks = 0U;
+#endif
+#if ( configUSE_EDF_SCHEDULE_TABLE == 1 )
+				pxNewTCB->xTaskTableRun = 0U;
+#endif
+#if ( configUSE_EDF_SLACK_STEALING == 1 )
+				pxNewTCB->xTaskSlackStealer = pdFALSE;
+
+				taskENTER_CRITICAL();
+				{
+					configASSERT( uxEDFSlackTasks < ( UBaseType_t ) configEDF_SLACK_MAX_TASKS );
+					pxEDFSlackTasks[ uxEDFSlackTasks++ ] = pxNewTCB;
+					prvEDFSlackRelease( pxNewTCB, xTickCount );
+				}
+				taskEXIT_CRITICAL();
+#endif
+#if ( configUSE_EDF_SPORADIC == 1 )
+				pxNewTCB->xTaskSporadic = pdFALSE;
+				pxNewTCB->uxTaskDeferredArrivals = 0U;
+				pxNewTCB->uxTaskEarlyArrivals = 0U;
+				pxNewTCB->uxTaskPendingHead = 0U;
+				pxNewTCB->uxTaskPendingCount = 0U;
+				pxNewTCB->ulTaskDensity = 0UL;
+
+				if( pxTaskCode != prvIdleTask )
+				{
+					/* Counted with a WCET of its period until it is set. */
+					taskENTER_CRITICAL();
+					{
+						prvEDFSetDensity( pxNewTCB, prvEDFDensity( uxPeriod, uxDeadline ) );
+					}
+					taskEXIT_CRITICAL();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+#endif
+#if ( configUSE_EDF_DVFS == 1 )
+				pxNewTCB->ulTaskUtilisation = 0UL;
+
+				taskENTER_CRITICAL();
+				{
+					prvEDFDvfsRelease( pxNewTCB );
+				}
+				taskEXIT_CRITICAL();
+#endif
+				/*end of special for EDF */
+
+				prvAddNewTaskToReadyList( pxNewTCB );
+
+				/* START of special for EDF */
+#if ( configUSE_EDF_SLACK_STEALING == 1 )
+				/* The new job takes some of the slack. */
+				vTaskSuspendAll();
+				{
+					prvEDFSlackUpdate();
+				}
+				( void ) xTaskResumeAll();
+#endif
+				/* END of special for EDF */
+
+				xReturn = pdPASS;
+			}
+			else
+			{
+				xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+			}
+
+			return xReturn;
+		}
+
+#endif /* configSUPPORT_EDF_DYNAMIC_ALLOCATION */
+		/*-----------------------------------------------------------*/
+
+		static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
+				const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+				const uint32_t ulStackDepth,
+				void * const pvParameters,
+				UBaseType_t uxPriority,
+				TaskHandle_t * const pxCreatedTask,
+				TCB_t * pxNewTCB,
+				const MemoryRegion_t * const xRegions )
+		{
+			StackType_t * pxTopOfStack;
+			UBaseType_t x;
+
+#if ( portUSING_MPU_WRAPPERS == 1 )
+			/* Should the task be created in privileged mode? */
+			BaseType_t xRunPrivileged;
+
+			if( ( uxPriority & portPRIVILEGE_BIT ) != 0U )
+			{
+				xRunPrivileged = pdTRUE;
+			}
+			else
+			{
+				xRunPrivileged = pdFALSE;
+			}
+			uxPriority &= ~portPRIVILEGE_BIT;
+#endif /* portUSING_MPU_WRAPPERS == 1 */
+
+			/* Avoid dependency on memset() if it is not required. */
+#if ( tskSET_NEW_STACKS_TO_KNOWN_VALUE == 1 )
+			{
+				/* Fill the stack with a known value to assist debugging. */
+				( void ) memset( pxNewTCB->pxStack, ( int ) tskSTACK_FILL_BYTE, ( size_t ) ulStackDepth * sizeof( StackType_t ) );
+			}
+#endif /* tskSET_NEW_STACKS_TO_KNOWN_VALUE */
+
+			/* Calculate the top of stack address.  This depends on whether the stack
+			 * grows from high memory to low (as per the 80x86) or vice versa.
+			 * portSTACK_GROWTH is used to make the result positive or negative as required
+			 * by the port. */
+#if ( portSTACK_GROWTH < 0 )
+			{
+				pxTopOfStack = &( pxNewTCB->pxStack[ ulStackDepth - ( uint32_t ) 1 ] );
+				pxTopOfStack = ( StackType_t * ) ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack ) & ( ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) ) ); /*lint !e923 !e9033 !e9078 MISRA exception.  Avoiding casts between pointers and integers is not practical.  Size differences accounted for using portPOINTER_SIZE_TYPE type.  Checked by assert(). */
+
+				/* Check the alignment of the calculated top of stack is correct. */
+				configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack & ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) == 0UL ) );
+
+#if ( configRECORD_STACK_HIGH_ADDRESS == 1 )
+				{
+					/* Also record the stack's high address, which may assist
+					 * debugging. */
+					pxNewTCB->pxEndOfStack = pxTopOfStack;
+				}
+#endif /* configRECORD_STACK_HIGH_ADDRESS */
+			}
+#else /* portSTACK_GROWTH */
+			{
+				pxTopOfStack = pxNewTCB->pxStack;
+
+				/* Check the alignment of the stack buffer is correct. */
+				configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pxNewTCB->pxStack & ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) == 0UL ) );
+
+				/* The other extreme of the stack space is required if stack checking is
+				 * performed. */
+				pxNewTCB->pxEndOfStack = pxNewTCB->pxStack + ( ulStackDepth - ( uint32_t ) 1 );
+			}
+#endif /* portSTACK_GROWTH */
+
+			/* Store the task name in the TCB. */
+			if( pcName != NULL )
+			{
+				for( x = ( UBaseType_t ) 0; x < ( UBaseType_t ) configMAX_TASK_NAME_LEN; x++ )
+				{
+					pxNewTCB->pcTaskName[ x ] = pcName[ x ];
+
+					/* Don't copy all configMAX_TASK_NAME_LEN if the string is shorter than
+					 * configMAX_TASK_NAME_LEN characters just in case the memory after the
+					 * string is not accessible (extremely unlikely). */
+					if( pcName[ x ] == ( char ) 0x00 )
+					{
+						break;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+
+				/* Ensure the name string is terminated in the case that the string length
+				 * was greater or equal to configMAX_TASK_NAME_LEN. */
+				pxNewTCB->pcTaskName[ configMAX_TASK_NAME_LEN - 1 ] = '\0';
+			}
+			else
+			{
+				/* The task has not been given a name, so just ensure there is a NULL
+				 * terminator when it is read out. */
+				pxNewTCB->pcTaskName[ 0 ] = 0x00;
+			}
+
+			/* This is used as an array index so must ensure it's not too large. */
+			configASSERT( uxPriority < configMAX_PRIORITIES );
+
+			if( uxPriority >= ( UBaseType_t ) configMAX_PRIORITIES )
+			{
+				uxPriority = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) 1U;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxNewTCB->uxPriority = uxPriority;
+#if ( configUSE_MUTEXES == 1 )
+			{
+				pxNewTCB->uxBasePriority = uxPriority;
+				pxNewTCB->uxMutexesHeld = 0;
+			}
+#endif /* configUSE_MUTEXES */
+
+			vListInitialiseItem( &( pxNewTCB->xStateListItem ) );
+			vListInitialiseItem( &( pxNewTCB->xEventListItem ) );
+
+			/* Set the pxNewTCB as a link back from the ListItem_t.  This is so we can get
+			 * back to  the containing TCB from a generic item in a list. */
+			listSET_LIST_ITEM_OWNER( &( pxNewTCB->xStateListItem ), pxNewTCB );
+
+			/* Event lists are always in priority order. */
+			listSET_LIST_ITEM_VALUE( &( pxNewTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+			listSET_LIST_ITEM_OWNER( &( pxNewTCB->xEventListItem ), pxNewTCB );
+
+#if ( portCRITICAL_NESTING_IN_TCB == 1 )
+			{
+				pxNewTCB->uxCriticalNesting = ( UBaseType_t ) 0U;
+			}
+#endif /* portCRITICAL_NESTING_IN_TCB */
+
+#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+			{
+				pxNewTCB->pxTaskTag = NULL;
+			}
+#endif /* configUSE_APPLICATION_TASK_TAG */
+
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+			{
+				pxNewTCB->ulRunTimeCounter = ( configRUN_TIME_COUNTER_TYPE ) 0;
+			}
+#endif /* configGENERATE_RUN_TIME_STATS */
+
+#if ( portUSING_MPU_WRAPPERS == 1 )
+			{
+				vPortStoreTaskMPUSettings( &( pxNewTCB->xMPUSettings ), xRegions, pxNewTCB->pxStack, ulStackDepth );
+			}
+#else
+			{
+				/* Avoid compiler warning about unreferenced parameter. */
+				( void ) xRegions;
+			}
+#endif
+
+#if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0 )
+			{
+				memset( ( void * ) &( pxNewTCB->pvThreadLocalStoragePointers[ 0 ] ), 0x00, sizeof( pxNewTCB->pvThreadLocalStoragePointers ) );
+			}
+#endif
+
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+			{
+				memset( ( void * ) &( pxNewTCB->ulNotifiedValue[ 0 ] ), 0x00, sizeof( pxNewTCB->ulNotifiedValue ) );
+				memset( ( void * ) &( pxNewTCB->ucNotifyState[ 0 ] ), 0x00, sizeof( pxNewTCB->ucNotifyState ) );
+			}
+#endif
+
+#if ( configUSE_NEWLIB_REENTRANT == 1 )
+			{
+				/* Initialise this task's Newlib reent structure.
+				 * See the third party link http://www.nadler.com/embedded/newlibAndFreeRTOS.html
+				 * for additional information. */
+				_REENT_INIT_PTR( ( &( pxNewTCB->xNewLib_reent ) ) );
+			}
+#endif
+
+#if ( INCLUDE_xTaskAbortDelay == 1 )
+			{
+				pxNewTCB->ucDelayAborted = pdFALSE;
+			}
+#endif
+
+			/* Initialize the TCB stack to look as if the task was already running,
+			 * but had been interrupted by the scheduler.  The return address is set
+			 * to the start of the task function. Once the stack has been initialised
+			 * the top of stack variable is updated. */
+#if ( portUSING_MPU_WRAPPERS == 1 )
+			{
+				/* If the port has capability to detect stack overflow,
+				 * pass the stack end address to the stack initialization
+				 * function as well. */
+#if ( portHAS_STACK_OVERFLOW_CHECKING == 1 )
+				{
+#if ( portSTACK_GROWTH < 0 )
+					{
+						pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxStack, pxTaskCode, pvParameters, xRunPrivileged );
+					}
+#else /* portSTACK_GROWTH */
+					{
+						pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxEndOfStack, pxTaskCode, pvParameters, xRunPrivileged );
+					}
+#endif /* portSTACK_GROWTH */
+				}
+#else /* portHAS_STACK_OVERFLOW_CHECKING */
+				{
+					pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTaskCode, pvParameters, xRunPrivileged );
+				}
+#endif /* portHAS_STACK_OVERFLOW_CHECKING */
+			}
+#else /* portUSING_MPU_WRAPPERS */
+			{
+				/* If the port has capability to detect stack overflow,
+				 * pass the stack end address to the stack initialization
+				 * function as well. */
+#if ( portHAS_STACK_OVERFLOW_CHECKING == 1 )
+				{
+#if ( portSTACK_GROWTH < 0 )
+					{
+						pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxStack, pxTaskCode, pvParameters );
+					}
 #else /* portSTACK_GROWTH */
+					{
+						pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxEndOfStack, pxTaskCode, pvParameters );
+					}
+#endif /* portSTACK_GROWTH */
+				}
+#else /* portHAS_STACK_OVERFLOW_CHECKING */
+				{
+					pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTaskCode, pvParameters );
+				}
+#endif /* portHAS_STACK_OVERFLOW_CHECKING */
+			}
+#endif /* portUSING_MPU_WRAPPERS */
+
+			/* START of special for EDF */
+#if ( taskUSE_NAME_REGISTRY == 1 )
+			{
+				prvTaskNameRegistryAdd( pxNewTCB );
+			}
+#endif
+			/* END of special for EDF */
+
+			if( pxCreatedTask != NULL )
+			{
+				/* Pass the handle out in an anonymous way.  The handle can be used to
+				 * change the created task's priority, delete the created task, etc.*/
+				*pxCreatedTask = ( TaskHandle_t ) pxNewTCB;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		/*-----------------------------------------------------------*/
+
+		static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
+		{
+			/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+			BaseType_t xYieldRequired = pdFALSE;
+#endif
+			/* END of special for EDF */
+
+			/* Ensure interrupts don't access the task lists while the lists are being
+			 * updated. */
+			taskENTER_CRITICAL();
+			{
+				uxCurrentNumberOfTasks++;
+
+				if( pxCurrentTCB == NULL )
+				{
+					/* There are no other tasks, or all the other tasks are in
+					 * the suspended state - make this the current task. */
+					pxCurrentTCB = pxNewTCB;
+
+					if( uxCurrentNumberOfTasks == ( UBaseType_t ) 1 )
+					{
+						/* This is the first task to be created so do the preliminary
+						 * initialisation required.  We will not recover if this call
+						 * fails, but we will report the failure. */
+						prvInitialiseTaskLists();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					/* If the scheduler is not already running, make this task the
+					 * current task if it is the highest priority task to be created
+					 * so far. */
+					if( xSchedulerRunning == pdFALSE )
+					{
+#if (configUSE_EDF_SCHEDULER == 0)
+						if( pxCurrentTCB->uxPriority <= pxNewTCB->uxPriority )
+						{
+							pxCurrentTCB = pxNewTCB;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+#else /* START of special for EDF */
+if( taskEDF_KEY( pxCurrentTCB ) >= taskEDF_KEY( pxNewTCB ) )
+{
+	pxCurrentTCB = pxNewTCB;
+}
+else
+{
+	mtCOVERAGE_TEST_MARKER();
+}
+#endif /* END of special for EDF */
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+
+				uxTaskNumber++;
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+				{
+					/* Add a counter into the TCB for tracing only. */
+					pxNewTCB->uxTCBNumber = uxTaskNumber;
+				}
+#endif /* configUSE_TRACE_FACILITY */
+				traceTASK_CREATE( pxNewTCB );
+
+				/* START of special for EDF */
+#if ( configUSE_EDF_SCHEDULER == 1 )
+				/* Its first job is released by the creation. */
+				traceTASK_JOB_RELEASE( pxNewTCB );
+#endif
+				taskEDF_LOCK_PARTITIONS_OF( pxNewTCB );
+				/* END of special for EDF */
+
+				prvAddTaskToReadyList( pxNewTCB );
+
+				/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+				/* The core to preempt is picked before another core can run
+				 * the task. */
+				if( xSchedulerRunning != pdFALSE )
+				{
+					xYieldRequired = prvEDFPreemptCoreFor( pxNewTCB, NULL );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+#endif
+				taskEDF_UNLOCK_PARTITIONS_OF( pxNewTCB );
+				/* END of special for EDF */
+
+				portSETUP_TCB( pxNewTCB );
+			}
+			taskEXIT_CRITICAL();
+
+			if( xSchedulerRunning != pdFALSE )
+			{
+#if ( configUSE_EDF_SCHEDULER == 0 )
+				{
+					/* If the created task is of a higher priority than the current task
+					 * then it should run now. */
+					if( pxCurrentTCB->uxPriority < pxNewTCB->uxPriority )
+					{
+						taskYIELD_IF_USING_PREEMPTION();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+#elif ( configNUMBER_OF_CORES == 1 ) /* START of special for EDF */
+				{
+					if( taskEDF_KEY( pxCurrentTCB ) >= taskEDF_KEY( pxNewTCB ) )
+					{
+						taskYIELD_IF_USING_PREEMPTION();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+#else
+				{
+					if( xYieldRequired != pdFALSE )
+					{
+						taskYIELD_IF_USING_PREEMPTION();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+#endif /* END of special for EDF */
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_vTaskDelete == 1 )
+
+		void vTaskDelete( TaskHandle_t xTaskToDelete )
+		{
+			TCB_t * pxTCB;
+
+			taskENTER_CRITICAL();
+			{
+				/* If null is passed in here then it is the calling task that is
+				 * being deleted. */
+				pxTCB = prvGetTCBFromHandle( xTaskToDelete );
+
+				/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+				/* A task running on another core cannot be deleted. */
+				configASSERT( ( pxTCB == pxCurrentTCB ) || ( pxTCB->xTaskRunState == taskTASK_NOT_RUNNING ) );
+#endif
+#if ( configUSE_EDF_DVFS == 1 )
+				/* A deleted task no longer needs processor time. */
+				prvEDFDvfsSetUtilisation( pxTCB, 0UL );
+#endif
+#if ( configUSE_EDF_SLACK_STEALING == 1 )
+				prvEDFSlackRemoveTask( pxTCB );
+#endif
+#if ( configUSE_EDF_SPORADIC == 1 )
+				prvEDFSporadicRemoveTask( pxTCB );
+#endif
+#if ( taskUSE_NAME_REGISTRY == 1 )
+				/* xTaskGetHandle() no longer finds the task. */
+				prvTaskNameRegistryRemove( pxTCB );
+#endif
+				taskEDF_LOCK_PARTITIONS_OF( pxTCB );
+				/* END of special for EDF */
+
+				/* Remove task from the ready/delayed list. */
+				if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+				{
+					taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* Is the task waiting on an event also? */
+				if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+				{
+					( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* START of special for EDF */
+				taskEDF_UNLOCK_PARTITIONS_OF( pxTCB );
+				/* END of special for EDF */
+
+				/* Increment the uxTaskNumber also so kernel aware debuggers can
+				 * detect that the task lists need re-generating.  This is done before
+				 * portPRE_TASK_DELETE_HOOK() as in the Windows port that macro will
+				 * not return. */
+				uxTaskNumber++;
+
+				if( pxTCB == pxCurrentTCB )
+				{
+					/* A task is deleting itself.  This cannot complete within the
+					 * task itself, as a context switch to another task is required.
+					 * Place the task in the termination list.  The idle task will
+					 * check the termination list and free up any memory allocated by
+					 * the scheduler for the TCB and stack of the deleted task. */
+					vListInsertEnd( &xTasksWaitingTermination, &( pxTCB->xStateListItem ) );
+
+					/* Increment the ucTasksDeleted variable so the idle task knows
+					 * there is a task that has been deleted and that it should therefore
+					 * check the xTasksWaitingTermination list. */
+					++uxDeletedTasksWaitingCleanUp;
+
+					/* Call the delete hook before portPRE_TASK_DELETE_HOOK() as
+					 * portPRE_TASK_DELETE_HOOK() does not return in the Win32 port. */
+					traceTASK_DELETE( pxTCB );
+
+					/* The pre-delete hook is primarily for the Windows simulator,
+					 * in which Windows specific clean up operations are performed,
+					 * after which it is not possible to yield away from this task -
+					 * hence xYieldPending is used to latch that a context switch is
+					 * required. */
+					portPRE_TASK_DELETE_HOOK( pxTCB, &xYieldPending );
+				}
+				else
+				{
+					--uxCurrentNumberOfTasks;
+					traceTASK_DELETE( pxTCB );
+
+					/* Reset the next expected unblock time in case it referred to
+					 * the task that has just been deleted. */
+					prvResetNextTaskUnblockTime();
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			/* If the task is not deleting itself, call prvDeleteTCB from outside of
+			 * critical section. If a task deletes itself, prvDeleteTCB is called
+			 * from prvCheckTasksWaitingTermination which is called from Idle task. */
+			if( pxTCB != pxCurrentTCB )
+			{
+				prvDeleteTCB( pxTCB );
+			}
+
+			/* Force a reschedule if it is the currently running task that has just
+			 * been deleted. */
+			if( xSchedulerRunning != pdFALSE )
+			{
+				if( pxTCB == pxCurrentTCB )
+				{
+					configASSERT( uxSchedulerSuspended == 0 );
+					portYIELD_WITHIN_API();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+
+#endif /* INCLUDE_vTaskDelete */
+		/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_xTaskDelayUntil == 1 )
+
+		BaseType_t xTaskDelayUntil( TickType_t * const pxPreviousWakeTime,
+				const TickType_t xTimeIncrement )
+		{
+			TickType_t xTimeToWake;
+			BaseType_t xAlreadyYielded, xShouldDelay = pdFALSE;
+			/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+			UBaseType_t uxSavedInterruptStatus;
+#endif
+			/* END of special for EDF */
+
+			configASSERT( pxPreviousWakeTime );
+			configASSERT( ( xTimeIncrement > 0U ) );
+			configASSERT( uxSchedulerSuspended == 0 );
+
+			/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+			/* Only the partition of the task is locked instead: it keeps the
+			 * tick count of the partition still and the task on its core.  The
+			 * end of a job takes no global lock. */
+			uxSavedInterruptStatus = portSET_INTERRUPT_MASK();
+			taskEDF_LOCK_PARTITIONS_OF( pxCurrentTCB );
+#else
+			/* END of special for EDF */
+			vTaskSuspendAll();
+			/* START of special for EDF */
+#endif
+			/* END of special for EDF */
+			{
+				/* Minor optimisation.  The tick count cannot change in this
+				 * block. */
+				const TickType_t xConstTickCount = xTickCount;
+
+				/* Generate the tick time at which the task wants to wake. */
+				xTimeToWake = *pxPreviousWakeTime + xTimeIncrement;
+
+				/* START of special for EDF */
+				/* A periodic task calls xTaskDelayUntil() once per job, at the
+				 * end of it. */
+				traceTASK_JOB_COMPLETE( pxCurrentTCB );
+				taskEDF_JOB_COMPLETE( pxCurrentTCB );
+
+#if ( configUSE_EDF_DVFS == 1 )
+				taskENTER_CRITICAL();
+				{
+					prvEDFDvfsComplete( pxCurrentTCB );
+				}
+				taskEXIT_CRITICAL();
+#endif
+#if ( configUSE_EDF_SLACK_STEALING == 1 )
+				/* The unused part of the WCET of the job becomes slack, it is
+				 * computed once the next job is released or delayed below. */
+				configASSERT( pxCurrentTCB->xTaskSlackStealer == pdFALSE );
+
+				taskENTER_CRITICAL();
+				{
+					pxCurrentTCB->xTaskJobActive = pdFALSE;
+				}
+				taskEXIT_CRITICAL();
+#endif
+				/* END of special for EDF */
+
+				if( xConstTickCount < *pxPreviousWakeTime )
+				{
+					/* The tick count has overflowed since this function was
+					 * lasted called.  In this case the only time we should ever
+					 * actually delay is if the wake time has also  overflowed,
+					 * and the wake time is greater than the tick time.  When this
+					 * is the case it is as if neither time had overflowed. */
+					if( ( xTimeToWake < *pxPreviousWakeTime ) && ( xTimeToWake > xConstTickCount ) )
+					{
+						xShouldDelay = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					/* The tick time has not overflowed.  In this case we will
+					 * delay if either the wake time has overflowed, and/or the
+					 * tick time is less than the wake time. */
+					if( ( xTimeToWake < *pxPreviousWakeTime ) || ( xTimeToWake > xConstTickCount ) )
+					{
+						xShouldDelay = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+
+				/* Update the wake time ready for the next call. */
+				*pxPreviousWakeTime = xTimeToWake;
+
+				if( xShouldDelay != pdFALSE )
+				{
+					traceTASK_DELAY_UNTIL( xTimeToWake );
+
+					/* prvAddCurrentTaskToDelayedList() needs the block time, not
+					 * the time to wake, so subtract the current tick count. */
+					prvAddCurrentTaskToDelayedList( xTimeToWake - xConstTickCount, pdFALSE );
+				}
+				else
+				{
+					/* START of special for EDF */
+#if ( configUSE_EDF_SCHEDULER == 1 )
+					/* Late, the next job is released at once, still due relative
+					 * to its wake time, and the task queued under its deadline
+					 * again.  The yield below picks the task to run. */
+#if ( configNUMBER_OF_CORES == 1 )
+					taskENTER_CRITICAL();
+#endif
+					{
+						pxCurrentTCB->xTaskAbsoluteDeadline = taskEDF_RELEASE_DEADLINE( pxCurrentTCB, xTimeToWake );
+						pxCurrentTCB->ulTaskJobs++;
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_EDF_SEMI_PARTITIONED == 1 ) )
+						prvEDFSplitRelease( pxCurrentTCB );
+#endif
+#if ( configUSE_EDF_DVFS == 1 )
+						prvEDFDvfsRelease( pxCurrentTCB );
+#endif
+#if ( configUSE_EDF_SLACK_STEALING == 1 )
+						prvEDFSlackRelease( pxCurrentTCB, xTimeToWake );
+#endif
+						traceTASK_JOB_RELEASE( pxCurrentTCB );
+						( void ) uxListRemove( &( pxCurrentTCB->xStateListItem ) );
+						prvAddTaskToReadyList( pxCurrentTCB );
+#if ( configNUMBER_OF_CORES > 1 )
+						/* A split job may be back on its first core. */
+						( void ) prvEDFPreemptCoreFor( pxCurrentTCB, NULL );
+#endif
+					}
+#if ( configNUMBER_OF_CORES == 1 )
+					taskEXIT_CRITICAL();
+#endif
+#else
+					mtCOVERAGE_TEST_MARKER();
+#endif
+					/* END of special for EDF */
+				}
+
+				/* START of special for EDF */
+#if ( configUSE_EDF_SLACK_STEALING == 1 )
+				/* The task switches below anyway. */
+				prvEDFSlackUpdate();
+#endif
+				/* END of special for EDF */
+			}
+			/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+			taskEDF_UNLOCK_PARTITIONS_OF( pxCurrentTCB );
+			portCLEAR_INTERRUPT_MASK( uxSavedInterruptStatus );
+			xAlreadyYielded = pdFALSE;
+#else
+			/* END of special for EDF */
+			xAlreadyYielded = xTaskResumeAll();
+			/* START of special for EDF */
+#endif
+			/* END of special for EDF */
+
+			/* Force a reschedule if xTaskResumeAll has not already done so, we may
+			 * have put ourselves to sleep. */
+			if( xAlreadyYielded == pdFALSE )
+			{
+				portYIELD_WITHIN_API();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			return xShouldDelay;
+		}
+
+#endif /* INCLUDE_xTaskDelayUntil */
+		/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_vTaskDelay == 1 )
+
+		void vTaskDelay( const TickType_t xTicksToDelay )
+		{
+			BaseType_t xAlreadyYielded = pdFALSE;
+
+			/* A delay time of zero just forces a reschedule. */
+			if( xTicksToDelay > ( TickType_t ) 0U )
+			{
+				configASSERT( uxSchedulerSuspended == 0 );
+				/* START of special for EDF */
+#if ( configNUMBER_OF_CORES == 1 )
+				/* END of special for EDF */
+				vTaskSuspendAll();
+				/* START of special for EDF */
+#endif
+				/* END of special for EDF */
+				{
+					traceTASK_DELAY();
+
+					/* A task that is removed from the event list while the
+					 * scheduler is suspended will not get placed in the ready
+					 * list or removed from the blocked list until the scheduler
+					 * is resumed.
+					 *
+					 * This task cannot be in an event list as it is the currently
+					 * executing task. */
+					prvAddCurrentTaskToDelayedList( xTicksToDelay, pdFALSE );
+				}
+				/* START of special for EDF */
+#if ( configNUMBER_OF_CORES == 1 )
+				/* END of special for EDF */
+				xAlreadyYielded = xTaskResumeAll();
+				/* START of special for EDF */
+#else
+				/* prvAddCurrentTaskToDelayedList() locks the partition itself,
+				 * the yield below switches the task out. */
+#endif
+				/* END of special for EDF */
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Force a reschedule if xTaskResumeAll has not already done so, we may
+			 * have put ourselves to sleep. */
+			if( xAlreadyYielded == pdFALSE )
+			{
+				portYIELD_WITHIN_API();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+#endif /* INCLUDE_vTaskDelay */
+		/*-----------------------------------------------------------*/
+
+#if ( ( INCLUDE_eTaskGetState == 1 ) || ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_xTaskAbortDelay == 1 ) )
+
+		eTaskState eTaskGetState( TaskHandle_t xTask )
+		{
+			eTaskState eReturn;
+			List_t const * pxStateList, * pxDelayedList, * pxOverflowedDelayedList;
+			const TCB_t * const pxTCB = xTask;
+			/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+			BaseType_t xRunning;
+#endif
+			/* END of special for EDF */
+
+			configASSERT( pxTCB );
+
+			if( pxTCB == pxCurrentTCB )
+			{
+				/* The task calling this function is querying its own state. */
+				eReturn = eRunning;
+			}
+			else
+			{
+				taskENTER_CRITICAL();
+				{
+					/* START of special for EDF */
+					taskEDF_LOCK_PARTITIONS_OF( pxTCB );
+					/* END of special for EDF */
+					pxStateList = listLIST_ITEM_CONTAINER( &( pxTCB->xStateListItem ) );
+					/* START of special for EDF */
+#if ( configUSE_EDF_TIMING_WHEEL == 1 )
+					pxDelayedList = &( xWheelLists[ 0 ] );
+					pxOverflowedDelayedList = &( xWheelLists[ taskWHEEL_FAR_LIST ] );
+#else
+					pxDelayedList = taskEDF_TASK_DELAYED_LIST( pxTCB );
+					pxOverflowedDelayedList = taskEDF_TASK_OVERFLOW_DELAYED_LIST( pxTCB );
+#endif
+#if ( configNUMBER_OF_CORES > 1 )
+					xRunning = ( pxTCB->xTaskRunState != taskTASK_NOT_RUNNING ) ? pdTRUE : pdFALSE;
+#endif
+					taskEDF_UNLOCK_PARTITIONS_OF( pxTCB );
+					/* END of special for EDF */
+				}
+				taskEXIT_CRITICAL();
+
+				/* START of special for EDF */
+#if ( configUSE_EDF_HIGH_RES_TIME == 1 )
+				if( pxStateList == &( xEDFTimerList ) )
+				{
+					/* Waiting in xTaskDelayUntilUs(). */
+					eReturn = eBlocked;
+				}
+				else
+#endif
+#if ( configUSE_EDF_TIMING_WHEEL == 1 )
+				/* Any list of the wheel. */
+				if( ( pxStateList >= pxDelayedList ) && ( pxStateList <= pxOverflowedDelayedList ) )
+#else
+				if( ( pxStateList == pxDelayedList ) || ( pxStateList == pxOverflowedDelayedList ) )
+#endif
+				/* END of special for EDF */
+				{
+					/* The task being queried is referenced from one of the Blocked
+					 * lists. */
+					eReturn = eBlocked;
+				}
+
+#if ( INCLUDE_vTaskSuspend == 1 )
+				else if( pxStateList == &xSuspendedTaskList )
+				{
+					/* The task being queried is referenced from the suspended
+					 * list.  Is it genuinely suspended or is it blocked
+					 * indefinitely? */
+					if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL )
+					{
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+						{
+							BaseType_t x;
+
+							/* The task does not appear on the event list item of
+							 * and of the RTOS objects, but could still be in the
+							 * blocked state if it is waiting on its notification
+							 * rather than waiting on an object.  If not, is
+							 * suspended. */
+							eReturn = eSuspended;
+
+							for( x = 0; x < configTASK_NOTIFICATION_ARRAY_ENTRIES; x++ )
+							{
+								if( pxTCB->ucNotifyState[ x ] == taskWAITING_NOTIFICATION )
+								{
+									eReturn = eBlocked;
+									break;
+								}
+							}
+						}
+#else /* if ( configUSE_TASK_NOTIFICATIONS == 1 ) */
+						{
+							eReturn = eSuspended;
+						}
+#endif /* if ( configUSE_TASK_NOTIFICATIONS == 1 ) */
+					}
+					else
+					{
+						eReturn = eBlocked;
+					}
+				}
+#endif /* if ( INCLUDE_vTaskSuspend == 1 ) */
+
+#if ( INCLUDE_vTaskDelete == 1 )
+				else if( ( pxStateList == &xTasksWaitingTermination ) || ( pxStateList == NULL ) )
+				{
+					/* The task being queried is referenced from the deleted
+					 * tasks list, or it is not referenced from any lists at
+					 * all. */
+					eReturn = eDeleted;
+				}
+#endif
+
+				else /*lint !e525 Negative indentation is intended to make use of pre-processor clearer. */
+				{
+					/* If the task is not in any other state, it must be in the
+					 * Ready (including pending ready) state. */
+					eReturn = eReady;
+
+					/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+					/* Or running on another core. */
+					if( xRunning != pdFALSE )
+					{
+						eReturn = eRunning;
+					}
+#endif
+					/* END of special for EDF */
+				}
+			}
+
+			return eReturn;
+		} /*lint !e818 xTask cannot be a pointer to const because it is a typedef. */
+
+#endif /* INCLUDE_eTaskGetState */
+		/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_uxTaskPriorityGet == 1 )
+
+		UBaseType_t uxTaskPriorityGet( const TaskHandle_t xTask )
+		{
+			TCB_t const * pxTCB;
+			UBaseType_t uxReturn;
+
+			taskENTER_CRITICAL();
+			{
+				/* If null is passed in here then it is the priority of the task
+				 * that called uxTaskPriorityGet() that is being queried. */
+				pxTCB = prvGetTCBFromHandle( xTask );
+				uxReturn = pxTCB->uxPriority;
+			}
+			taskEXIT_CRITICAL();
+
+			return uxReturn;
+		}
+
+#endif /* INCLUDE_uxTaskPriorityGet */
+		/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_uxTaskPriorityGet == 1 )
+
+		UBaseType_t uxTaskPriorityGetFromISR( const TaskHandle_t xTask )
+		{
+			TCB_t const * pxTCB;
+			UBaseType_t uxReturn, uxSavedInterruptState;
+
+			/* RTOS ports that support interrupt nesting have the concept of a
+			 * maximum  system call (or maximum API call) interrupt priority.
+			 * Interrupts that are  above the maximum system call priority are keep
+			 * permanently enabled, even when the RTOS kernel is in a critical section,
+			 * but cannot make any calls to FreeRTOS API functions.  If configASSERT()
+			 * is defined in FreeRTOSConfig.h then
+			 * portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+			 * failure if a FreeRTOS API function is called from an interrupt that has
+			 * been assigned a priority above the configured maximum system call
+			 * priority.  Only FreeRTOS functions that end in FromISR can be called
+			 * from interrupts  that have been assigned a priority at or (logically)
+			 * below the maximum system call interrupt priority.  FreeRTOS maintains a
+			 * separate interrupt safe API to ensure interrupt entry is as fast and as
+			 * simple as possible.  More information (albeit Cortex-M specific) is
+			 * provided on the following link:
+			 * https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
+			portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+			uxSavedInterruptState = portSET_INTERRUPT_MASK_FROM_ISR();
+			{
+				/* If null is passed in here then it is the priority of the calling
+				 * task that is being queried. */
+				pxTCB = prvGetTCBFromHandle( xTask );
+				uxReturn = pxTCB->uxPriority;
+			}
+			portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptState );
+
+			return uxReturn;
+		}
+
+#endif /* INCLUDE_uxTaskPriorityGet */
+		/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_vTaskPrioritySet == 1 )
+
+		void vTaskPrioritySet( TaskHandle_t xTask,
+				UBaseType_t uxNewPriority )
+		{
+			TCB_t * pxTCB;
+			UBaseType_t uxCurrentBasePriority, uxPriorityUsedOnEntry;
+			BaseType_t xYieldRequired = pdFALSE;
+
+			configASSERT( uxNewPriority < configMAX_PRIORITIES );
+
+			/* Ensure the new priority is valid. */
+			if( uxNewPriority >= ( UBaseType_t ) configMAX_PRIORITIES )
+			{
+				uxNewPriority = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) 1U;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			taskENTER_CRITICAL();
+			{
+				/* If null is passed in here then it is the priority of the calling
+				 * task that is being changed. */
+				pxTCB = prvGetTCBFromHandle( xTask );
+
+				traceTASK_PRIORITY_SET( pxTCB, uxNewPriority );
+
+#if ( configUSE_MUTEXES == 1 )
+				{
+					uxCurrentBasePriority = pxTCB->uxBasePriority;
+				}
+#else
+				{
+					uxCurrentBasePriority = pxTCB->uxPriority;
+				}
+#endif
+
+				if( uxCurrentBasePriority != uxNewPriority )
+				{
+					/* The priority change may have readied a task of higher
+					 * priority than the calling task. */
+					if( uxNewPriority > uxCurrentBasePriority )
+					{
+						if( pxTCB != pxCurrentTCB )
+						{
+							/* The priority of a task other than the currently
+							 * running task is being raised.  Is the priority being
+							 * raised above that of the running task? */
+							if( uxNewPriority >= pxCurrentTCB->uxPriority )
+							{
+								xYieldRequired = pdTRUE;
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+						}
+						else
+						{
+							/* The priority of the running task is being raised,
+							 * but the running task must already be the highest
+							 * priority task able to run so no yield is required. */
+						}
+					}
+					else if( pxTCB == pxCurrentTCB )
+					{
+						/* Setting the priority of the running task down means
+						 * there may now be another task of higher priority that
+						 * is ready to execute. */
+						xYieldRequired = pdTRUE;
+					}
+					else
+					{
+						/* Setting the priority of any other task down does not
+						 * require a yield as the running task must be above the
+						 * new priority of the task being modified. */
+					}
+
+					/* Remember the ready list the task might be referenced from
+					 * before its uxPriority member is changed so the
+					 * taskRESET_READY_PRIORITY() macro can function correctly. */
+					uxPriorityUsedOnEntry = pxTCB->uxPriority;
+
+#if ( configUSE_MUTEXES == 1 )
+					{
+						/* Only change the priority being used if the task is not
+						 * currently using an inherited priority. */
+						if( pxTCB->uxBasePriority == pxTCB->uxPriority )
+						{
+							pxTCB->uxPriority = uxNewPriority;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+
+						/* The base priority gets set whatever. */
+						pxTCB->uxBasePriority = uxNewPriority;
+					}
+#else /* if ( configUSE_MUTEXES == 1 ) */
+					{
+						pxTCB->uxPriority = uxNewPriority;
+					}
+#endif /* if ( configUSE_MUTEXES == 1 ) */
+
+					/* Only reset the event list item value if the value is not
+					 * being used for anything else. */
+					if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+					{
+						listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxNewPriority ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					/* If the task is in the blocked or suspended list we need do
+					 * nothing more than change its priority variable. However, if
+					 * the task is in a ready list it needs to be removed and placed
+					 * in the list appropriate to its new priority. */
+					if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+					{
+						/* The task is currently in its ready list - remove before
+						 * adding it to its new ready list.  As we are in a critical
+						 * section we can do this even if the scheduler is suspended. */
+						if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+						{
+							/* It is known that the task is in its ready list so
+							 * there is no need to check again and the port level
+							 * reset macro can be called directly. */
+							portRESET_READY_PRIORITY( uxPriorityUsedOnEntry, uxTopReadyPriority );
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+
+						prvAddTaskToReadyList( pxTCB );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					if( xYieldRequired != pdFALSE )
+					{
+						taskYIELD_IF_USING_PREEMPTION();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					/* Remove compiler warning about unused variables when the port
+					 * optimised task selection is not being used. */
+					( void ) uxPriorityUsedOnEntry;
+				}
+			}
+			taskEXIT_CRITICAL();
+		}
+
+#endif /* INCLUDE_vTaskPrioritySet */
+		/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_vTaskSuspend == 1 )
+
+		void vTaskSuspend( TaskHandle_t xTaskToSuspend )
+		{
+			TCB_t * pxTCB;
+
+			taskENTER_CRITICAL();
+			{
+				/* If null is passed in here then it is the running task that is
+				 * being suspended. */
+				pxTCB = prvGetTCBFromHandle( xTaskToSuspend );
+
+				/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+				/* A task running on another core cannot be suspended. */
+				configASSERT( ( pxTCB == pxCurrentTCB ) || ( pxTCB->xTaskRunState == taskTASK_NOT_RUNNING ) );
+#endif
+				/* END of special for EDF */
+
+				traceTASK_SUSPEND( pxTCB );
+
+				/* START of special for EDF */
+				taskEDF_LOCK_PARTITIONS_OF( pxTCB );
+				/* END of special for EDF */
+
+				/* Remove task from the ready/delayed list and place in the
+				 * suspended list. */
+				if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+				{
+					taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* Is the task waiting on an event also? */
+				if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+				{
+					( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				vListInsertEnd( &xSuspendedTaskList, &( pxTCB->xStateListItem ) );
+
+				/* START of special for EDF */
+				taskEDF_UNLOCK_PARTITIONS_OF( pxTCB );
+				/* END of special for EDF */
+
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+				{
+					BaseType_t x;
+
+					for( x = 0; x < configTASK_NOTIFICATION_ARRAY_ENTRIES; x++ )
+					{
+						if( pxTCB->ucNotifyState[ x ] == taskWAITING_NOTIFICATION )
+						{
+							/* The task was blocked to wait for a notification, but is
+							 * now suspended, so no notification was received. */
+							pxTCB->ucNotifyState[ x ] = taskNOT_WAITING_NOTIFICATION;
+						}
+					}
+				}
+#endif /* if ( configUSE_TASK_NOTIFICATIONS == 1 ) */
+			}
+			taskEXIT_CRITICAL();
+
+			if( xSchedulerRunning != pdFALSE )
+			{
+				/* Reset the next expected unblock time in case it referred to the
+				 * task that is now in the Suspended state. */
+				taskENTER_CRITICAL();
+				{
+					prvResetNextTaskUnblockTime();
+				}
+				taskEXIT_CRITICAL();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( pxTCB == pxCurrentTCB )
+			{
+				if( xSchedulerRunning != pdFALSE )
+				{
+					/* The current task has just been suspended. */
+					configASSERT( uxSchedulerSuspended == 0 );
+					portYIELD_WITHIN_API();
+				}
+				else
+				{
+					/* The scheduler is not running, but the task that was pointed
+					 * to by pxCurrentTCB has just been suspended and pxCurrentTCB
+					 * must be adjusted to point to a different task. */
+					if( listCURRENT_LIST_LENGTH( &xSuspendedTaskList ) == uxCurrentNumberOfTasks ) /*lint !e931 Right has no side effect, just volatile. */
+					{
+						/* No other tasks are ready, so set pxCurrentTCB back to
+						 * NULL so when the next task is created pxCurrentTCB will
+						 * be set to point to it no matter what its relative priority
+						 * is. */
+						pxCurrentTCB = NULL;
+					}
+					else
+					{
+						vTaskSwitchContext();
+					}
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+#endif /* INCLUDE_vTaskSuspend */
+		/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_vTaskSuspend == 1 )
+
+		static BaseType_t prvTaskIsTaskSuspended( const TaskHandle_t xTask )
+		{
+			BaseType_t xReturn = pdFALSE;
+			const TCB_t * const pxTCB = xTask;
+
+			/* Accesses xPendingReadyList so must be called from a critical
+			 * section. */
+
+			/* It does not make sense to check if the calling task is suspended. */
+			configASSERT( xTask );
+
+			/* Is the task being resumed actually in the suspended list? */
+			if( listIS_CONTAINED_WITHIN( &xSuspendedTaskList, &( pxTCB->xStateListItem ) ) != pdFALSE )
+			{
+				/* Has the task already been resumed from within an ISR? */
+				if( listIS_CONTAINED_WITHIN( &xPendingReadyList, &( pxTCB->xEventListItem ) ) == pdFALSE )
+				{
+					/* Is it in the suspended list because it is in the Suspended
+					 * state, or because is is blocked with no timeout? */
+					if( listIS_CONTAINED_WITHIN( NULL, &( pxTCB->xEventListItem ) ) != pdFALSE ) /*lint !e961.  The cast is only redundant when NULL is used. */
+					{
+						xReturn = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			return xReturn;
+		} /*lint !e818 xTask cannot be a pointer to const because it is a typedef. */
+
+#endif /* INCLUDE_vTaskSuspend */
+		/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_vTaskSuspend == 1 )
+
+		void vTaskResume( TaskHandle_t xTaskToResume )
+		{
+			TCB_t * const pxTCB = xTaskToResume;
+
+			/* It does not make sense to resume the calling task. */
+			configASSERT( xTaskToResume );
+
+			/* The parameter cannot be NULL as it is impossible to resume the
+			 * currently executing task. */
+			if( ( pxTCB != pxCurrentTCB ) && ( pxTCB != NULL ) )
+			{
+				taskENTER_CRITICAL();
+				{
+					if( prvTaskIsTaskSuspended( pxTCB ) != pdFALSE )
+					{
+						traceTASK_RESUME( pxTCB );
+
+						/* The ready list can be accessed even if the scheduler is
+						 * suspended because this is inside a critical section. */
+						/* START of special for EDF */
+						taskEDF_LOCK_PARTITIONS_OF( pxTCB );
+						/* END of special for EDF */
+						( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+						prvAddTaskToReadyList( pxTCB );
+
+						/* A higher priority task may have just been resumed. */
+						/* START of special for EDF */
+						if( taskEDF_RESUMED_TASK_PREEMPTS( pxTCB ) )
+						/* END of special for EDF */
+						{
+							/* This yield may not cause the task just resumed to run,
+							 * but will leave the lists in the correct state for the
+							 * next yield. */
+							taskYIELD_IF_USING_PREEMPTION();
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+
+						/* START of special for EDF */
+						taskEDF_UNLOCK_PARTITIONS_OF( pxTCB );
+						/* END of special for EDF */
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				taskEXIT_CRITICAL();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+#endif /* INCLUDE_vTaskSuspend */
+
+		/*-----------------------------------------------------------*/
+
+#if ( ( INCLUDE_xTaskResumeFromISR == 1 ) && ( INCLUDE_vTaskSuspend == 1 ) )
+
+		BaseType_t xTaskResumeFromISR( TaskHandle_t xTaskToResume )
+		{
+			BaseType_t xYieldRequired = pdFALSE;
+			TCB_t * const pxTCB = xTaskToResume;
+			UBaseType_t uxSavedInterruptStatus;
+
+			configASSERT( xTaskToResume );
+
+			/* RTOS ports that support interrupt nesting have the concept of a
+			 * maximum  system call (or maximum API call) interrupt priority.
+			 * Interrupts that are  above the maximum system call priority are keep
+			 * permanently enabled, even when the RTOS kernel is in a critical section,
+			 * but cannot make any calls to FreeRTOS API functions.  If configASSERT()
+			 * is defined in FreeRTOSConfig.h then
+			 * portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+			 * failure if a FreeRTOS API function is called from an interrupt that has
+			 * been assigned a priority above the configured maximum system call
+			 * priority.  Only FreeRTOS functions that end in FromISR can be called
+			 * from interrupts  that have been assigned a priority at or (logically)
+			 * below the maximum system call interrupt priority.  FreeRTOS maintains a
+			 * separate interrupt safe API to ensure interrupt entry is as fast and as
+			 * simple as possible.  More information (albeit Cortex-M specific) is
+			 * provided on the following link:
+			 * https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
+			portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+			/* START of special for EDF */
+			uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+			/* END of special for EDF */
+			{
+				if( prvTaskIsTaskSuspended( pxTCB ) != pdFALSE )
+				{
+					traceTASK_RESUME_FROM_ISR( pxTCB );
+
+					/* Check the ready lists can be accessed. */
+					if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+					{
+						/* Ready lists can be accessed so move the task from the
+						 * suspended list to the ready list directly. */
+						/* START of special for EDF */
+						taskEDF_LOCK_PARTITIONS_OF( pxTCB );
+
+						if( taskEDF_RESUMED_TASK_PREEMPTS( pxTCB ) )
+						/* END of special for EDF */
+						{
+							xYieldRequired = pdTRUE;
+
+							/* Mark that a yield is pending in case the user is not
+							 * using the return value to initiate a context switch
+							 * from the ISR using portYIELD_FROM_ISR. */
+							xYieldPending = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+
+						( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+						prvAddTaskToReadyList( pxTCB );
+						/* START of special for EDF */
+						taskEDF_UNLOCK_PARTITIONS_OF( pxTCB );
+						/* END of special for EDF */
+					}
+					else
+					{
+						/* The delayed or ready lists cannot be accessed so the task
+						 * is held in the pending ready list until the scheduler is
+						 * unsuspended. */
+						vListInsertEnd( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			/* START of special for EDF */
+			taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+			/* END of special for EDF */
+
+			return xYieldRequired;
+		}
+
+#endif /* ( ( INCLUDE_xTaskResumeFromISR == 1 ) && ( INCLUDE_vTaskSuspend == 1 ) ) */
+		/*-----------------------------------------------------------*/
+
+		void vTaskStartScheduler( void )
+		{
+			BaseType_t xReturn;
+
+			/* Add the idle task at the lowest priority. */
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+			{
+				StaticTask_t * pxIdleTaskTCBBuffer = NULL;
+				StackType_t * pxIdleTaskStackBuffer = NULL;
+				uint32_t ulIdleTaskStackSize;
+
+				/* The Idle task is created using user provided RAM - obtain the
+				 * address of the RAM then create the idle task. */
+				vApplicationGetIdleTaskMemory( &pxIdleTaskTCBBuffer, &pxIdleTaskStackBuffer, &ulIdleTaskStackSize );
+				xIdleTaskHandle = xTaskCreateStatic( prvIdleTask,
+						configIDLE_TASK_NAME,
+						ulIdleTaskStackSize,
+						( void * ) NULL,       /*lint !e961.  The cast is not redundant for all compilers. */
+						portPRIVILEGE_BIT,     /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
+						pxIdleTaskStackBuffer,
+						pxIdleTaskTCBBuffer ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+
+				if( xIdleTaskHandle != NULL )
+				{
+					xReturn = pdPASS;
+				}
+				else
+				{
+					xReturn = pdFAIL;
+				}
+			}
+#else /* if ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
+			{
+				/* START of special for EDF */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configNUMBER_OF_CORES == 1 ) )
+				{
+					xIDLEPeriod = 200;
+
+					xReturn = xTaskPeriodicCreate( prvIdleTask,
+							configIDLE_TASK_NAME,
+							configMINIMAL_STACK_SIZE,
+							( void * ) NULL,
+							portPRIVILEGE_BIT,  /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
+							&xIdleTaskHandle, /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+							xIDLEPeriod);
+
+#if ( taskEDF_USE_WCET )
+					/* The idle task only runs in the slack, it needs no speed
+					 * and takes no slack away. */
+					if( xReturn == pdPASS )
+					{
+						vTaskSetWorstCaseExecutionTime( xIdleTaskHandle, 0 );
+					}
+#endif
+				}
+#elif (configUSE_EDF_SCHEDULER == 1)
+				{
+					BaseType_t xCoreID;
+
+					xIDLEPeriod = 200;
+					xReturn = pdPASS;
+
+					/* Every core needs a task to run when fewer tasks than cores
+					 * are ready. */
+					for( xCoreID = 0; ( xCoreID < ( BaseType_t ) configNUMBER_OF_CORES ) && ( xReturn == pdPASS ); xCoreID++ )
+					{
+#if ( configUSE_EDF_PARTITIONED == 1 )
+						xReturn = xTaskPeriodicCreateOnCore( prvIdleTask,
+								configIDLE_TASK_NAME,
+								configMINIMAL_STACK_SIZE,
+								( void * ) NULL,
+								portPRIVILEGE_BIT,  /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
+								&( xIdleTaskHandles[ xCoreID ] ), /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+								xIDLEPeriod,
+								xIDLEPeriod,
+								xCoreID );
+#else
+						xReturn = xTaskPeriodicCreate( prvIdleTask,
+								configIDLE_TASK_NAME,
+								configMINIMAL_STACK_SIZE,
+								( void * ) NULL,
+								portPRIVILEGE_BIT,  /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
+								&( xIdleTaskHandles[ xCoreID ] ), /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+								xIDLEPeriod);
+#endif
+					}
+
+					xIdleTaskHandle = xIdleTaskHandles[ 0 ];
+				}
+				/* END of special for EDF */
+#else
+				{
+					/* The Idle task is being created using dynamically allocated RAM. */
+					xReturn = xTaskCreate( prvIdleTask,
+							configIDLE_TASK_NAME,
+							configMINIMAL_STACK_SIZE,
+							( void * ) NULL,
+							portPRIVILEGE_BIT,  /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
+							&xIdleTaskHandle ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+
+				}
+#endif
+			}
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+
+#if ( configUSE_TIMERS == 1 )
+			{
+				if( xReturn == pdPASS )
+				{
+					xReturn = xTimerCreateTimerTask();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+#endif /* configUSE_TIMERS */
+
+if( xReturn == pdPASS )
+{
+	/* freertos_tasks_c_additions_init() should only be called if the user
+	 * definable macro FREERTOS_TASKS_C_ADDITIONS_INIT() is defined, as that is
+	 * the only macro called by the function. */
+#ifdef FREERTOS_TASKS_C_ADDITIONS_INIT
+	{
+		freertos_tasks_c_additions_init();
+	}
+#endif
+
+	/* Interrupts are turned off here, to ensure a tick does not occur
+	 * before or during the call to xPortStartScheduler().  The stacks of
+	 * the created tasks contain a status word with interrupts switched on
+	 * so interrupts will automatically get re-enabled when the first task
+	 * starts to run. */
+	portDISABLE_INTERRUPTS();
+
+	/* START of special for EDF */
+#if ( configUSE_EDF_SCHEDULE_TABLE == 1 )
+	if( uxEDFTableEntries > 0U )
+	{
+		/* The first switch point is at tick 0. */
+		xEDFTableActive = pdTRUE;
+		xEDFTableOffset = 0U;
+		uxEDFTableNext = 1U;
+		pxEDFTableTask = xEDFTable[ 0 ].pxTask;
+		prvEDFTableSelect();
+	}
+#endif
+	/* END of special for EDF */
+
+#if ( configUSE_NEWLIB_REENTRANT == 1 )
+	{
+		/* Switch Newlib's _impure_ptr variable to point to the _reent
+		 * structure specific to the task that will run first.
+		 * See the third party link http://www.nadler.com/embedded/newlibAndFreeRTOS.html
+		 * for additional information. */
+		_impure_ptr = &( pxCurrentTCB->xNewLib_reent );
+	}
+#endif /* configUSE_NEWLIB_REENTRANT */
+
+	xNextTaskUnblockTime = portMAX_DELAY;
+	xSchedulerRunning = pdTRUE;
+	xTickCount = ( TickType_t ) configINITIAL_TICK_COUNT;
+
+	/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+	{
+		BaseType_t xCoreID;
+
+		/* Until now only the slot of this core was used to track the earliest
+		 * deadline created.  Give each core one of the configNUMBER_OF_CORES
+		 * earliest deadlines. */
+		for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+		{
+			pxCurrentTCBs[ xCoreID ] = NULL;
+
+#if ( configUSE_EDF_PARTITIONED == 1 )
+			/* Above, only the partition of this core was set. */
+			xNextTaskUnblockTimes[ taskEDF_CORE_PARTITION( xCoreID ) ] = portMAX_DELAY;
+			xTickCounts[ taskEDF_CORE_PARTITION( xCoreID ) ] = ( TickType_t ) configINITIAL_TICK_COUNT;
+#endif
+		}
+
+		for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+		{
+			prvEDFSelectTaskForCore( xCoreID );
+		}
+	}
+#endif
+	/* END of special for EDF */
+
+	/* If configGENERATE_RUN_TIME_STATS is defined then the following
+	 * macro must be defined to configure the timer/counter used to generate
+	 * the run time counter time base.   NOTE:  If configGENERATE_RUN_TIME_STATS
+	 * is set to 0 and the following line fails to build then ensure you do not
+	 * have portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() defined in your
+	 * FreeRTOSConfig.h file. */
+	portCONFIGURE_TIMER_FOR_RUN_TIME_STATS();
+
+	/* START of special for EDF */
+#if ( configUSE_EDF_DVFS == 1 )
+	ulEDFCyclesAccountedTime = portGET_RUN_TIME_COUNTER_VALUE();
+#endif
+	/* END of special for EDF */
+
+	traceTASK_SWITCHED_IN();
+
+	/* Setting up the timer tick is hardware specific and thus in the
+	 * portable interface. */
+	if( xPortStartScheduler() != pdFALSE )
+	{
+		/* Should not reach here as if the scheduler is running the
+		 * function will not return. */
+	}
+	else
+	{
+		/* Should only reach here if a task calls xTaskEndScheduler(). */
+	}
+}
+else
+{
+	/* This line will only be reached if the kernel could not be started,
+	 * because there was not enough FreeRTOS heap to create the idle task
+	 * or the timer task. */
+	configASSERT( xReturn != errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY );
+}
+
+/* Prevent compiler warnings if INCLUDE_xTaskGetIdleTaskHandle is set to 0,
+ * meaning xIdleTaskHandle is not used anywhere else. */
+( void ) xIdleTaskHandle;
+
+/* OpenOCD makes use of uxTopUsedPriority for thread debugging. Prevent uxTopUsedPriority
+ * from getting optimized out as it is no longer used by the kernel. */
+( void ) uxTopUsedPriority;
+		}
+		/*-----------------------------------------------------------*/
+
+		void vTaskEndScheduler( void )
+		{
+			/* Stop the scheduler interrupts and call the portable scheduler end
+			 * routine so the original ISRs can be restored if necessary.  The port
+			 * layer must ensure interrupts enable  bit is left in the correct state. */
+			portDISABLE_INTERRUPTS();
+			xSchedulerRunning = pdFALSE;
+			vPortEndScheduler();
+		}
+		/*----------------------------------------------------------*/
+
+		void vTaskSuspendAll( void )
+		{
+			/* A critical section is not required as the variable is of type
+			 * BaseType_t.  Please read Richard Barry's reply in the following link to a
+			 * post in the FreeRTOS support forum before reporting this as a bug! -
+			 * https://goo.gl/wu4acr */
+
+			/* portSOFTWARE_BARRIER() is only implemented for emulated/simulated ports that
+			 * do not otherwise exhibit real time behaviour. */
+			portSOFTWARE_BARRIER();
+
+			/* START of special for EDF */
+			/* The tick count does not move while the scheduler is suspended,
+			 * the blocking calls made meanwhile count from it. */
+			taskEDF_TICKLESS_CATCH_UP();
+			/* END of special for EDF */
+
+			/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+			{
+				/* The outermost suspension takes the task lock and holds it
+				 * until xTaskResumeAll(), so the scheduler is only suspended on
+				 * one core at a time.  The count changes under the partition
+				 * lock, which the tick reads it under. */
+				const UBaseType_t uxSavedInterruptStatus = portSET_INTERRUPT_MASK();
+
+				if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+				{
+					portGET_TASK_LOCK();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				portGET_PARTITION_LOCK( taskEDF_PARTITION );
+				++uxSchedulerSuspended;
+				portRELEASE_PARTITION_LOCK( taskEDF_PARTITION );
+
+				portCLEAR_INTERRUPT_MASK( uxSavedInterruptStatus );
+			}
+#else
+			/* END of special for EDF */
+
+			/* The scheduler is suspended if uxSchedulerSuspended is non-zero.  An increment
+			 * is used to allow calls to vTaskSuspendAll() to nest. */
+			++uxSchedulerSuspended;
+			/* START of special for EDF */
+#endif
+			/* END of special for EDF */
+
+			/* Enforces ordering for ports and optimised compilers that may otherwise place
+			 * the above increment elsewhere. */
+			portMEMORY_BARRIER();
+		}
+		/*----------------------------------------------------------*/
+
+#if ( configUSE_TICKLESS_IDLE != 0 )
+
+		static TickType_t prvGetExpectedIdleTime( void )
+		{
+			TickType_t xReturn;
+
+			/* START of special for EDF */
+#if ( configUSE_EDF_SCHEDULER == 1 )
+			/* Every ready task, idle included, is in xReadyTasksListEDF whatever
+			 * its priority.  The processor has nothing to do until the next
+			 * release only when the idle task runs and is alone in that list.
+			 * The next release is the head of the delayed list, which is what
+			 * xNextTaskUnblockTime holds. */
+			if( pxCurrentTCB != xIdleTaskHandle )
+			{
+				xReturn = 0;
+			}
+			else if( listCURRENT_LIST_LENGTH( taskEDF_READY_LIST( pxCurrentTCB ) ) > ( UBaseType_t ) 1 )
+			{
+				/* A task was released and idle still holds the processor
+				 * until the next context switch. */
+				xReturn = 0;
+			}
+			else
+			{
+				xReturn = xNextTaskUnblockTime - xTickCount;
+			}
+#else
+			UBaseType_t uxHigherPriorityReadyTasks = pdFALSE;
+
+			/* uxHigherPriorityReadyTasks takes care of the case where
+			 * configUSE_PREEMPTION is 0, so there may be tasks above the idle priority
+			 * task that are in the Ready state, even though the idle task is
+			 * running. */
+#if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
+			{
+				if( uxTopReadyPriority > tskIDLE_PRIORITY )
+				{
+					uxHigherPriorityReadyTasks = pdTRUE;
+				}
+			}
+#else
+{
+	const UBaseType_t uxLeastSignificantBit = ( UBaseType_t ) 0x01;
+
+	/* When port optimised task selection is used the uxTopReadyPriority
+	 * variable is used as a bit map.  If bits other than the least
+	 * significant bit are set then there are tasks that have a priority
+	 * above the idle priority that are in the Ready state.  This takes
+	 * care of the case where the co-operative scheduler is in use. */
+	if( uxTopReadyPriority > uxLeastSignificantBit )
+	{
+		uxHigherPriorityReadyTasks = pdTRUE;
+	}
+}
+#endif /* if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 ) */
+
+if( pxCurrentTCB->uxPriority > tskIDLE_PRIORITY )
+{
+	xReturn = 0;
+}
+else if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > 1 )
+{
+	/* There are other idle priority tasks in the ready state.  If
+	 * time slicing is used then the very next tick interrupt must be
+	 * processed. */
+	xReturn = 0;
+}
+else if( uxHigherPriorityReadyTasks != pdFALSE )
+{
+	/* There are tasks in the Ready state that have a priority above the
+	 * idle priority.  This path can only be reached if
+	 * configUSE_PREEMPTION is 0. */
+	xReturn = 0;
+}
+else
+{
+	xReturn = xNextTaskUnblockTime - xTickCount;
+}
+#endif /* configUSE_EDF_SCHEDULER */
+			/* END of special for EDF */
+
+return xReturn;
+		}
+
+#endif /* configUSE_TICKLESS_IDLE */
+		/*----------------------------------------------------------*/
+
+		BaseType_t xTaskResumeAll( void )
+		{
+			TCB_t * pxTCB = NULL;
+			BaseType_t xAlreadyYielded = pdFALSE;
+			/* START of special for EDF */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configNUMBER_OF_CORES > 1 ) )
+			UBaseType_t uxCoresYielding = 0U;
+#endif
+			/* END of special for EDF */
+
+			/* If uxSchedulerSuspended is zero then this function does not match a
+			 * previous call to vTaskSuspendAll(). */
+			configASSERT( uxSchedulerSuspended );
+
+			/* It is possible that an ISR caused a task to be removed from an event
+			 * list while the scheduler was suspended.  If this was the case then the
+			 * removed task will have been added to the xPendingReadyList.  Once the
+			 * scheduler has been resumed it is safe to move all the pending ready
+			 * tasks from this list into their appropriate ready list. */
+			taskENTER_CRITICAL();
+			{
+				/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+				portGET_PARTITION_LOCK( taskEDF_PARTITION );
+				--uxSchedulerSuspended;
+				portRELEASE_PARTITION_LOCK( taskEDF_PARTITION );
+#else
+				/* END of special for EDF */
+				--uxSchedulerSuspended;
+				/* START of special for EDF */
+#endif
+				/* END of special for EDF */
+
+				if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+				{
+					/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+					/* Drop the hold of the suspension, the critical section
+					 * still holds the task lock. */
+					portRELEASE_TASK_LOCK();
+#endif
+					/* END of special for EDF */
+
+					if( uxCurrentNumberOfTasks > ( UBaseType_t ) 0U )
+					{
+						/* Move any readied tasks from the pending list into the
+						 * appropriate ready list. */
+						while( listLIST_IS_EMPTY( &xPendingReadyList ) == pdFALSE )
+						{
+							pxTCB = listGET_OWNER_OF_HEAD_ENTRY( ( &xPendingReadyList ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+							/* START of special for EDF */
+							taskEDF_LOCK_PARTITIONS_OF( pxTCB );
+							/* END of special for EDF */
+							listREMOVE_ITEM( &( pxTCB->xEventListItem ) );
+							portMEMORY_BARRIER();
+							listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+							prvAddTaskToReadyList( pxTCB );
+
+							/* If the moved task has a priority higher than or equal to
+							 * the current task then a yield must be performed. */
+							/* START of special for EDF */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configNUMBER_OF_CORES > 1 ) )
+							/* Like the tick, each task made ready here must
+							 * preempt a different core. */
+							if( prvEDFPreemptCoreFor( pxTCB, &uxCoresYielding ) != pdFALSE )
+#else
+							if( taskEDF_RESUMED_TASK_PREEMPTS( pxTCB ) )
+#endif
+							/* END of special for EDF */
+							{
+								xYieldPending = pdTRUE;
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+
+							/* START of special for EDF */
+							taskEDF_UNLOCK_PARTITIONS_OF( pxTCB );
+							/* END of special for EDF */
+						}
+
+						if( pxTCB != NULL )
+						{
+							/* A task was unblocked while the scheduler was suspended,
+							 * which may have prevented the next unblock time from being
+							 * re-calculated, in which case re-calculate it now.  Mainly
+							 * important for low power tickless implementations, where
+							 * this can prevent an unnecessary exit from low power
+							 * state. */
+							prvResetNextTaskUnblockTime();
+						}
+
+						/* If any ticks occurred while the scheduler was suspended then
+						 * they should be processed now.  This ensures the tick count does
+						 * not  slip, and that any delayed tasks are resumed at the correct
+						 * time. */
+						{
+							TickType_t xPendedCounts = xPendedTicks; /* Non-volatile copy. */
+
+							if( xPendedCounts > ( TickType_t ) 0U )
+							{
+								do
+								{
+									if( xTaskIncrementTick() != pdFALSE )
+									{
+										xYieldPending = pdTRUE;
+									}
+									else
+									{
+										mtCOVERAGE_TEST_MARKER();
+									}
+
+									--xPendedCounts;
+								} while( xPendedCounts > ( TickType_t ) 0U );
+
+								xPendedTicks = 0;
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+						}
+
+						/* START of special for EDF */
+#if ( configUSE_EDF_TICKLESS_KERNEL == 1 )
+						if( xEDFTicklessStarted != pdFALSE )
+						{
+							prvEDFTicklessProgram( pdFALSE );
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+#endif
+						/* END of special for EDF */
+
+						if( xYieldPending != pdFALSE )
+						{
+#if ( configUSE_PREEMPTION != 0 )
+							{
+								xAlreadyYielded = pdTRUE;
+							}
+#endif
+							taskYIELD_IF_USING_PREEMPTION();
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			return xAlreadyYielded;
+		}
+		/*-----------------------------------------------------------*/
+
+		TickType_t xTaskGetTickCount( void )
+		{
+			TickType_t xTicks;
+
+			/* START of special for EDF */
+			taskEDF_TICKLESS_CATCH_UP();
+			/* END of special for EDF */
+
+			/* Critical section required if running on a 16 bit processor. */
+			portTICK_TYPE_ENTER_CRITICAL();
+			{
+				xTicks = xTickCount;
+			}
+			portTICK_TYPE_EXIT_CRITICAL();
+
+			return xTicks;
+		}
+		/*-----------------------------------------------------------*/
+
+		TickType_t xTaskGetTickCountFromISR( void )
+		{
+			TickType_t xReturn;
+			UBaseType_t uxSavedInterruptStatus;
+
+			/* RTOS ports that support interrupt nesting have the concept of a maximum
+			 * system call (or maximum API call) interrupt priority.  Interrupts that are
+			 * above the maximum system call priority are kept permanently enabled, even
+			 * when the RTOS kernel is in a critical section, but cannot make any calls to
+			 * FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
+			 * then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+			 * failure if a FreeRTOS API function is called from an interrupt that has been
+			 * assigned a priority above the configured maximum system call priority.
+			 * Only FreeRTOS functions that end in FromISR can be called from interrupts
+			 * that have been assigned a priority at or (logically) below the maximum
+			 * system call  interrupt priority.  FreeRTOS maintains a separate interrupt
+			 * safe API to ensure interrupt entry is as fast and as simple as possible.
+			 * More information (albeit Cortex-M specific) is provided on the following
+			 * link: https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
+			portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+			uxSavedInterruptStatus = portTICK_TYPE_SET_INTERRUPT_MASK_FROM_ISR();
+			{
+				xReturn = xTickCount;
+			}
+			portTICK_TYPE_CLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+			return xReturn;
+		}
+		/*-----------------------------------------------------------*/
+
+		UBaseType_t uxTaskGetNumberOfTasks( void )
+		{
+			/* A critical section is not required because the variables are of type
+			 * BaseType_t. */
+			return uxCurrentNumberOfTasks;
+		}
+		/*-----------------------------------------------------------*/
+
+		char * pcTaskGetName( TaskHandle_t xTaskToQuery ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+		{
+			TCB_t * pxTCB;
+
+			/* If null is passed in here then the name of the calling task is being
+			 * queried. */
+			pxTCB = prvGetTCBFromHandle( xTaskToQuery );
+			configASSERT( pxTCB );
+			return &( pxTCB->pcTaskName[ 0 ] );
+		}
+		/*-----------------------------------------------------------*/
+
+#if ( ( INCLUDE_xTaskGetHandle == 1 ) && ( taskUSE_NAME_REGISTRY == 0 ) )
+
+		static TCB_t * prvSearchForNameWithinSingleList( List_t * pxList,
+				const char pcNameToQuery[] )
+		{
+			TCB_t * pxNextTCB, * pxFirstTCB, * pxReturn = NULL;
+			UBaseType_t x;
+			char cNextChar;
+			BaseType_t xBreakLoop;
+
+			/* This function is called with the scheduler suspended. */
+
+			if( listCURRENT_LIST_LENGTH( pxList ) > ( UBaseType_t ) 0 )
+			{
+				listGET_OWNER_OF_NEXT_ENTRY( pxFirstTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+				do
+				{
+					listGET_OWNER_OF_NEXT_ENTRY( pxNextTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+					/* Check each character in the name looking for a match or
+					 * mismatch. */
+					xBreakLoop = pdFALSE;
+
+					for( x = ( UBaseType_t ) 0; x < ( UBaseType_t ) configMAX_TASK_NAME_LEN; x++ )
+					{
+						cNextChar = pxNextTCB->pcTaskName[ x ];
+
+						if( cNextChar != pcNameToQuery[ x ] )
+						{
+							/* Characters didn't match. */
+							xBreakLoop = pdTRUE;
+						}
+						else if( cNextChar == ( char ) 0x00 )
+						{
+							/* Both strings terminated, a match must have been
+							 * found. */
+							pxReturn = pxNextTCB;
+							xBreakLoop = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+
+						if( xBreakLoop != pdFALSE )
+						{
+							break;
+						}
+					}
+
+					if( pxReturn != NULL )
+					{
+						/* The handle has been found. */
+						break;
+					}
+				} while( pxNextTCB != pxFirstTCB );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			return pxReturn;
+		}
+
+#endif /* INCLUDE_xTaskGetHandle */
+		/*-----------------------------------------------------------*/
+
+		/* START of special for EDF */
+#if ( taskUSE_NAME_REGISTRY == 1 )
+
+		static uint32_t prvTaskNameHash( const char * pcName ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+		{
+			uint32_t ulHash = 2166136261UL;
+			UBaseType_t x;
+
+			/* FNV-1a over the characters kept in pcTaskName. */
+			for( x = ( UBaseType_t ) 0; x < ( UBaseType_t ) ( configMAX_TASK_NAME_LEN - 1 ); x++ )
+			{
+				if( pcName[ x ] == ( char ) 0x00 )
+				{
+					break;
+				}
+
+				ulHash ^= ( uint32_t ) ( uint8_t ) pcName[ x ];
+				ulHash *= 16777619UL;
+			}
+
+			return ulHash;
+		}
+		/*-----------------------------------------------------------*/
+
+		static void prvTaskNameRegistryAdd( TCB_t * pxTCB )
+		{
+			const uint32_t ulHash = prvTaskNameHash( pxTCB->pcTaskName );
+			UBaseType_t uxSlot = ( UBaseType_t ) ( ulHash % ( uint32_t ) configTASK_NAME_REGISTRY_SIZE );
+			UBaseType_t uxProbes;
+			TCB_t * pxSlotTCB;
+
+			taskENTER_CRITICAL();
+			{
+				for( uxProbes = ( UBaseType_t ) 0U; uxProbes < ( UBaseType_t ) configTASK_NAME_REGISTRY_SIZE; uxProbes++ )
+				{
+					pxSlotTCB = xTaskNameRegistry[ uxSlot ].pxTCB;
+
+					if( ( pxSlotTCB == NULL ) || ( pxSlotTCB == taskNAME_SLOT_DELETED ) )
+					{
+						break;
+					}
+
+					uxSlot = ( uxSlot + ( UBaseType_t ) 1U ) % ( UBaseType_t ) configTASK_NAME_REGISTRY_SIZE;
+				}
+
+				/* configTASK_NAME_REGISTRY_SIZE is too small for the tasks. */
+				configASSERT( uxProbes < ( UBaseType_t ) configTASK_NAME_REGISTRY_SIZE );
+
+				if( uxProbes < ( UBaseType_t ) configTASK_NAME_REGISTRY_SIZE )
+				{
+					uxTaskNameRegistrySeq++;
+					taskNAME_REGISTRY_BARRIER();
+					xTaskNameRegistry[ uxSlot ].ulHash = ulHash;
+					xTaskNameRegistry[ uxSlot ].pxTCB = pxTCB;
+					taskNAME_REGISTRY_BARRIER();
+					uxTaskNameRegistrySeq++;
+				}
+
+				pxTCB->uxTaskNameSlot = uxSlot;
+			}
+			taskEXIT_CRITICAL();
+		}
+		/*-----------------------------------------------------------*/
+
+		static void prvTaskNameRegistryRemove( TCB_t * pxTCB )
+		{
+			UBaseType_t uxSlot = pxTCB->uxTaskNameSlot;
+			UBaseType_t uxProbes;
+
+			/* Called in a critical section. */
+			if( xTaskNameRegistry[ uxSlot ].pxTCB == pxTCB )
+			{
+				uxTaskNameRegistrySeq++;
+				taskNAME_REGISTRY_BARRIER();
+				xTaskNameRegistry[ uxSlot ].pxTCB = taskNAME_SLOT_DELETED;
+
+				/* Deleted slots just before a never used one end no probe
+				 * sequence any more, empty them so the lookups stop earlier. */
+				if( xTaskNameRegistry[ ( uxSlot + ( UBaseType_t ) 1U ) % ( UBaseType_t ) configTASK_NAME_REGISTRY_SIZE ].pxTCB == NULL )
+				{
+					for( uxProbes = ( UBaseType_t ) 0U; uxProbes < ( UBaseType_t ) configTASK_NAME_REGISTRY_SIZE; uxProbes++ )
+					{
+						if( xTaskNameRegistry[ uxSlot ].pxTCB != taskNAME_SLOT_DELETED )
+						{
+							break;
+						}
+
+						xTaskNameRegistry[ uxSlot ].pxTCB = NULL;
+						uxSlot = ( uxSlot + ( UBaseType_t ) configTASK_NAME_REGISTRY_SIZE - ( UBaseType_t ) 1U ) % ( UBaseType_t ) configTASK_NAME_REGISTRY_SIZE;
+					}
+				}
+
+				taskNAME_REGISTRY_BARRIER();
+				uxTaskNameRegistrySeq++;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+#endif /* taskUSE_NAME_REGISTRY */
+		/* END of special for EDF */
+		/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_xTaskGetHandle == 1 )
+
+		TaskHandle_t xTaskGetHandle( const char * pcNameToQuery ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+		{
+			/* START of special for EDF */
+#if ( taskUSE_NAME_REGISTRY == 1 )
+			const uint32_t ulHash = prvTaskNameHash( pcNameToQuery );
+			TCB_t * pxSlotTCB, * pxTCB;
+			UBaseType_t uxSeq, uxSlot, uxProbes;
+
+			/* Task names will be truncated to configMAX_TASK_NAME_LEN - 1 bytes. */
+			configASSERT( strlen( pcNameToQuery ) < configMAX_TASK_NAME_LEN );
+
+			/* A task deleted while its name is compared may already be freed,
+			 * the sequence then tells the result is to be thrown away. */
+			do
+			{
+				uxSeq = uxTaskNameRegistrySeq;
+				taskNAME_REGISTRY_BARRIER();
+
+				pxTCB = NULL;
+				uxSlot = ( UBaseType_t ) ( ulHash % ( uint32_t ) configTASK_NAME_REGISTRY_SIZE );
+
+				for( uxProbes = ( UBaseType_t ) 0U; uxProbes < ( UBaseType_t ) configTASK_NAME_REGISTRY_SIZE; uxProbes++ )
+				{
+					pxSlotTCB = xTaskNameRegistry[ uxSlot ].pxTCB;
+
+					if( pxSlotTCB == NULL )
+					{
+						/* The end of the probe sequence. */
+						break;
+					}
+
+					if( ( pxSlotTCB != taskNAME_SLOT_DELETED ) &&
+						( xTaskNameRegistry[ uxSlot ].ulHash == ulHash ) &&
+						( strncmp( pxSlotTCB->pcTaskName, pcNameToQuery, ( size_t ) configMAX_TASK_NAME_LEN ) == 0 ) )
+					{
+						pxTCB = pxSlotTCB;
+						break;
+					}
+
+					uxSlot = ( uxSlot + ( UBaseType_t ) 1U ) % ( UBaseType_t ) configTASK_NAME_REGISTRY_SIZE;
+				}
+
+				taskNAME_REGISTRY_BARRIER();
+			} while( ( ( uxSeq & ( UBaseType_t ) 1U ) != ( UBaseType_t ) 0U ) || ( uxSeq != uxTaskNameRegistrySeq ) );
+
+			return pxTCB;
+#else /* taskUSE_NAME_REGISTRY */
+#if ( configUSE_EDF_SCHEDULER == 1 )
+			BaseType_t xList;
+#else
+			UBaseType_t uxQueue = configMAX_PRIORITIES;
+#endif
+			TCB_t * pxTCB = NULL;
+
+			/* Task names will be truncated to configMAX_TASK_NAME_LEN - 1 bytes. */
+			configASSERT( strlen( pcNameToQuery ) < configMAX_TASK_NAME_LEN );
+
+#if ( configNUMBER_OF_CORES > 1 )
+			/* The other cores go on changing the lists while this one has the
+			 * scheduler suspended. */
+			taskENTER_CRITICAL();
+			prvEDFLockAllPartitions();
+#else
+			vTaskSuspendAll();
+#endif
+			{
+				/* Search the ready lists. */
+#if ( configUSE_EDF_SCHEDULER == 1 )
+				for( xList = 0; ( xList < taskEDF_READY_LISTS ) && ( pxTCB == NULL ); xList++ )
+				{
+					pxTCB = prvSearchForNameWithinSingleList( taskEDF_CORE_READY_LIST( xList ), pcNameToQuery );
+				}
+#else
+				do
+				{
+					uxQueue--;
+					pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) &( pxReadyTasksLists[ uxQueue ] ), pcNameToQuery );
+
+					if( pxTCB != NULL )
+					{
+						/* Found the handle. */
+						break;
+					}
+				} while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+#endif
+
+				/* Search the delayed lists. */
+				/* START of special for EDF */
+#if ( configUSE_EDF_TIMING_WHEEL == 1 )
+				{
+					UBaseType_t uxList;
+
+					for( uxList = ( UBaseType_t ) 0U; ( uxList < taskWHEEL_LISTS ) && ( pxTCB == NULL ); uxList++ )
+					{
+						pxTCB = prvSearchForNameWithinSingleList( &( xWheelLists[ uxList ] ), pcNameToQuery );
+					}
+				}
+#elif ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_EDF_PARTITIONED == 1 ) )
+				{
+					BaseType_t xPartition;
+
+					for( xPartition = 0; ( xPartition < taskEDF_PARTITIONS ) && ( pxTCB == NULL ); xPartition++ )
+					{
+						pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskLists[ xPartition ], pcNameToQuery );
+
+						if( pxTCB == NULL )
+						{
+							pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskLists[ xPartition ], pcNameToQuery );
+						}
+					}
+				}
+#else
+				/* END of special for EDF */
+				if( pxTCB == NULL )
+				{
+					pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, pcNameToQuery );
+				}
+
+				if( pxTCB == NULL )
+				{
+					pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
+				}
+#endif
+
+				/* START of special for EDF */
+#if ( configUSE_EDF_HIGH_RES_TIME == 1 )
+				if( pxTCB == NULL )
+				{
+					pxTCB = prvSearchForNameWithinSingleList( &( xEDFTimerList ), pcNameToQuery );
+				}
+#endif
+				/* END of special for EDF */
+
+#if ( INCLUDE_vTaskSuspend == 1 )
+				{
+					if( pxTCB == NULL )
+					{
+						/* Search the suspended list. */
+						pxTCB = prvSearchForNameWithinSingleList( &xSuspendedTaskList, pcNameToQuery );
+					}
+				}
+#endif
+
+#if ( INCLUDE_vTaskDelete == 1 )
+				{
+					if( pxTCB == NULL )
+					{
+						/* Search the deleted list. */
+						pxTCB = prvSearchForNameWithinSingleList( &xTasksWaitingTermination, pcNameToQuery );
+					}
+				}
+#endif
+			}
+#if ( configNUMBER_OF_CORES > 1 )
+			prvEDFUnlockAllPartitions();
+			taskEXIT_CRITICAL();
+#else
+			( void ) xTaskResumeAll();
+#endif
+
+			return pxTCB;
+#endif /* taskUSE_NAME_REGISTRY */
+			/* END of special for EDF */
+		}
+
+#endif /* INCLUDE_xTaskGetHandle */
+		/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+		UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray,
+				const UBaseType_t uxArraySize,
+				configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime )
+		{
+			/* START of special for EDF */
+#if ( configUSE_EDF_SCHEDULER == 1 )
+			UBaseType_t uxTask = 0;
+			BaseType_t xList;
+#else
+			UBaseType_t uxTask = 0, uxQueue = configMAX_PRIORITIES;
+#endif
+
+#if ( configNUMBER_OF_CORES > 1 )
+			/* The other cores go on changing the lists while this one has the
+			 * scheduler suspended. */
+			taskENTER_CRITICAL();
+			prvEDFLockAllPartitions();
+#else
+			vTaskSuspendAll();
+#endif
+			/* END of special for EDF */
+			{
+				/* Is there a space in the array for each task in the system? */
+				if( uxArraySize >= uxCurrentNumberOfTasks )
+				{
+					/* Fill in an TaskStatus_t structure with information on each
+					 * task in the Ready state. */
+					/* START of special for EDF */
+#if ( configUSE_EDF_SCHEDULER == 1 )
+					for( xList = 0; xList < taskEDF_READY_LISTS; xList++ )
+					{
+						uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), taskEDF_CORE_READY_LIST( xList ), eReady );
+					}
+#else
+					do
+					{
+						uxQueue--;
+						uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxReadyTasksLists[ uxQueue ] ), eReady );
+					} while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+#endif
+					/* END of special for EDF */
+
+					/* Fill in an TaskStatus_t structure with information on each
+					 * task in the Blocked state. */
+					/* START of special for EDF */
+#if ( configUSE_EDF_TIMING_WHEEL == 1 )
+					{
+						UBaseType_t uxList;
+
+						for( uxList = ( UBaseType_t ) 0U; uxList < taskWHEEL_LISTS; uxList++ )
+						{
+							uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( xWheelLists[ uxList ] ), eBlocked );
+						}
+					}
+#elif ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_EDF_PARTITIONED == 1 ) )
+					{
+						BaseType_t xPartition;
+
+						for( xPartition = 0; xPartition < taskEDF_PARTITIONS; xPartition++ )
+						{
+							uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskLists[ xPartition ], eBlocked );
+							uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskLists[ xPartition ], eBlocked );
+						}
+					}
+#else
+					/* END of special for EDF */
+					uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
+					uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+#endif
+
+					/* START of special for EDF */
+#if ( configUSE_EDF_HIGH_RES_TIME == 1 )
+					uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( xEDFTimerList ), eBlocked );
+#endif
+					/* END of special for EDF */
+
+#if ( INCLUDE_vTaskDelete == 1 )
+					{
+						/* Fill in an TaskStatus_t structure with information on
+						 * each task that has been deleted but not yet cleaned up. */
+						uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xTasksWaitingTermination, eDeleted );
+					}
+#endif
+
+#if ( INCLUDE_vTaskSuspend == 1 )
+					{
+						/* Fill in an TaskStatus_t structure with information on
+						 * each task in the Suspended state. */
+						uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xSuspendedTaskList, eSuspended );
+					}
+#endif
+
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+					{
+						if( pulTotalRunTime != NULL )
+						{
+#ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+							portALT_GET_RUN_TIME_COUNTER_VALUE( ( *pulTotalRunTime ) );
+#else
+							*pulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
+#endif
+						}
+					}
+#else /* if ( configGENERATE_RUN_TIME_STATS == 1 ) */
+					{
+						if( pulTotalRunTime != NULL )
+						{
+							*pulTotalRunTime = 0;
+						}
+					}
+#endif /* if ( configGENERATE_RUN_TIME_STATS == 1 ) */
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+			prvEDFUnlockAllPartitions();
+			taskEXIT_CRITICAL();
+#else
+			( void ) xTaskResumeAll();
+#endif
+			/* END of special for EDF */
+
+			return uxTask;
+		}
+
+#endif /* configUSE_TRACE_FACILITY */
+		/*----------------------------------------------------------*/
+
+#if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
+
+		TaskHandle_t xTaskGetIdleTaskHandle( void )
+		{
+			/* If xTaskGetIdleTaskHandle() is called before the scheduler has been
+			 * started, then xIdleTaskHandle will be NULL. */
+			configASSERT( ( xIdleTaskHandle != NULL ) );
+			return xIdleTaskHandle;
+		}
+
+#endif /* INCLUDE_xTaskGetIdleTaskHandle */
+		/*----------------------------------------------------------*/
+
+		/* This conditional compilation should use inequality to 0, not equality to 1.
+		 * This is to ensure vTaskStepTick() is available when user defined low power mode
+		 * implementations require configUSE_TICKLESS_IDLE to be set to a value other than
+		 * 1. */
+#if ( configUSE_TICKLESS_IDLE != 0 )
+
+		void vTaskStepTick( const TickType_t xTicksToJump )
+		{
+			/* Correct the tick count value after a period during which the tick
+			 * was suppressed.  Note this does *not* call the tick hook function for
+			 * each stepped tick. */
+			configASSERT( ( xTickCount + xTicksToJump ) <= xNextTaskUnblockTime );
+			xTickCount += xTicksToJump;
+			traceINCREASE_TICK_COUNT( xTicksToJump );
+		}
+
+#endif /* configUSE_TICKLESS_IDLE */
+		/*----------------------------------------------------------*/
+
+		BaseType_t xTaskCatchUpTicks( TickType_t xTicksToCatchUp )
+		{
+			BaseType_t xYieldOccurred;
+
+			/* Must not be called with the scheduler suspended as the implementation
+			 * relies on xPendedTicks being wound down to 0 in xTaskResumeAll(). */
+			configASSERT( uxSchedulerSuspended == 0 );
+
+			/* Use xPendedTicks to mimic xTicksToCatchUp number of ticks occurring when
+			 * the scheduler is suspended so the ticks are executed in xTaskResumeAll(). */
+			vTaskSuspendAll();
+			/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
 			{
-				StackType_t * pxStack;
+				/* The tick, on another core, pends its ticks here too. */
+				const UBaseType_t uxSavedInterruptStatus = portSET_INTERRUPT_MASK();
+
+				portGET_PARTITION_LOCK( taskEDF_PARTITION );
+				xPendedTicks += xTicksToCatchUp;
+				portRELEASE_PARTITION_LOCK( taskEDF_PARTITION );
+				portCLEAR_INTERRUPT_MASK( uxSavedInterruptStatus );
+			}
+#else
+			xPendedTicks += xTicksToCatchUp;
+#endif
+			/* END of special for EDF */
+			xYieldOccurred = xTaskResumeAll();
+
+			return xYieldOccurred;
+		}
+		/*----------------------------------------------------------*/
+
+#if ( INCLUDE_xTaskAbortDelay == 1 )
+
+		BaseType_t xTaskAbortDelay( TaskHandle_t xTask )
+		{
+			TCB_t * pxTCB = xTask;
+			BaseType_t xReturn;
+
+			configASSERT( pxTCB );
+
+			vTaskSuspendAll();
+			{
+				/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+				/* An interrupt on another core can unblock the task meanwhile. */
+				taskENTER_CRITICAL();
+				taskEDF_LOCK_PARTITIONS_OF( pxTCB );
+#endif
+				/* END of special for EDF */
+
+				/* A task can only be prematurely removed from the Blocked state if
+				 * it is actually in the Blocked state. */
+				if( eTaskGetState( xTask ) == eBlocked )
+				{
+					xReturn = pdPASS;
+
+					/* Remove the reference to the task from the blocked list.  An
+					 * interrupt won't touch the xStateListItem because the
+					 * scheduler is suspended. */
+					( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+
+					/* Is the task waiting on an event also?  If so remove it from
+					 * the event list too.  Interrupts can touch the event list item,
+					 * even though the scheduler is suspended, so a critical section
+					 * is used. */
+					taskENTER_CRITICAL();
+					{
+						if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+						{
+							( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+
+							/* This lets the task know it was forcibly removed from the
+							 * blocked state so it should not re-evaluate its block time and
+							 * then block again. */
+							pxTCB->ucDelayAborted = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					taskEXIT_CRITICAL();
+
+					/* Place the unblocked task into the appropriate ready list. */
+					prvAddTaskToReadyList( pxTCB );
+
+					/* A task being unblocked cannot cause an immediate context
+					 * switch if preemption is turned off. */
+#if ( configUSE_PREEMPTION == 1 )
+					{
+						/* Preemption is on, but a context switch should only be
+						 * performed if the unblocked task has a priority that is
+						 * higher than the currently executing task. */
+						/* START of special for EDF */
+						if( taskEDF_WOKEN_TASK_PREEMPTS( pxTCB ) )
+						/* END of special for EDF */
+						{
+							/* Pend the yield to be performed when the scheduler
+							 * is unsuspended. */
+							xYieldPending = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+#endif /* configUSE_PREEMPTION */
+				}
+				else
+				{
+					xReturn = pdFAIL;
+				}
+
+				/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+				taskEDF_UNLOCK_PARTITIONS_OF( pxTCB );
+				taskEXIT_CRITICAL();
+#endif
+				/* END of special for EDF */
+			}
+			( void ) xTaskResumeAll();
+
+			return xReturn;
+		}
+
+#endif /* INCLUDE_xTaskAbortDelay */
+		/*----------------------------------------------------------*/
+
+		/* START of special for EDF */
+#if ( taskEDF_BATCH_RELEASE == 1 )
+
+		static BaseType_t prvEDFReleaseBatch( List_t * pxReleased )
+		{
+			List_t * const pxReadyList = taskEDF_CORE_READY_LIST( 0 );
+			ListItem_t * const pxEnd = ( ListItem_t * ) &( pxReadyList->xListEnd ); /*lint !e826 !e740 !e9087 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
+			ListItem_t * pxPosition = pxEnd;
+			ListItem_t * pxItem;
+			TCB_t * pxTCB;
+			BaseType_t xPreempt = pdFALSE;
+			BaseType_t xSorted = pdTRUE;
+#if ( configUSE_EDF_SCHEDULE_TABLE == 1 )
+			BaseType_t xDeviation = pdFALSE;
+#endif
+
+#if ( configUSE_EDF_SCHEDULE_TABLE == 1 )
+			if( xEDFTableActive != pdFALSE )
+			{
+				/* The table picks the tasks, the order of the list is only needed
+				 * once it is dropped. */
+				pxPosition = pxEnd->pxPrevious;
+				xSorted = pdFALSE;
+			}
+#endif
+
+#if ( configUSE_PREEMPTION == 1 )
+			if( ( xSorted != pdFALSE ) && ( listLIST_IS_EMPTY( pxReleased ) == pdFALSE ) )
+			{
+				pxTCB = listGET_OWNER_OF_HEAD_ENTRY( pxReleased ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+				if( taskEDF_PREEMPTS( pxTCB ) )
+				{
+					xPreempt = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+#endif
+
+			/* Each task goes after the ready tasks of earlier or equal deadline,
+			 * like vListInsert() would put it, and the walk resumes from it. */
+			while( listLIST_IS_EMPTY( pxReleased ) == pdFALSE )
+			{
+				pxItem = listGET_HEAD_ENTRY( pxReleased );
+				pxTCB = listGET_LIST_ITEM_OWNER( pxItem ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+				listREMOVE_ITEM( pxItem );
+
+#if ( configUSE_EDF_SCHEDULE_TABLE == 1 )
+				/* The offset of the table moves to this tick after the releases. */
+				if( ( xSorted == pdFALSE ) && ( ( ( xEDFTableOffset + 1U ) % pxTCB->xTaskPeriod ) != 0U ) )
+				{
+					xDeviation = pdTRUE;
+				}
+#endif
+
+#if ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 )
+				/* The threshold can hold off the earliest deadline and not a
+				 * later one of a lower relative deadline. */
+				if( ( xSorted != pdFALSE ) && ( taskEDF_PREEMPTS( pxTCB ) ) )
+				{
+					xPreempt = pdTRUE;
+				}
+#endif
+
+				while( ( xSorted != pdFALSE ) &&
+					   ( pxPosition->pxNext != pxEnd ) &&
+					   ( listGET_LIST_ITEM_VALUE( pxPosition->pxNext ) <= listGET_LIST_ITEM_VALUE( pxItem ) ) )
+				{
+					pxPosition = pxPosition->pxNext;
+				}
+
+				traceMOVED_TASK_TO_READY_STATE( pxTCB );
+
+				pxItem->pxNext = pxPosition->pxNext;
+				pxItem->pxPrevious = pxPosition;
+				pxPosition->pxNext->pxPrevious = pxItem;
+				pxPosition->pxNext = pxItem;
+				pxItem->pxContainer = pxReadyList;
+				( pxReadyList->uxNumberOfItems )++;
+
+				tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB );
+
+				pxPosition = pxItem;
+			}
+
+#if ( configUSE_EDF_SCHEDULE_TABLE == 1 )
+			if( xDeviation != pdFALSE )
+			{
+				/* Leaves a yield pending. */
+				prvEDFTableStop();
+			}
+#endif
+
+			/* Without preemption pxTCB is only used by the trace macros. */
+			( void ) pxTCB;
+
+			return xPreempt;
+		}
+		/*-----------------------------------------------------------*/
+
+#endif /* taskEDF_BATCH_RELEASE */
+		/* END of special for EDF */
+
+		BaseType_t xTaskIncrementTick( void )
+		{
+			TCB_t * pxTCB;
+			TickType_t xItemValue;
+			BaseType_t xSwitchRequired = pdFALSE;
+
+			/* START of special for EDF */
+#if ( taskEDF_BATCH_RELEASE == 1 )
+			List_t xReleased;
+#endif
+#if ( configNUMBER_OF_CORES > 1 )
+			UBaseType_t uxCoresYielding = 0U;
+			const BaseType_t xPartition = taskEDF_PARTITION;
+			BaseType_t xEventListsLocked = pdFALSE;
+#if ( configUSE_EDF_SEMI_PARTITIONED == 1 )
+			BaseType_t xAllPartitionsLocked = pdFALSE;
+#endif
+#if ( configUSE_EDF_SPORADIC == 1 )
+			BaseType_t xReleaseDeferred = pdFALSE;
+#endif
+#if ( configUSE_TICK_HOOK == 1 )
+			BaseType_t xCallTickHook = pdFALSE;
+#endif
+
+			/* The tick only takes the lock of its partition, unless it wakes a
+			 * task that is also in an event list.  Then it first takes the task
+			 * and ISR locks as a critical section does, which also makes it
+			 * wait for a scheduler suspended on another core.  A split job it
+			 * moves to another partition makes it lock all of them. */
+			portGET_PARTITION_LOCK( xPartition );
+
+			if( prvEDFPartitionSuspended( xPartition ) == pdFALSE )
+			{
+				xEventListsLocked = prvEDFTickNeedsEventLists();
+#if ( configUSE_EDF_SEMI_PARTITIONED == 1 )
+				xAllPartitionsLocked = prvEDFTickMovesSplitJob();
+#endif
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( xEventListsLocked != pdFALSE )
+			{
+				portRELEASE_PARTITION_LOCK( xPartition );
+				portGET_TASK_LOCK();
+				portGET_ISR_LOCK();
+				portGET_PARTITION_LOCK( xPartition );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+#if ( configUSE_EDF_SEMI_PARTITIONED == 1 )
+			if( xAllPartitionsLocked != pdFALSE )
+			{
+				portRELEASE_PARTITION_LOCK( xPartition );
+				prvEDFLockAllPartitions();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+#endif
+#endif
+			/* END of special for EDF */
+
+			/* Called by the portable layer each time a tick interrupt occurs.
+			 * Increments the tick then checks to see if the new tick value will cause any
+			 * tasks to be unblocked. */
+			traceTASK_INCREMENT_TICK( xTickCount );
+
+			/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+			if( prvEDFPartitionSuspended( xPartition ) == pdFALSE )
+#else
+			/* END of special for EDF */
+			if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+			/* START of special for EDF */
+#endif
+			/* END of special for EDF */
+			{
+				/* Minor optimisation.  The tick count cannot change in this
+				 * block. */
+				const TickType_t xConstTickCount = xTickCount + ( TickType_t ) 1;
 
-				/* Allocate space for the stack used by the task being created. */
-				pxStack = pvPortMallocStack( ( ( ( size_t ) usStackDepth ) * sizeof( StackType_t ) ) ); /*lint !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack and this allocation is the stack. */
+				/* Increment the RTOS tick, switching the delayed and overflowed
+				 * delayed lists if it wraps to 0. */
+				xTickCount = xConstTickCount;
 
-				if( pxStack != NULL )
+				/* START of special for EDF */
+#if ( configUSE_EDF_TIMING_WHEEL == 0 )
+				/* END of special for EDF */
+				if( xConstTickCount == ( TickType_t ) 0U ) /*lint !e774 'if' does not always evaluate to false as it is looking for an overflow. */
 				{
-					/* Allocate space for the TCB. */
-					pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) ); /*lint !e9087 !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack, and the first member of TCB_t is always a pointer to the task's stack. */
+					taskSWITCH_DELAYED_LISTS();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+#endif
 
-					if( pxNewTCB != NULL )
+				/* START of special for EDF */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configGENERATE_RUN_TIME_STATS == 1 ) && !defined( configRUN_TIME_COUNTS_PER_TICK ) )
+#if ( configNUMBER_OF_CORES > 1 )
+				/* The calibration counts the ticks of the first partition. */
+				if( ( ulRunTimeCountsPerTick == 0UL ) && ( xPartition == 0 ) )
+#else
+				if( ulRunTimeCountsPerTick == 0UL )
+#endif
+				{
+					prvCalibrateRunTimeCounter();
+				}
+#endif
+
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_EDF_SEMI_PARTITIONED == 1 ) )
+				/* Each core charges its own split job, before the releases so
+				 * the core is not interrupted twice. */
+				if( prvEDFSplitCharge( &uxCoresYielding ) != pdFALSE )
+				{
+					xSwitchRequired = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+#endif
+
+#if ( configUSE_EDF_SLACK_STEALING == 1 )
+				/* The tick spent in a stealer or idle is slack used up, the
+				 * periodic tasks do not change the slack while they run. */
+				if( ( xEDFSlack > 0U ) && ( ( pxCurrentTCB->xTaskSlackStealer != pdFALSE ) || ( pxCurrentTCB == xIdleTaskHandle ) ) )
+				{
+					xEDFSlack--;
+
+					if( ( xEDFSlack == 0U ) && ( prvEDFSlackMoveStealers() != pdFALSE ) )
+					{
+						xSwitchRequired = pdTRUE;
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+#endif
+				/* END of special for EDF */
+
+				/* See if this tick has made a timeout expire.  Tasks are stored in
+				 * the  queue in the order of their wake time - meaning once one task
+				 * has been found whose block time has not expired there is no need to
+				 * look any further down the list.  With the timing wheel the list is
+				 * the slot of this tick, whose tasks all wake now. */
+				if( taskDELAYED_TASKS_DUE( xConstTickCount ) )
+				{
+					/* START of special for EDF */
+#if ( taskEDF_BATCH_RELEASE == 1 )
+					vListInitialise( &xReleased );
+#endif
+					/* END of special for EDF */
+
+					for( ; ; )
+					{
+						if( listLIST_IS_EMPTY( taskDELAYED_DUE_LIST() ) != pdFALSE )
+						{
+							/* The delayed list is empty.  Set xNextTaskUnblockTime
+							 * to the maximum possible value so it is extremely
+							 * unlikely that the
+							 * if( xTickCount >= xNextTaskUnblockTime ) test will pass
+							 * next time through. */
+							xNextTaskUnblockTime = portMAX_DELAY; /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+							break;
+						}
+						else
+						{
+							/* The delayed list is not empty, get the value of the
+							 * item at the head of the delayed list.  This is the time
+							 * at which the task at the head of the delayed list must
+							 * be removed from the Blocked state. */
+							pxTCB = listGET_OWNER_OF_HEAD_ENTRY( taskDELAYED_DUE_LIST() ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+							xItemValue = listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) );
+
+							if( xConstTickCount < xItemValue )
+							{
+								/* It is not time to unblock this item yet, but the
+								 * item value is the time at which the task at the head
+								 * of the blocked list must be removed from the Blocked
+								 * state -  so record the item value in
+								 * xNextTaskUnblockTime. */
+								xNextTaskUnblockTime = xItemValue;
+								break; /*lint !e9011 Code structure here is deemed easier to understand with multiple breaks. */
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+
+							/* It is time to remove the item from the Blocked state. */
+							listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+
+							/* Is the task waiting on an event also?  If so remove
+							 * it from the event list. */
+							if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+							{
+								listREMOVE_ITEM( &( pxTCB->xEventListItem ) );
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+
+							/* START of special for EDF */
+#if ( configUSE_EDF_SCHEDULER == 1)
+							{
+								pxTCB->xTaskAbsoluteDeadline = taskEDF_RELEASE_DEADLINE( pxTCB, xTickCount );
+								pxTCB->ulTaskJobs++;
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_EDF_SEMI_PARTITIONED == 1 ) )
+								prvEDFSplitRelease( pxTCB );
+#endif
+#if ( configUSE_EDF_DVFS == 1 )
+								prvEDFDvfsRelease( pxTCB );
+#endif
+#if ( configUSE_EDF_SLACK_STEALING == 1 )
+								if( pxTCB->xTaskSlackStealer == pdFALSE )
+								{
+									prvEDFSlackRelease( pxTCB, xItemValue );
+								}
+#endif
+								traceTASK_JOB_RELEASE( pxTCB );
+							}
+#endif
+							/* END of special for EDF */
+
+							/* START of special for EDF */
+#if ( taskEDF_BATCH_RELEASE == 1 )
+							/* Sorted among the tasks released by this tick, they
+							 * are moved to the ready list together below. */
+							listSET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ), taskEDF_KEY( pxTCB ) );
+							vListInsert( &xReleased, &( pxTCB->xStateListItem ) );
+#else
+							/* END of special for EDF */
+
+							/* Place the unblocked task into the appropriate ready
+							 * list. */
+							prvAddTaskToReadyList( pxTCB );
+
+							/* A task being unblocked cannot cause an immediate
+							 * context switch if preemption is turned off. */
+#if ( configUSE_PREEMPTION == 1 )
+							{
+								/* START of special for EDF */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configNUMBER_OF_CORES == 1 ) )
+								{
+									if( taskEDF_PREEMPTS( pxTCB ) )
+									{
+										xSwitchRequired = pdTRUE;
+									}
+									else
+									{
+										mtCOVERAGE_TEST_MARKER();
+									}
+								}
+#elif ( configUSE_EDF_SCHEDULER == 1 )
+								{
+									/* Several tasks can be released by this tick, each
+									 * one must preempt a different core. */
+									if( prvEDFPreemptCoreFor( pxTCB, &uxCoresYielding ) != pdFALSE )
+									{
+										xSwitchRequired = pdTRUE;
+									}
+									else
+									{
+										mtCOVERAGE_TEST_MARKER();
+									}
+								}
+								/* END of special for EDF */
+#else
+								{
+									/* Preemption is on, but a context switch should
+									 * only be performed if the unblocked task has a
+									 * priority that is equal to or higher than the
+									 * currently executing task. */
+									if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+									{
+										xSwitchRequired = pdTRUE;
+									}
+									else
+									{
+										mtCOVERAGE_TEST_MARKER();
+									}
+								}
+#endif
+
+							}
+#endif /* configUSE_PREEMPTION */
+#endif /* taskEDF_BATCH_RELEASE */
+						}
+					}
+
+					/* START of special for EDF */
+#if ( taskEDF_BATCH_RELEASE == 1 )
+					if( prvEDFReleaseBatch( &xReleased ) != pdFALSE )
+					{
+						xSwitchRequired = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+#endif
+					/* END of special for EDF */
+				}
+
+				/* START of special for EDF */
+#if ( ( configUSE_EDF_SPORADIC == 1 ) && ( configNUMBER_OF_CORES > 1 ) )
+				/* Released once the partition is unlocked, see below. */
+				xReleaseDeferred = ( uxEDFSporadicDeferred > 0U ) ? pdTRUE : pdFALSE;
+#elif ( configUSE_EDF_SPORADIC == 1 )
+				if( uxEDFSporadicDeferred > 0U )
+				{
+					if( prvEDFSporadicReleaseDeferred() != pdFALSE )
+					{
+						xSwitchRequired = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+#endif
+#if ( configUSE_EDF_SCHEDULE_TABLE == 1 )
+				if( ( xEDFTableActive != pdFALSE ) && ( prvEDFTableTick() != pdFALSE ) )
+				{
+					xSwitchRequired = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+#endif
+#if ( configUSE_EDF_DEFERRED_PREEMPTION == 1 )
+				if( ( xEDFPreemptionDeferred != pdFALSE ) &&
+					( ( TickType_t ) ( xTickCount - xEDFDeferredSince ) >= pxCurrentTCB->xTaskNonPreemptiveTicks ) )
+				{
+					/* End of the non-preemptive region. */
+					xEDFPreemptionDeferred = pdFALSE;
+					xSwitchRequired = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+#endif
+#if ( configUSE_EDF_HIGH_RES_TIME == 1 )
+				/* Catches the wake ups the alarm could not release because the
+				 * scheduler was suspended, and all of them on the POSIX port. */
+				if( ( listLIST_IS_EMPTY( &( xEDFTimerList ) ) == pdFALSE ) && ( prvEDFTimerReleaseDue() != pdFALSE ) )
+				{
+					xSwitchRequired = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				prvEDFRebase();
+#endif
+#if ( configUSE_EDF_TICKLESS_KERNEL == 1 )
+				if( xEDFTicklessStarted == pdFALSE )
+				{
+					/* First tick of the port, the one-shot event takes over from
+					 * here. */
+					xEDFTicklessStarted = pdTRUE;
+					configEDF_TICKLESS_START();
+					prvEDFTicklessProgram( pdTRUE );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+#endif
+				/* END of special for EDF */
+
+				/* Tasks of equal priority to the currently running task will share
+				 * processing time (time slice) if preemption is on, and the application
+				 * writer has not explicitly turned time slicing off. */
+#if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
+				{
+					if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 )
+					{
+						xSwitchRequired = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+#endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) ) */
+
+#if ( configUSE_TICK_HOOK == 1 )
+				{
+					/* Guard against the tick hook being called when the pended tick
+					 * count is being unwound (when the scheduler is being unlocked). */
+					if( xPendedTicks == ( TickType_t ) 0 )
+					{
+						/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+						xCallTickHook = pdTRUE;
+#else
+						/* END of special for EDF */
+						vApplicationTickHook();
+						/* START of special for EDF */
+#endif
+						/* END of special for EDF */
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+#endif /* configUSE_TICK_HOOK */
+
+#if ( configUSE_PREEMPTION == 1 )
+				{
+					if( xYieldPending != pdFALSE )
 					{
-						/* Store the stack location in the TCB. */
-						pxNewTCB->pxStack = pxStack;
+						xSwitchRequired = pdTRUE;
 					}
 					else
 					{
-						/* The stack cannot be used as the TCB was not created.  Free
-						 * it again. */
-						vPortFreeStack( pxStack );
+						mtCOVERAGE_TEST_MARKER();
 					}
 				}
-				else
+#endif /* configUSE_PREEMPTION */
+			}
+			else
+			{
+				++xPendedTicks;
+
+				/* The tick hook gets called at regular intervals, even if the
+				 * scheduler is locked. */
+#if ( configUSE_TICK_HOOK == 1 )
 				{
-					pxNewTCB = NULL;
+					/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+					xCallTickHook = pdTRUE;
+#else
+					/* END of special for EDF */
+					vApplicationTickHook();
+					/* START of special for EDF */
+#endif
+					/* END of special for EDF */
 				}
+#endif
 			}
-#endif /* portSTACK_GROWTH */
 
-			if( pxNewTCB != NULL )
+			/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+#if ( configUSE_EDF_SEMI_PARTITIONED == 1 )
+			if( xAllPartitionsLocked != pdFALSE )
 			{
-#if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e9029 !e731 Macro has been consolidated for readability reasons. */
+				prvEDFUnlockAllPartitions();
+			}
+			else
+#endif
+			{
+				portRELEASE_PARTITION_LOCK( xPartition );
+			}
+
+			/* The deferred sporadic arrivals and the tick hook are shared by
+			 * the partitions, the first one runs them.  They may make tasks of
+			 * any partition ready, so they run with no partition locked. */
+#if ( configUSE_EDF_SPORADIC == 1 )
+			if( ( xReleaseDeferred != pdFALSE ) && ( xPartition == 0 ) )
+			{
+				const UBaseType_t uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+
+				if( prvEDFSporadicReleaseDeferred() != pdFALSE )
 				{
-					/* Tasks can be created statically or dynamically, so note this
-					 * task was created dynamically in case it is later deleted. */
-					pxNewTCB->ucStaticallyAllocated = tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB;
+					xSwitchRequired = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
 				}
-#endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
 
-				prvInitialiseNewTask( pxTaskCode, pcName, ( uint32_t ) usStackDepth, pvParameters, uxPriority, pxCreatedTask, pxNewTCB, NULL );
-				prvAddNewTaskToReadyList( pxNewTCB );
-				xReturn = pdPASS;
+				taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+			}
+#endif
+
+			if( xEventListsLocked != pdFALSE )
+			{
+				portRELEASE_ISR_LOCK();
+				portRELEASE_TASK_LOCK();
 			}
 			else
 			{
-				xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+				mtCOVERAGE_TEST_MARKER();
 			}
 
-			return xReturn;
-		}
+#if ( configUSE_TICK_HOOK == 1 )
+			if( ( xCallTickHook != pdFALSE ) && ( xPartition == 0 ) )
+			{
+				vApplicationTickHook();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+#endif
+#endif /* configNUMBER_OF_CORES */
+			/* END of special for EDF */
 
-#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+			traceTASK_INCREMENT_TICK_END( xSwitchRequired );
+
+			return xSwitchRequired;
+		}
 		/*-----------------------------------------------------------*/
-		/* START of special for EDF */
-#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 && configUSE_EDF_SCHEDULER == 1 ) 
 
-		BaseType_t xTaskPeriodicCreate( TaskFunction_t pxTaskCode,
-				const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
-				const configSTACK_DEPTH_TYPE usStackDepth,
-				void * const pvParameters,
-				UBaseType_t uxPriority,
-				TaskHandle_t * const pxCreatedTask,
-				TickType_t uxPeriod	)
+#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+
+		void vTaskSetApplicationTaskTag( TaskHandle_t xTask,
+				TaskHookFunction_t pxHookFunction )
 		{
-			TCB_t * pxNewTCB;
-			BaseType_t xReturn;
+			TCB_t * xTCB;
 
-			/* If the stack grows down then allocate the stack then the TCB so the stack
-			 * does not grow into the TCB.  Likewise if the stack grows up then allocate
-			 * the TCB then the stack. */
-#if ( portSTACK_GROWTH > 0 )
+			/* If xTask is NULL then it is the task hook of the calling task that is
+			 * getting set. */
+			if( xTask == NULL )
 			{
-				/* Allocate space for the TCB.  Where the memory comes from depends on
-				 * the implementation of the port malloc function and whether or not static
-				 * allocation is being used. */
-				pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
-
-				if( pxNewTCB != NULL )
-				{
-					/* Allocate space for the stack used by the task being created.
-					 * The base of the stack memory stored in the TCB so the task can
-					 * be deleted later if required. */
-					pxNewTCB->pxStack = ( StackType_t * ) pvPortMallocStack( ( ( ( size_t ) usStackDepth ) * sizeof( StackType_t ) ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-
-					if( pxNewTCB->pxStack == NULL )
-					{
-						/* Could not allocate the stack.  Delete the allocated TCB. */
-						vPortFree( pxNewTCB );
-						pxNewTCB = NULL;
-					}
-				}
+				xTCB = ( TCB_t * ) pxCurrentTCB;
 			}
-#else /* portSTACK_GROWTH */
+			else
 			{
-				StackType_t * pxStack;
+				xTCB = xTask;
+			}
 
-				/* Allocate space for the stack used by the task being created. */
-				pxStack = pvPortMallocStack( ( ( ( size_t ) usStackDepth ) * sizeof( StackType_t ) ) ); /*lint !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack and this allocation is the stack. */
+			/* Save the hook function in the TCB.  A critical section is required as
+			 * the value can be accessed from an interrupt. */
+			taskENTER_CRITICAL();
+			{
+				xTCB->pxTaskTag = pxHookFunction;
+			}
+			taskEXIT_CRITICAL();
+		}
 
-				if( pxStack != NULL )
-				{
-					/* Allocate space for the TCB. */
-					pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) ); /*lint !e9087 !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack, and the first member of TCB_t is always a pointer to the task's stack. */
+#endif /* configUSE_APPLICATION_TASK_TAG */
+		/*-----------------------------------------------------------*/
 
-					if( pxNewTCB != NULL )
-					{
-						/* Store the stack location in the TCB. */
-						pxNewTCB->pxStack = pxStack;
-					}
-					else
-					{
-						/* The stack cannot be used as the TCB was not created.  Free
-						 * it again. */
-						vPortFreeStack( pxStack );
-					}
-				}
-				else
-				{
-					pxNewTCB = NULL;
-				}
-			}
-#endif /* portSTACK_GROWTH */
+#if ( configUSE_APPLICATION_TASK_TAG == 1 )
 
-			if( pxNewTCB != NULL )
+		TaskHookFunction_t xTaskGetApplicationTaskTag( TaskHandle_t xTask )
+		{
+			TCB_t * pxTCB;
+			TaskHookFunction_t xReturn;
+
+			/* If xTask is NULL then set the calling task's hook. */
+			pxTCB = prvGetTCBFromHandle( xTask );
+
+			/* Save the hook function in the TCB.  A critical section is required as
+			 * the value can be accessed from an interrupt. */
+			taskENTER_CRITICAL();
 			{
-#if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e9029 !e731 Macro has been consolidated for readability reasons. */
-				{
-					/* Tasks can be created statically or dynamically, so note this
-					 * task was created dynamically in case it is later deleted. */
-					pxNewTCB->ucStaticallyAllocated = tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB;
-				}
-#endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
+				xReturn = pxTCB->pxTaskTag;
+			}
+			taskEXIT_CRITICAL();
 
-				prvInitialiseNewTask( pxTaskCode, pcName, ( uint32_t ) usStackDepth, pvParameters, uxPriority, pxCreatedTask, pxNewTCB, NULL );
+			return xReturn;
+		}
 
-				/* start of special for EDF */
-				pxNewTCB->xTaskPeriod = uxPeriod;
-				listSET_LIST_ITEM_VALUE( &( ( pxNewTCB )->xStateListItem ), ( pxNewTCB)->xTaskPeriod + xTickCount);
-				/*end of special for EDF */
+#endif /* configUSE_APPLICATION_TASK_TAG */
+		/*-----------------------------------------------------------*/
 
-				prvAddNewTaskToReadyList( pxNewTCB );
-				xReturn = pdPASS;
-			}
-			else
+#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+
+		TaskHookFunction_t xTaskGetApplicationTaskTagFromISR( TaskHandle_t xTask )
+		{
+			TCB_t * pxTCB;
+			TaskHookFunction_t xReturn;
+			UBaseType_t uxSavedInterruptStatus;
+
+			/* If xTask is NULL then set the calling task's hook. */
+			pxTCB = prvGetTCBFromHandle( xTask );
+
+			/* Save the hook function in the TCB.  A critical section is required as
+			 * the value can be accessed from an interrupt. */
+			uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
 			{
-				xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+				xReturn = pxTCB->pxTaskTag;
 			}
+			portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
 
 			return xReturn;
 		}
 
-#endif /* configSUPPORT_EDF_DYNAMIC_ALLOCATION */
+#endif /* configUSE_APPLICATION_TASK_TAG */
 		/*-----------------------------------------------------------*/
 
-		static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
-				const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
-				const uint32_t ulStackDepth,
-				void * const pvParameters,
-				UBaseType_t uxPriority,
-				TaskHandle_t * const pxCreatedTask,
-				TCB_t * pxNewTCB,
-				const MemoryRegion_t * const xRegions )
+#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+
+		BaseType_t xTaskCallApplicationTaskHook( TaskHandle_t xTask,
+				void * pvParameter )
 		{
-			StackType_t * pxTopOfStack;
-			UBaseType_t x;
+			TCB_t * xTCB;
+			BaseType_t xReturn;
 
-#if ( portUSING_MPU_WRAPPERS == 1 )
-			/* Should the task be created in privileged mode? */
-			BaseType_t xRunPrivileged;
+			/* If xTask is NULL then we are calling our own task hook. */
+			if( xTask == NULL )
+			{
+				xTCB = pxCurrentTCB;
+			}
+			else
+			{
+				xTCB = xTask;
+			}
 
-			if( ( uxPriority & portPRIVILEGE_BIT ) != 0U )
+			if( xTCB->pxTaskTag != NULL )
 			{
-				xRunPrivileged = pdTRUE;
+				xReturn = xTCB->pxTaskTag( pvParameter );
 			}
 			else
 			{
-				xRunPrivileged = pdFALSE;
+				xReturn = pdFAIL;
 			}
-			uxPriority &= ~portPRIVILEGE_BIT;
-#endif /* portUSING_MPU_WRAPPERS == 1 */
 
-			/* Avoid dependency on memset() if it is not required. */
-#if ( tskSET_NEW_STACKS_TO_KNOWN_VALUE == 1 )
+			return xReturn;
+		}
+
+#endif /* configUSE_APPLICATION_TASK_TAG */
+		/*-----------------------------------------------------------*/
+
+		void vTaskSwitchContext( void )
+		{
+			/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+			/* Called from the yield interrupt of every core, which only needs
+			 * the lock of its own partition. */
+			const UBaseType_t uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+			const BaseType_t xPartition = taskEDF_PARTITION;
+#if ( configUSE_EDF_SEMI_PARTITIONED == 1 )
+			const TCB_t * const pxPreviousTCB = pxCurrentTCB;
+
+			/* A split job switched out after it migrated is made to run on
+			 * its second core, whose partition is locked too. */
+			if( pxPreviousTCB->xTaskSplitCore != taskTASK_NOT_SPLIT )
 			{
-				/* Fill the stack with a known value to assist debugging. */
-				( void ) memset( pxNewTCB->pxStack, ( int ) tskSTACK_FILL_BYTE, ( size_t ) ulStackDepth * sizeof( StackType_t ) );
+				prvEDFLockPartitionsOf( pxPreviousTCB );
+			}
+			else
+#endif
+			{
+				portGET_PARTITION_LOCK( xPartition );
 			}
-#endif /* tskSET_NEW_STACKS_TO_KNOWN_VALUE */
+#endif
+			/* END of special for EDF */
 
-			/* Calculate the top of stack address.  This depends on whether the stack
-			 * grows from high memory to low (as per the 80x86) or vice versa.
-			 * portSTACK_GROWTH is used to make the result positive or negative as required
-			 * by the port. */
-#if ( portSTACK_GROWTH < 0 )
+			if( uxSchedulerSuspended != ( UBaseType_t ) pdFALSE )
 			{
-				pxTopOfStack = &( pxNewTCB->pxStack[ ulStackDepth - ( uint32_t ) 1 ] );
-				pxTopOfStack = ( StackType_t * ) ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack ) & ( ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) ) ); /*lint !e923 !e9033 !e9078 MISRA exception.  Avoiding casts between pointers and integers is not practical.  Size differences accounted for using portPOINTER_SIZE_TYPE type.  Checked by assert(). */
-
-				/* Check the alignment of the calculated top of stack is correct. */
-				configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack & ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) == 0UL ) );
+				/* The scheduler is currently suspended - do not allow a context
+				 * switch. */
+				xYieldPending = pdTRUE;
+			}
+			else
+			{
+				xYieldPending = pdFALSE;
+				traceTASK_SWITCHED_OUT();
 
-#if ( configRECORD_STACK_HIGH_ADDRESS == 1 )
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
 				{
-					/* Also record the stack's high address, which may assist
-					 * debugging. */
-					pxNewTCB->pxEndOfStack = pxTopOfStack;
+#ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+					portALT_GET_RUN_TIME_COUNTER_VALUE( ulTotalRunTime );
+#else
+					ulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
+#endif
+
+					/* Add the amount of time the task has been running to the
+					 * accumulated time so far.  The time the task started running was
+					 * stored in ulTaskSwitchedInTime.  Note that there is no overflow
+					 * protection here so count values are only valid until the timer
+					 * overflows.  The guard against negative values is to protect
+					 * against suspect run time stat counter implementations - which
+					 * are provided by the application, not the kernel. */
+					if( ulTotalRunTime > ulTaskSwitchedInTime )
+					{
+						pxCurrentTCB->ulRunTimeCounter += ( ulTotalRunTime - ulTaskSwitchedInTime );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					ulTaskSwitchedInTime = ulTotalRunTime;
 				}
-#endif /* configRECORD_STACK_HIGH_ADDRESS */
-			}
-#else /* portSTACK_GROWTH */
-			{
-				pxTopOfStack = pxNewTCB->pxStack;
+#endif /* configGENERATE_RUN_TIME_STATS */
 
-				/* Check the alignment of the stack buffer is correct. */
-				configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pxNewTCB->pxStack & ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) == 0UL ) );
+				/* START of special for EDF */
+#if ( configUSE_EDF_DVFS == 1 )
+				prvEDFDvfsAccountCycles();
+#endif
+				/* END of special for EDF */
 
-				/* The other extreme of the stack space is required if stack checking is
-				 * performed. */
-				pxNewTCB->pxEndOfStack = pxNewTCB->pxStack + ( ulStackDepth - ( uint32_t ) 1 );
-			}
-#endif /* portSTACK_GROWTH */
+				/* Check for stack overflow, if configured. */
+				taskCHECK_FOR_STACK_OVERFLOW();
 
-			/* Store the task name in the TCB. */
-			if( pcName != NULL )
-			{
-				for( x = ( UBaseType_t ) 0; x < ( UBaseType_t ) configMAX_TASK_NAME_LEN; x++ )
+				/* Before the currently running task is switched out, save its errno. */
+#if ( configUSE_POSIX_ERRNO == 1 )
 				{
-					pxNewTCB->pcTaskName[ x ] = pcName[ x ];
+					pxCurrentTCB->iTaskErrno = FreeRTOS_errno;
+				}
+#endif
 
-					/* Don't copy all configMAX_TASK_NAME_LEN if the string is shorter than
-					 * configMAX_TASK_NAME_LEN characters just in case the memory after the
-					 * string is not accessible (extremely unlikely). */
-					if( pcName[ x ] == ( char ) 0x00 )
+				/* Select a new task to run using either the generic C or port
+				 * optimised asm code. */
+
+				/* START of special for EDF */
+#if (configUSE_EDF_SCHEDULER == 0)
+				{
+					taskSELECT_HIGHEST_PRIORITY_TASK(); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+				}
+#elif ( configNUMBER_OF_CORES == 1 )
+				{
+#if ( configUSE_EDF_SCHEDULE_TABLE == 1 )
+					if( xEDFTableActive != pdFALSE )
 					{
-						break;
+						prvEDFTableSelect();
 					}
 					else
+#endif
+#if ( configUSE_EDF_DEFERRED_PREEMPTION == 1 )
+					if( prvEDFPreemptionDeferred() != pdFALSE )
 					{
+						/* The running task goes on to the end of its region. */
 						mtCOVERAGE_TEST_MARKER();
 					}
+					else
+#endif
+					{
+#if ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 )
+						prvEDFThresholdSelect();
+#else
+						pxCurrentTCB = (TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( &( xReadyTasksListEDF ) );
+#endif
+					}
+				}
+#else
+				{
+					/* The head of the list can be running on another core. */
+					prvEDFSelectTaskForCore( portGET_CORE_ID() );
+				}
+#endif
+#if ( configUSE_EDF_TICKLESS_KERNEL == 1 )
+				/* The task switched out may have blocked until before the
+				 * event programmed. */
+				if( xEDFTicklessStarted != pdFALSE )
+				{
+					prvEDFTicklessProgram( pdFALSE );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
 				}
+#endif
+				/* END of special for EDF */
 
-				/* Ensure the name string is terminated in the case that the string length
-				 * was greater or equal to configMAX_TASK_NAME_LEN. */
-				pxNewTCB->pcTaskName[ configMAX_TASK_NAME_LEN - 1 ] = '\0';
-			}
-			else
-			{
-				/* The task has not been given a name, so just ensure there is a NULL
-				 * terminator when it is read out. */
-				pxNewTCB->pcTaskName[ 0 ] = 0x00;
-			}
+				traceTASK_SWITCHED_IN();
 
-			/* This is used as an array index so must ensure it's not too large. */
-			configASSERT( uxPriority < configMAX_PRIORITIES );
+				/* After the new task is switched in, update the global errno. */
+#if ( configUSE_POSIX_ERRNO == 1 )
+				{
+					FreeRTOS_errno = pxCurrentTCB->iTaskErrno;
+				}
+#endif
 
-			if( uxPriority >= ( UBaseType_t ) configMAX_PRIORITIES )
+#if ( configUSE_NEWLIB_REENTRANT == 1 )
+				{
+					/* Switch Newlib's _impure_ptr variable to point to the _reent
+					 * structure specific to this task.
+					 * See the third party link http://www.nadler.com/embedded/newlibAndFreeRTOS.html
+					 * for additional information. */
+					_impure_ptr = &( pxCurrentTCB->xNewLib_reent );
+				}
+#endif /* configUSE_NEWLIB_REENTRANT */
+			}
+
+			/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+#if ( configUSE_EDF_SEMI_PARTITIONED == 1 )
+			if( pxPreviousTCB->xTaskSplitCore != taskTASK_NOT_SPLIT )
 			{
-				uxPriority = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) 1U;
+				prvEDFUnlockPartitionsOf( pxPreviousTCB );
 			}
 			else
+#endif
 			{
-				mtCOVERAGE_TEST_MARKER();
+				portRELEASE_PARTITION_LOCK( xPartition );
 			}
 
-			pxNewTCB->uxPriority = uxPriority;
-#if ( configUSE_MUTEXES == 1 )
-			{
-				pxNewTCB->uxBasePriority = uxPriority;
-				pxNewTCB->uxMutexesHeld = 0;
-			}
-#endif /* configUSE_MUTEXES */
+			portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+#endif
+			/* END of special for EDF */
+		}
+		/*-----------------------------------------------------------*/
 
-			vListInitialiseItem( &( pxNewTCB->xStateListItem ) );
-			vListInitialiseItem( &( pxNewTCB->xEventListItem ) );
+		void vTaskPlaceOnEventList( List_t * const pxEventList,
+				const TickType_t xTicksToWait )
+		{
+			configASSERT( pxEventList );
 
-			/* Set the pxNewTCB as a link back from the ListItem_t.  This is so we can get
-			 * back to  the containing TCB from a generic item in a list. */
-			listSET_LIST_ITEM_OWNER( &( pxNewTCB->xStateListItem ), pxNewTCB );
+			/* THIS FUNCTION MUST BE CALLED WITH EITHER INTERRUPTS DISABLED OR THE
+			 * SCHEDULER SUSPENDED AND THE QUEUE BEING ACCESSED LOCKED. */
 
-			/* Event lists are always in priority order. */
-			listSET_LIST_ITEM_VALUE( &( pxNewTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-			listSET_LIST_ITEM_OWNER( &( pxNewTCB->xEventListItem ), pxNewTCB );
+			/* Place the event list item of the TCB in the appropriate event list.
+			 * This is placed in the list in priority order so the highest priority task
+			 * is the first to be woken by the event.
+			 *
+			 * Note: Lists are sorted in ascending order by ListItem_t.xItemValue.
+			 * Normally, the xItemValue of a TCB's ListItem_t members is:
+			 *      xItemValue = ( configMAX_PRIORITIES - uxPriority )
+			 * Therefore, the event list is sorted in descending priority order.
+			 *
+			 * The queue that contains the event list is locked, preventing
+			 * simultaneous access from interrupts. */
+			/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+			/* The tick of another core may be taking a task out of the
+			 * same list, the event lists are under the ISR lock. */
+			taskENTER_CRITICAL();
+#endif
+			/* END of special for EDF */
 
-#if ( portCRITICAL_NESTING_IN_TCB == 1 )
-			{
-				pxNewTCB->uxCriticalNesting = ( UBaseType_t ) 0U;
-			}
-#endif /* portCRITICAL_NESTING_IN_TCB */
+			vListInsert( pxEventList, &( pxCurrentTCB->xEventListItem ) );
 
-#if ( configUSE_APPLICATION_TASK_TAG == 1 )
-			{
-				pxNewTCB->pxTaskTag = NULL;
-			}
-#endif /* configUSE_APPLICATION_TASK_TAG */
+			prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
 
-#if ( configGENERATE_RUN_TIME_STATS == 1 )
-			{
-				pxNewTCB->ulRunTimeCounter = ( configRUN_TIME_COUNTER_TYPE ) 0;
-			}
-#endif /* configGENERATE_RUN_TIME_STATS */
+			/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+			taskEXIT_CRITICAL();
+#endif
+			/* END of special for EDF */
+		}
+		/*-----------------------------------------------------------*/
 
-#if ( portUSING_MPU_WRAPPERS == 1 )
-			{
-				vPortStoreTaskMPUSettings( &( pxNewTCB->xMPUSettings ), xRegions, pxNewTCB->pxStack, ulStackDepth );
-			}
-#else
-			{
-				/* Avoid compiler warning about unreferenced parameter. */
-				( void ) xRegions;
-			}
+		void vTaskPlaceOnUnorderedEventList( List_t * pxEventList,
+				const TickType_t xItemValue,
+				const TickType_t xTicksToWait )
+		{
+			configASSERT( pxEventList );
+
+			/* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.  It is used by
+			 * the event groups implementation. */
+			configASSERT( uxSchedulerSuspended != 0 );
+
+			/* Store the item value in the event list item.  It is safe to access the
+			 * event list item here as interrupts won't access the event list item of a
+			 * task that is not in the Blocked state. */
+			listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+
+			/* Place the event list item of the TCB at the end of the appropriate event
+			 * list.  It is safe to access the event list here because it is part of an
+			 * event group implementation - and interrupts don't access event groups
+			 * directly (instead they access them indirectly by pending function calls to
+			 * the task level). */
+			/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+			/* The event lists are under the ISR lock. */
+			taskENTER_CRITICAL();
+#endif
+			/* END of special for EDF */
+
+			listINSERT_END( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+
+			prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
+
+			/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+			taskEXIT_CRITICAL();
 #endif
+			/* END of special for EDF */
+		}
+		/*-----------------------------------------------------------*/
+
+#if ( configUSE_TIMERS == 1 )
+
+		void vTaskPlaceOnEventListRestricted( List_t * const pxEventList,
+				TickType_t xTicksToWait,
+				const BaseType_t xWaitIndefinitely )
+		{
+			configASSERT( pxEventList );
 
-#if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0 )
-			{
-				memset( ( void * ) &( pxNewTCB->pvThreadLocalStoragePointers[ 0 ] ), 0x00, sizeof( pxNewTCB->pvThreadLocalStoragePointers ) );
-			}
-#endif
+			/* This function should not be called by application code hence the
+			 * 'Restricted' in its name.  It is not part of the public API.  It is
+			 * designed for use by kernel code, and has special calling requirements -
+			 * it should be called with the scheduler suspended. */
 
-#if ( configUSE_TASK_NOTIFICATIONS == 1 )
-			{
-				memset( ( void * ) &( pxNewTCB->ulNotifiedValue[ 0 ] ), 0x00, sizeof( pxNewTCB->ulNotifiedValue ) );
-				memset( ( void * ) &( pxNewTCB->ucNotifyState[ 0 ] ), 0x00, sizeof( pxNewTCB->ucNotifyState ) );
-			}
-#endif
 
-#if ( configUSE_NEWLIB_REENTRANT == 1 )
-			{
-				/* Initialise this task's Newlib reent structure.
-				 * See the third party link http://www.nadler.com/embedded/newlibAndFreeRTOS.html
-				 * for additional information. */
-				_REENT_INIT_PTR( ( &( pxNewTCB->xNewLib_reent ) ) );
-			}
+			/* Place the event list item of the TCB in the appropriate event list.
+			 * In this case it is assume that this is the only task that is going to
+			 * be waiting on this event list, so the faster vListInsertEnd() function
+			 * can be used in place of vListInsert. */
+			/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+			/* The event lists are under the ISR lock. */
+			taskENTER_CRITICAL();
 #endif
+			/* END of special for EDF */
 
-#if ( INCLUDE_xTaskAbortDelay == 1 )
-			{
-				pxNewTCB->ucDelayAborted = pdFALSE;
-			}
-#endif
+			listINSERT_END( pxEventList, &( pxCurrentTCB->xEventListItem ) );
 
-			/* Initialize the TCB stack to look as if the task was already running,
-			 * but had been interrupted by the scheduler.  The return address is set
-			 * to the start of the task function. Once the stack has been initialised
-			 * the top of stack variable is updated. */
-#if ( portUSING_MPU_WRAPPERS == 1 )
-			{
-				/* If the port has capability to detect stack overflow,
-				 * pass the stack end address to the stack initialization
-				 * function as well. */
-#if ( portHAS_STACK_OVERFLOW_CHECKING == 1 )
-				{
-#if ( portSTACK_GROWTH < 0 )
-					{
-						pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxStack, pxTaskCode, pvParameters, xRunPrivileged );
-					}
-#else /* portSTACK_GROWTH */
-					{
-						pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxEndOfStack, pxTaskCode, pvParameters, xRunPrivileged );
-					}
-#endif /* portSTACK_GROWTH */
-				}
-#else /* portHAS_STACK_OVERFLOW_CHECKING */
-				{
-					pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTaskCode, pvParameters, xRunPrivileged );
-				}
-#endif /* portHAS_STACK_OVERFLOW_CHECKING */
-			}
-#else /* portUSING_MPU_WRAPPERS */
+			/* If the task should block indefinitely then set the block time to a
+			 * value that will be recognised as an indefinite delay inside the
+			 * prvAddCurrentTaskToDelayedList() function. */
+			if( xWaitIndefinitely != pdFALSE )
 			{
-				/* If the port has capability to detect stack overflow,
-				 * pass the stack end address to the stack initialization
-				 * function as well. */
-#if ( portHAS_STACK_OVERFLOW_CHECKING == 1 )
-				{
-#if ( portSTACK_GROWTH < 0 )
-					{
-						pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxStack, pxTaskCode, pvParameters );
-					}
-#else /* portSTACK_GROWTH */
-					{
-						pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxEndOfStack, pxTaskCode, pvParameters );
-					}
-#endif /* portSTACK_GROWTH */
-				}
-#else /* portHAS_STACK_OVERFLOW_CHECKING */
-				{
-					pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTaskCode, pvParameters );
-				}
-#endif /* portHAS_STACK_OVERFLOW_CHECKING */
+				xTicksToWait = portMAX_DELAY;
 			}
-#endif /* portUSING_MPU_WRAPPERS */
 
-			if( pxCreatedTask != NULL )
-			{
-				/* Pass the handle out in an anonymous way.  The handle can be used to
-				 * change the created task's priority, delete the created task, etc.*/
-				*pxCreatedTask = ( TaskHandle_t ) pxNewTCB;
-			}
-			else
-			{
-				mtCOVERAGE_TEST_MARKER();
-			}
+			traceTASK_DELAY_UNTIL( ( xTickCount + xTicksToWait ) );
+			prvAddCurrentTaskToDelayedList( xTicksToWait, xWaitIndefinitely );
+
+			/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+			taskEXIT_CRITICAL();
+#endif
+			/* END of special for EDF */
 		}
+
+#endif /* configUSE_TIMERS */
 		/*-----------------------------------------------------------*/
 
-		static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
+		BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList )
 		{
-			/* Ensure interrupts don't access the task lists while the lists are being
-			 * updated. */
-			taskENTER_CRITICAL();
-			{
-				uxCurrentNumberOfTasks++;
+			TCB_t * pxUnblockedTCB;
+			BaseType_t xReturn;
 
-				if( pxCurrentTCB == NULL )
-				{
-					/* There are no other tasks, or all the other tasks are in
-					 * the suspended state - make this the current task. */
-					pxCurrentTCB = pxNewTCB;
+			/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.  It can also be
+			 * called from a critical section within an ISR. */
 
-					if( uxCurrentNumberOfTasks == ( UBaseType_t ) 1 )
-					{
-						/* This is the first task to be created so do the preliminary
-						 * initialisation required.  We will not recover if this call
-						 * fails, but we will report the failure. */
-						prvInitialiseTaskLists();
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
-				}
-				else
-				{
-					/* If the scheduler is not already running, make this task the
-					 * current task if it is the highest priority task to be created
-					 * so far. */
-					if( xSchedulerRunning == pdFALSE )
-					{
-#if (configUSE_EDF_SCHEDULER == 0)
-						if( pxCurrentTCB->uxPriority <= pxNewTCB->uxPriority )
-						{
-							pxCurrentTCB = pxNewTCB;
-						}
-						else
-						{
-							mtCOVERAGE_TEST_MARKER();
-						}
-#else /* START of special for EDF */
-if( pxCurrentTCB->xStateListItem.xItemValue >= pxNewTCB->xStateListItem.xItemValue )
-{
-	pxCurrentTCB = pxNewTCB;
-}
-else
-{
-	mtCOVERAGE_TEST_MARKER();
-}
-#endif /* END of special for EDF */
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
-				}
+			/* The event list is sorted in priority order, so the first in the list can
+			 * be removed as it is known to be the highest priority.  Remove the TCB from
+			 * the delayed list, and add it to the ready list.
+			 *
+			 * If an event is for a queue that is locked then this function will never
+			 * get called - the lock count on the queue will get modified instead.  This
+			 * means exclusive access to the event list is guaranteed here.
+			 *
+			 * This function assumes that a check has already been made to ensure that
+			 * pxEventList is not empty. */
+			pxUnblockedTCB = listGET_OWNER_OF_HEAD_ENTRY( pxEventList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+			configASSERT( pxUnblockedTCB );
+			/* START of special for EDF */
+			taskEDF_LOCK_PARTITIONS_OF( pxUnblockedTCB );
+			/* END of special for EDF */
+			listREMOVE_ITEM( &( pxUnblockedTCB->xEventListItem ) );
 
-				uxTaskNumber++;
+			if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+			{
+				listREMOVE_ITEM( &( pxUnblockedTCB->xStateListItem ) );
+				prvAddTaskToReadyList( pxUnblockedTCB );
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+#if ( configUSE_TICKLESS_IDLE != 0 )
 				{
-					/* Add a counter into the TCB for tracing only. */
-					pxNewTCB->uxTCBNumber = uxTaskNumber;
+					/* If a task is blocked on a kernel object then xNextTaskUnblockTime
+					 * might be set to the blocked task's time out time.  If the task is
+					 * unblocked for a reason other than a timeout xNextTaskUnblockTime is
+					 * normally left unchanged, because it is automatically reset to a new
+					 * value when the tick count equals xNextTaskUnblockTime.  However if
+					 * tickless idling is used it might be more important to enter sleep mode
+					 * at the earliest possible time - so reset xNextTaskUnblockTime here to
+					 * ensure it is updated at the earliest possible time. */
+					prvResetNextTaskUnblockTime();
 				}
-#endif /* configUSE_TRACE_FACILITY */
-				traceTASK_CREATE( pxNewTCB );
-
-				prvAddTaskToReadyList( pxNewTCB );
-
-				portSETUP_TCB( pxNewTCB );
+#endif
+			}
+			else
+			{
+				/* The delayed and ready lists cannot be accessed, so hold this task
+				 * pending until the scheduler is resumed. */
+				listINSERT_END( &( xPendingReadyList ), &( pxUnblockedTCB->xEventListItem ) );
 			}
-			taskEXIT_CRITICAL();
 
-			if( xSchedulerRunning != pdFALSE )
+			/* START of special for EDF */
+			if( taskEDF_WOKEN_TASK_PREEMPTS( pxUnblockedTCB ) )
+			/* END of special for EDF */
 			{
-#if ( configUSE_EDF_SCHEDULER == 0 )
-				{
-					/* If the created task is of a higher priority than the current task
-					 * then it should run now. */
-					if( pxCurrentTCB->uxPriority < pxNewTCB->uxPriority )
-					{
-						taskYIELD_IF_USING_PREEMPTION();
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
-				}
-#else /* START of special for EDF */
-				{
-					if( pxCurrentTCB->xStateListItem.xItemValue >= pxNewTCB->xStateListItem.xItemValue )
-					{
-						taskYIELD_IF_USING_PREEMPTION();
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
-				}
-#endif /* END of special for EDF */
+				/* Return true if the task removed from the event list has a higher
+				 * priority than the calling task.  This allows the calling task to know if
+				 * it should force a context switch now. */
+				xReturn = pdTRUE;
+
+				/* Mark that a yield is pending in case the user is not using the
+				 * "xHigherPriorityTaskWoken" parameter to an ISR safe FreeRTOS function. */
+				xYieldPending = pdTRUE;
 			}
 			else
 			{
-				mtCOVERAGE_TEST_MARKER();
+				xReturn = pdFALSE;
 			}
+
+			/* START of special for EDF */
+			taskEDF_UNLOCK_PARTITIONS_OF( pxUnblockedTCB );
+			/* END of special for EDF */
+
+			return xReturn;
 		}
 		/*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskDelete == 1 )
-
-		void vTaskDelete( TaskHandle_t xTaskToDelete )
+		void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
+				const TickType_t xItemValue )
 		{
-			TCB_t * pxTCB;
-
-			taskENTER_CRITICAL();
-			{
-				/* If null is passed in here then it is the calling task that is
-				 * being deleted. */
-				pxTCB = prvGetTCBFromHandle( xTaskToDelete );
-
-				/* Remove task from the ready/delayed list. */
-				if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
-				{
-					taskRESET_READY_PRIORITY( pxTCB->uxPriority );
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
+			TCB_t * pxUnblockedTCB;
 
-				/* Is the task waiting on an event also? */
-				if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
-				{
-					( void ) uxListRemove( &( pxTCB->xEventListItem ) );
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
+			/* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.  It is used by
+			 * the event flags implementation. */
+			configASSERT( uxSchedulerSuspended != pdFALSE );
 
-				/* Increment the uxTaskNumber also so kernel aware debuggers can
-				 * detect that the task lists need re-generating.  This is done before
-				 * portPRE_TASK_DELETE_HOOK() as in the Windows port that macro will
-				 * not return. */
-				uxTaskNumber++;
+			/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+			/* The tick of another partition may be taking a task out of the
+			 * same list, and this task out of its delayed list. */
+			taskENTER_CRITICAL();
+#endif
+			/* END of special for EDF */
 
-				if( pxTCB == pxCurrentTCB )
-				{
-					/* A task is deleting itself.  This cannot complete within the
-					 * task itself, as a context switch to another task is required.
-					 * Place the task in the termination list.  The idle task will
-					 * check the termination list and free up any memory allocated by
-					 * the scheduler for the TCB and stack of the deleted task. */
-					vListInsertEnd( &xTasksWaitingTermination, &( pxTCB->xStateListItem ) );
+			/* Store the new item value in the event list. */
+			listSET_LIST_ITEM_VALUE( pxEventListItem, xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
 
-					/* Increment the ucTasksDeleted variable so the idle task knows
-					 * there is a task that has been deleted and that it should therefore
-					 * check the xTasksWaitingTermination list. */
-					++uxDeletedTasksWaitingCleanUp;
+			/* Remove the event list form the event flag.  Interrupts do not access
+			 * event flags. */
+			pxUnblockedTCB = listGET_LIST_ITEM_OWNER( pxEventListItem ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+			configASSERT( pxUnblockedTCB );
+			/* START of special for EDF */
+			taskEDF_LOCK_PARTITIONS_OF( pxUnblockedTCB );
+			/* END of special for EDF */
+			listREMOVE_ITEM( pxEventListItem );
 
-					/* Call the delete hook before portPRE_TASK_DELETE_HOOK() as
-					 * portPRE_TASK_DELETE_HOOK() does not return in the Win32 port. */
-					traceTASK_DELETE( pxTCB );
+#if ( configUSE_TICKLESS_IDLE != 0 )
+			{
+				/* If a task is blocked on a kernel object then xNextTaskUnblockTime
+				 * might be set to the blocked task's time out time.  If the task is
+				 * unblocked for a reason other than a timeout xNextTaskUnblockTime is
+				 * normally left unchanged, because it is automatically reset to a new
+				 * value when the tick count equals xNextTaskUnblockTime.  However if
+				 * tickless idling is used it might be more important to enter sleep mode
+				 * at the earliest possible time - so reset xNextTaskUnblockTime here to
+				 * ensure it is updated at the earliest possible time. */
+				prvResetNextTaskUnblockTime();
+			}
+#endif
 
-					/* The pre-delete hook is primarily for the Windows simulator,
-					 * in which Windows specific clean up operations are performed,
-					 * after which it is not possible to yield away from this task -
-					 * hence xYieldPending is used to latch that a context switch is
-					 * required. */
-					portPRE_TASK_DELETE_HOOK( pxTCB, &xYieldPending );
-				}
-				else
-				{
-					--uxCurrentNumberOfTasks;
-					traceTASK_DELETE( pxTCB );
+			/* Remove the task from the delayed list and add it to the ready list.  The
+			 * scheduler is suspended so interrupts will not be accessing the ready
+			 * lists. */
+			listREMOVE_ITEM( &( pxUnblockedTCB->xStateListItem ) );
+			prvAddTaskToReadyList( pxUnblockedTCB );
 
-					/* Reset the next expected unblock time in case it referred to
-					 * the task that has just been deleted. */
-					prvResetNextTaskUnblockTime();
-				}
+			/* START of special for EDF */
+			if( taskEDF_WOKEN_TASK_PREEMPTS( pxUnblockedTCB ) )
+			/* END of special for EDF */
+			{
+				/* The unblocked task has a priority above that of the calling task, so
+				 * a context switch is required.  This function is called with the
+				 * scheduler suspended so xYieldPending is set so the context switch
+				 * occurs immediately that the scheduler is resumed (unsuspended). */
+				xYieldPending = pdTRUE;
 			}
+
+			/* START of special for EDF */
+			taskEDF_UNLOCK_PARTITIONS_OF( pxUnblockedTCB );
+#if ( configNUMBER_OF_CORES > 1 )
 			taskEXIT_CRITICAL();
+#endif
+			/* END of special for EDF */
+		}
+		/*-----------------------------------------------------------*/
 
-			/* If the task is not deleting itself, call prvDeleteTCB from outside of
-			 * critical section. If a task deletes itself, prvDeleteTCB is called
-			 * from prvCheckTasksWaitingTermination which is called from Idle task. */
-			if( pxTCB != pxCurrentTCB )
-			{
-				prvDeleteTCB( pxTCB );
-			}
+		void vTaskSetTimeOutState( TimeOut_t * const pxTimeOut )
+		{
+			configASSERT( pxTimeOut );
 
-			/* Force a reschedule if it is the currently running task that has just
-			 * been deleted. */
-			if( xSchedulerRunning != pdFALSE )
+			/* START of special for EDF */
+			taskEDF_TICKLESS_CATCH_UP();
+			/* END of special for EDF */
+
+			taskENTER_CRITICAL();
 			{
-				if( pxTCB == pxCurrentTCB )
-				{
-					configASSERT( uxSchedulerSuspended == 0 );
-					portYIELD_WITHIN_API();
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
+				pxTimeOut->xOverflowCount = xNumOfOverflows;
+				pxTimeOut->xTimeOnEntering = xTickCount;
 			}
+			taskEXIT_CRITICAL();
 		}
-
-#endif /* INCLUDE_vTaskDelete */
 		/*-----------------------------------------------------------*/
 
-#if ( INCLUDE_xTaskDelayUntil == 1 )
+		void vTaskInternalSetTimeOutState( TimeOut_t * const pxTimeOut )
+		{
+			/* For internal use only as it does not use a critical section. */
 
-		BaseType_t xTaskDelayUntil( TickType_t * const pxPreviousWakeTime,
-				const TickType_t xTimeIncrement )
+			/* START of special for EDF */
+			taskEDF_TICKLESS_CATCH_UP();
+			/* END of special for EDF */
+
+			pxTimeOut->xOverflowCount = xNumOfOverflows;
+			pxTimeOut->xTimeOnEntering = xTickCount;
+		}
+		/*-----------------------------------------------------------*/
+
+		BaseType_t xTaskCheckForTimeOut( TimeOut_t * const pxTimeOut,
+				TickType_t * const pxTicksToWait )
 		{
-			TickType_t xTimeToWake;
-			BaseType_t xAlreadyYielded, xShouldDelay = pdFALSE;
+			BaseType_t xReturn;
 
-			configASSERT( pxPreviousWakeTime );
-			configASSERT( ( xTimeIncrement > 0U ) );
-			configASSERT( uxSchedulerSuspended == 0 );
+			configASSERT( pxTimeOut );
+			configASSERT( pxTicksToWait );
 
-			vTaskSuspendAll();
+			/* START of special for EDF */
+			taskEDF_TICKLESS_CATCH_UP();
+			/* END of special for EDF */
+
+			taskENTER_CRITICAL();
 			{
-				/* Minor optimisation.  The tick count cannot change in this
-				 * block. */
+				/* Minor optimisation.  The tick count cannot change in this block. */
 				const TickType_t xConstTickCount = xTickCount;
+				const TickType_t xElapsedTime = xConstTickCount - pxTimeOut->xTimeOnEntering;
 
-				/* Generate the tick time at which the task wants to wake. */
-				xTimeToWake = *pxPreviousWakeTime + xTimeIncrement;
-
-				if( xConstTickCount < *pxPreviousWakeTime )
+#if ( INCLUDE_xTaskAbortDelay == 1 )
+				if( pxCurrentTCB->ucDelayAborted != ( uint8_t ) pdFALSE )
 				{
-					/* The tick count has overflowed since this function was
-					 * lasted called.  In this case the only time we should ever
-					 * actually delay is if the wake time has also  overflowed,
-					 * and the wake time is greater than the tick time.  When this
-					 * is the case it is as if neither time had overflowed. */
-					if( ( xTimeToWake < *pxPreviousWakeTime ) && ( xTimeToWake > xConstTickCount ) )
-					{
-						xShouldDelay = pdTRUE;
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+					/* The delay was aborted, which is not the same as a time out,
+					 * but has the same result. */
+					pxCurrentTCB->ucDelayAborted = pdFALSE;
+					xReturn = pdTRUE;
 				}
 				else
-				{
-					/* The tick time has not overflowed.  In this case we will
-					 * delay if either the wake time has overflowed, and/or the
-					 * tick time is less than the wake time. */
-					if( ( xTimeToWake < *pxPreviousWakeTime ) || ( xTimeToWake > xConstTickCount ) )
+#endif
+
+#if ( INCLUDE_vTaskSuspend == 1 )
+					if( *pxTicksToWait == portMAX_DELAY )
 					{
-						xShouldDelay = pdTRUE;
+						/* If INCLUDE_vTaskSuspend is set to 1 and the block time
+						 * specified is the maximum block time then the task should block
+						 * indefinitely, and therefore never time out. */
+						xReturn = pdFALSE;
 					}
 					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
-				}
-
-				/* Update the wake time ready for the next call. */
-				*pxPreviousWakeTime = xTimeToWake;
-
-				if( xShouldDelay != pdFALSE )
-				{
-					traceTASK_DELAY_UNTIL( xTimeToWake );
-
-					/* prvAddCurrentTaskToDelayedList() needs the block time, not
-					 * the time to wake, so subtract the current tick count. */
-					prvAddCurrentTaskToDelayedList( xTimeToWake - xConstTickCount, pdFALSE );
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
-			}
-			xAlreadyYielded = xTaskResumeAll();
+#endif
 
-			/* Force a reschedule if xTaskResumeAll has not already done so, we may
-			 * have put ourselves to sleep. */
-			if( xAlreadyYielded == pdFALSE )
-			{
-				portYIELD_WITHIN_API();
-			}
-			else
-			{
-				mtCOVERAGE_TEST_MARKER();
+						if( ( xNumOfOverflows != pxTimeOut->xOverflowCount ) && ( xConstTickCount >= pxTimeOut->xTimeOnEntering ) ) /*lint !e525 Indentation preferred as is to make code within pre-processor directives clearer. */
+						{
+							/* The tick count is greater than the time at which
+							 * vTaskSetTimeout() was called, but has also overflowed since
+							 * vTaskSetTimeOut() was called.  It must have wrapped all the way
+							 * around and gone past again. This passed since vTaskSetTimeout()
+							 * was called. */
+							xReturn = pdTRUE;
+							*pxTicksToWait = ( TickType_t ) 0;
+						}
+						else if( xElapsedTime < *pxTicksToWait ) /*lint !e961 Explicit casting is only redundant with some compilers, whereas others require it to prevent integer conversion errors. */
+						{
+							/* Not a genuine timeout. Adjust parameters for time remaining. */
+							*pxTicksToWait -= xElapsedTime;
+							vTaskInternalSetTimeOutState( pxTimeOut );
+							xReturn = pdFALSE;
+						}
+						else
+						{
+							*pxTicksToWait = ( TickType_t ) 0;
+							xReturn = pdTRUE;
+						}
 			}
+			taskEXIT_CRITICAL();
 
-			return xShouldDelay;
+			return xReturn;
 		}
+		/*-----------------------------------------------------------*/
 
-#endif /* INCLUDE_xTaskDelayUntil */
+		void vTaskMissedYield( void )
+		{
+			xYieldPending = pdTRUE;
+		}
 		/*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskDelay == 1 )
+#if ( configUSE_TRACE_FACILITY == 1 )
 
-		void vTaskDelay( const TickType_t xTicksToDelay )
+		UBaseType_t uxTaskGetTaskNumber( TaskHandle_t xTask )
 		{
-			BaseType_t xAlreadyYielded = pdFALSE;
+			UBaseType_t uxReturn;
+			TCB_t const * pxTCB;
 
-			/* A delay time of zero just forces a reschedule. */
-			if( xTicksToDelay > ( TickType_t ) 0U )
+			if( xTask != NULL )
 			{
-				configASSERT( uxSchedulerSuspended == 0 );
-				vTaskSuspendAll();
-				{
-					traceTASK_DELAY();
-
-					/* A task that is removed from the event list while the
-					 * scheduler is suspended will not get placed in the ready
-					 * list or removed from the blocked list until the scheduler
-					 * is resumed.
-					 *
-					 * This task cannot be in an event list as it is the currently
-					 * executing task. */
-					prvAddCurrentTaskToDelayedList( xTicksToDelay, pdFALSE );
-				}
-				xAlreadyYielded = xTaskResumeAll();
+				pxTCB = xTask;
+				uxReturn = pxTCB->uxTaskNumber;
 			}
 			else
 			{
-				mtCOVERAGE_TEST_MARKER();
+				uxReturn = 0U;
 			}
 
-			/* Force a reschedule if xTaskResumeAll has not already done so, we may
-			 * have put ourselves to sleep. */
-			if( xAlreadyYielded == pdFALSE )
-			{
-				portYIELD_WITHIN_API();
-			}
-			else
-			{
-				mtCOVERAGE_TEST_MARKER();
-			}
+			return uxReturn;
 		}
 
-#endif /* INCLUDE_vTaskDelay */
+#endif /* configUSE_TRACE_FACILITY */
 		/*-----------------------------------------------------------*/
 
-#if ( ( INCLUDE_eTaskGetState == 1 ) || ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_xTaskAbortDelay == 1 ) )
+#if ( configUSE_TRACE_FACILITY == 1 )
 
-		eTaskState eTaskGetState( TaskHandle_t xTask )
+		void vTaskSetTaskNumber( TaskHandle_t xTask,
+				const UBaseType_t uxHandle )
 		{
-			eTaskState eReturn;
-			List_t const * pxStateList, * pxDelayedList, * pxOverflowedDelayedList;
-			const TCB_t * const pxTCB = xTask;
-
-			configASSERT( pxTCB );
+			TCB_t * pxTCB;
 
-			if( pxTCB == pxCurrentTCB )
+			if( xTask != NULL )
 			{
-				/* The task calling this function is querying its own state. */
-				eReturn = eRunning;
+				pxTCB = xTask;
+				pxTCB->uxTaskNumber = uxHandle;
 			}
-			else
+		}
+
+#endif /* configUSE_TRACE_FACILITY */
+
+		/*
+		 * -----------------------------------------------------------
+		 * The Idle task.
+		 * ----------------------------------------------------------
+		 *
+		 * The portTASK_FUNCTION() macro is used to allow port/compiler specific
+		 * language extensions.  The equivalent prototype for this function is:
+		 *
+		 * void prvIdleTask( void *pvParameters );
+		 *
+		 */
+		static portTASK_FUNCTION( prvIdleTask, pvParameters )
+		{
+			/* Stop warnings. */
+			( void ) pvParameters;
+
+			/** THIS IS THE RTOS IDLE TASK - WHICH IS CREATED AUTOMATICALLY WHEN THE
+			 * SCHEDULER IS STARTED. **/
+
+			/* In case a task that has a secure context deletes itself, in which case
+			 * the idle task is responsible for deleting the task's secure context, if
+			 * any. */
+			portALLOCATE_SECURE_CONTEXT( configMINIMAL_SECURE_STACK_SIZE );
+
+			for( ; ; )
 			{
-				taskENTER_CRITICAL();
+				/* See if any tasks have deleted themselves - if so then the idle task
+				 * is responsible for freeing the deleted task's TCB and stack. */
+				prvCheckTasksWaitingTermination();
+
+#if ( configUSE_PREEMPTION == 0 )
 				{
-					pxStateList = listLIST_ITEM_CONTAINER( &( pxTCB->xStateListItem ) );
-					pxDelayedList = pxDelayedTaskList;
-					pxOverflowedDelayedList = pxOverflowDelayedTaskList;
+					/* If we are not using preemption we keep forcing a task switch to
+					 * see if any other task has become available.  If we are using
+					 * preemption we don't need to do this as any task becoming available
+					 * will automatically get the processor anyway. */
+					taskYIELD();
 				}
-				taskEXIT_CRITICAL();
+#endif /* configUSE_PREEMPTION */
 
-				if( ( pxStateList == pxDelayedList ) || ( pxStateList == pxOverflowedDelayedList ) )
+#if ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) )
 				{
-					/* The task being queried is referenced from one of the Blocked
-					 * lists. */
-					eReturn = eBlocked;
+					/* When using preemption tasks of equal priority will be
+					 * timesliced.  If a task that is sharing the idle priority is ready
+					 * to run then the idle task should yield before the end of the
+					 * timeslice.
+					 *
+					 * A critical region is not required here as we are just reading from
+					 * the list, and an occasional incorrect value will not matter.  If
+					 * the ready list at the idle priority contains more than one task
+					 * then a task other than the idle task is ready to execute. */
+					if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > ( UBaseType_t ) 1 )
+					{
+						taskYIELD();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
 				}
+#endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) ) */
 
-#if ( INCLUDE_vTaskSuspend == 1 )
-				else if( pxStateList == &xSuspendedTaskList )
+#if ( configUSE_IDLE_HOOK == 1 )
 				{
-					/* The task being queried is referenced from the suspended
-					 * list.  Is it genuinely suspended or is it blocked
-					 * indefinitely? */
-					if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL )
+					extern void vApplicationIdleHook( void );
+
+					/* Call the user defined function from within the idle task.  This
+					 * allows the application designer to add background functionality
+					 * without the overhead of a separate task.
+					 * NOTE: vApplicationIdleHook() MUST NOT, UNDER ANY CIRCUMSTANCES,
+					 * CALL A FUNCTION THAT MIGHT BLOCK. */
+					vApplicationIdleHook();
+				}
+#endif /* configUSE_IDLE_HOOK */
+
+				/* This conditional compilation should use inequality to 0, not equality
+				 * to 1.  This is to ensure portSUPPRESS_TICKS_AND_SLEEP() is called when
+				 * user defined low power mode  implementations require
+				 * configUSE_TICKLESS_IDLE to be set to a value other than 1. */
+#if ( configUSE_TICKLESS_IDLE != 0 )
+				{
+					TickType_t xExpectedIdleTime;
+
+					/* It is not desirable to suspend then resume the scheduler on
+					 * each iteration of the idle task.  Therefore, a preliminary
+					 * test of the expected idle time is performed without the
+					 * scheduler suspended.  The result here is not necessarily
+					 * valid. */
+					xExpectedIdleTime = prvGetExpectedIdleTime();
+
+					if( xExpectedIdleTime >= configEXPECTED_IDLE_TIME_BEFORE_SLEEP )
 					{
-#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+						vTaskSuspendAll();
 						{
-							BaseType_t x;
+							/* Now the scheduler is suspended, the expected idle
+							 * time can be sampled again, and this time its value can
+							 * be used. */
+							configASSERT( xNextTaskUnblockTime >= xTickCount );
+							xExpectedIdleTime = prvGetExpectedIdleTime();
 
-							/* The task does not appear on the event list item of
-							 * and of the RTOS objects, but could still be in the
-							 * blocked state if it is waiting on its notification
-							 * rather than waiting on an object.  If not, is
-							 * suspended. */
-							eReturn = eSuspended;
+							/* Define the following macro to set xExpectedIdleTime to 0
+							 * if the application does not want
+							 * portSUPPRESS_TICKS_AND_SLEEP() to be called. */
+							configPRE_SUPPRESS_TICKS_AND_SLEEP_PROCESSING( xExpectedIdleTime );
 
-							for( x = 0; x < configTASK_NOTIFICATION_ARRAY_ENTRIES; x++ )
+							if( xExpectedIdleTime >= configEXPECTED_IDLE_TIME_BEFORE_SLEEP )
 							{
-								if( pxTCB->ucNotifyState[ x ] == taskWAITING_NOTIFICATION )
-								{
-									eReturn = eBlocked;
-									break;
-								}
+								traceLOW_POWER_IDLE_BEGIN();
+								portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime );
+								traceLOW_POWER_IDLE_END();
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
 							}
 						}
-#else /* if ( configUSE_TASK_NOTIFICATIONS == 1 ) */
-						{
-							eReturn = eSuspended;
-						}
-#endif /* if ( configUSE_TASK_NOTIFICATIONS == 1 ) */
+						( void ) xTaskResumeAll();
 					}
 					else
 					{
-						eReturn = eBlocked;
+						mtCOVERAGE_TEST_MARKER();
 					}
 				}
-#endif /* if ( INCLUDE_vTaskSuspend == 1 ) */
+#endif /* configUSE_TICKLESS_IDLE */
 
-#if ( INCLUDE_vTaskDelete == 1 )
-				else if( ( pxStateList == &xTasksWaitingTermination ) || ( pxStateList == NULL ) )
+				/* START of special for EDF */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configNUMBER_OF_CORES == 1 ) )
+				{
+					prvGetTCBFromHandle( xIdleTaskHandle )->xTaskAbsoluteDeadline = taskEDF_DEADLINE_AFTER( xIDLEPeriod );
+					listSET_LIST_ITEM_VALUE( &( ( prvGetTCBFromHandle(xIdleTaskHandle) )->xStateListItem ), taskEDF_KEY( prvGetTCBFromHandle( xIdleTaskHandle ) ) );
+				}
+#elif ( configUSE_EDF_SCHEDULER == 1 )
+				{
+					/* Each core has its own idle task, this is the one running here.
+					 * The other cores pick their tasks from the list while it runs,
+					 * so it is queued again under its new deadline rather than
+					 * left out of order. */
+					const UBaseType_t uxSavedInterruptStatus = portSET_INTERRUPT_MASK();
+					TCB_t * const pxIdleTCB = pxCurrentTCB;
+
+					taskEDF_LOCK_PARTITIONS_OF( pxIdleTCB );
+					{
+						pxIdleTCB->xTaskAbsoluteDeadline = taskEDF_DEADLINE_AFTER( xIDLEPeriod );
+						( void ) uxListRemove( &( pxIdleTCB->xStateListItem ) );
+						listSET_LIST_ITEM_VALUE( &( pxIdleTCB->xStateListItem ), taskEDF_KEY( pxIdleTCB ) );
+						vListInsert( taskEDF_READY_LIST( pxIdleTCB ), &( pxIdleTCB->xStateListItem ) );
+					}
+					taskEDF_UNLOCK_PARTITIONS_OF( pxIdleTCB );
+					portCLEAR_INTERRUPT_MASK( uxSavedInterruptStatus );
+				}
+#endif
+				/* END of special for EDF */
+			}
+		}
+		/*-----------------------------------------------------------*/
+
+#if ( configUSE_TICKLESS_IDLE != 0 )
+
+		eSleepModeStatus eTaskConfirmSleepModeStatus( void )
+		{
+			/* The idle task exists in addition to the application tasks. */
+			const UBaseType_t uxNonApplicationTasks = 1;
+			eSleepModeStatus eReturn = eStandardSleep;
+
+			/* This function must be called from a critical section. */
+
+			if( listCURRENT_LIST_LENGTH( &xPendingReadyList ) != 0 )
+			{
+				/* A task was made ready while the scheduler was suspended. */
+				eReturn = eAbortSleep;
+			}
+			else if( xYieldPending != pdFALSE )
+			{
+				/* A yield was pended while the scheduler was suspended. */
+				eReturn = eAbortSleep;
+			}
+			else if( xPendedTicks != 0 )
+			{
+				/* A tick interrupt has already occurred but was held pending
+				 * because the scheduler is suspended. */
+				eReturn = eAbortSleep;
+			}
+			else
+			{
+				/* If all the tasks are in the suspended list (which might mean they
+				 * have an infinite block time rather than actually being suspended)
+				 * then it is safe to turn all clocks off and just wait for external
+				 * interrupts. */
+				if( listCURRENT_LIST_LENGTH( &xSuspendedTaskList ) == ( uxCurrentNumberOfTasks - uxNonApplicationTasks ) )
 				{
-					/* The task being queried is referenced from the deleted
-					 * tasks list, or it is not referenced from any lists at
-					 * all. */
-					eReturn = eDeleted;
+					eReturn = eNoTasksWaitingTimeout;
 				}
-#endif
-
-				else /*lint !e525 Negative indentation is intended to make use of pre-processor clearer. */
+				else
 				{
-					/* If the task is not in any other state, it must be in the
-					 * Ready (including pending ready) state. */
-					eReturn = eReady;
+					mtCOVERAGE_TEST_MARKER();
 				}
 			}
 
 			return eReturn;
-		} /*lint !e818 xTask cannot be a pointer to const because it is a typedef. */
+		}
 
-#endif /* INCLUDE_eTaskGetState */
+#endif /* configUSE_TICKLESS_IDLE */
 		/*-----------------------------------------------------------*/
 
-#if ( INCLUDE_uxTaskPriorityGet == 1 )
+#if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0 )
 
-		UBaseType_t uxTaskPriorityGet( const TaskHandle_t xTask )
+		void vTaskSetThreadLocalStoragePointer( TaskHandle_t xTaskToSet,
+				BaseType_t xIndex,
+				void * pvValue )
 		{
-			TCB_t const * pxTCB;
-			UBaseType_t uxReturn;
+			TCB_t * pxTCB;
 
-			taskENTER_CRITICAL();
+			if( xIndex < configNUM_THREAD_LOCAL_STORAGE_POINTERS )
 			{
-				/* If null is passed in here then it is the priority of the task
-				 * that called uxTaskPriorityGet() that is being queried. */
-				pxTCB = prvGetTCBFromHandle( xTask );
-				uxReturn = pxTCB->uxPriority;
+				pxTCB = prvGetTCBFromHandle( xTaskToSet );
+				configASSERT( pxTCB != NULL );
+				pxTCB->pvThreadLocalStoragePointers[ xIndex ] = pvValue;
 			}
-			taskEXIT_CRITICAL();
-
-			return uxReturn;
 		}
 
-#endif /* INCLUDE_uxTaskPriorityGet */
+#endif /* configNUM_THREAD_LOCAL_STORAGE_POINTERS */
 		/*-----------------------------------------------------------*/
 
-#if ( INCLUDE_uxTaskPriorityGet == 1 )
+#if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0 )
 
-		UBaseType_t uxTaskPriorityGetFromISR( const TaskHandle_t xTask )
+		void * pvTaskGetThreadLocalStoragePointer( TaskHandle_t xTaskToQuery,
+				BaseType_t xIndex )
 		{
-			TCB_t const * pxTCB;
-			UBaseType_t uxReturn, uxSavedInterruptState;
-
-			/* RTOS ports that support interrupt nesting have the concept of a
-			 * maximum  system call (or maximum API call) interrupt priority.
-			 * Interrupts that are  above the maximum system call priority are keep
-			 * permanently enabled, even when the RTOS kernel is in a critical section,
-			 * but cannot make any calls to FreeRTOS API functions.  If configASSERT()
-			 * is defined in FreeRTOSConfig.h then
-			 * portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
-			 * failure if a FreeRTOS API function is called from an interrupt that has
-			 * been assigned a priority above the configured maximum system call
-			 * priority.  Only FreeRTOS functions that end in FromISR can be called
-			 * from interrupts  that have been assigned a priority at or (logically)
-			 * below the maximum system call interrupt priority.  FreeRTOS maintains a
-			 * separate interrupt safe API to ensure interrupt entry is as fast and as
-			 * simple as possible.  More information (albeit Cortex-M specific) is
-			 * provided on the following link:
-			 * https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
-			portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+			void * pvReturn = NULL;
+			TCB_t * pxTCB;
 
-			uxSavedInterruptState = portSET_INTERRUPT_MASK_FROM_ISR();
+			if( xIndex < configNUM_THREAD_LOCAL_STORAGE_POINTERS )
 			{
-				/* If null is passed in here then it is the priority of the calling
-				 * task that is being queried. */
-				pxTCB = prvGetTCBFromHandle( xTask );
-				uxReturn = pxTCB->uxPriority;
+				pxTCB = prvGetTCBFromHandle( xTaskToQuery );
+				pvReturn = pxTCB->pvThreadLocalStoragePointers[ xIndex ];
+			}
+			else
+			{
+				pvReturn = NULL;
 			}
-			portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptState );
 
-			return uxReturn;
+			return pvReturn;
 		}
 
-#endif /* INCLUDE_uxTaskPriorityGet */
+#endif /* configNUM_THREAD_LOCAL_STORAGE_POINTERS */
 		/*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskPrioritySet == 1 )
+#if ( portUSING_MPU_WRAPPERS == 1 )
 
-		void vTaskPrioritySet( TaskHandle_t xTask,
-				UBaseType_t uxNewPriority )
+		void vTaskAllocateMPURegions( TaskHandle_t xTaskToModify,
+				const MemoryRegion_t * const xRegions )
 		{
 			TCB_t * pxTCB;
-			UBaseType_t uxCurrentBasePriority, uxPriorityUsedOnEntry;
-			BaseType_t xYieldRequired = pdFALSE;
 
-			configASSERT( uxNewPriority < configMAX_PRIORITIES );
+			/* If null is passed in here then we are modifying the MPU settings of
+			 * the calling task. */
+			pxTCB = prvGetTCBFromHandle( xTaskToModify );
 
-			/* Ensure the new priority is valid. */
-			if( uxNewPriority >= ( UBaseType_t ) configMAX_PRIORITIES )
-			{
-				uxNewPriority = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) 1U;
-			}
-			else
+			vPortStoreTaskMPUSettings( &( pxTCB->xMPUSettings ), xRegions, NULL, 0 );
+		}
+
+#endif /* portUSING_MPU_WRAPPERS */
+		/*-----------------------------------------------------------*/
+
+		static void prvInitialiseTaskLists( void )
+		{
+			UBaseType_t uxPriority;
+
+			for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) configMAX_PRIORITIES; uxPriority++ )
 			{
-				mtCOVERAGE_TEST_MARKER();
+				vListInitialise( &( pxReadyTasksLists[ uxPriority ] ) );
 			}
 
-			taskENTER_CRITICAL();
+			/* START of special for EDF */
+#if ( configUSE_EDF_TIMING_WHEEL == 1 )
 			{
-				/* If null is passed in here then it is the priority of the calling
-				 * task that is being changed. */
-				pxTCB = prvGetTCBFromHandle( xTask );
+				UBaseType_t uxList;
 
-				traceTASK_PRIORITY_SET( pxTCB, uxNewPriority );
+				for( uxList = ( UBaseType_t ) 0U; uxList < taskWHEEL_LISTS; uxList++ )
+				{
+					vListInitialise( &( xWheelLists[ uxList ] ) );
+				}
+			}
+#elif ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_EDF_PARTITIONED == 1 ) )
+			{
+				BaseType_t xPartition;
 
-#if ( configUSE_MUTEXES == 1 )
+				/* The tick of each partition starts with the lists, the tasks
+				 * created before the scheduler starts are due from it. */
+				for( xPartition = 0; xPartition < taskEDF_PARTITIONS; xPartition++ )
 				{
-					uxCurrentBasePriority = pxTCB->uxBasePriority;
+					vListInitialise( &( xDelayedTaskLists1[ xPartition ] ) );
+					vListInitialise( &( xDelayedTaskLists2[ xPartition ] ) );
+					pxDelayedTaskLists[ xPartition ] = &( xDelayedTaskLists1[ xPartition ] );
+					pxOverflowDelayedTaskLists[ xPartition ] = &( xDelayedTaskLists2[ xPartition ] );
+					xTickCounts[ xPartition ] = ( TickType_t ) configINITIAL_TICK_COUNT;
 				}
+			}
 #else
+			/* END of special for EDF */
+			vListInitialise( &xDelayedTaskList1 );
+			vListInitialise( &xDelayedTaskList2 );
+#endif
+			/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+			{
+				BaseType_t xCoreID;
+
+				for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
 				{
-					uxCurrentBasePriority = pxTCB->uxPriority;
+					vListInitialise( &( xPendingReadyLists[ xCoreID ] ) );
 				}
+			}
+#else
+			/* END of special for EDF */
+			vListInitialise( &xPendingReadyList );
+			/* START of special for EDF */
 #endif
+#if ( configUSE_EDF_HIGH_RES_TIME == 1 )
+			vListInitialise( &xEDFTimerList );
+#endif
+			/* END of special for EDF */
 
-				if( uxCurrentBasePriority != uxNewPriority )
+#if ( INCLUDE_vTaskDelete == 1 )
+			{
+				vListInitialise( &xTasksWaitingTermination );
+			}
+#endif /* INCLUDE_vTaskDelete */
+
+#if ( INCLUDE_vTaskSuspend == 1 )
+			{
+				vListInitialise( &xSuspendedTaskList );
+			}
+#endif /* INCLUDE_vTaskSuspend */
+
+			/* START of special for EDF */
+			/* E.C. */
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_EDF_PARTITIONED == 1 ) )
+			{
+				BaseType_t xCoreID;
+
+				for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
 				{
-					/* The priority change may have readied a task of higher
-					 * priority than the calling task. */
-					if( uxNewPriority > uxCurrentBasePriority )
-					{
-						if( pxTCB != pxCurrentTCB )
-						{
-							/* The priority of a task other than the currently
-							 * running task is being raised.  Is the priority being
-							 * raised above that of the running task? */
-							if( uxNewPriority >= pxCurrentTCB->uxPriority )
-							{
-								xYieldRequired = pdTRUE;
-							}
-							else
-							{
-								mtCOVERAGE_TEST_MARKER();
-							}
-						}
-						else
-						{
-							/* The priority of the running task is being raised,
-							 * but the running task must already be the highest
-							 * priority task able to run so no yield is required. */
-						}
-					}
-					else if( pxTCB == pxCurrentTCB )
-					{
-						/* Setting the priority of the running task down means
-						 * there may now be another task of higher priority that
-						 * is ready to execute. */
-						xYieldRequired = pdTRUE;
-					}
-					else
-					{
-						/* Setting the priority of any other task down does not
-						 * require a yield as the running task must be above the
-						 * new priority of the task being modified. */
-					}
+					vListInitialise( &( xReadyTasksListsEDF[ xCoreID ] ) );
+				}
+			}
+#elif ( configUSE_EDF_SCHEDULER == 1 )
+			{
+				vListInitialise( &xReadyTasksListEDF );
+			}
+#endif
+			/* END of special for EDF */
 
-					/* Remember the ready list the task might be referenced from
-					 * before its uxPriority member is changed so the
-					 * taskRESET_READY_PRIORITY() macro can function correctly. */
-					uxPriorityUsedOnEntry = pxTCB->uxPriority;
+			/* Start with pxDelayedTaskList using list1 and the pxOverflowDelayedTaskList
+			 * using list2. */
+			/* START of special for EDF */
+#if ( ( configUSE_EDF_TIMING_WHEEL == 0 ) && ( ( configNUMBER_OF_CORES == 1 ) || ( configUSE_EDF_PARTITIONED == 0 ) ) )
+			/* END of special for EDF */
+			pxDelayedTaskList = &xDelayedTaskList1;
+			pxOverflowDelayedTaskList = &xDelayedTaskList2;
+#endif
+		}
+		/*-----------------------------------------------------------*/
 
-#if ( configUSE_MUTEXES == 1 )
-					{
-						/* Only change the priority being used if the task is not
-						 * currently using an inherited priority. */
-						if( pxTCB->uxBasePriority == pxTCB->uxPriority )
-						{
-							pxTCB->uxPriority = uxNewPriority;
-						}
-						else
-						{
-							mtCOVERAGE_TEST_MARKER();
-						}
+		static void prvCheckTasksWaitingTermination( void )
+		{
+			/** THIS FUNCTION IS CALLED FROM THE RTOS IDLE TASK **/
 
-						/* The base priority gets set whatever. */
-						pxTCB->uxBasePriority = uxNewPriority;
-					}
-#else /* if ( configUSE_MUTEXES == 1 ) */
-					{
-						pxTCB->uxPriority = uxNewPriority;
-					}
-#endif /* if ( configUSE_MUTEXES == 1 ) */
+#if ( INCLUDE_vTaskDelete == 1 )
+			{
+				TCB_t * pxTCB;
+				/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+				BaseType_t xStillRunning = pdFALSE;
+#endif
+				/* END of special for EDF */
 
-					/* Only reset the event list item value if the value is not
-					 * being used for anything else. */
-					if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
-					{
-						listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxNewPriority ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-					}
-					else
+				/* uxDeletedTasksWaitingCleanUp is used to prevent taskENTER_CRITICAL()
+				 * being called too often in the idle task. */
+				while( uxDeletedTasksWaitingCleanUp > ( UBaseType_t ) 0U )
+				{
+					taskENTER_CRITICAL();
 					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+						pxTCB = listGET_OWNER_OF_HEAD_ENTRY( ( &xTasksWaitingTermination ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
 
-					/* If the task is in the blocked or suspended list we need do
-					 * nothing more than change its priority variable. However, if
-					 * the task is in a ready list it needs to be removed and placed
-					 * in the list appropriate to its new priority. */
-					if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
-					{
-						/* The task is currently in its ready list - remove before
-						 * adding it to its new ready list.  As we are in a critical
-						 * section we can do this even if the scheduler is suspended. */
-						if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
-						{
-							/* It is known that the task is in its ready list so
-							 * there is no need to check again and the port level
-							 * reset macro can be called directly. */
-							portRESET_READY_PRIORITY( uxPriorityUsedOnEntry, uxTopReadyPriority );
-						}
-						else
+						/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+						/* A task that deleted itself is only freed once its
+						 * core has switched it out. */
+						taskEDF_LOCK_PARTITIONS_OF( pxTCB );
+						xStillRunning = ( pxTCB->xTaskRunState != taskTASK_NOT_RUNNING ) ? pdTRUE : pdFALSE;
+						taskEDF_UNLOCK_PARTITIONS_OF( pxTCB );
+
+						if( xStillRunning == pdFALSE )
+#endif
+						/* END of special for EDF */
 						{
-							mtCOVERAGE_TEST_MARKER();
+							( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+							--uxCurrentNumberOfTasks;
+							--uxDeletedTasksWaitingCleanUp;
 						}
-
-						prvAddTaskToReadyList( pxTCB );
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
 					}
+					taskEXIT_CRITICAL();
 
-					if( xYieldRequired != pdFALSE )
-					{
-						taskYIELD_IF_USING_PREEMPTION();
-					}
-					else
+					/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+					if( xStillRunning != pdFALSE )
 					{
-						mtCOVERAGE_TEST_MARKER();
+						/* Tried again from the next idle loop. */
+						break;
 					}
+#endif
+					/* END of special for EDF */
 
-					/* Remove compiler warning about unused variables when the port
-					 * optimised task selection is not being used. */
-					( void ) uxPriorityUsedOnEntry;
+					prvDeleteTCB( pxTCB );
 				}
 			}
-			taskEXIT_CRITICAL();
+#endif /* INCLUDE_vTaskDelete */
 		}
-
-#endif /* INCLUDE_vTaskPrioritySet */
 		/*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskSuspend == 1 )
+#if ( configUSE_TRACE_FACILITY == 1 )
 
-		void vTaskSuspend( TaskHandle_t xTaskToSuspend )
+		void vTaskGetInfo( TaskHandle_t xTask,
+				TaskStatus_t * pxTaskStatus,
+				BaseType_t xGetFreeStackSpace,
+				eTaskState eState )
 		{
 			TCB_t * pxTCB;
 
-			taskENTER_CRITICAL();
+			/* xTask is NULL then get the state of the calling task. */
+			pxTCB = prvGetTCBFromHandle( xTask );
+
+			pxTaskStatus->xHandle = ( TaskHandle_t ) pxTCB;
+			pxTaskStatus->pcTaskName = ( const char * ) &( pxTCB->pcTaskName[ 0 ] );
+			pxTaskStatus->uxCurrentPriority = pxTCB->uxPriority;
+			pxTaskStatus->pxStackBase = pxTCB->pxStack;
+			pxTaskStatus->xTaskNumber = pxTCB->uxTCBNumber;
+
+			/* START of special for EDF */
+#if ( configUSE_EDF_SCHEDULER == 1 )
 			{
-				/* If null is passed in here then it is the running task that is
-				 * being suspended. */
-				pxTCB = prvGetTCBFromHandle( xTaskToSuspend );
+				pxTaskStatus->xPeriod = pxTCB->xTaskPeriod;
+				pxTaskStatus->xAbsoluteDeadline = pxTCB->xTaskAbsoluteDeadline;
+				pxTaskStatus->ulJobCount = pxTCB->ulTaskJobs;
+				pxTaskStatus->ulDeadlineMisses = pxTCB->ulTaskDeadlineMisses;
+			}
+#endif
+			/* END of special for EDF */
 
-				traceTASK_SUSPEND( pxTCB );
+#if ( configUSE_MUTEXES == 1 )
+			{
+				pxTaskStatus->uxBasePriority = pxTCB->uxBasePriority;
+			}
+#else
+			{
+				pxTaskStatus->uxBasePriority = 0;
+			}
+#endif
 
-				/* Remove task from the ready/delayed list and place in the
-				 * suspended list. */
-				if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+			{
+				pxTaskStatus->ulRunTimeCounter = pxTCB->ulRunTimeCounter;
+			}
+#else
+			{
+				pxTaskStatus->ulRunTimeCounter = ( configRUN_TIME_COUNTER_TYPE ) 0;
+			}
+#endif
+
+			/* Obtaining the task state is a little fiddly, so is only done if the
+			 * value of eState passed into this function is eInvalid - otherwise the
+			 * state is just set to whatever is passed in. */
+			if( eState != eInvalid )
+			{
+				if( pxTCB == pxCurrentTCB )
 				{
-					taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+					pxTaskStatus->eCurrentState = eRunning;
 				}
 				else
 				{
-					mtCOVERAGE_TEST_MARKER();
+					pxTaskStatus->eCurrentState = eState;
+
+#if ( INCLUDE_vTaskSuspend == 1 )
+{
+	/* If the task is in the suspended list then there is a
+	 *  chance it is actually just blocked indefinitely - so really
+	 *  it should be reported as being in the Blocked state. */
+						if( eState == eSuspended )
+						{
+							/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+							/* The event lists are guarded by the critical
+							 * sections, also called from uxTaskGetSystemState()
+							 * with the partitions locked. */
+							taskENTER_CRITICAL();
+#else
+							vTaskSuspendAll();
+#endif
+							/* END of special for EDF */
+							{
+								if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+								{
+									pxTaskStatus->eCurrentState = eBlocked;
+								}
+							}
+							/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+							taskEXIT_CRITICAL();
+#else
+							( void ) xTaskResumeAll();
+#endif
+							/* END of special for EDF */
+						}
+}
+#endif /* INCLUDE_vTaskSuspend */
 				}
+			}
+			else
+			{
+				pxTaskStatus->eCurrentState = eTaskGetState( pxTCB );
+			}
 
-				/* Is the task waiting on an event also? */
-				if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+			/* Obtaining the stack space takes some time, so the xGetFreeStackSpace
+			 * parameter is provided to allow it to be skipped. */
+			if( xGetFreeStackSpace != pdFALSE )
+			{
+#if ( portSTACK_GROWTH > 0 )
 				{
-					( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+					pxTaskStatus->usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxEndOfStack );
 				}
-				else
+#else
 				{
-					mtCOVERAGE_TEST_MARKER();
+					pxTaskStatus->usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxStack );
 				}
+#endif
+			}
+			else
+			{
+				pxTaskStatus->usStackHighWaterMark = 0;
+			}
+		}
 
-				vListInsertEnd( &xSuspendedTaskList, &( pxTCB->xStateListItem ) );
+#endif /* configUSE_TRACE_FACILITY */
+		/*-----------------------------------------------------------*/
 
-#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+		static UBaseType_t prvListTasksWithinSingleList( TaskStatus_t * pxTaskStatusArray,
+				List_t * pxList,
+				eTaskState eState )
+		{
+			configLIST_VOLATILE TCB_t * pxNextTCB, * pxFirstTCB;
+			UBaseType_t uxTask = 0;
+
+			if( listCURRENT_LIST_LENGTH( pxList ) > ( UBaseType_t ) 0 )
+			{
+				listGET_OWNER_OF_NEXT_ENTRY( pxFirstTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+				/* Populate an TaskStatus_t structure within the
+				 * pxTaskStatusArray array for each task that is referenced from
+				 * pxList.  See the definition of TaskStatus_t in task.h for the
+				 * meaning of each TaskStatus_t structure member. */
+				do
 				{
-					BaseType_t x;
+					listGET_OWNER_OF_NEXT_ENTRY( pxNextTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+					vTaskGetInfo( ( TaskHandle_t ) pxNextTCB, &( pxTaskStatusArray[ uxTask ] ), pdTRUE, eState );
+					uxTask++;
+				} while( pxNextTCB != pxFirstTCB );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			return uxTask;
+		}
+
+#endif /* configUSE_TRACE_FACILITY */
+		/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) )
+
+		static configSTACK_DEPTH_TYPE prvTaskCheckFreeStackSpace( const uint8_t * pucStackByte )
+		{
+			uint32_t ulCount = 0U;
+
+			while( *pucStackByte == ( uint8_t ) tskSTACK_FILL_BYTE )
+			{
+				pucStackByte -= portSTACK_GROWTH;
+				ulCount++;
+			}
+
+			ulCount /= ( uint32_t ) sizeof( StackType_t ); /*lint !e961 Casting is not redundant on smaller architectures. */
+
+			return ( configSTACK_DEPTH_TYPE ) ulCount;
+		}
+
+#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) ) */
+		/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 )
+
+		/* uxTaskGetStackHighWaterMark() and uxTaskGetStackHighWaterMark2() are the
+		 * same except for their return type.  Using configSTACK_DEPTH_TYPE allows the
+		 * user to determine the return type.  It gets around the problem of the value
+		 * overflowing on 8-bit types without breaking backward compatibility for
+		 * applications that expect an 8-bit return type. */
+		configSTACK_DEPTH_TYPE uxTaskGetStackHighWaterMark2( TaskHandle_t xTask )
+		{
+			TCB_t * pxTCB;
+			uint8_t * pucEndOfStack;
+			configSTACK_DEPTH_TYPE uxReturn;
+
+			/* uxTaskGetStackHighWaterMark() and uxTaskGetStackHighWaterMark2() are
+			 * the same except for their return type.  Using configSTACK_DEPTH_TYPE
+			 * allows the user to determine the return type.  It gets around the
+			 * problem of the value overflowing on 8-bit types without breaking
+			 * backward compatibility for applications that expect an 8-bit return
+			 * type. */
 
-					for( x = 0; x < configTASK_NOTIFICATION_ARRAY_ENTRIES; x++ )
-					{
-						if( pxTCB->ucNotifyState[ x ] == taskWAITING_NOTIFICATION )
-						{
-							/* The task was blocked to wait for a notification, but is
-							 * now suspended, so no notification was received. */
-							pxTCB->ucNotifyState[ x ] = taskNOT_WAITING_NOTIFICATION;
-						}
-					}
-				}
-#endif /* if ( configUSE_TASK_NOTIFICATIONS == 1 ) */
-			}
-			taskEXIT_CRITICAL();
+			pxTCB = prvGetTCBFromHandle( xTask );
 
-			if( xSchedulerRunning != pdFALSE )
+#if portSTACK_GROWTH < 0
 			{
-				/* Reset the next expected unblock time in case it referred to the
-				 * task that is now in the Suspended state. */
-				taskENTER_CRITICAL();
-				{
-					prvResetNextTaskUnblockTime();
-				}
-				taskEXIT_CRITICAL();
+				pucEndOfStack = ( uint8_t * ) pxTCB->pxStack;
 			}
-			else
+#else
 			{
-				mtCOVERAGE_TEST_MARKER();
+				pucEndOfStack = ( uint8_t * ) pxTCB->pxEndOfStack;
 			}
+#endif
 
-			if( pxTCB == pxCurrentTCB )
+			uxReturn = prvTaskCheckFreeStackSpace( pucEndOfStack );
+
+			return uxReturn;
+		}
+
+#endif /* INCLUDE_uxTaskGetStackHighWaterMark2 */
+		/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_uxTaskGetStackHighWaterMark == 1 )
+
+		UBaseType_t uxTaskGetStackHighWaterMark( TaskHandle_t xTask )
+		{
+			TCB_t * pxTCB;
+			uint8_t * pucEndOfStack;
+			UBaseType_t uxReturn;
+
+			pxTCB = prvGetTCBFromHandle( xTask );
+
+#if portSTACK_GROWTH < 0
 			{
-				if( xSchedulerRunning != pdFALSE )
-				{
-					/* The current task has just been suspended. */
-					configASSERT( uxSchedulerSuspended == 0 );
-					portYIELD_WITHIN_API();
-				}
-				else
-				{
-					/* The scheduler is not running, but the task that was pointed
-					 * to by pxCurrentTCB has just been suspended and pxCurrentTCB
-					 * must be adjusted to point to a different task. */
-					if( listCURRENT_LIST_LENGTH( &xSuspendedTaskList ) == uxCurrentNumberOfTasks ) /*lint !e931 Right has no side effect, just volatile. */
-					{
-						/* No other tasks are ready, so set pxCurrentTCB back to
-						 * NULL so when the next task is created pxCurrentTCB will
-						 * be set to point to it no matter what its relative priority
-						 * is. */
-						pxCurrentTCB = NULL;
-					}
-					else
-					{
-						vTaskSwitchContext();
-					}
-				}
+				pucEndOfStack = ( uint8_t * ) pxTCB->pxStack;
 			}
-			else
+#else
 			{
-				mtCOVERAGE_TEST_MARKER();
+				pucEndOfStack = ( uint8_t * ) pxTCB->pxEndOfStack;
 			}
+#endif
+
+			uxReturn = ( UBaseType_t ) prvTaskCheckFreeStackSpace( pucEndOfStack );
+
+			return uxReturn;
 		}
 
-#endif /* INCLUDE_vTaskSuspend */
+#endif /* INCLUDE_uxTaskGetStackHighWaterMark */
 		/*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskSuspend == 1 )
+#if ( INCLUDE_vTaskDelete == 1 )
 
-		static BaseType_t prvTaskIsTaskSuspended( const TaskHandle_t xTask )
+		static void prvDeleteTCB( TCB_t * pxTCB )
 		{
-			BaseType_t xReturn = pdFALSE;
-			const TCB_t * const pxTCB = xTask;
-
-			/* Accesses xPendingReadyList so must be called from a critical
-			 * section. */
+			/* This call is required specifically for the TriCore port.  It must be
+			 * above the vPortFree() calls.  The call is also used by ports/demos that
+			 * want to allocate and clean RAM statically. */
+			portCLEAN_UP_TCB( pxTCB );
 
-			/* It does not make sense to check if the calling task is suspended. */
-			configASSERT( xTask );
+			/* Free up the memory allocated by the scheduler for the task.  It is up
+			 * to the task to free any memory allocated at the application level.
+			 * See the third party link http://www.nadler.com/embedded/newlibAndFreeRTOS.html
+			 * for additional information. */
+#if ( configUSE_NEWLIB_REENTRANT == 1 )
+			{
+				_reclaim_reent( &( pxTCB->xNewLib_reent ) );
+			}
+#endif /* configUSE_NEWLIB_REENTRANT */
 
-			/* Is the task being resumed actually in the suspended list? */
-			if( listIS_CONTAINED_WITHIN( &xSuspendedTaskList, &( pxTCB->xStateListItem ) ) != pdFALSE )
+#if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) && ( portUSING_MPU_WRAPPERS == 0 ) )
 			{
-				/* Has the task already been resumed from within an ISR? */
-				if( listIS_CONTAINED_WITHIN( &xPendingReadyList, &( pxTCB->xEventListItem ) ) == pdFALSE )
+				/* The task can only have been allocated dynamically - free both
+				 * the stack and TCB. */
+				vPortFreeStack( pxTCB->pxStack );
+				vPortFree( pxTCB );
+			}
+#elif ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e731 !e9029 Macro has been consolidated for readability reasons. */
+			{
+				/* The task could have been allocated statically or dynamically, so
+				 * check what was statically allocated before trying to free the
+				 * memory. */
+				if( pxTCB->ucStaticallyAllocated == tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB )
 				{
-					/* Is it in the suspended list because it is in the Suspended
-					 * state, or because is is blocked with no timeout? */
-					if( listIS_CONTAINED_WITHIN( NULL, &( pxTCB->xEventListItem ) ) != pdFALSE ) /*lint !e961.  The cast is only redundant when NULL is used. */
-					{
-						xReturn = pdTRUE;
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+					/* Both the stack and TCB were allocated dynamically, so both
+					 * must be freed. */
+					vPortFreeStack( pxTCB->pxStack );
+					vPortFree( pxTCB );
+				}
+				else if( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_ONLY )
+				{
+					/* Only the stack was statically allocated, so the TCB is the
+					 * only memory that must be freed. */
+					vPortFree( pxTCB );
 				}
 				else
 				{
+					/* Neither the stack nor the TCB were allocated dynamically, so
+					 * nothing needs to be freed. */
+					configASSERT( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_AND_TCB );
 					mtCOVERAGE_TEST_MARKER();
 				}
 			}
-			else
-			{
-				mtCOVERAGE_TEST_MARKER();
-			}
-
-			return xReturn;
-		} /*lint !e818 xTask cannot be a pointer to const because it is a typedef. */
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+		}
 
-#endif /* INCLUDE_vTaskSuspend */
+#endif /* INCLUDE_vTaskDelete */
 		/*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskSuspend == 1 )
-
-		void vTaskResume( TaskHandle_t xTaskToResume )
+		static void prvResetNextTaskUnblockTime( void )
 		{
-			TCB_t * const pxTCB = xTaskToResume;
-
-			/* It does not make sense to resume the calling task. */
-			configASSERT( xTaskToResume );
-
-			/* The parameter cannot be NULL as it is impossible to resume the
-			 * currently executing task. */
-			if( ( pxTCB != pxCurrentTCB ) && ( pxTCB != NULL ) )
+			/* START of special for EDF */
+#if ( configUSE_EDF_TIMING_WHEEL == 1 )
+			/* The wheel looks at the slots of every tick, xNextTaskUnblockTime
+			 * is not used. */
+#else
+#if ( configNUMBER_OF_CORES > 1 )
+			/* Called with interrupts masked, for the partition of the calling
+			 * core.  Reset too early it only costs the tick a look at the
+			 * delayed list. */
+			portGET_PARTITION_LOCK( taskEDF_PARTITION );
+#endif
+			/* END of special for EDF */
+			if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
 			{
-				taskENTER_CRITICAL();
-				{
-					if( prvTaskIsTaskSuspended( pxTCB ) != pdFALSE )
-					{
-						traceTASK_RESUME( pxTCB );
-
-						/* The ready list can be accessed even if the scheduler is
-						 * suspended because this is inside a critical section. */
-						( void ) uxListRemove( &( pxTCB->xStateListItem ) );
-						prvAddTaskToReadyList( pxTCB );
-
-						/* A higher priority task may have just been resumed. */
-						if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
-						{
-							/* This yield may not cause the task just resumed to run,
-							 * but will leave the lists in the correct state for the
-							 * next yield. */
-							taskYIELD_IF_USING_PREEMPTION();
-						}
-						else
-						{
-							mtCOVERAGE_TEST_MARKER();
-						}
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
-				}
-				taskEXIT_CRITICAL();
+				/* The new current delayed list is empty.  Set xNextTaskUnblockTime to
+				 * the maximum possible value so it is  extremely unlikely that the
+				 * if( xTickCount >= xNextTaskUnblockTime ) test will pass until
+				 * there is an item in the delayed list. */
+				xNextTaskUnblockTime = portMAX_DELAY;
 			}
 			else
 			{
-				mtCOVERAGE_TEST_MARKER();
+				/* The new current delayed list is not empty, get the value of
+				 * the item at the head of the delayed list.  This is the time at
+				 * which the task at the head of the delayed list should be removed
+				 * from the Blocked state. */
+				xNextTaskUnblockTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxDelayedTaskList );
 			}
+			/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+			portRELEASE_PARTITION_LOCK( taskEDF_PARTITION );
+#endif
+#endif
+			/* END of special for EDF */
 		}
-
-#endif /* INCLUDE_vTaskSuspend */
-
 		/*-----------------------------------------------------------*/
 
-#if ( ( INCLUDE_xTaskResumeFromISR == 1 ) && ( INCLUDE_vTaskSuspend == 1 ) )
+		/* START of special for EDF */
+#if ( configUSE_EDF_TIMING_WHEEL == 1 )
 
-		BaseType_t xTaskResumeFromISR( TaskHandle_t xTaskToResume )
+		static void prvWheelInsert( ListItem_t * pxItem,
+				const TickType_t xNow )
 		{
-			BaseType_t xYieldRequired = pdFALSE;
-			TCB_t * const pxTCB = xTaskToResume;
-			UBaseType_t uxSavedInterruptStatus;
-
-			configASSERT( xTaskToResume );
+			const TickType_t xTimeToWake = listGET_LIST_ITEM_VALUE( pxItem );
+			const TickType_t xDelay = xTimeToWake - xNow;
+			UBaseType_t uxLevel = ( UBaseType_t ) 0U;
+			UBaseType_t uxList;
 
-			/* RTOS ports that support interrupt nesting have the concept of a
-			 * maximum  system call (or maximum API call) interrupt priority.
-			 * Interrupts that are  above the maximum system call priority are keep
-			 * permanently enabled, even when the RTOS kernel is in a critical section,
-			 * but cannot make any calls to FreeRTOS API functions.  If configASSERT()
-			 * is defined in FreeRTOSConfig.h then
-			 * portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
-			 * failure if a FreeRTOS API function is called from an interrupt that has
-			 * been assigned a priority above the configured maximum system call
-			 * priority.  Only FreeRTOS functions that end in FromISR can be called
-			 * from interrupts  that have been assigned a priority at or (logically)
-			 * below the maximum system call interrupt priority.  FreeRTOS maintains a
-			 * separate interrupt safe API to ensure interrupt entry is as fast and as
-			 * simple as possible.  More information (albeit Cortex-M specific) is
-			 * provided on the following link:
-			 * https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
-			portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+			while( ( uxLevel < ( UBaseType_t ) configEDF_WHEEL_LEVELS ) &&
+				   ( ( xDelay >> ( ( uxLevel + ( UBaseType_t ) 1U ) * ( UBaseType_t ) configEDF_WHEEL_SLOT_BITS ) ) != ( TickType_t ) 0U ) )
+			{
+				uxLevel++;
+			}
 
-			uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+			if( uxLevel < ( UBaseType_t ) configEDF_WHEEL_LEVELS )
+			{
+				uxList = ( uxLevel * taskWHEEL_SLOTS ) + ( UBaseType_t ) ( ( xTimeToWake >> ( uxLevel * ( UBaseType_t ) configEDF_WHEEL_SLOT_BITS ) ) & taskWHEEL_MASK );
+			}
+			else
 			{
-				if( prvTaskIsTaskSuspended( pxTCB ) != pdFALSE )
-				{
-					traceTASK_RESUME_FROM_ISR( pxTCB );
+				uxList = taskWHEEL_FAR_LIST;
+			}
 
-					/* Check the ready lists can be accessed. */
-					if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
-					{
-						/* Ready lists can be accessed so move the task from the
-						 * suspended list to the ready list directly. */
-						if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
-						{
-							xYieldRequired = pdTRUE;
+			listINSERT_END( &( xWheelLists[ uxList ] ), pxItem );
+		}
+		/*-----------------------------------------------------------*/
 
-							/* Mark that a yield is pending in case the user is not
-							 * using the return value to initiate a context switch
-							 * from the ISR using portYIELD_FROM_ISR. */
-							xYieldPending = pdTRUE;
-						}
-						else
-						{
-							mtCOVERAGE_TEST_MARKER();
-						}
+		static void prvWheelCascade( List_t * pxList,
+				const TickType_t xNow )
+		{
+			ListItem_t * pxItem = listGET_HEAD_ENTRY( pxList );
+			ListItem_t * pxNext;
+			const ListItem_t * const pxEnd = listGET_END_MARKER( pxList );
 
-						( void ) uxListRemove( &( pxTCB->xStateListItem ) );
-						prvAddTaskToReadyList( pxTCB );
-					}
-					else
-					{
-						/* The delayed or ready lists cannot be accessed so the task
-						 * is held in the pending ready list until the scheduler is
-						 * unsuspended. */
-						vListInsertEnd( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
-					}
+			/* The tasks of a slot all go to lower levels, the tasks of the far
+			 * list the wheel does not span yet stay where they are. */
+			while( pxItem != pxEnd )
+			{
+				pxNext = listGET_NEXT( pxItem );
+
+				if( ( ( TickType_t ) ( listGET_LIST_ITEM_VALUE( pxItem ) - xNow ) >> taskWHEEL_SPAN_BITS ) == ( TickType_t ) 0U )
+				{
+					listREMOVE_ITEM( pxItem );
+					prvWheelInsert( pxItem, xNow );
 				}
 				else
 				{
 					mtCOVERAGE_TEST_MARKER();
 				}
-			}
-			portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
 
-			return xYieldRequired;
+				pxItem = pxNext;
+			}
 		}
-
-#endif /* ( ( INCLUDE_xTaskResumeFromISR == 1 ) && ( INCLUDE_vTaskSuspend == 1 ) ) */
 		/*-----------------------------------------------------------*/
 
-		void vTaskStartScheduler( void )
+		static BaseType_t prvWheelAdvance( const TickType_t xNow )
 		{
-			BaseType_t xReturn;
+			UBaseType_t uxLevel;
 
-			/* Add the idle task at the lowest priority. */
-#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+			if( taskWHEEL_LEVEL_OFFSET( xNow, ( UBaseType_t ) configEDF_WHEEL_LEVELS ) == ( TickType_t ) 0U )
 			{
-				StaticTask_t * pxIdleTaskTCBBuffer = NULL;
-				StackType_t * pxIdleTaskStackBuffer = NULL;
-				uint32_t ulIdleTaskStackSize;
-
-				/* The Idle task is created using user provided RAM - obtain the
-				 * address of the RAM then create the idle task. */
-				vApplicationGetIdleTaskMemory( &pxIdleTaskTCBBuffer, &pxIdleTaskStackBuffer, &ulIdleTaskStackSize );
-				xIdleTaskHandle = xTaskCreateStatic( prvIdleTask,
-						configIDLE_TASK_NAME,
-						ulIdleTaskStackSize,
-						( void * ) NULL,       /*lint !e961.  The cast is not redundant for all compilers. */
-						portPRIVILEGE_BIT,     /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
-						pxIdleTaskStackBuffer,
-						pxIdleTaskTCBBuffer ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+				prvWheelCascade( &( xWheelLists[ taskWHEEL_FAR_LIST ] ), xNow );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 
-				if( xIdleTaskHandle != NULL )
+			/* From the top, a task moved down is never put in a slot moved
+			 * down later in the same tick. */
+			for( uxLevel = ( UBaseType_t ) configEDF_WHEEL_LEVELS - ( UBaseType_t ) 1U; uxLevel > ( UBaseType_t ) 0U; uxLevel-- )
+			{
+				if( taskWHEEL_LEVEL_OFFSET( xNow, uxLevel ) == ( TickType_t ) 0U )
 				{
-					xReturn = pdPASS;
+					prvWheelCascade( &( xWheelLists[ ( uxLevel * taskWHEEL_SLOTS ) + ( UBaseType_t ) ( ( xNow >> ( uxLevel * ( UBaseType_t ) configEDF_WHEEL_SLOT_BITS ) ) & taskWHEEL_MASK ) ] ), xNow );
 				}
 				else
 				{
-					xReturn = pdFAIL;
+					mtCOVERAGE_TEST_MARKER();
 				}
 			}
-#else /* if ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
-			{
-				/* START of special for EDF */
-#if (configUSE_EDF_SCHEDULER == 1)
-				{
-					xIDLEPeriod = 200;
 
-					xReturn = xTaskPeriodicCreate( prvIdleTask,
-							configIDLE_TASK_NAME,
-							configMINIMAL_STACK_SIZE,
-							( void * ) NULL,
-							portPRIVILEGE_BIT,  /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
-							&xIdleTaskHandle, /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
-							xIDLEPeriod);
-				}
-				/* END of special for EDF */
+			return ( listLIST_IS_EMPTY( &( xWheelLists[ ( UBaseType_t ) ( xNow & taskWHEEL_MASK ) ] ) ) == pdFALSE ) ? pdTRUE : pdFALSE;
+		}
+
+#endif /* configUSE_EDF_TIMING_WHEEL */
+		/* END of special for EDF */
+		/*-----------------------------------------------------------*/
+
+#if ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) )
+
+		TaskHandle_t xTaskGetCurrentTaskHandle( void )
+		{
+			TaskHandle_t xReturn;
+
+			/* START of special for EDF */
+#if ( configNUMBER_OF_CORES == 1 )
+			/* A critical section is not required as this is not called from
+			 * an interrupt and the current TCB will always be the same for any
+			 * individual execution thread. */
+			xReturn = pxCurrentTCB;
 #else
-				{
-					/* The Idle task is being created using dynamically allocated RAM. */
-					xReturn = xTaskCreate( prvIdleTask,
-							configIDLE_TASK_NAME,
-							configMINIMAL_STACK_SIZE,
-							( void * ) NULL,
-							portPRIVILEGE_BIT,  /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
-							&xIdleTaskHandle ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+			/* The task could migrate between reading the core ID and reading
+			 * the current TCB of that core.  Masking the interrupts of the core
+			 * is enough, the locks are not needed. */
+			const UBaseType_t uxSavedInterruptStatus = portSET_INTERRUPT_MASK();
 
-				}
+			xReturn = pxCurrentTCB;
+			portCLEAR_INTERRUPT_MASK( uxSavedInterruptStatus );
 #endif
-			}
-#endif /* configSUPPORT_STATIC_ALLOCATION */
+			/* END of special for EDF */
 
-#if ( configUSE_TIMERS == 1 )
+			return xReturn;
+		}
+
+#endif /* ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) ) */
+		/*-----------------------------------------------------------*/
+
+#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+
+		BaseType_t xTaskGetSchedulerState( void )
+		{
+			BaseType_t xReturn;
+
+			if( xSchedulerRunning == pdFALSE )
 			{
-				if( xReturn == pdPASS )
+				xReturn = taskSCHEDULER_NOT_STARTED;
+			}
+			else
+			{
+				if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
 				{
-					xReturn = xTimerCreateTimerTask();
+					xReturn = taskSCHEDULER_RUNNING;
 				}
 				else
 				{
-					mtCOVERAGE_TEST_MARKER();
+					xReturn = taskSCHEDULER_SUSPENDED;
 				}
 			}
-#endif /* configUSE_TIMERS */
 
-if( xReturn == pdPASS )
-{
-	/* freertos_tasks_c_additions_init() should only be called if the user
-	 * definable macro FREERTOS_TASKS_C_ADDITIONS_INIT() is defined, as that is
-	 * the only macro called by the function. */
-#ifdef FREERTOS_TASKS_C_ADDITIONS_INIT
-	{
-		freertos_tasks_c_additions_init();
-	}
-#endif
+			return xReturn;
+		}
 
-	/* Interrupts are turned off here, to ensure a tick does not occur
-	 * before or during the call to xPortStartScheduler().  The stacks of
-	 * the created tasks contain a status word with interrupts switched on
-	 * so interrupts will automatically get re-enabled when the first task
-	 * starts to run. */
-	portDISABLE_INTERRUPTS();
+#endif /* ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) ) */
+		/*-----------------------------------------------------------*/
 
-#if ( configUSE_NEWLIB_REENTRANT == 1 )
-	{
-		/* Switch Newlib's _impure_ptr variable to point to the _reent
-		 * structure specific to the task that will run first.
-		 * See the third party link http://www.nadler.com/embedded/newlibAndFreeRTOS.html
-		 * for additional information. */
-		_impure_ptr = &( pxCurrentTCB->xNewLib_reent );
-	}
-#endif /* configUSE_NEWLIB_REENTRANT */
+#if ( configUSE_MUTEXES == 1 )
 
-	xNextTaskUnblockTime = portMAX_DELAY;
-	xSchedulerRunning = pdTRUE;
-	xTickCount = ( TickType_t ) configINITIAL_TICK_COUNT;
+		BaseType_t xTaskPriorityInherit( TaskHandle_t const pxMutexHolder )
+		{
+			TCB_t * const pxMutexHolderTCB = pxMutexHolder;
+			BaseType_t xReturn = pdFALSE;
 
-	/* If configGENERATE_RUN_TIME_STATS is defined then the following
-	 * macro must be defined to configure the timer/counter used to generate
-	 * the run time counter time base.   NOTE:  If configGENERATE_RUN_TIME_STATS
-	 * is set to 0 and the following line fails to build then ensure you do not
-	 * have portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() defined in your
-	 * FreeRTOSConfig.h file. */
-	portCONFIGURE_TIMER_FOR_RUN_TIME_STATS();
+			/* If the mutex was given back by an interrupt while the queue was
+			 * locked then the mutex holder might now be NULL.  _RB_ Is this still
+			 * needed as interrupts can no longer use mutexes? */
+			if( pxMutexHolder != NULL )
+			{
+				/* If the holder of the mutex has a priority below the priority of
+				 * the task attempting to obtain the mutex then it will temporarily
+				 * inherit the priority of the task attempting to obtain the mutex. */
+				if( pxMutexHolderTCB->uxPriority < pxCurrentTCB->uxPriority )
+				{
+					/* Adjust the mutex holder state to account for its new
+					 * priority.  Only reset the event list item value if the value is
+					 * not being used for anything else. */
+					if( ( listGET_LIST_ITEM_VALUE( &( pxMutexHolderTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+					{
+						listSET_LIST_ITEM_VALUE( &( pxMutexHolderTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxCurrentTCB->uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
 
-	traceTASK_SWITCHED_IN();
+					/* If the task being modified is in the ready state it will need
+					 * to be moved into a new list. */
+					if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxMutexHolderTCB->uxPriority ] ), &( pxMutexHolderTCB->xStateListItem ) ) != pdFALSE )
+					{
+						if( uxListRemove( &( pxMutexHolderTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+						{
+							/* It is known that the task is in its ready list so
+							 * there is no need to check again and the port level
+							 * reset macro can be called directly. */
+							portRESET_READY_PRIORITY( pxMutexHolderTCB->uxPriority, uxTopReadyPriority );
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
 
-	/* Setting up the timer tick is hardware specific and thus in the
-	 * portable interface. */
-	if( xPortStartScheduler() != pdFALSE )
-	{
-		/* Should not reach here as if the scheduler is running the
-		 * function will not return. */
-	}
-	else
-	{
-		/* Should only reach here if a task calls xTaskEndScheduler(). */
-	}
-}
-else
-{
-	/* This line will only be reached if the kernel could not be started,
-	 * because there was not enough FreeRTOS heap to create the idle task
-	 * or the timer task. */
-	configASSERT( xReturn != errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY );
-}
+						/* Inherit the priority before being moved into the new list. */
+						pxMutexHolderTCB->uxPriority = pxCurrentTCB->uxPriority;
+						prvAddTaskToReadyList( pxMutexHolderTCB );
+					}
+					else
+					{
+						/* Just inherit the priority. */
+						pxMutexHolderTCB->uxPriority = pxCurrentTCB->uxPriority;
+					}
 
-/* Prevent compiler warnings if INCLUDE_xTaskGetIdleTaskHandle is set to 0,
- * meaning xIdleTaskHandle is not used anywhere else. */
-( void ) xIdleTaskHandle;
+					traceTASK_PRIORITY_INHERIT( pxMutexHolderTCB, pxCurrentTCB->uxPriority );
+
+					/* Inheritance occurred. */
+					xReturn = pdTRUE;
+				}
+				else
+				{
+					if( pxMutexHolderTCB->uxBasePriority < pxCurrentTCB->uxPriority )
+					{
+						/* The base priority of the mutex holder is lower than the
+						 * priority of the task attempting to take the mutex, but the
+						 * current priority of the mutex holder is not lower than the
+						 * priority of the task attempting to take the mutex.
+						 * Therefore the mutex holder must have already inherited a
+						 * priority, but inheritance would have occurred if that had
+						 * not been the case. */
+						xReturn = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 
-/* OpenOCD makes use of uxTopUsedPriority for thread debugging. Prevent uxTopUsedPriority
- * from getting optimized out as it is no longer used by the kernel. */
-( void ) uxTopUsedPriority;
+			return xReturn;
 		}
+
+#endif /* configUSE_MUTEXES */
 		/*-----------------------------------------------------------*/
 
-		void vTaskEndScheduler( void )
-		{
-			/* Stop the scheduler interrupts and call the portable scheduler end
-			 * routine so the original ISRs can be restored if necessary.  The port
-			 * layer must ensure interrupts enable  bit is left in the correct state. */
-			portDISABLE_INTERRUPTS();
-			xSchedulerRunning = pdFALSE;
-			vPortEndScheduler();
-		}
-		/*----------------------------------------------------------*/
+#if ( configUSE_MUTEXES == 1 )
 
-		void vTaskSuspendAll( void )
+		BaseType_t xTaskPriorityDisinherit( TaskHandle_t const pxMutexHolder )
 		{
-			/* A critical section is not required as the variable is of type
-			 * BaseType_t.  Please read Richard Barry's reply in the following link to a
-			 * post in the FreeRTOS support forum before reporting this as a bug! -
-			 * https://goo.gl/wu4acr */
+			TCB_t * const pxTCB = pxMutexHolder;
+			BaseType_t xReturn = pdFALSE;
 
-			/* portSOFTWARE_BARRIER() is only implemented for emulated/simulated ports that
-			 * do not otherwise exhibit real time behaviour. */
-			portSOFTWARE_BARRIER();
+			if( pxMutexHolder != NULL )
+			{
+				/* A task can only have an inherited priority if it holds the mutex.
+				 * If the mutex is held by a task then it cannot be given from an
+				 * interrupt, and if a mutex is given by the holding task then it must
+				 * be the running state task. */
+				configASSERT( pxTCB == pxCurrentTCB );
+				configASSERT( pxTCB->uxMutexesHeld );
+				( pxTCB->uxMutexesHeld )--;
 
-			/* The scheduler is suspended if uxSchedulerSuspended is non-zero.  An increment
-			 * is used to allow calls to vTaskSuspendAll() to nest. */
-			++uxSchedulerSuspended;
+				/* Has the holder of the mutex inherited the priority of another
+				 * task? */
+				if( pxTCB->uxPriority != pxTCB->uxBasePriority )
+				{
+					/* Only disinherit if no other mutexes are held. */
+					if( pxTCB->uxMutexesHeld == ( UBaseType_t ) 0 )
+					{
+						/* A task can only have an inherited priority if it holds
+						 * the mutex.  If the mutex is held by a task then it cannot be
+						 * given from an interrupt, and if a mutex is given by the
+						 * holding task then it must be the running state task.  Remove
+						 * the holding task from the ready list. */
+						/* START of special for EDF */
+						taskEDF_LOCK_PARTITIONS_OF( pxTCB );
+						/* END of special for EDF */
 
-			/* Enforces ordering for ports and optimised compilers that may otherwise place
-			 * the above increment elsewhere. */
-			portMEMORY_BARRIER();
-		}
-		/*----------------------------------------------------------*/
+						if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+						{
+							portRESET_READY_PRIORITY( pxTCB->uxPriority, uxTopReadyPriority );
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
 
-#if ( configUSE_TICKLESS_IDLE != 0 )
+						/* Disinherit the priority before adding the task into the
+						 * new  ready list. */
+						traceTASK_PRIORITY_DISINHERIT( pxTCB, pxTCB->uxBasePriority );
+						pxTCB->uxPriority = pxTCB->uxBasePriority;
 
-		static TickType_t prvGetExpectedIdleTime( void )
-		{
-			TickType_t xReturn;
-			UBaseType_t uxHigherPriorityReadyTasks = pdFALSE;
+						/* Reset the event list item value.  It cannot be in use for
+						 * any other purpose if this task is running, and it must be
+						 * running to give back the mutex. */
+						listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxTCB->uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+						prvAddTaskToReadyList( pxTCB );
+						/* START of special for EDF */
+						taskEDF_UNLOCK_PARTITIONS_OF( pxTCB );
+						/* END of special for EDF */
 
-			/* uxHigherPriorityReadyTasks takes care of the case where
-			 * configUSE_PREEMPTION is 0, so there may be tasks above the idle priority
-			 * task that are in the Ready state, even though the idle task is
-			 * running. */
-#if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
-			{
-				if( uxTopReadyPriority > tskIDLE_PRIORITY )
+						/* Return true to indicate that a context switch is required.
+						 * This is only actually required in the corner case whereby
+						 * multiple mutexes were held and the mutexes were given back
+						 * in an order different to that in which they were taken.
+						 * If a context switch did not occur when the first mutex was
+						 * returned, even if a task was waiting on it, then a context
+						 * switch should occur when the last mutex is returned whether
+						 * a task is waiting on it or not. */
+						xReturn = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
 				{
-					uxHigherPriorityReadyTasks = pdTRUE;
+					mtCOVERAGE_TEST_MARKER();
 				}
 			}
-#else
-{
-	const UBaseType_t uxLeastSignificantBit = ( UBaseType_t ) 0x01;
-
-	/* When port optimised task selection is used the uxTopReadyPriority
-	 * variable is used as a bit map.  If bits other than the least
-	 * significant bit are set then there are tasks that have a priority
-	 * above the idle priority that are in the Ready state.  This takes
-	 * care of the case where the co-operative scheduler is in use. */
-	if( uxTopReadyPriority > uxLeastSignificantBit )
-	{
-		uxHigherPriorityReadyTasks = pdTRUE;
-	}
-}
-#endif /* if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 ) */
-
-if( pxCurrentTCB->uxPriority > tskIDLE_PRIORITY )
-{
-	xReturn = 0;
-}
-else if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > 1 )
-{
-	/* There are other idle priority tasks in the ready state.  If
-	 * time slicing is used then the very next tick interrupt must be
-	 * processed. */
-	xReturn = 0;
-}
-else if( uxHigherPriorityReadyTasks != pdFALSE )
-{
-	/* There are tasks in the Ready state that have a priority above the
-	 * idle priority.  This path can only be reached if
-	 * configUSE_PREEMPTION is 0. */
-	xReturn = 0;
-}
-else
-{
-	xReturn = xNextTaskUnblockTime - xTickCount;
-}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 
-return xReturn;
+			return xReturn;
 		}
 
-#endif /* configUSE_TICKLESS_IDLE */
-		/*----------------------------------------------------------*/
+#endif /* configUSE_MUTEXES */
+		/*-----------------------------------------------------------*/
 
-		BaseType_t xTaskResumeAll( void )
-		{
-			TCB_t * pxTCB = NULL;
-			BaseType_t xAlreadyYielded = pdFALSE;
+#if ( configUSE_MUTEXES == 1 )
 
-			/* If uxSchedulerSuspended is zero then this function does not match a
-			 * previous call to vTaskSuspendAll(). */
-			configASSERT( uxSchedulerSuspended );
+		void vTaskPriorityDisinheritAfterTimeout( TaskHandle_t const pxMutexHolder,
+				UBaseType_t uxHighestPriorityWaitingTask )
+		{
+			TCB_t * const pxTCB = pxMutexHolder;
+			UBaseType_t uxPriorityUsedOnEntry, uxPriorityToUse;
+			const UBaseType_t uxOnlyOneMutexHeld = ( UBaseType_t ) 1;
 
-			/* It is possible that an ISR caused a task to be removed from an event
-			 * list while the scheduler was suspended.  If this was the case then the
-			 * removed task will have been added to the xPendingReadyList.  Once the
-			 * scheduler has been resumed it is safe to move all the pending ready
-			 * tasks from this list into their appropriate ready list. */
-			taskENTER_CRITICAL();
+			if( pxMutexHolder != NULL )
 			{
-				--uxSchedulerSuspended;
+				/* If pxMutexHolder is not NULL then the holder must hold at least
+				 * one mutex. */
+				configASSERT( pxTCB->uxMutexesHeld );
 
-				if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+				/* Determine the priority to which the priority of the task that
+				 * holds the mutex should be set.  This will be the greater of the
+				 * holding task's base priority and the priority of the highest
+				 * priority task that is waiting to obtain the mutex. */
+				if( pxTCB->uxBasePriority < uxHighestPriorityWaitingTask )
 				{
-					if( uxCurrentNumberOfTasks > ( UBaseType_t ) 0U )
+					uxPriorityToUse = uxHighestPriorityWaitingTask;
+				}
+				else
+				{
+					uxPriorityToUse = pxTCB->uxBasePriority;
+				}
+
+				/* Does the priority need to change? */
+				if( pxTCB->uxPriority != uxPriorityToUse )
+				{
+					/* Only disinherit if no other mutexes are held.  This is a
+					 * simplification in the priority inheritance implementation.  If
+					 * the task that holds the mutex is also holding other mutexes then
+					 * the other mutexes may have caused the priority inheritance. */
+					if( pxTCB->uxMutexesHeld == uxOnlyOneMutexHeld )
 					{
-						/* Move any readied tasks from the pending list into the
-						 * appropriate ready list. */
-						while( listLIST_IS_EMPTY( &xPendingReadyList ) == pdFALSE )
-						{
-							pxTCB = listGET_OWNER_OF_HEAD_ENTRY( ( &xPendingReadyList ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-							listREMOVE_ITEM( &( pxTCB->xEventListItem ) );
-							portMEMORY_BARRIER();
-							listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
-							prvAddTaskToReadyList( pxTCB );
+						/* If a task has timed out because it already holds the
+						 * mutex it was trying to obtain then it cannot of inherited
+						 * its own priority. */
+						configASSERT( pxTCB != pxCurrentTCB );
 
-							/* If the moved task has a priority higher than or equal to
-							 * the current task then a yield must be performed. */
-							if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
-							{
-								xYieldPending = pdTRUE;
-							}
-							else
-							{
-								mtCOVERAGE_TEST_MARKER();
-							}
+						/* Disinherit the priority, remembering the previous
+						 * priority to facilitate determining the subject task's
+						 * state. */
+						traceTASK_PRIORITY_DISINHERIT( pxTCB, uxPriorityToUse );
+						uxPriorityUsedOnEntry = pxTCB->uxPriority;
+						pxTCB->uxPriority = uxPriorityToUse;
+
+						/* Only reset the event list item value if the value is not
+						 * being used for anything else. */
+						if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+						{
+							listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxPriorityToUse ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
 						}
-
-						if( pxTCB != NULL )
+						else
 						{
-							/* A task was unblocked while the scheduler was suspended,
-							 * which may have prevented the next unblock time from being
-							 * re-calculated, in which case re-calculate it now.  Mainly
-							 * important for low power tickless implementations, where
-							 * this can prevent an unnecessary exit from low power
-							 * state. */
-							prvResetNextTaskUnblockTime();
+							mtCOVERAGE_TEST_MARKER();
 						}
 
-						/* If any ticks occurred while the scheduler was suspended then
-						 * they should be processed now.  This ensures the tick count does
-						 * not  slip, and that any delayed tasks are resumed at the correct
-						 * time. */
+						/* If the running task is not the task that holds the mutex
+						 * then the task that holds the mutex could be in either the
+						 * Ready, Blocked or Suspended states.  Only remove the task
+						 * from its current state list if it is in the Ready state as
+						 * the task's priority is going to change and there is one
+						 * Ready list per priority. */
+						if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
 						{
-							TickType_t xPendedCounts = xPendedTicks; /* Non-volatile copy. */
-
-							if( xPendedCounts > ( TickType_t ) 0U )
+							if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
 							{
-								do
-								{
-									if( xTaskIncrementTick() != pdFALSE )
-									{
-										xYieldPending = pdTRUE;
-									}
-									else
-									{
-										mtCOVERAGE_TEST_MARKER();
-									}
-
-									--xPendedCounts;
-								} while( xPendedCounts > ( TickType_t ) 0U );
-
-								xPendedTicks = 0;
+								/* It is known that the task is in its ready list so
+								 * there is no need to check again and the port level
+								 * reset macro can be called directly. */
+								portRESET_READY_PRIORITY( pxTCB->uxPriority, uxTopReadyPriority );
 							}
 							else
 							{
 								mtCOVERAGE_TEST_MARKER();
 							}
-						}
 
-						if( xYieldPending != pdFALSE )
-						{
-#if ( configUSE_PREEMPTION != 0 )
-							{
-								xAlreadyYielded = pdTRUE;
-							}
-#endif
-							taskYIELD_IF_USING_PREEMPTION();
+							prvAddTaskToReadyList( pxTCB );
 						}
 						else
 						{
 							mtCOVERAGE_TEST_MARKER();
 						}
 					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
 				}
 				else
 				{
 					mtCOVERAGE_TEST_MARKER();
 				}
 			}
-			taskEXIT_CRITICAL();
-
-			return xAlreadyYielded;
-		}
-		/*-----------------------------------------------------------*/
-
-		TickType_t xTaskGetTickCount( void )
-		{
-			TickType_t xTicks;
-
-			/* Critical section required if running on a 16 bit processor. */
-			portTICK_TYPE_ENTER_CRITICAL();
+			else
 			{
-				xTicks = xTickCount;
+				mtCOVERAGE_TEST_MARKER();
 			}
-			portTICK_TYPE_EXIT_CRITICAL();
-
-			return xTicks;
 		}
+
+#endif /* configUSE_MUTEXES */
 		/*-----------------------------------------------------------*/
 
-		TickType_t xTaskGetTickCountFromISR( void )
+#if ( portCRITICAL_NESTING_IN_TCB == 1 )
+
+		void vTaskEnterCritical( void )
 		{
-			TickType_t xReturn;
-			UBaseType_t uxSavedInterruptStatus;
+			portDISABLE_INTERRUPTS();
 
-			/* RTOS ports that support interrupt nesting have the concept of a maximum
-			 * system call (or maximum API call) interrupt priority.  Interrupts that are
-			 * above the maximum system call priority are kept permanently enabled, even
-			 * when the RTOS kernel is in a critical section, but cannot make any calls to
-			 * FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
-			 * then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
-			 * failure if a FreeRTOS API function is called from an interrupt that has been
-			 * assigned a priority above the configured maximum system call priority.
-			 * Only FreeRTOS functions that end in FromISR can be called from interrupts
-			 * that have been assigned a priority at or (logically) below the maximum
-			 * system call  interrupt priority.  FreeRTOS maintains a separate interrupt
-			 * safe API to ensure interrupt entry is as fast and as simple as possible.
-			 * More information (albeit Cortex-M specific) is provided on the following
-			 * link: https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
-			portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+			if( xSchedulerRunning != pdFALSE )
+			{
+				( pxCurrentTCB->uxCriticalNesting )++;
 
-			uxSavedInterruptStatus = portTICK_TYPE_SET_INTERRUPT_MASK_FROM_ISR();
+				/* This is not the interrupt safe version of the enter critical
+				 * function so  assert() if it is being called from an interrupt
+				 * context.  Only API functions that end in "FromISR" can be used in an
+				 * interrupt.  Only assert if the critical nesting count is 1 to
+				 * protect against recursive calls if the assert function also uses a
+				 * critical section. */
+				if( pxCurrentTCB->uxCriticalNesting == 1 )
+				{
+					portASSERT_IF_IN_ISR();
+				}
+			}
+			else
 			{
-				xReturn = xTickCount;
+				mtCOVERAGE_TEST_MARKER();
 			}
-			portTICK_TYPE_CLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
-
-			return xReturn;
-		}
-		/*-----------------------------------------------------------*/
-
-		UBaseType_t uxTaskGetNumberOfTasks( void )
-		{
-			/* A critical section is not required because the variables are of type
-			 * BaseType_t. */
-			return uxCurrentNumberOfTasks;
 		}
-		/*-----------------------------------------------------------*/
-
-		char * pcTaskGetName( TaskHandle_t xTaskToQuery ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
-		{
-			TCB_t * pxTCB;
 
-			/* If null is passed in here then the name of the calling task is being
-			 * queried. */
-			pxTCB = prvGetTCBFromHandle( xTaskToQuery );
-			configASSERT( pxTCB );
-			return &( pxTCB->pcTaskName[ 0 ] );
-		}
+#endif /* portCRITICAL_NESTING_IN_TCB */
 		/*-----------------------------------------------------------*/
 
-#if ( INCLUDE_xTaskGetHandle == 1 )
+#if ( portCRITICAL_NESTING_IN_TCB == 1 )
 
-		static TCB_t * prvSearchForNameWithinSingleList( List_t * pxList,
-				const char pcNameToQuery[] )
+		void vTaskExitCritical( void )
 		{
-			TCB_t * pxNextTCB, * pxFirstTCB, * pxReturn = NULL;
-			UBaseType_t x;
-			char cNextChar;
-			BaseType_t xBreakLoop;
-
-			/* This function is called with the scheduler suspended. */
-
-			if( listCURRENT_LIST_LENGTH( pxList ) > ( UBaseType_t ) 0 )
+			if( xSchedulerRunning != pdFALSE )
 			{
-				listGET_OWNER_OF_NEXT_ENTRY( pxFirstTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-
-				do
+				if( pxCurrentTCB->uxCriticalNesting > 0U )
 				{
-					listGET_OWNER_OF_NEXT_ENTRY( pxNextTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-
-					/* Check each character in the name looking for a match or
-					 * mismatch. */
-					xBreakLoop = pdFALSE;
+					( pxCurrentTCB->uxCriticalNesting )--;
 
-					for( x = ( UBaseType_t ) 0; x < ( UBaseType_t ) configMAX_TASK_NAME_LEN; x++ )
+					if( pxCurrentTCB->uxCriticalNesting == 0U )
 					{
-						cNextChar = pxNextTCB->pcTaskName[ x ];
-
-						if( cNextChar != pcNameToQuery[ x ] )
-						{
-							/* Characters didn't match. */
-							xBreakLoop = pdTRUE;
-						}
-						else if( cNextChar == ( char ) 0x00 )
-						{
-							/* Both strings terminated, a match must have been
-							 * found. */
-							pxReturn = pxNextTCB;
-							xBreakLoop = pdTRUE;
-						}
-						else
-						{
-							mtCOVERAGE_TEST_MARKER();
-						}
-
-						if( xBreakLoop != pdFALSE )
-						{
-							break;
-						}
+						portENABLE_INTERRUPTS();
 					}
-
-					if( pxReturn != NULL )
+					else
 					{
-						/* The handle has been found. */
-						break;
+						mtCOVERAGE_TEST_MARKER();
 					}
-				} while( pxNextTCB != pxFirstTCB );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 			}
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
-
-			return pxReturn;
 		}
 
-#endif /* INCLUDE_xTaskGetHandle */
+#endif /* portCRITICAL_NESTING_IN_TCB */
 		/*-----------------------------------------------------------*/
 
-#if ( INCLUDE_xTaskGetHandle == 1 )
+		/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
 
-		TaskHandle_t xTaskGetHandle( const char * pcNameToQuery ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+		/* The outermost critical section of a core takes the task lock then
+		 * the ISR lock, see the lock order at the top of the file. */
+		void vTaskEnterCritical( void )
 		{
-			UBaseType_t uxQueue = configMAX_PRIORITIES;
-			TCB_t * pxTCB;
+			BaseType_t xCoreID;
 
-			/* Task names will be truncated to configMAX_TASK_NAME_LEN - 1 bytes. */
-			configASSERT( strlen( pcNameToQuery ) < configMAX_TASK_NAME_LEN );
+			portDISABLE_INTERRUPTS();
 
-			vTaskSuspendAll();
+			if( xSchedulerRunning != pdFALSE )
 			{
-				/* Search the ready lists. */
-				do
-				{
-					uxQueue--;
-					pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) &( pxReadyTasksLists[ uxQueue ] ), pcNameToQuery );
-
-					if( pxTCB != NULL )
-					{
-						/* Found the handle. */
-						break;
-					}
-				} while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+				/* Interrupts are masked, the task can no longer migrate. */
+				xCoreID = portGET_CORE_ID();
 
-				/* Search the delayed lists. */
-				if( pxTCB == NULL )
+				if( uxCriticalNestings[ xCoreID ] == 0U )
 				{
-					pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, pcNameToQuery );
+					portGET_TASK_LOCK();
+					portGET_ISR_LOCK();
 				}
-
-				if( pxTCB == NULL )
+				else
 				{
-					pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
+					mtCOVERAGE_TEST_MARKER();
 				}
 
-#if ( INCLUDE_vTaskSuspend == 1 )
-				{
-					if( pxTCB == NULL )
-					{
-						/* Search the suspended list. */
-						pxTCB = prvSearchForNameWithinSingleList( &xSuspendedTaskList, pcNameToQuery );
-					}
-				}
-#endif
+				uxCriticalNestings[ xCoreID ]++;
 
-#if ( INCLUDE_vTaskDelete == 1 )
-				{
-					if( pxTCB == NULL )
-					{
-						/* Search the deleted list. */
-						pxTCB = prvSearchForNameWithinSingleList( &xTasksWaitingTermination, pcNameToQuery );
-					}
+				/* Same check as the single core version. */
+				if( uxCriticalNestings[ xCoreID ] == 1U )
+				{
+					portASSERT_IF_IN_ISR();
 				}
-#endif
 			}
-			( void ) xTaskResumeAll();
-
-			return pxTCB;
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
-
-#endif /* INCLUDE_xTaskGetHandle */
 		/*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
-
-		UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray,
-				const UBaseType_t uxArraySize,
-				configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime )
+		void vTaskExitCritical( void )
 		{
-			UBaseType_t uxTask = 0, uxQueue = configMAX_PRIORITIES;
+			BaseType_t xCoreID;
 
-			vTaskSuspendAll();
+			if( xSchedulerRunning != pdFALSE )
 			{
-				/* Is there a space in the array for each task in the system? */
-				if( uxArraySize >= uxCurrentNumberOfTasks )
-				{
-					/* Fill in an TaskStatus_t structure with information on each
-					 * task in the Ready state. */
-					do
-					{
-						uxQueue--;
-						uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxReadyTasksLists[ uxQueue ] ), eReady );
-					} while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-
-					/* Fill in an TaskStatus_t structure with information on each
-					 * task in the Blocked state. */
-					uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
-					uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
-
-#if ( INCLUDE_vTaskDelete == 1 )
-					{
-						/* Fill in an TaskStatus_t structure with information on
-						 * each task that has been deleted but not yet cleaned up. */
-						uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xTasksWaitingTermination, eDeleted );
-					}
-#endif
+				xCoreID = portGET_CORE_ID();
 
-#if ( INCLUDE_vTaskSuspend == 1 )
-					{
-						/* Fill in an TaskStatus_t structure with information on
-						 * each task in the Suspended state. */
-						uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xSuspendedTaskList, eSuspended );
-					}
-#endif
+				if( uxCriticalNestings[ xCoreID ] > 0U )
+				{
+					uxCriticalNestings[ xCoreID ]--;
 
-#if ( configGENERATE_RUN_TIME_STATS == 1 )
+					if( uxCriticalNestings[ xCoreID ] == 0U )
 					{
-						if( pulTotalRunTime != NULL )
-						{
-#ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
-							portALT_GET_RUN_TIME_COUNTER_VALUE( ( *pulTotalRunTime ) );
-#else
-							*pulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
-#endif
-						}
+						portRELEASE_ISR_LOCK();
+						portRELEASE_TASK_LOCK();
+						portENABLE_INTERRUPTS();
 					}
-#else /* if ( configGENERATE_RUN_TIME_STATS == 1 ) */
+					else
 					{
-						if( pulTotalRunTime != NULL )
-						{
-							*pulTotalRunTime = 0;
-						}
+						mtCOVERAGE_TEST_MARKER();
 					}
-#endif /* if ( configGENERATE_RUN_TIME_STATS == 1 ) */
 				}
 				else
 				{
 					mtCOVERAGE_TEST_MARKER();
 				}
 			}
-			( void ) xTaskResumeAll();
-
-			return uxTask;
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
+		/*-----------------------------------------------------------*/
 
-#endif /* configUSE_TRACE_FACILITY */
-		/*----------------------------------------------------------*/
-
-#if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
-
-		TaskHandle_t xTaskGetIdleTaskHandle( void )
+		/* An ISR only needs the ISR lock: the task lock is held by task level
+		 * code that does not mask interrupts the whole time. */
+		UBaseType_t vTaskEnterCriticalFromISR( void )
 		{
-			/* If xTaskGetIdleTaskHandle() is called before the scheduler has been
-			 * started, then xIdleTaskHandle will be NULL. */
-			configASSERT( ( xIdleTaskHandle != NULL ) );
-			return xIdleTaskHandle;
-		}
+			const UBaseType_t uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
 
-#endif /* INCLUDE_xTaskGetIdleTaskHandle */
-		/*----------------------------------------------------------*/
+			portGET_ISR_LOCK();
 
-		/* This conditional compilation should use inequality to 0, not equality to 1.
-		 * This is to ensure vTaskStepTick() is available when user defined low power mode
-		 * implementations require configUSE_TICKLESS_IDLE to be set to a value other than
-		 * 1. */
-#if ( configUSE_TICKLESS_IDLE != 0 )
+			return uxSavedInterruptStatus;
+		}
+		/*-----------------------------------------------------------*/
 
-		void vTaskStepTick( const TickType_t xTicksToJump )
+		void vTaskExitCriticalFromISR( UBaseType_t uxSavedInterruptStatus )
 		{
-			/* Correct the tick count value after a period during which the tick
-			 * was suppressed.  Note this does *not* call the tick hook function for
-			 * each stepped tick. */
-			configASSERT( ( xTickCount + xTicksToJump ) <= xNextTaskUnblockTime );
-			xTickCount += xTicksToJump;
-			traceINCREASE_TICK_COUNT( xTicksToJump );
+			portRELEASE_ISR_LOCK();
+			portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
 		}
 
-#endif /* configUSE_TICKLESS_IDLE */
-		/*----------------------------------------------------------*/
+#endif /* configNUMBER_OF_CORES */
+		/* END of special for EDF */
+		/*-----------------------------------------------------------*/
 
-		BaseType_t xTaskCatchUpTicks( TickType_t xTicksToCatchUp )
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
+
+		static char * prvWriteNameToBuffer( char * pcBuffer,
+				const char * pcTaskName )
 		{
-			BaseType_t xYieldOccurred;
+			size_t x;
 
-			/* Must not be called with the scheduler suspended as the implementation
-			 * relies on xPendedTicks being wound down to 0 in xTaskResumeAll(). */
-			configASSERT( uxSchedulerSuspended == 0 );
+			/* Start by copying the entire string. */
+			strcpy( pcBuffer, pcTaskName );
 
-			/* Use xPendedTicks to mimic xTicksToCatchUp number of ticks occurring when
-			 * the scheduler is suspended so the ticks are executed in xTaskResumeAll(). */
-			vTaskSuspendAll();
-			xPendedTicks += xTicksToCatchUp;
-			xYieldOccurred = xTaskResumeAll();
+			/* Pad the end of the string with spaces to ensure columns line up when
+			 * printed out. */
+			for( x = strlen( pcBuffer ); x < ( size_t ) ( configMAX_TASK_NAME_LEN - 1 ); x++ )
+			{
+				pcBuffer[ x ] = ' ';
+			}
 
-			return xYieldOccurred;
+			/* Terminate. */
+			pcBuffer[ x ] = ( char ) 0x00;
+
+			/* Return the new end of string. */
+			return &( pcBuffer[ x ] );
 		}
-		/*----------------------------------------------------------*/
 
-#if ( INCLUDE_xTaskAbortDelay == 1 )
+#endif /* ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) */
+		/*-----------------------------------------------------------*/
 
-		BaseType_t xTaskAbortDelay( TaskHandle_t xTask )
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+		void vTaskList( char * pcWriteBuffer )
 		{
-			TCB_t * pxTCB = xTask;
-			BaseType_t xReturn;
+			TaskStatus_t * pxTaskStatusArray;
+			UBaseType_t uxArraySize, x;
+			char cStatus;
 
-			configASSERT( pxTCB );
+			/*
+			 * PLEASE NOTE:
+			 *
+			 * This function is provided for convenience only, and is used by many
+			 * of the demo applications.  Do not consider it to be part of the
+			 * scheduler.
+			 *
+			 * vTaskList() calls uxTaskGetSystemState(), then formats part of the
+			 * uxTaskGetSystemState() output into a human readable table that
+			 * displays task: names, states, priority, stack usage and task number.
+			 * Stack usage specified as the number of unused StackType_t words stack can hold
+			 * on top of stack - not the number of bytes.
+			 *
+			 * vTaskList() has a dependency on the sprintf() C library function that
+			 * might bloat the code size, use a lot of stack, and provide different
+			 * results on different platforms.  An alternative, tiny, third party,
+			 * and limited functionality implementation of sprintf() is provided in
+			 * many of the FreeRTOS/Demo sub-directories in a file called
+			 * printf-stdarg.c (note printf-stdarg.c does not provide a full
+			 * snprintf() implementation!).
+			 *
+			 * It is recommended that production systems call uxTaskGetSystemState()
+			 * directly to get access to raw stats data, rather than indirectly
+			 * through a call to vTaskList().
+			 */
 
-			vTaskSuspendAll();
-			{
-				/* A task can only be prematurely removed from the Blocked state if
-				 * it is actually in the Blocked state. */
-				if( eTaskGetState( xTask ) == eBlocked )
-				{
-					xReturn = pdPASS;
 
-					/* Remove the reference to the task from the blocked list.  An
-					 * interrupt won't touch the xStateListItem because the
-					 * scheduler is suspended. */
-					( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+			/* Make sure the write buffer does not contain a string. */
+			*pcWriteBuffer = ( char ) 0x00;
 
-					/* Is the task waiting on an event also?  If so remove it from
-					 * the event list too.  Interrupts can touch the event list item,
-					 * even though the scheduler is suspended, so a critical section
-					 * is used. */
-					taskENTER_CRITICAL();
-					{
-						if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
-						{
-							( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+			/* Take a snapshot of the number of tasks in case it changes while this
+			 * function is executing. */
+			uxArraySize = uxCurrentNumberOfTasks;
 
-							/* This lets the task know it was forcibly removed from the
-							 * blocked state so it should not re-evaluate its block time and
-							 * then block again. */
-							pxTCB->ucDelayAborted = pdTRUE;
-						}
-						else
-						{
-							mtCOVERAGE_TEST_MARKER();
-						}
-					}
-					taskEXIT_CRITICAL();
+			/* Allocate an array index for each task.  NOTE!  if
+			 * configSUPPORT_DYNAMIC_ALLOCATION is set to 0 then pvPortMalloc() will
+			 * equate to NULL. */
+			pxTaskStatusArray = pvPortMalloc( uxCurrentNumberOfTasks * sizeof( TaskStatus_t ) ); /*lint !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack and this allocation allocates a struct that has the alignment requirements of a pointer. */
 
-					/* Place the unblocked task into the appropriate ready list. */
-					prvAddTaskToReadyList( pxTCB );
+			if( pxTaskStatusArray != NULL )
+			{
+				/* Generate the (binary) data. */
+				uxArraySize = uxTaskGetSystemState( pxTaskStatusArray, uxArraySize, NULL );
 
-					/* A task being unblocked cannot cause an immediate context
-					 * switch if preemption is turned off. */
-#if ( configUSE_PREEMPTION == 1 )
+				/* Create a human readable table from the binary data. */
+				for( x = 0; x < uxArraySize; x++ )
+				{
+					switch( pxTaskStatusArray[ x ].eCurrentState )
 					{
-						/* Preemption is on, but a context switch should only be
-						 * performed if the unblocked task has a priority that is
-						 * higher than the currently executing task. */
-						if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
-						{
-							/* Pend the yield to be performed when the scheduler
-							 * is unsuspended. */
-							xYieldPending = pdTRUE;
-						}
-						else
-						{
-							mtCOVERAGE_TEST_MARKER();
-						}
+					case eRunning:
+						cStatus = tskRUNNING_CHAR;
+						break;
+
+					case eReady:
+						cStatus = tskREADY_CHAR;
+						break;
+
+					case eBlocked:
+						cStatus = tskBLOCKED_CHAR;
+						break;
+
+					case eSuspended:
+						cStatus = tskSUSPENDED_CHAR;
+						break;
+
+					case eDeleted:
+						cStatus = tskDELETED_CHAR;
+						break;
+
+					case eInvalid: /* Fall through. */
+					default:       /* Should not get here, but it is included
+					 * to prevent static checking errors. */
+					 cStatus = ( char ) 0x00;
+					break;
 					}
-#endif /* configUSE_PREEMPTION */
-				}
-				else
-				{
-					xReturn = pdFAIL;
+
+					/* Write the task name to the string, padding with spaces so it
+					 * can be printed in tabular form more easily. */
+					pcWriteBuffer = prvWriteNameToBuffer( pcWriteBuffer, pxTaskStatusArray[ x ].pcTaskName );
+
+					/* Write the rest of the string. */
+					/* START of special for EDF */
+#if ( configUSE_EDF_SCHEDULER == 1 )
+					sprintf( pcWriteBuffer, "\t%c\t%u\t%u\t%u\t%lu\t%lu\t%lu\t%lu\r\n", cStatus, ( unsigned int ) pxTaskStatusArray[ x ].uxCurrentPriority, ( unsigned int ) pxTaskStatusArray[ x ].usStackHighWaterMark, ( unsigned int ) pxTaskStatusArray[ x ].xTaskNumber,
+							 ( unsigned long ) pxTaskStatusArray[ x ].xPeriod, ( unsigned long ) pxTaskStatusArray[ x ].xAbsoluteDeadline, ( unsigned long ) pxTaskStatusArray[ x ].ulJobCount, ( unsigned long ) pxTaskStatusArray[ x ].ulDeadlineMisses ); /*lint !e586 sprintf() allowed as this is compiled with many compilers and this is a utility function only - not part of the core kernel implementation. */
+#else
+					sprintf( pcWriteBuffer, "\t%c\t%u\t%u\t%u\r\n", cStatus, ( unsigned int ) pxTaskStatusArray[ x ].uxCurrentPriority, ( unsigned int ) pxTaskStatusArray[ x ].usStackHighWaterMark, ( unsigned int ) pxTaskStatusArray[ x ].xTaskNumber ); /*lint !e586 sprintf() allowed as this is compiled with many compilers and this is a utility function only - not part of the core kernel implementation. */
+#endif
+					/* END of special for EDF */
+					pcWriteBuffer += strlen( pcWriteBuffer );                                                                                                                                                                                                /*lint !e9016 Pointer arithmetic ok on char pointers especially as in this case where it best denotes the intent of the code. */
 				}
-			}
-			( void ) xTaskResumeAll();
 
-			return xReturn;
+				/* Free the array again.  NOTE!  If configSUPPORT_DYNAMIC_ALLOCATION
+				 * is 0 then vPortFree() will be #defined to nothing. */
+				vPortFree( pxTaskStatusArray );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
 
-#endif /* INCLUDE_xTaskAbortDelay */
+#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
 		/*----------------------------------------------------------*/
 
-		BaseType_t xTaskIncrementTick( void )
-		{
-			TCB_t * pxTCB;
-			TickType_t xItemValue;
-			BaseType_t xSwitchRequired = pdFALSE;
+#if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 
-			/* Called by the portable layer each time a tick interrupt occurs.
-			 * Increments the tick then checks to see if the new tick value will cause any
-			 * tasks to be unblocked. */
-			traceTASK_INCREMENT_TICK( xTickCount );
+		void vTaskGetRunTimeStats( char * pcWriteBuffer )
+		{
+			TaskStatus_t * pxTaskStatusArray;
+			UBaseType_t uxArraySize, x;
+			configRUN_TIME_COUNTER_TYPE ulTotalTime, ulStatsAsPercentage;
 
-			if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+#if ( configUSE_TRACE_FACILITY != 1 )
 			{
-				/* Minor optimisation.  The tick count cannot change in this
-				 * block. */
-				const TickType_t xConstTickCount = xTickCount + ( TickType_t ) 1;
+#error configUSE_TRACE_FACILITY must also be set to 1 in FreeRTOSConfig.h to use vTaskGetRunTimeStats().
+			}
+#endif
 
-				/* Increment the RTOS tick, switching the delayed and overflowed
-				 * delayed lists if it wraps to 0. */
-				xTickCount = xConstTickCount;
+			/*
+			 * PLEASE NOTE:
+			 *
+			 * This function is provided for convenience only, and is used by many
+			 * of the demo applications.  Do not consider it to be part of the
+			 * scheduler.
+			 *
+			 * vTaskGetRunTimeStats() calls uxTaskGetSystemState(), then formats part
+			 * of the uxTaskGetSystemState() output into a human readable table that
+			 * displays the amount of time each task has spent in the Running state
+			 * in both absolute and percentage terms.
+			 *
+			 * vTaskGetRunTimeStats() has a dependency on the sprintf() C library
+			 * function that might bloat the code size, use a lot of stack, and
+			 * provide different results on different platforms.  An alternative,
+			 * tiny, third party, and limited functionality implementation of
+			 * sprintf() is provided in many of the FreeRTOS/Demo sub-directories in
+			 * a file called printf-stdarg.c (note printf-stdarg.c does not provide
+			 * a full snprintf() implementation!).
+			 *
+			 * It is recommended that production systems call uxTaskGetSystemState()
+			 * directly to get access to raw stats data, rather than indirectly
+			 * through a call to vTaskGetRunTimeStats().
+			 */
 
-				if( xConstTickCount == ( TickType_t ) 0U ) /*lint !e774 'if' does not always evaluate to false as it is looking for an overflow. */
-				{
-					taskSWITCH_DELAYED_LISTS();
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
+			/* Make sure the write buffer does not contain a string. */
+			*pcWriteBuffer = ( char ) 0x00;
 
-				/* See if this tick has made a timeout expire.  Tasks are stored in
-				 * the  queue in the order of their wake time - meaning once one task
-				 * has been found whose block time has not expired there is no need to
-				 * look any further down the list. */
-				if( xConstTickCount >= xNextTaskUnblockTime )
+			/* Take a snapshot of the number of tasks in case it changes while this
+			 * function is executing. */
+			uxArraySize = uxCurrentNumberOfTasks;
+
+			/* Allocate an array index for each task.  NOTE!  If
+			 * configSUPPORT_DYNAMIC_ALLOCATION is set to 0 then pvPortMalloc() will
+			 * equate to NULL. */
+			pxTaskStatusArray = pvPortMalloc( uxCurrentNumberOfTasks * sizeof( TaskStatus_t ) ); /*lint !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack and this allocation allocates a struct that has the alignment requirements of a pointer. */
+
+			if( pxTaskStatusArray != NULL )
+			{
+				/* Generate the (binary) data. */
+				uxArraySize = uxTaskGetSystemState( pxTaskStatusArray, uxArraySize, &ulTotalTime );
+
+				/* For percentage calculations. */
+				ulTotalTime /= 100UL;
+
+				/* Avoid divide by zero errors. */
+				if( ulTotalTime > 0UL )
 				{
-					for( ; ; )
+					/* Create a human readable table from the binary data. */
+					for( x = 0; x < uxArraySize; x++ )
 					{
-						if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
-						{
-							/* The delayed list is empty.  Set xNextTaskUnblockTime
-							 * to the maximum possible value so it is extremely
-							 * unlikely that the
-							 * if( xTickCount >= xNextTaskUnblockTime ) test will pass
-							 * next time through. */
-							xNextTaskUnblockTime = portMAX_DELAY; /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-							break;
-						}
-						else
-						{
-							/* The delayed list is not empty, get the value of the
-							 * item at the head of the delayed list.  This is the time
-							 * at which the task at the head of the delayed list must
-							 * be removed from the Blocked state. */
-							pxTCB = listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-							xItemValue = listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) );
-
-							if( xConstTickCount < xItemValue )
-							{
-								/* It is not time to unblock this item yet, but the
-								 * item value is the time at which the task at the head
-								 * of the blocked list must be removed from the Blocked
-								 * state -  so record the item value in
-								 * xNextTaskUnblockTime. */
-								xNextTaskUnblockTime = xItemValue;
-								break; /*lint !e9011 Code structure here is deemed easier to understand with multiple breaks. */
-							}
-							else
-							{
-								mtCOVERAGE_TEST_MARKER();
-							}
+						/* What percentage of the total run time has the task used?
+						 * This will always be rounded down to the nearest integer.
+						 * ulTotalRunTime has already been divided by 100. */
+						ulStatsAsPercentage = pxTaskStatusArray[ x ].ulRunTimeCounter / ulTotalTime;
 
-							/* It is time to remove the item from the Blocked state. */
-							listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+						/* Write the task name to the string, padding with
+						 * spaces so it can be printed in tabular form more
+						 * easily. */
+						pcWriteBuffer = prvWriteNameToBuffer( pcWriteBuffer, pxTaskStatusArray[ x ].pcTaskName );
 
-							/* Is the task waiting on an event also?  If so remove
-							 * it from the event list. */
-							if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
-							{
-								listREMOVE_ITEM( &( pxTCB->xEventListItem ) );
-							}
-							else
+						if( ulStatsAsPercentage > 0UL )
+						{
+#ifdef portLU_PRINTF_SPECIFIER_REQUIRED
 							{
-								mtCOVERAGE_TEST_MARKER();
+								sprintf( pcWriteBuffer, "\t%lu\t\t%lu%%\r\n", pxTaskStatusArray[ x ].ulRunTimeCounter, ulStatsAsPercentage );
 							}
-
-							/* START of special for EDF */
-#if ( configUSE_EDF_SCHEDULER == 1)
+#else
 							{
-								listSET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ), ( ( pxTCB )->xTaskPeriod )+ xTickCount );
+								/* sizeof( int ) == sizeof( long ) so a smaller
+								 * printf() library can be used. */
+								sprintf( pcWriteBuffer, "\t%u\t\t%u%%\r\n", ( unsigned int ) pxTaskStatusArray[ x ].ulRunTimeCounter, ( unsigned int ) ulStatsAsPercentage ); /*lint !e586 sprintf() allowed as this is compiled with many compilers and this is a utility function only - not part of the core kernel implementation. */
 							}
 #endif
-							/* END of special for EDF */
-
-							/* Place the unblocked task into the appropriate ready
-							 * list. */
-							prvAddTaskToReadyList( pxTCB );
-
-							/* A task being unblocked cannot cause an immediate
-							 * context switch if preemption is turned off. */
-#if ( configUSE_PREEMPTION == 1 )
+						}
+						else
+						{
+							/* If the percentage is zero here then the task has
+							 * consumed less than 1% of the total run time. */
+#ifdef portLU_PRINTF_SPECIFIER_REQUIRED
 							{
-								/* START of special for EDF */
-#if ( configUSE_EDF_SCHEDULER == 1 )
-								{
-									if( pxTCB->xStateListItem.xItemValue <= pxCurrentTCB->xStateListItem.xItemValue )
-									{
-										xSwitchRequired = pdTRUE;
-									}
-									else
-									{
-										mtCOVERAGE_TEST_MARKER();
-									}
-								}
-								/* END of special for EDF */
+								sprintf( pcWriteBuffer, "\t%lu\t\t<1%%\r\n", pxTaskStatusArray[ x ].ulRunTimeCounter );
+							}
 #else
-								{
-									/* Preemption is on, but a context switch should
-									 * only be performed if the unblocked task has a
-									 * priority that is equal to or higher than the
-									 * currently executing task. */
-									if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
-									{
-										xSwitchRequired = pdTRUE;
-									}
-									else
-									{
-										mtCOVERAGE_TEST_MARKER();
-									}
-								}
-#endif
-
+							{
+								/* sizeof( int ) == sizeof( long ) so a smaller
+								 * printf() library can be used. */
+								sprintf( pcWriteBuffer, "\t%u\t\t<1%%\r\n", ( unsigned int ) pxTaskStatusArray[ x ].ulRunTimeCounter ); /*lint !e586 sprintf() allowed as this is compiled with many compilers and this is a utility function only - not part of the core kernel implementation. */
 							}
-#endif /* configUSE_PREEMPTION */
-						}
-					}
-				}
-
-				/* Tasks of equal priority to the currently running task will share
-				 * processing time (time slice) if preemption is on, and the application
-				 * writer has not explicitly turned time slicing off. */
-#if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
-				{
-					if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 )
-					{
-						xSwitchRequired = pdTRUE;
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
-				}
-#endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) ) */
+#endif
+						}
 
-#if ( configUSE_TICK_HOOK == 1 )
-				{
-					/* Guard against the tick hook being called when the pended tick
-					 * count is being unwound (when the scheduler is being unlocked). */
-					if( xPendedTicks == ( TickType_t ) 0 )
-					{
-						vApplicationTickHook();
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
+						pcWriteBuffer += strlen( pcWriteBuffer ); /*lint !e9016 Pointer arithmetic ok on char pointers especially as in this case where it best denotes the intent of the code. */
 					}
 				}
-#endif /* configUSE_TICK_HOOK */
-
-#if ( configUSE_PREEMPTION == 1 )
+				else
 				{
-					if( xYieldPending != pdFALSE )
-					{
-						xSwitchRequired = pdTRUE;
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+					mtCOVERAGE_TEST_MARKER();
 				}
-#endif /* configUSE_PREEMPTION */
+
+				/* Free the array again.  NOTE!  If configSUPPORT_DYNAMIC_ALLOCATION
+				 * is 0 then vPortFree() will be #defined to nothing. */
+				vPortFree( pxTaskStatusArray );
 			}
 			else
 			{
-				++xPendedTicks;
-
-				/* The tick hook gets called at regular intervals, even if the
-				 * scheduler is locked. */
-#if ( configUSE_TICK_HOOK == 1 )
-				{
-					vApplicationTickHook();
-				}
-#endif
+				mtCOVERAGE_TEST_MARKER();
 			}
-
-			return xSwitchRequired;
 		}
-		/*-----------------------------------------------------------*/
 
-#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+#endif /* ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) ) */
+		/*-----------------------------------------------------------*/
 
-		void vTaskSetApplicationTaskTag( TaskHandle_t xTask,
-				TaskHookFunction_t pxHookFunction )
+		TickType_t uxTaskResetEventItemValue( void )
 		{
-			TCB_t * xTCB;
+			TickType_t uxReturn;
 
-			/* If xTask is NULL then it is the task hook of the calling task that is
-			 * getting set. */
-			if( xTask == NULL )
-			{
-				xTCB = ( TCB_t * ) pxCurrentTCB;
-			}
-			else
-			{
-				xTCB = xTask;
-			}
+			uxReturn = listGET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ) );
 
-			/* Save the hook function in the TCB.  A critical section is required as
-			 * the value can be accessed from an interrupt. */
-			taskENTER_CRITICAL();
-			{
-				xTCB->pxTaskTag = pxHookFunction;
-			}
-			taskEXIT_CRITICAL();
-		}
+			/* Reset the event list item to its normal value - so it can be used with
+			 * queues and semaphores. */
+			listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxCurrentTCB->uxPriority ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
 
-#endif /* configUSE_APPLICATION_TASK_TAG */
+			return uxReturn;
+		}
 		/*-----------------------------------------------------------*/
 
-#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+#if ( configUSE_MUTEXES == 1 )
 
-		TaskHookFunction_t xTaskGetApplicationTaskTag( TaskHandle_t xTask )
+		TaskHandle_t pvTaskIncrementMutexHeldCount( void )
 		{
-			TCB_t * pxTCB;
-			TaskHookFunction_t xReturn;
-
-			/* If xTask is NULL then set the calling task's hook. */
-			pxTCB = prvGetTCBFromHandle( xTask );
-
-			/* Save the hook function in the TCB.  A critical section is required as
-			 * the value can be accessed from an interrupt. */
-			taskENTER_CRITICAL();
+			/* If xSemaphoreCreateMutex() is called before any tasks have been created
+			 * then pxCurrentTCB will be NULL. */
+			if( pxCurrentTCB != NULL )
 			{
-				xReturn = pxTCB->pxTaskTag;
+				( pxCurrentTCB->uxMutexesHeld )++;
 			}
-			taskEXIT_CRITICAL();
 
-			return xReturn;
+			return pxCurrentTCB;
 		}
 
-#endif /* configUSE_APPLICATION_TASK_TAG */
+#endif /* configUSE_MUTEXES */
 		/*-----------------------------------------------------------*/
 
-#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
 
-		TaskHookFunction_t xTaskGetApplicationTaskTagFromISR( TaskHandle_t xTask )
+		uint32_t ulTaskGenericNotifyTake( UBaseType_t uxIndexToWait,
+				BaseType_t xClearCountOnExit,
+				TickType_t xTicksToWait )
 		{
-			TCB_t * pxTCB;
-			TaskHookFunction_t xReturn;
-			UBaseType_t uxSavedInterruptStatus;
+			uint32_t ulReturn;
 
-			/* If xTask is NULL then set the calling task's hook. */
-			pxTCB = prvGetTCBFromHandle( xTask );
+			configASSERT( uxIndexToWait < configTASK_NOTIFICATION_ARRAY_ENTRIES );
 
-			/* Save the hook function in the TCB.  A critical section is required as
-			 * the value can be accessed from an interrupt. */
-			uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+			taskENTER_CRITICAL();
 			{
-				xReturn = pxTCB->pxTaskTag;
-			}
-			portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
-
-			return xReturn;
-		}
-
-#endif /* configUSE_APPLICATION_TASK_TAG */
-		/*-----------------------------------------------------------*/
+				/* START of special for EDF */
+#if ( configUSE_EDF_SCHEDULER == 1 )
+				/* Waiting for the notification that releases the jobs of the
+				 * task ends the current one. */
+				if( pxCurrentTCB->uxTaskReleaseNotifyIndex == uxIndexToWait )
+				{
+					taskEDF_JOB_COMPLETE( pxCurrentTCB );
+				}
+#endif
+				/* END of special for EDF */
 
-#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+				/* Only block if the notification count is not already non-zero. */
+				if( pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ] == 0UL )
+				{
+					/* Mark this task as waiting for a notification. */
+					pxCurrentTCB->ucNotifyState[ uxIndexToWait ] = taskWAITING_NOTIFICATION;
 
-		BaseType_t xTaskCallApplicationTaskHook( TaskHandle_t xTask,
-				void * pvParameter )
-		{
-			TCB_t * xTCB;
-			BaseType_t xReturn;
+					if( xTicksToWait > ( TickType_t ) 0 )
+					{
+						prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
+						traceTASK_NOTIFY_TAKE_BLOCK( uxIndexToWait );
 
-			/* If xTask is NULL then we are calling our own task hook. */
-			if( xTask == NULL )
-			{
-				xTCB = pxCurrentTCB;
-			}
-			else
-			{
-				xTCB = xTask;
+						/* All ports are written to allow a yield in a critical
+						 * section (some will yield immediately, others wait until the
+						 * critical section exits) - but it is not something that
+						 * application code should ever do. */
+						portYIELD_WITHIN_API();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					/* START of special for EDF */
+#if ( configUSE_EDF_SCHEDULER == 1 )
+					prvEDFNotifyReleasePending( uxIndexToWait );
+#else
+					mtCOVERAGE_TEST_MARKER();
+#endif
+					/* END of special for EDF */
+				}
 			}
+			taskEXIT_CRITICAL();
 
-			if( xTCB->pxTaskTag != NULL )
-			{
-				xReturn = xTCB->pxTaskTag( pvParameter );
-			}
-			else
+			taskENTER_CRITICAL();
 			{
-				xReturn = pdFAIL;
+				traceTASK_NOTIFY_TAKE( uxIndexToWait );
+				ulReturn = pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ];
+
+				if( ulReturn != 0UL )
+				{
+					if( xClearCountOnExit != pdFALSE )
+					{
+						pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ] = 0UL;
+					}
+					else
+					{
+						pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ] = ulReturn - ( uint32_t ) 1;
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				pxCurrentTCB->ucNotifyState[ uxIndexToWait ] = taskNOT_WAITING_NOTIFICATION;
 			}
+			taskEXIT_CRITICAL();
 
-			return xReturn;
+			return ulReturn;
 		}
 
-#endif /* configUSE_APPLICATION_TASK_TAG */
+#endif /* configUSE_TASK_NOTIFICATIONS */
 		/*-----------------------------------------------------------*/
 
-		void vTaskSwitchContext( void )
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+
+		BaseType_t xTaskGenericNotifyWait( UBaseType_t uxIndexToWait,
+				uint32_t ulBitsToClearOnEntry,
+				uint32_t ulBitsToClearOnExit,
+				uint32_t * pulNotificationValue,
+				TickType_t xTicksToWait )
 		{
-			if( uxSchedulerSuspended != ( UBaseType_t ) pdFALSE )
-			{
-				/* The scheduler is currently suspended - do not allow a context
-				 * switch. */
-				xYieldPending = pdTRUE;
-			}
-			else
-			{
-				xYieldPending = pdFALSE;
-				traceTASK_SWITCHED_OUT();
+			BaseType_t xReturn;
 
-#if ( configGENERATE_RUN_TIME_STATS == 1 )
+			configASSERT( uxIndexToWait < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+
+			taskENTER_CRITICAL();
+			{
+				/* START of special for EDF */
+#if ( configUSE_EDF_SCHEDULER == 1 )
+				if( pxCurrentTCB->uxTaskReleaseNotifyIndex == uxIndexToWait )
 				{
-#ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
-					portALT_GET_RUN_TIME_COUNTER_VALUE( ulTotalRunTime );
-#else
-					ulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
+					taskEDF_JOB_COMPLETE( pxCurrentTCB );
+				}
 #endif
+				/* END of special for EDF */
 
-					/* Add the amount of time the task has been running to the
-					 * accumulated time so far.  The time the task started running was
-					 * stored in ulTaskSwitchedInTime.  Note that there is no overflow
-					 * protection here so count values are only valid until the timer
-					 * overflows.  The guard against negative values is to protect
-					 * against suspect run time stat counter implementations - which
-					 * are provided by the application, not the kernel. */
-					if( ulTotalRunTime > ulTaskSwitchedInTime )
+				/* Only block if a notification is not already pending. */
+				if( pxCurrentTCB->ucNotifyState[ uxIndexToWait ] != taskNOTIFICATION_RECEIVED )
+				{
+					/* Clear bits in the task's notification value as bits may get
+					 * set  by the notifying task or interrupt.  This can be used to
+					 * clear the value to zero. */
+					pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ] &= ~ulBitsToClearOnEntry;
+
+					/* Mark this task as waiting for a notification. */
+					pxCurrentTCB->ucNotifyState[ uxIndexToWait ] = taskWAITING_NOTIFICATION;
+
+					if( xTicksToWait > ( TickType_t ) 0 )
 					{
-						pxCurrentTCB->ulRunTimeCounter += ( ulTotalRunTime - ulTaskSwitchedInTime );
+						prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
+						traceTASK_NOTIFY_WAIT_BLOCK( uxIndexToWait );
+
+						/* All ports are written to allow a yield in a critical
+						 * section (some will yield immediately, others wait until the
+						 * critical section exits) - but it is not something that
+						 * application code should ever do. */
+						portYIELD_WITHIN_API();
 					}
 					else
 					{
 						mtCOVERAGE_TEST_MARKER();
 					}
-
-					ulTaskSwitchedInTime = ulTotalRunTime;
 				}
-#endif /* configGENERATE_RUN_TIME_STATS */
-
-				/* Check for stack overflow, if configured. */
-				taskCHECK_FOR_STACK_OVERFLOW();
-
-				/* Before the currently running task is switched out, save its errno. */
-#if ( configUSE_POSIX_ERRNO == 1 )
+				else
 				{
-					pxCurrentTCB->iTaskErrno = FreeRTOS_errno;
-				}
+					/* START of special for EDF */
+#if ( configUSE_EDF_SCHEDULER == 1 )
+					prvEDFNotifyReleasePending( uxIndexToWait );
+#else
+					mtCOVERAGE_TEST_MARKER();
 #endif
+					/* END of special for EDF */
+				}
+			}
+			taskEXIT_CRITICAL();
 
-				/* Select a new task to run using either the generic C or port
-				 * optimised asm code. */
+			taskENTER_CRITICAL();
+			{
+				traceTASK_NOTIFY_WAIT( uxIndexToWait );
 
-				/* START of special for EDF */
-#if (configUSE_EDF_SCHEDULER == 0)
-				{
-					taskSELECT_HIGHEST_PRIORITY_TASK(); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-				}
-#else
+				if( pulNotificationValue != NULL )
 				{
-					pxCurrentTCB = (TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( &( xReadyTasksListEDF ) );
+					/* Output the current notification value, which may or may not
+					 * have changed. */
+					*pulNotificationValue = pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ];
 				}
-#endif
-				/* END of special for EDF */
-
-				traceTASK_SWITCHED_IN();
 
-				/* After the new task is switched in, update the global errno. */
-#if ( configUSE_POSIX_ERRNO == 1 )
+				/* If ucNotifyValue is set then either the task never entered the
+				 * blocked state (because a notification was already pending) or the
+				 * task unblocked because of a notification.  Otherwise the task
+				 * unblocked because of a timeout. */
+				if( pxCurrentTCB->ucNotifyState[ uxIndexToWait ] != taskNOTIFICATION_RECEIVED )
 				{
-					FreeRTOS_errno = pxCurrentTCB->iTaskErrno;
+					/* A notification was not received. */
+					xReturn = pdFALSE;
 				}
-#endif
-
-#if ( configUSE_NEWLIB_REENTRANT == 1 )
+				else
 				{
-					/* Switch Newlib's _impure_ptr variable to point to the _reent
-					 * structure specific to this task.
-					 * See the third party link http://www.nadler.com/embedded/newlibAndFreeRTOS.html
-					 * for additional information. */
-					_impure_ptr = &( pxCurrentTCB->xNewLib_reent );
+					/* A notification was already pending or a notification was
+					 * received while the task was waiting. */
+					pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ] &= ~ulBitsToClearOnExit;
+					xReturn = pdTRUE;
 				}
-#endif /* configUSE_NEWLIB_REENTRANT */
+
+				pxCurrentTCB->ucNotifyState[ uxIndexToWait ] = taskNOT_WAITING_NOTIFICATION;
 			}
+			taskEXIT_CRITICAL();
+
+			return xReturn;
 		}
-		/*-----------------------------------------------------------*/
 
-		void vTaskPlaceOnEventList( List_t * const pxEventList,
-				const TickType_t xTicksToWait )
-		{
-			configASSERT( pxEventList );
+#endif /* configUSE_TASK_NOTIFICATIONS */
+		/*-----------------------------------------------------------*/
 
-			/* THIS FUNCTION MUST BE CALLED WITH EITHER INTERRUPTS DISABLED OR THE
-			 * SCHEDULER SUSPENDED AND THE QUEUE BEING ACCESSED LOCKED. */
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
 
-			/* Place the event list item of the TCB in the appropriate event list.
-			 * This is placed in the list in priority order so the highest priority task
-			 * is the first to be woken by the event.
-			 *
-			 * Note: Lists are sorted in ascending order by ListItem_t.xItemValue.
-			 * Normally, the xItemValue of a TCB's ListItem_t members is:
-			 *      xItemValue = ( configMAX_PRIORITIES - uxPriority )
-			 * Therefore, the event list is sorted in descending priority order.
-			 *
-			 * The queue that contains the event list is locked, preventing
-			 * simultaneous access from interrupts. */
-			vListInsert( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+		BaseType_t xTaskGenericNotify( TaskHandle_t xTaskToNotify,
+				UBaseType_t uxIndexToNotify,
+				uint32_t ulValue,
+				eNotifyAction eAction,
+				uint32_t * pulPreviousNotificationValue )
+		{
+			TCB_t * pxTCB;
+			BaseType_t xReturn = pdPASS;
+			uint8_t ucOriginalNotifyState;
 
-			prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
-		}
-		/*-----------------------------------------------------------*/
+			configASSERT( uxIndexToNotify < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+			configASSERT( xTaskToNotify );
+			pxTCB = xTaskToNotify;
 
-		void vTaskPlaceOnUnorderedEventList( List_t * pxEventList,
-				const TickType_t xItemValue,
-				const TickType_t xTicksToWait )
-		{
-			configASSERT( pxEventList );
+			taskENTER_CRITICAL();
+			{
+				if( pulPreviousNotificationValue != NULL )
+				{
+					*pulPreviousNotificationValue = pxTCB->ulNotifiedValue[ uxIndexToNotify ];
+				}
 
-			/* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.  It is used by
-			 * the event groups implementation. */
-			configASSERT( uxSchedulerSuspended != 0 );
+				ucOriginalNotifyState = pxTCB->ucNotifyState[ uxIndexToNotify ];
 
-			/* Store the item value in the event list item.  It is safe to access the
-			 * event list item here as interrupts won't access the event list item of a
-			 * task that is not in the Blocked state. */
-			listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+				pxTCB->ucNotifyState[ uxIndexToNotify ] = taskNOTIFICATION_RECEIVED;
 
-			/* Place the event list item of the TCB at the end of the appropriate event
-			 * list.  It is safe to access the event list here because it is part of an
-			 * event group implementation - and interrupts don't access event groups
-			 * directly (instead they access them indirectly by pending function calls to
-			 * the task level). */
-			listINSERT_END( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+				switch( eAction )
+				{
+				case eSetBits:
+					pxTCB->ulNotifiedValue[ uxIndexToNotify ] |= ulValue;
+					break;
 
-			prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
-		}
-		/*-----------------------------------------------------------*/
+				case eIncrement:
+					( pxTCB->ulNotifiedValue[ uxIndexToNotify ] )++;
+					break;
 
-#if ( configUSE_TIMERS == 1 )
+				case eSetValueWithOverwrite:
+					pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
+					break;
 
-		void vTaskPlaceOnEventListRestricted( List_t * const pxEventList,
-				TickType_t xTicksToWait,
-				const BaseType_t xWaitIndefinitely )
-		{
-			configASSERT( pxEventList );
+				case eSetValueWithoutOverwrite:
 
-			/* This function should not be called by application code hence the
-			 * 'Restricted' in its name.  It is not part of the public API.  It is
-			 * designed for use by kernel code, and has special calling requirements -
-			 * it should be called with the scheduler suspended. */
+					if( ucOriginalNotifyState != taskNOTIFICATION_RECEIVED )
+					{
+						pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
+					}
+					else
+					{
+						/* The value could not be written to the task. */
+						xReturn = pdFAIL;
+					}
 
+					break;
 
-			/* Place the event list item of the TCB in the appropriate event list.
-			 * In this case it is assume that this is the only task that is going to
-			 * be waiting on this event list, so the faster vListInsertEnd() function
-			 * can be used in place of vListInsert. */
-			listINSERT_END( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+				case eNoAction:
 
-			/* If the task should block indefinitely then set the block time to a
-			 * value that will be recognised as an indefinite delay inside the
-			 * prvAddCurrentTaskToDelayedList() function. */
-			if( xWaitIndefinitely != pdFALSE )
-			{
-				xTicksToWait = portMAX_DELAY;
-			}
+					/* The task is being notified without its notify value being
+					 * updated. */
+					 break;
 
-			traceTASK_DELAY_UNTIL( ( xTickCount + xTicksToWait ) );
-			prvAddCurrentTaskToDelayedList( xTicksToWait, xWaitIndefinitely );
-		}
+				default:
 
-#endif /* configUSE_TIMERS */
-		/*-----------------------------------------------------------*/
+					/* Should not get here if all enums are handled.
+					 * Artificially force an assert by testing a value the
+					 * compiler can't assume is const. */
+					configASSERT( xTickCount == ( TickType_t ) 0 );
 
-		BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList )
-		{
-			TCB_t * pxUnblockedTCB;
-			BaseType_t xReturn;
+					break;
+				}
 
-			/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.  It can also be
-			 * called from a critical section within an ISR. */
+				traceTASK_NOTIFY( uxIndexToNotify );
 
-			/* The event list is sorted in priority order, so the first in the list can
-			 * be removed as it is known to be the highest priority.  Remove the TCB from
-			 * the delayed list, and add it to the ready list.
-			 *
-			 * If an event is for a queue that is locked then this function will never
-			 * get called - the lock count on the queue will get modified instead.  This
-			 * means exclusive access to the event list is guaranteed here.
-			 *
-			 * This function assumes that a check has already been made to ensure that
-			 * pxEventList is not empty. */
-			pxUnblockedTCB = listGET_OWNER_OF_HEAD_ENTRY( pxEventList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-			configASSERT( pxUnblockedTCB );
-			listREMOVE_ITEM( &( pxUnblockedTCB->xEventListItem ) );
+				/* If the task is in the blocked state specifically to wait for a
+				 * notification then unblock it now. */
+				if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
+				{
+					/* START of special for EDF */
+					taskEDF_LOCK_PARTITIONS_OF( pxTCB );
+					/* END of special for EDF */
+					listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+					/* START of special for EDF */
+					taskEDF_NOTIFY_RELEASE( pxTCB, uxIndexToNotify );
+					/* END of special for EDF */
+					prvAddTaskToReadyList( pxTCB );
 
-			if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
-			{
-				listREMOVE_ITEM( &( pxUnblockedTCB->xStateListItem ) );
-				prvAddTaskToReadyList( pxUnblockedTCB );
+					/* The task should not have been on an event list. */
+					configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
 
 #if ( configUSE_TICKLESS_IDLE != 0 )
-				{
-					/* If a task is blocked on a kernel object then xNextTaskUnblockTime
-					 * might be set to the blocked task's time out time.  If the task is
-					 * unblocked for a reason other than a timeout xNextTaskUnblockTime is
-					 * normally left unchanged, because it is automatically reset to a new
-					 * value when the tick count equals xNextTaskUnblockTime.  However if
-					 * tickless idling is used it might be more important to enter sleep mode
-					 * at the earliest possible time - so reset xNextTaskUnblockTime here to
-					 * ensure it is updated at the earliest possible time. */
-					prvResetNextTaskUnblockTime();
-				}
+					{
+						/* If a task is blocked waiting for a notification then
+						 * xNextTaskUnblockTime might be set to the blocked task's time
+						 * out time.  If the task is unblocked for a reason other than
+						 * a timeout xNextTaskUnblockTime is normally left unchanged,
+						 * because it will automatically get reset to a new value when
+						 * the tick count equals xNextTaskUnblockTime.  However if
+						 * tickless idling is used it might be more important to enter
+						 * sleep mode at the earliest possible time - so reset
+						 * xNextTaskUnblockTime here to ensure it is updated at the
+						 * earliest possible time. */
+						prvResetNextTaskUnblockTime();
+					}
 #endif
-			}
-			else
-			{
-				/* The delayed and ready lists cannot be accessed, so hold this task
-				 * pending until the scheduler is resumed. */
-				listINSERT_END( &( xPendingReadyList ), &( pxUnblockedTCB->xEventListItem ) );
-			}
 
-			if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
-			{
-				/* Return true if the task removed from the event list has a higher
-				 * priority than the calling task.  This allows the calling task to know if
-				 * it should force a context switch now. */
-				xReturn = pdTRUE;
+					/* START of special for EDF */
+					if( taskEDF_WOKEN_TASK_PREEMPTS( pxTCB ) )
+					/* END of special for EDF */
+					{
+						/* The notified task has a priority above the currently
+						 * executing task so a yield is required. */
+						taskYIELD_IF_USING_PREEMPTION();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
 
-				/* Mark that a yield is pending in case the user is not using the
-				 * "xHigherPriorityTaskWoken" parameter to an ISR safe FreeRTOS function. */
-				xYieldPending = pdTRUE;
-			}
-			else
-			{
-				xReturn = pdFALSE;
+					/* START of special for EDF */
+					taskEDF_UNLOCK_PARTITIONS_OF( pxTCB );
+					/* END of special for EDF */
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 			}
+			taskEXIT_CRITICAL();
 
 			return xReturn;
 		}
+
+#endif /* configUSE_TASK_NOTIFICATIONS */
 		/*-----------------------------------------------------------*/
 
-		void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
-				const TickType_t xItemValue )
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+
+		BaseType_t xTaskGenericNotifyFromISR( TaskHandle_t xTaskToNotify,
+				UBaseType_t uxIndexToNotify,
+				uint32_t ulValue,
+				eNotifyAction eAction,
+				uint32_t * pulPreviousNotificationValue,
+				BaseType_t * pxHigherPriorityTaskWoken )
 		{
-			TCB_t * pxUnblockedTCB;
+			TCB_t * pxTCB;
+			uint8_t ucOriginalNotifyState;
+			BaseType_t xReturn = pdPASS;
+			UBaseType_t uxSavedInterruptStatus;
 
-			/* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.  It is used by
-			 * the event flags implementation. */
-			configASSERT( uxSchedulerSuspended != pdFALSE );
+			configASSERT( xTaskToNotify );
+			configASSERT( uxIndexToNotify < configTASK_NOTIFICATION_ARRAY_ENTRIES );
 
-			/* Store the new item value in the event list. */
-			listSET_LIST_ITEM_VALUE( pxEventListItem, xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+			/* RTOS ports that support interrupt nesting have the concept of a
+			 * maximum  system call (or maximum API call) interrupt priority.
+			 * Interrupts that are  above the maximum system call priority are keep
+			 * permanently enabled, even when the RTOS kernel is in a critical section,
+			 * but cannot make any calls to FreeRTOS API functions.  If configASSERT()
+			 * is defined in FreeRTOSConfig.h then
+			 * portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+			 * failure if a FreeRTOS API function is called from an interrupt that has
+			 * been assigned a priority above the configured maximum system call
+			 * priority.  Only FreeRTOS functions that end in FromISR can be called
+			 * from interrupts  that have been assigned a priority at or (logically)
+			 * below the maximum system call interrupt priority.  FreeRTOS maintains a
+			 * separate interrupt safe API to ensure interrupt entry is as fast and as
+			 * simple as possible.  More information (albeit Cortex-M specific) is
+			 * provided on the following link:
+			 * https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
+			portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
 
-			/* Remove the event list form the event flag.  Interrupts do not access
-			 * event flags. */
-			pxUnblockedTCB = listGET_LIST_ITEM_OWNER( pxEventListItem ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-			configASSERT( pxUnblockedTCB );
-			listREMOVE_ITEM( pxEventListItem );
+			pxTCB = xTaskToNotify;
 
-#if ( configUSE_TICKLESS_IDLE != 0 )
+			/* START of special for EDF */
+			uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+			/* END of special for EDF */
 			{
-				/* If a task is blocked on a kernel object then xNextTaskUnblockTime
-				 * might be set to the blocked task's time out time.  If the task is
-				 * unblocked for a reason other than a timeout xNextTaskUnblockTime is
-				 * normally left unchanged, because it is automatically reset to a new
-				 * value when the tick count equals xNextTaskUnblockTime.  However if
-				 * tickless idling is used it might be more important to enter sleep mode
-				 * at the earliest possible time - so reset xNextTaskUnblockTime here to
-				 * ensure it is updated at the earliest possible time. */
-				prvResetNextTaskUnblockTime();
-			}
-#endif
+				if( pulPreviousNotificationValue != NULL )
+				{
+					*pulPreviousNotificationValue = pxTCB->ulNotifiedValue[ uxIndexToNotify ];
+				}
 
-			/* Remove the task from the delayed list and add it to the ready list.  The
-			 * scheduler is suspended so interrupts will not be accessing the ready
-			 * lists. */
-			listREMOVE_ITEM( &( pxUnblockedTCB->xStateListItem ) );
-			prvAddTaskToReadyList( pxUnblockedTCB );
+				ucOriginalNotifyState = pxTCB->ucNotifyState[ uxIndexToNotify ];
+				pxTCB->ucNotifyState[ uxIndexToNotify ] = taskNOTIFICATION_RECEIVED;
 
-			if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
-			{
-				/* The unblocked task has a priority above that of the calling task, so
-				 * a context switch is required.  This function is called with the
-				 * scheduler suspended so xYieldPending is set so the context switch
-				 * occurs immediately that the scheduler is resumed (unsuspended). */
-				xYieldPending = pdTRUE;
-			}
-		}
-		/*-----------------------------------------------------------*/
+				switch( eAction )
+				{
+				case eSetBits:
+					pxTCB->ulNotifiedValue[ uxIndexToNotify ] |= ulValue;
+					break;
 
-		void vTaskSetTimeOutState( TimeOut_t * const pxTimeOut )
-		{
-			configASSERT( pxTimeOut );
-			taskENTER_CRITICAL();
-			{
-				pxTimeOut->xOverflowCount = xNumOfOverflows;
-				pxTimeOut->xTimeOnEntering = xTickCount;
-			}
-			taskEXIT_CRITICAL();
-		}
-		/*-----------------------------------------------------------*/
+				case eIncrement:
+					( pxTCB->ulNotifiedValue[ uxIndexToNotify ] )++;
+					break;
 
-		void vTaskInternalSetTimeOutState( TimeOut_t * const pxTimeOut )
-		{
-			/* For internal use only as it does not use a critical section. */
-			pxTimeOut->xOverflowCount = xNumOfOverflows;
-			pxTimeOut->xTimeOnEntering = xTickCount;
-		}
-		/*-----------------------------------------------------------*/
+				case eSetValueWithOverwrite:
+					pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
+					break;
 
-		BaseType_t xTaskCheckForTimeOut( TimeOut_t * const pxTimeOut,
-				TickType_t * const pxTicksToWait )
-		{
-			BaseType_t xReturn;
+				case eSetValueWithoutOverwrite:
 
-			configASSERT( pxTimeOut );
-			configASSERT( pxTicksToWait );
+					if( ucOriginalNotifyState != taskNOTIFICATION_RECEIVED )
+					{
+						pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
+					}
+					else
+					{
+						/* The value could not be written to the task. */
+						xReturn = pdFAIL;
+					}
 
-			taskENTER_CRITICAL();
-			{
-				/* Minor optimisation.  The tick count cannot change in this block. */
-				const TickType_t xConstTickCount = xTickCount;
-				const TickType_t xElapsedTime = xConstTickCount - pxTimeOut->xTimeOnEntering;
+					break;
 
-#if ( INCLUDE_xTaskAbortDelay == 1 )
-				if( pxCurrentTCB->ucDelayAborted != ( uint8_t ) pdFALSE )
-				{
-					/* The delay was aborted, which is not the same as a time out,
-					 * but has the same result. */
-					pxCurrentTCB->ucDelayAborted = pdFALSE;
-					xReturn = pdTRUE;
+				case eNoAction:
+
+					/* The task is being notified without its notify value being
+					 * updated. */
+					 break;
+
+				default:
+
+					/* Should not get here if all enums are handled.
+					 * Artificially force an assert by testing a value the
+					 * compiler can't assume is const. */
+					configASSERT( xTickCount == ( TickType_t ) 0 );
+					break;
 				}
-				else
-#endif
 
-#if ( INCLUDE_vTaskSuspend == 1 )
-					if( *pxTicksToWait == portMAX_DELAY )
+				traceTASK_NOTIFY_FROM_ISR( uxIndexToNotify );
+
+				/* If the task is in the blocked state specifically to wait for a
+				 * notification then unblock it now. */
+				if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
+				{
+					/* The task should not have been on an event list. */
+					configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
+
+					/* START of special for EDF */
+					taskEDF_LOCK_PARTITIONS_OF( pxTCB );
+					taskEDF_NOTIFY_RELEASE( pxTCB, uxIndexToNotify );
+					/* END of special for EDF */
+
+					if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
 					{
-						/* If INCLUDE_vTaskSuspend is set to 1 and the block time
-						 * specified is the maximum block time then the task should block
-						 * indefinitely, and therefore never time out. */
-						xReturn = pdFALSE;
+						listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+						prvAddTaskToReadyList( pxTCB );
 					}
 					else
-#endif
+					{
+						/* The delayed and ready lists cannot be accessed, so hold
+						 * this task pending until the scheduler is resumed. */
+						listINSERT_END( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
+					}
 
-						if( ( xNumOfOverflows != pxTimeOut->xOverflowCount ) && ( xConstTickCount >= pxTimeOut->xTimeOnEntering ) ) /*lint !e525 Indentation preferred as is to make code within pre-processor directives clearer. */
-						{
-							/* The tick count is greater than the time at which
-							 * vTaskSetTimeout() was called, but has also overflowed since
-							 * vTaskSetTimeOut() was called.  It must have wrapped all the way
-							 * around and gone past again. This passed since vTaskSetTimeout()
-							 * was called. */
-							xReturn = pdTRUE;
-							*pxTicksToWait = ( TickType_t ) 0;
-						}
-						else if( xElapsedTime < *pxTicksToWait ) /*lint !e961 Explicit casting is only redundant with some compilers, whereas others require it to prevent integer conversion errors. */
-						{
-							/* Not a genuine timeout. Adjust parameters for time remaining. */
-							*pxTicksToWait -= xElapsedTime;
-							vTaskInternalSetTimeOutState( pxTimeOut );
-							xReturn = pdFALSE;
-						}
-						else
+					/* START of special for EDF */
+					if( taskEDF_WOKEN_TASK_PREEMPTS( pxTCB ) )
+					/* END of special for EDF */
+					{
+						/* The notified task has a priority above the currently
+						 * executing task so a yield is required. */
+						if( pxHigherPriorityTaskWoken != NULL )
 						{
-							*pxTicksToWait = ( TickType_t ) 0;
-							xReturn = pdTRUE;
-						}
-			}
-			taskEXIT_CRITICAL();
-
-			return xReturn;
-		}
-		/*-----------------------------------------------------------*/
-
-		void vTaskMissedYield( void )
-		{
-			xYieldPending = pdTRUE;
-		}
-		/*-----------------------------------------------------------*/
-
-#if ( configUSE_TRACE_FACILITY == 1 )
+							*pxHigherPriorityTaskWoken = pdTRUE;
+						}
 
-		UBaseType_t uxTaskGetTaskNumber( TaskHandle_t xTask )
-		{
-			UBaseType_t uxReturn;
-			TCB_t const * pxTCB;
+						/* Mark that a yield is pending in case the user is not
+						 * using the "xHigherPriorityTaskWoken" parameter to an ISR
+						 * safe FreeRTOS function. */
+						xYieldPending = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
 
-			if( xTask != NULL )
-			{
-				pxTCB = xTask;
-				uxReturn = pxTCB->uxTaskNumber;
-			}
-			else
-			{
-				uxReturn = 0U;
+					/* START of special for EDF */
+					taskEDF_UNLOCK_PARTITIONS_OF( pxTCB );
+					/* END of special for EDF */
+				}
 			}
+			/* START of special for EDF */
+			taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+			/* END of special for EDF */
 
-			return uxReturn;
+			return xReturn;
 		}
 
-#endif /* configUSE_TRACE_FACILITY */
+#endif /* configUSE_TASK_NOTIFICATIONS */
 		/*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
 
-		void vTaskSetTaskNumber( TaskHandle_t xTask,
-				const UBaseType_t uxHandle )
+		void vTaskGenericNotifyGiveFromISR( TaskHandle_t xTaskToNotify,
+				UBaseType_t uxIndexToNotify,
+				BaseType_t * pxHigherPriorityTaskWoken )
 		{
 			TCB_t * pxTCB;
+			uint8_t ucOriginalNotifyState;
+			UBaseType_t uxSavedInterruptStatus;
 
-			if( xTask != NULL )
-			{
-				pxTCB = xTask;
-				pxTCB->uxTaskNumber = uxHandle;
-			}
-		}
+			configASSERT( xTaskToNotify );
+			configASSERT( uxIndexToNotify < configTASK_NOTIFICATION_ARRAY_ENTRIES );
 
-#endif /* configUSE_TRACE_FACILITY */
+			/* RTOS ports that support interrupt nesting have the concept of a
+			 * maximum  system call (or maximum API call) interrupt priority.
+			 * Interrupts that are  above the maximum system call priority are keep
+			 * permanently enabled, even when the RTOS kernel is in a critical section,
+			 * but cannot make any calls to FreeRTOS API functions.  If configASSERT()
+			 * is defined in FreeRTOSConfig.h then
+			 * portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+			 * failure if a FreeRTOS API function is called from an interrupt that has
+			 * been assigned a priority above the configured maximum system call
+			 * priority.  Only FreeRTOS functions that end in FromISR can be called
+			 * from interrupts  that have been assigned a priority at or (logically)
+			 * below the maximum system call interrupt priority.  FreeRTOS maintains a
+			 * separate interrupt safe API to ensure interrupt entry is as fast and as
+			 * simple as possible.  More information (albeit Cortex-M specific) is
+			 * provided on the following link:
+			 * https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
+			portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
 
-		/*
-		 * -----------------------------------------------------------
-		 * The Idle task.
-		 * ----------------------------------------------------------
-		 *
-		 * The portTASK_FUNCTION() macro is used to allow port/compiler specific
-		 * language extensions.  The equivalent prototype for this function is:
-		 *
-		 * void prvIdleTask( void *pvParameters );
-		 *
-		 */
-		static portTASK_FUNCTION( prvIdleTask, pvParameters )
-		{
-			/* Stop warnings. */
-			( void ) pvParameters;
+			pxTCB = xTaskToNotify;
 
-			/** THIS IS THE RTOS IDLE TASK - WHICH IS CREATED AUTOMATICALLY WHEN THE
-			 * SCHEDULER IS STARTED. **/
+			/* START of special for EDF */
+			uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+			/* END of special for EDF */
+			{
+				ucOriginalNotifyState = pxTCB->ucNotifyState[ uxIndexToNotify ];
+				pxTCB->ucNotifyState[ uxIndexToNotify ] = taskNOTIFICATION_RECEIVED;
 
-			/* In case a task that has a secure context deletes itself, in which case
-			 * the idle task is responsible for deleting the task's secure context, if
-			 * any. */
-			portALLOCATE_SECURE_CONTEXT( configMINIMAL_SECURE_STACK_SIZE );
+				/* 'Giving' is equivalent to incrementing a count in a counting
+				 * semaphore. */
+				( pxTCB->ulNotifiedValue[ uxIndexToNotify ] )++;
 
-			for( ; ; )
-			{
-				/* See if any tasks have deleted themselves - if so then the idle task
-				 * is responsible for freeing the deleted task's TCB and stack. */
-				prvCheckTasksWaitingTermination();
+				traceTASK_NOTIFY_GIVE_FROM_ISR( uxIndexToNotify );
 
-#if ( configUSE_PREEMPTION == 0 )
+				/* If the task is in the blocked state specifically to wait for a
+				 * notification then unblock it now. */
+				if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
 				{
-					/* If we are not using preemption we keep forcing a task switch to
-					 * see if any other task has become available.  If we are using
-					 * preemption we don't need to do this as any task becoming available
-					 * will automatically get the processor anyway. */
-					taskYIELD();
-				}
-#endif /* configUSE_PREEMPTION */
+					/* The task should not have been on an event list. */
+					configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
 
-#if ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) )
-				{
-					/* When using preemption tasks of equal priority will be
-					 * timesliced.  If a task that is sharing the idle priority is ready
-					 * to run then the idle task should yield before the end of the
-					 * timeslice.
-					 *
-					 * A critical region is not required here as we are just reading from
-					 * the list, and an occasional incorrect value will not matter.  If
-					 * the ready list at the idle priority contains more than one task
-					 * then a task other than the idle task is ready to execute. */
-					if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > ( UBaseType_t ) 1 )
+					/* START of special for EDF */
+					taskEDF_LOCK_PARTITIONS_OF( pxTCB );
+					taskEDF_NOTIFY_RELEASE( pxTCB, uxIndexToNotify );
+					/* END of special for EDF */
+
+					if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
 					{
-						taskYIELD();
+						listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+						prvAddTaskToReadyList( pxTCB );
 					}
 					else
 					{
-						mtCOVERAGE_TEST_MARKER();
+						/* The delayed and ready lists cannot be accessed, so hold
+						 * this task pending until the scheduler is resumed. */
+						listINSERT_END( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
 					}
-				}
-#endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) ) */
-
-#if ( configUSE_IDLE_HOOK == 1 )
-				{
-					extern void vApplicationIdleHook( void );
-
-					/* Call the user defined function from within the idle task.  This
-					 * allows the application designer to add background functionality
-					 * without the overhead of a separate task.
-					 * NOTE: vApplicationIdleHook() MUST NOT, UNDER ANY CIRCUMSTANCES,
-					 * CALL A FUNCTION THAT MIGHT BLOCK. */
-					vApplicationIdleHook();
-				}
-#endif /* configUSE_IDLE_HOOK */
-
-				/* This conditional compilation should use inequality to 0, not equality
-				 * to 1.  This is to ensure portSUPPRESS_TICKS_AND_SLEEP() is called when
-				 * user defined low power mode  implementations require
-				 * configUSE_TICKLESS_IDLE to be set to a value other than 1. */
-#if ( configUSE_TICKLESS_IDLE != 0 )
-				{
-					TickType_t xExpectedIdleTime;
-
-					/* It is not desirable to suspend then resume the scheduler on
-					 * each iteration of the idle task.  Therefore, a preliminary
-					 * test of the expected idle time is performed without the
-					 * scheduler suspended.  The result here is not necessarily
-					 * valid. */
-					xExpectedIdleTime = prvGetExpectedIdleTime();
 
-					if( xExpectedIdleTime >= configEXPECTED_IDLE_TIME_BEFORE_SLEEP )
+					/* START of special for EDF */
+					if( taskEDF_WOKEN_TASK_PREEMPTS( pxTCB ) )
+					/* END of special for EDF */
 					{
-						vTaskSuspendAll();
+						/* The notified task has a priority above the currently
+						 * executing task so a yield is required. */
+						if( pxHigherPriorityTaskWoken != NULL )
 						{
-							/* Now the scheduler is suspended, the expected idle
-							 * time can be sampled again, and this time its value can
-							 * be used. */
-							configASSERT( xNextTaskUnblockTime >= xTickCount );
-							xExpectedIdleTime = prvGetExpectedIdleTime();
-
-							/* Define the following macro to set xExpectedIdleTime to 0
-							 * if the application does not want
-							 * portSUPPRESS_TICKS_AND_SLEEP() to be called. */
-							configPRE_SUPPRESS_TICKS_AND_SLEEP_PROCESSING( xExpectedIdleTime );
-
-							if( xExpectedIdleTime >= configEXPECTED_IDLE_TIME_BEFORE_SLEEP )
-							{
-								traceLOW_POWER_IDLE_BEGIN();
-								portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime );
-								traceLOW_POWER_IDLE_END();
-							}
-							else
-							{
-								mtCOVERAGE_TEST_MARKER();
-							}
+							*pxHigherPriorityTaskWoken = pdTRUE;
 						}
-						( void ) xTaskResumeAll();
+
+						/* Mark that a yield is pending in case the user is not
+						 * using the "xHigherPriorityTaskWoken" parameter in an ISR
+						 * safe FreeRTOS function. */
+						xYieldPending = pdTRUE;
 					}
 					else
 					{
 						mtCOVERAGE_TEST_MARKER();
 					}
-				}
-#endif /* configUSE_TICKLESS_IDLE */
 
-				/* START of special for EDF */
-#if ( configUSE_EDF_SCHEDULER == 1 )
-				{
-					listSET_LIST_ITEM_VALUE( &( ( prvGetTCBFromHandle(xIdleTaskHandle) )->xStateListItem ), xIDLEPeriod + xTickCount );
+					/* START of special for EDF */
+					taskEDF_UNLOCK_PARTITIONS_OF( pxTCB );
+					/* END of special for EDF */
 				}
-#endif
-				/* END of special for EDF */
 			}
+			/* START of special for EDF */
+			taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+			/* END of special for EDF */
 		}
+
+#endif /* configUSE_TASK_NOTIFICATIONS */
 		/*-----------------------------------------------------------*/
 
-#if ( configUSE_TICKLESS_IDLE != 0 )
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
 
-		eSleepModeStatus eTaskConfirmSleepModeStatus( void )
+		BaseType_t xTaskGenericNotifyStateClear( TaskHandle_t xTask,
+				UBaseType_t uxIndexToClear )
 		{
-			/* The idle task exists in addition to the application tasks. */
-			const UBaseType_t uxNonApplicationTasks = 1;
-			eSleepModeStatus eReturn = eStandardSleep;
+			TCB_t * pxTCB;
+			BaseType_t xReturn;
 
-			/* This function must be called from a critical section. */
+			configASSERT( uxIndexToClear < configTASK_NOTIFICATION_ARRAY_ENTRIES );
 
-			if( listCURRENT_LIST_LENGTH( &xPendingReadyList ) != 0 )
-			{
-				/* A task was made ready while the scheduler was suspended. */
-				eReturn = eAbortSleep;
-			}
-			else if( xYieldPending != pdFALSE )
-			{
-				/* A yield was pended while the scheduler was suspended. */
-				eReturn = eAbortSleep;
-			}
-			else if( xPendedTicks != 0 )
-			{
-				/* A tick interrupt has already occurred but was held pending
-				 * because the scheduler is suspended. */
-				eReturn = eAbortSleep;
-			}
-			else
+			/* If null is passed in here then it is the calling task that is having
+			 * its notification state cleared. */
+			pxTCB = prvGetTCBFromHandle( xTask );
+
+			taskENTER_CRITICAL();
 			{
-				/* If all the tasks are in the suspended list (which might mean they
-				 * have an infinite block time rather than actually being suspended)
-				 * then it is safe to turn all clocks off and just wait for external
-				 * interrupts. */
-				if( listCURRENT_LIST_LENGTH( &xSuspendedTaskList ) == ( uxCurrentNumberOfTasks - uxNonApplicationTasks ) )
+				if( pxTCB->ucNotifyState[ uxIndexToClear ] == taskNOTIFICATION_RECEIVED )
 				{
-					eReturn = eNoTasksWaitingTimeout;
+					pxTCB->ucNotifyState[ uxIndexToClear ] = taskNOT_WAITING_NOTIFICATION;
+					xReturn = pdPASS;
 				}
 				else
 				{
-					mtCOVERAGE_TEST_MARKER();
+					xReturn = pdFAIL;
 				}
 			}
+			taskEXIT_CRITICAL();
 
-			return eReturn;
+			return xReturn;
 		}
 
-#endif /* configUSE_TICKLESS_IDLE */
+#endif /* configUSE_TASK_NOTIFICATIONS */
 		/*-----------------------------------------------------------*/
 
-#if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0 )
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
 
-		void vTaskSetThreadLocalStoragePointer( TaskHandle_t xTaskToSet,
-				BaseType_t xIndex,
-				void * pvValue )
+		uint32_t ulTaskGenericNotifyValueClear( TaskHandle_t xTask,
+				UBaseType_t uxIndexToClear,
+				uint32_t ulBitsToClear )
 		{
 			TCB_t * pxTCB;
+			uint32_t ulReturn;
 
-			if( xIndex < configNUM_THREAD_LOCAL_STORAGE_POINTERS )
+			/* If null is passed in here then it is the calling task that is having
+			 * its notification state cleared. */
+			pxTCB = prvGetTCBFromHandle( xTask );
+
+			taskENTER_CRITICAL();
 			{
-				pxTCB = prvGetTCBFromHandle( xTaskToSet );
-				configASSERT( pxTCB != NULL );
-				pxTCB->pvThreadLocalStoragePointers[ xIndex ] = pvValue;
+				/* Return the notification as it was before the bits were cleared,
+				 * then clear the bit mask. */
+				ulReturn = pxTCB->ulNotifiedValue[ uxIndexToClear ];
+				pxTCB->ulNotifiedValue[ uxIndexToClear ] &= ~ulBitsToClear;
 			}
+			taskEXIT_CRITICAL();
+
+			return ulReturn;
 		}
 
-#endif /* configNUM_THREAD_LOCAL_STORAGE_POINTERS */
+#endif /* configUSE_TASK_NOTIFICATIONS */
 		/*-----------------------------------------------------------*/
 
-#if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0 )
+#if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( INCLUDE_xTaskGetIdleTaskHandle == 1 ) )
 
-		void * pvTaskGetThreadLocalStoragePointer( TaskHandle_t xTaskToQuery,
-				BaseType_t xIndex )
+		configRUN_TIME_COUNTER_TYPE ulTaskGetIdleRunTimeCounter( void )
 		{
-			void * pvReturn = NULL;
-			TCB_t * pxTCB;
+			return xIdleTaskHandle->ulRunTimeCounter;
+		}
 
-			if( xIndex < configNUM_THREAD_LOCAL_STORAGE_POINTERS )
+#endif
+		/*-----------------------------------------------------------*/
+
+#if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( INCLUDE_xTaskGetIdleTaskHandle == 1 ) )
+
+		configRUN_TIME_COUNTER_TYPE ulTaskGetIdleRunTimePercent( void )
+		{
+			configRUN_TIME_COUNTER_TYPE ulTotalTime, ulReturn;
+
+			ulTotalTime = portGET_RUN_TIME_COUNTER_VALUE();
+
+			/* For percentage calculations. */
+			ulTotalTime /= ( configRUN_TIME_COUNTER_TYPE ) 100;
+
+			/* Avoid divide by zero errors. */
+			if( ulTotalTime > ( configRUN_TIME_COUNTER_TYPE ) 0 )
 			{
-				pxTCB = prvGetTCBFromHandle( xTaskToQuery );
-				pvReturn = pxTCB->pvThreadLocalStoragePointers[ xIndex ];
+				ulReturn = xIdleTaskHandle->ulRunTimeCounter / ulTotalTime;
 			}
 			else
 			{
-				pvReturn = NULL;
+				ulReturn = 0;
 			}
 
-			return pvReturn;
+			return ulReturn;
 		}
 
-#endif /* configNUM_THREAD_LOCAL_STORAGE_POINTERS */
+#endif /* if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( INCLUDE_xTaskGetIdleTaskHandle == 1 ) ) */
 		/*-----------------------------------------------------------*/
 
-#if ( portUSING_MPU_WRAPPERS == 1 )
+		/* START of special for EDF */
+#if ( configUSE_EDF_SCHEDULER == 1 )
 
-		void vTaskAllocateMPURegions( TaskHandle_t xTaskToModify,
-				const MemoryRegion_t * const xRegions )
+		TickType_t xTaskGetDeadline( TaskHandle_t xTask )
 		{
-			TCB_t * pxTCB;
+			TickType_t xDeadline;
 
-			/* If null is passed in here then we are modifying the MPU settings of
-			 * the calling task. */
-			pxTCB = prvGetTCBFromHandle( xTaskToModify );
+			taskENTER_CRITICAL();
+			{
+				xDeadline = prvGetTCBFromHandle( xTask )->xTaskAbsoluteDeadline;
+			}
+			taskEXIT_CRITICAL();
 
-			vPortStoreTaskMPUSettings( &( pxTCB->xMPUSettings ), xRegions, NULL, 0 );
+			return xDeadline;
 		}
-
-#endif /* portUSING_MPU_WRAPPERS */
 		/*-----------------------------------------------------------*/
 
-		static void prvInitialiseTaskLists( void )
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+
+		void vTaskSetReleaseOnNotify( TaskHandle_t xTask,
+				UBaseType_t uxIndexToWait )
 		{
-			UBaseType_t uxPriority;
+			configASSERT( uxIndexToWait <= tskEDF_NO_RELEASE_ON_NOTIFY );
 
-			for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) configMAX_PRIORITIES; uxPriority++ )
+			taskENTER_CRITICAL();
 			{
-				vListInitialise( &( pxReadyTasksLists[ uxPriority ] ) );
+				prvGetTCBFromHandle( xTask )->uxTaskReleaseNotifyIndex = uxIndexToWait;
 			}
+			taskEXIT_CRITICAL();
+		}
+		/*-----------------------------------------------------------*/
 
-			vListInitialise( &xDelayedTaskList1 );
-			vListInitialise( &xDelayedTaskList2 );
-			vListInitialise( &xPendingReadyList );
+		static void prvEDFNotifyRelease( TCB_t * pxTCB )
+		{
+			TickType_t xReleaseTime = taskEDF_TASK_TICK_COUNT( pxTCB );
 
-#if ( INCLUDE_vTaskDelete == 1 )
+#if ( configUSE_EDF_SPORADIC == 1 )
+			/* A job of a sporadic task is due relative to its release, which is
+			 * earlier if the task was still busy with the previous job.  The
+			 * jobs are taken in the order they were released. */
+			if( ( pxTCB->xTaskSporadic != pdFALSE ) && ( pxTCB->uxTaskPendingCount > 0U ) )
 			{
-				vListInitialise( &xTasksWaitingTermination );
+				xReleaseTime = pxTCB->xTaskPendingReleases[ pxTCB->uxTaskPendingHead ];
+				pxTCB->uxTaskPendingHead = ( pxTCB->uxTaskPendingHead + 1U ) % ( UBaseType_t ) configEDF_SPORADIC_MAX_PENDING;
+				pxTCB->uxTaskPendingCount--;
 			}
-#endif /* INCLUDE_vTaskDelete */
+#endif
 
-#if ( INCLUDE_vTaskSuspend == 1 )
+			/* Same as a release by the tick. */
+			pxTCB->xTaskAbsoluteDeadline = taskEDF_RELEASE_DEADLINE( pxTCB, xReleaseTime );
+			pxTCB->ulTaskJobs++;
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_EDF_SEMI_PARTITIONED == 1 ) )
+			prvEDFSplitRelease( pxTCB );
+#endif
+#if ( configUSE_EDF_DVFS == 1 )
+			prvEDFDvfsRelease( pxTCB );
+#endif
+#if ( configUSE_EDF_SLACK_STEALING == 1 )
+			/* Counted as periodic, with the period as minimum time between
+			 * releases, which the slack was computed for already. */
+			if( pxTCB->xTaskSlackStealer == pdFALSE )
 			{
-				vListInitialise( &xSuspendedTaskList );
+				prvEDFSlackRelease( pxTCB, xReleaseTime );
 			}
-#endif /* INCLUDE_vTaskSuspend */
+#endif
+			traceTASK_JOB_RELEASE( pxTCB );
+		}
+		/*-----------------------------------------------------------*/
 
-			/* START of special for EDF */
-			/* E.C. */
-#if ( configUSE_EDF_SCHEDULER == 1 )
+		static void prvEDFNotifyReleasePending( UBaseType_t uxIndexToWait )
+		{
+			if( pxCurrentTCB->uxTaskReleaseNotifyIndex == uxIndexToWait )
+			{
+				/* The running task stays in the ready list, it is moved to the
+				 * deadline of its next job. */
+				taskEDF_LOCK_PARTITIONS_OF( pxCurrentTCB );
+				( void ) uxListRemove( &( pxCurrentTCB->xStateListItem ) );
+				prvEDFNotifyRelease( pxCurrentTCB );
+				prvAddTaskToReadyList( pxCurrentTCB );
+				taskEDF_UNLOCK_PARTITIONS_OF( pxCurrentTCB );
+				portYIELD_WITHIN_API();
+			}
+			else
 			{
-				vListInitialise( &xReadyTasksListEDF );
+				mtCOVERAGE_TEST_MARKER();
 			}
-#endif
-			/* END of special for EDF */
-
-			/* Start with pxDelayedTaskList using list1 and the pxOverflowDelayedTaskList
-			 * using list2. */
-			pxDelayedTaskList = &xDelayedTaskList1;
-			pxOverflowDelayedTaskList = &xDelayedTaskList2;
 		}
 		/*-----------------------------------------------------------*/
 
-		static void prvCheckTasksWaitingTermination( void )
+#endif /* configUSE_TASK_NOTIFICATIONS */
+
+#endif /* configUSE_EDF_SCHEDULER */
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configGENERATE_RUN_TIME_STATS == 1 ) )
+
+#ifndef configRUN_TIME_COUNTS_PER_TICK
+
+		static void prvCalibrateRunTimeCounter( void )
 		{
-			/** THIS FUNCTION IS CALLED FROM THE RTOS IDLE TASK **/
+			configRUN_TIME_COUNTER_TYPE ulNow;
 
-#if ( INCLUDE_vTaskDelete == 1 )
+#ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+			portALT_GET_RUN_TIME_COUNTER_VALUE( ulNow );
+#else
+			ulNow = portGET_RUN_TIME_COUNTER_VALUE();
+#endif
+
+			/* Both ends of the measurement are taken at the same point of the
+			 * tick interrupt, so the interrupt latency cancels out.  The ticks
+			 * xTaskResumeAll() unwinds from xPendedTicks all read the counter
+			 * when the scheduler is resumed, long after they fell, so they are
+			 * not taken as ends.  Counting the ticks from xTickCount rather than
+			 * from the calls keeps those between the ends in the measurement. */
+			if( xPendedTicks != ( TickType_t ) 0U )
 			{
-				TCB_t * pxTCB;
+				mtCOVERAGE_TEST_MARKER();
+			}
+			else if( xCalibrationStarted == pdFALSE )
+			{
+				ulCalibrationStartTime = ulNow;
+				xCalibrationStartTick = xTickCount;
+				xCalibrationStarted = pdTRUE;
+			}
+			else if( ( TickType_t ) ( xTickCount - xCalibrationStartTick ) >= taskRUN_TIME_CALIBRATION_TICKS )
+			{
+				ulRunTimeCountsPerTick = ( ulNow - ulCalibrationStartTime ) / ( configRUN_TIME_COUNTER_TYPE ) ( xTickCount - xCalibrationStartTick );
 
-				/* uxDeletedTasksWaitingCleanUp is used to prevent taskENTER_CRITICAL()
-				 * being called too often in the idle task. */
-				while( uxDeletedTasksWaitingCleanUp > ( UBaseType_t ) 0U )
-				{
-					taskENTER_CRITICAL();
-					{
-						pxTCB = listGET_OWNER_OF_HEAD_ENTRY( ( &xTasksWaitingTermination ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-						( void ) uxListRemove( &( pxTCB->xStateListItem ) );
-						--uxCurrentNumberOfTasks;
-						--uxDeletedTasksWaitingCleanUp;
-					}
-					taskEXIT_CRITICAL();
+				/* A counter slower than the tick cannot measure execution time.
+				 * Do not leave the busy waits stuck waiting for the calibration. */
+				configASSERT( ulRunTimeCountsPerTick != 0UL );
 
-					prvDeleteTCB( pxTCB );
+				if( ulRunTimeCountsPerTick == 0UL )
+				{
+					ulRunTimeCountsPerTick = 1UL;
 				}
 			}
-#endif /* INCLUDE_vTaskDelete */
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
+
+#endif /* configRUN_TIME_COUNTS_PER_TICK */
 		/*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+		/* Read x, updated by the context switches, afresh each time. */
+#define taskRUN_TIME_READ( x )    ( *( volatile configRUN_TIME_COUNTER_TYPE * ) &( x ) )
 
-		void vTaskGetInfo( TaskHandle_t xTask,
-				TaskStatus_t * pxTaskStatus,
-				BaseType_t xGetFreeStackSpace,
-				eTaskState eState )
+		static configRUN_TIME_COUNTER_TYPE prvGetCurrentTaskRunTime( void )
 		{
-			TCB_t * pxTCB;
+			configRUN_TIME_COUNTER_TYPE ulNow, ulRunTime, ulSwitchedInTime;
 
-			/* xTask is NULL then get the state of the calling task. */
-			pxTCB = prvGetTCBFromHandle( xTask );
+			/* The running total is only updated when the task is switched out,
+			 * so add the time since it was last switched in.  Called in the
+			 * busy loops, so rather than a critical section the values are
+			 * read again if a switch, which moves ulTaskSwitchedInTime, came
+			 * in between. */
+			do
+			{
+				ulSwitchedInTime = taskRUN_TIME_READ( ulTaskSwitchedInTime );
+				ulRunTime = taskRUN_TIME_READ( pxCurrentTCB->ulRunTimeCounter );
+#ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+				portALT_GET_RUN_TIME_COUNTER_VALUE( ulNow );
+#else
+				ulNow = portGET_RUN_TIME_COUNTER_VALUE();
+#endif
+			} while( ulSwitchedInTime != taskRUN_TIME_READ( ulTaskSwitchedInTime ) );
 
-			pxTaskStatus->xHandle = ( TaskHandle_t ) pxTCB;
-			pxTaskStatus->pcTaskName = ( const char * ) &( pxTCB->pcTaskName[ 0 ] );
-			pxTaskStatus->uxCurrentPriority = pxTCB->uxPriority;
-			pxTaskStatus->pxStackBase = pxTCB->pxStack;
-			pxTaskStatus->xTaskNumber = pxTCB->uxTCBNumber;
+			return ulRunTime + ( ulNow - ulSwitchedInTime );
+		}
+		/*-----------------------------------------------------------*/
 
-#if ( configUSE_MUTEXES == 1 )
+		static void prvBusyWaitRunTime( configRUN_TIME_COUNTER_TYPE ulCounts )
+		{
+			const configRUN_TIME_COUNTER_TYPE ulStart = prvGetCurrentTaskRunTime();
+
+			/* Time spent preempted is not added to the task's run time, so
+			 * this only returns once the task itself consumed ulCounts. */
+			while( ( prvGetCurrentTaskRunTime() - ulStart ) < ulCounts )
 			{
-				pxTaskStatus->uxBasePriority = pxTCB->uxBasePriority;
 			}
-#else
+		}
+		/*-----------------------------------------------------------*/
+
+		void vTaskBusyWaitExecutionTime( TickType_t xTicks )
+		{
+			/* The first few ticks after the scheduler started are used to
+			 * calibrate the run time counter. */
+			while( ulRunTimeCountsPerTick == 0UL )
 			{
-				pxTaskStatus->uxBasePriority = 0;
 			}
-#endif
 
-#if ( configGENERATE_RUN_TIME_STATS == 1 )
+			prvBusyWaitRunTime( ulRunTimeCountsPerTick * ( configRUN_TIME_COUNTER_TYPE ) xTicks );
+		}
+		/*-----------------------------------------------------------*/
+
+		void vTaskBusyWaitExecutionTimeUs( uint32_t ulMicroseconds )
+		{
+			uint64_t ullCounts;
+
+			while( ulRunTimeCountsPerTick == 0UL )
 			{
-				pxTaskStatus->ulRunTimeCounter = pxTCB->ulRunTimeCounter;
 			}
+
+			ullCounts = ( ( uint64_t ) ulRunTimeCountsPerTick * ( uint64_t ) ulMicroseconds * ( uint64_t ) configTICK_RATE_HZ ) / 1000000ULL;
+
+			prvBusyWaitRunTime( ( configRUN_TIME_COUNTER_TYPE ) ullCounts );
+		}
+
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configGENERATE_RUN_TIME_STATS == 1 ) */
+
+#if ( configUSE_EDF_DVFS == 1 )
+
+		static void prvEDFDvfsAccountCycles( void )
+		{
+			configRUN_TIME_COUNTER_TYPE ulNow;
+
+#ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+			portALT_GET_RUN_TIME_COUNTER_VALUE( ulNow );
 #else
-			{
-				pxTaskStatus->ulRunTimeCounter = ( configRUN_TIME_COUNTER_TYPE ) 0;
-			}
+			ulNow = portGET_RUN_TIME_COUNTER_VALUE();
 #endif
 
-			/* Obtaining the task state is a little fiddly, so is only done if the
-			 * value of eState passed into this function is eInvalid - otherwise the
-			 * state is just set to whatever is passed in. */
-			if( eState != eInvalid )
+			if( xSchedulerRunning != pdFALSE )
 			{
-				if( pxTCB == pxCurrentTCB )
-				{
-					pxTaskStatus->eCurrentState = eRunning;
-				}
-				else
-				{
-					pxTaskStatus->eCurrentState = eState;
-
-#if ( INCLUDE_vTaskSuspend == 1 )
-{
-	/* If the task is in the suspended list then there is a
-	 *  chance it is actually just blocked indefinitely - so really
-	 *  it should be reported as being in the Blocked state. */
-						if( eState == eSuspended )
-						{
-							vTaskSuspendAll();
-							{
-								if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
-								{
-									pxTaskStatus->eCurrentState = eBlocked;
-								}
-							}
-							( void ) xTaskResumeAll();
-						}
-}
-#endif /* INCLUDE_vTaskSuspend */
-				}
+				pxCurrentTCB->ulJobCycles += ( configRUN_TIME_COUNTER_TYPE ) ( ( ( uint64_t ) ( ulNow - ulEDFCyclesAccountedTime ) * ( uint64_t ) ulEDFSpeed ) / ( uint64_t ) tskEDF_SPEED_FULL );
 			}
 			else
 			{
-				pxTaskStatus->eCurrentState = eTaskGetState( pxTCB );
+				mtCOVERAGE_TEST_MARKER();
 			}
 
-			/* Obtaining the stack space takes some time, so the xGetFreeStackSpace
-			 * parameter is provided to allow it to be skipped. */
-			if( xGetFreeStackSpace != pdFALSE )
-			{
-#if ( portSTACK_GROWTH > 0 )
-				{
-					pxTaskStatus->usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxEndOfStack );
-				}
-#else
-				{
-					pxTaskStatus->usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxStack );
-				}
-#endif
+			ulEDFCyclesAccountedTime = ulNow;
+		}
+		/*-----------------------------------------------------------*/
+
+		static void prvEDFDvfsSetUtilisation( TCB_t * pxTCB,
+				uint32_t ulUtilisation )
+		{
+			uint32_t ulRequired;
+
+			if( ulUtilisation != pxTCB->ulTaskUtilisation )
+			{
+				ulEDFActiveUtilisation = ( ulEDFActiveUtilisation - pxTCB->ulTaskUtilisation ) + ulUtilisation;
+				pxTCB->ulTaskUtilisation = ulUtilisation;
+
+				ulRequired = ( ulEDFActiveUtilisation < tskEDF_SPEED_FULL ) ? ulEDFActiveUtilisation : tskEDF_SPEED_FULL;
+
+				/* The work done so far counts at the old speed. */
+				prvEDFDvfsAccountCycles();
+				ulEDFSpeed = configEDF_DVFS_SET_SPEED( ulRequired );
+				configASSERT( ulEDFSpeed >= ulRequired );
 			}
 			else
 			{
-				pxTaskStatus->usStackHighWaterMark = 0;
+				mtCOVERAGE_TEST_MARKER();
 			}
 		}
-
-#endif /* configUSE_TRACE_FACILITY */
 		/*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+		static void prvEDFDvfsRelease( TCB_t * pxTCB )
+		{
+			pxTCB->ulJobCycles = 0;
+			prvEDFDvfsSetUtilisation( pxTCB, ( uint32_t ) ( ( ( uint64_t ) pxTCB->xTaskWCET * ( uint64_t ) tskEDF_SPEED_FULL ) / ( uint64_t ) pxTCB->xTaskPeriod ) );
+		}
+		/*-----------------------------------------------------------*/
 
-		static UBaseType_t prvListTasksWithinSingleList( TaskStatus_t * pxTaskStatusArray,
-				List_t * pxList,
-				eTaskState eState )
+		static void prvEDFDvfsComplete( TCB_t * pxTCB )
 		{
-			configLIST_VOLATILE TCB_t * pxNextTCB, * pxFirstTCB;
-			UBaseType_t uxTask = 0;
+			uint32_t ulUtilisation;
 
-			if( listCURRENT_LIST_LENGTH( pxList ) > ( UBaseType_t ) 0 )
+			prvEDFDvfsAccountCycles();
+
+			/* Nothing is reclaimed before the run time counter is calibrated. */
+			if( ulRunTimeCountsPerTick != 0UL )
 			{
-				listGET_OWNER_OF_NEXT_ENTRY( pxFirstTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+				ulUtilisation = ( uint32_t ) ( ( ( uint64_t ) pxTCB->ulJobCycles * ( uint64_t ) tskEDF_SPEED_FULL ) /
+											   ( ( uint64_t ) ulRunTimeCountsPerTick * ( uint64_t ) pxTCB->xTaskPeriod ) );
 
-				/* Populate an TaskStatus_t structure within the
-				 * pxTaskStatusArray array for each task that is referenced from
-				 * pxList.  See the definition of TaskStatus_t in task.h for the
-				 * meaning of each TaskStatus_t structure member. */
-				do
+				/* A job overrunning its WCET keeps the WCET reserved. */
+				if( ulUtilisation < pxTCB->ulTaskUtilisation )
 				{
-					listGET_OWNER_OF_NEXT_ENTRY( pxNextTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-					vTaskGetInfo( ( TaskHandle_t ) pxNextTCB, &( pxTaskStatusArray[ uxTask ] ), pdTRUE, eState );
-					uxTask++;
-				} while( pxNextTCB != pxFirstTCB );
+					prvEDFDvfsSetUtilisation( pxTCB, ulUtilisation );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 			}
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
-
-			return uxTask;
 		}
 
-#endif /* configUSE_TRACE_FACILITY */
+#endif /* configUSE_EDF_DVFS */
+		/* END of special for EDF */
 		/*-----------------------------------------------------------*/
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) )
+		/* START of special for EDF */
+#if ( configUSE_EDF_SLACK_STEALING == 1 )
 
-		static configSTACK_DEPTH_TYPE prvTaskCheckFreeStackSpace( const uint8_t * pucStackByte )
+		static void prvEDFSlackRelease( TCB_t * pxTCB,
+				TickType_t xReleaseTime )
 		{
-			uint32_t ulCount = 0U;
+			pxTCB->xTaskJobActive = pdTRUE;
+			pxTCB->xTaskNextRelease = xReleaseTime + pxTCB->xTaskPeriod;
+			pxTCB->ulJobStartRunTime = pxTCB->ulRunTimeCounter;
+		}
+		/*-----------------------------------------------------------*/
 
-			while( *pucStackByte == ( uint8_t ) tskSTACK_FILL_BYTE )
+		static TickType_t prvEDFSlackOffset( TickType_t xTime )
+		{
+			TickType_t xOffset = xTime - xTickCount;
+
+			/* A time already passed, a late job, counts as now. */
+			if( xOffset > ( portMAX_DELAY >> 1 ) )
 			{
-				pucStackByte -= portSTACK_GROWTH;
-				ulCount++;
+				xOffset = 0U;
 			}
 
-			ulCount /= ( uint32_t ) sizeof( StackType_t ); /*lint !e961 Casting is not redundant on smaller architectures. */
-
-			return ( configSTACK_DEPTH_TYPE ) ulCount;
+			return xOffset;
 		}
-
-#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) ) */
 		/*-----------------------------------------------------------*/
 
-#if ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 )
-
-		/* uxTaskGetStackHighWaterMark() and uxTaskGetStackHighWaterMark2() are the
-		 * same except for their return type.  Using configSTACK_DEPTH_TYPE allows the
-		 * user to determine the return type.  It gets around the problem of the value
-		 * overflowing on 8-bit types without breaking backward compatibility for
-		 * applications that expect an 8-bit return type. */
-		configSTACK_DEPTH_TYPE uxTaskGetStackHighWaterMark2( TaskHandle_t xTask )
+		static TickType_t prvEDFSlackCompute( void )
 		{
+			UBaseType_t uxTask, uxOther;
 			TCB_t * pxTCB;
-			uint8_t * pucEndOfStack;
-			configSTACK_DEPTH_TYPE uxReturn;
+			TickType_t xExecuted, xDeadline;
+			uint32_t ulDemand, ulWork = 0UL, ulTail = 0UL;
+			int32_t lSlack = ( int32_t ) configEDF_SLACK_HORIZON;
+			const TickType_t xHorizon = configEDF_SLACK_HORIZON;
 
-			/* uxTaskGetStackHighWaterMark() and uxTaskGetStackHighWaterMark2() are
-			 * the same except for their return type.  Using configSTACK_DEPTH_TYPE
-			 * allows the user to determine the return type.  It gets around the
-			 * problem of the value overflowing on 8-bit types without breaking
-			 * backward compatibility for applications that expect an 8-bit return
-			 * type. */
+			/* Work left in each current job and next release, relative to
+			 * now.  The run time counter of the running task was last updated
+			 * when it was switched in, so the work left is over-estimated.  An
+			 * interrupt can release a job, so each task is read in one go. */
+			for( uxTask = 0U; uxTask < uxEDFSlackTasks; uxTask++ )
+			{
+				pxTCB = pxEDFSlackTasks[ uxTask ];
+				xEDFSlackLeft[ uxTask ] = 0U;
 
-			pxTCB = prvGetTCBFromHandle( xTask );
+				taskENTER_CRITICAL();
+				{
+					xEDFSlackActive[ uxTask ] = pxTCB->xTaskJobActive;
+					xEDFSlackNext[ uxTask ] = prvEDFSlackOffset( pxTCB->xTaskNextRelease );
+					xEDFSlackDeadline[ uxTask ] = prvEDFSlackOffset( ( pxTCB->xTaskNextRelease - pxTCB->xTaskPeriod ) + pxTCB->xTaskRelativeDeadline );
+					xExecuted = 0U;
 
-#if portSTACK_GROWTH < 0
-			{
-				pucEndOfStack = ( uint8_t * ) pxTCB->pxStack;
+					if( ulRunTimeCountsPerTick != 0UL )
+					{
+						xExecuted = ( TickType_t ) ( ( pxTCB->ulRunTimeCounter - pxTCB->ulJobStartRunTime ) / ulRunTimeCountsPerTick );
+					}
+				}
+				taskEXIT_CRITICAL();
+
+				if( xEDFSlackActive[ uxTask ] != pdFALSE )
+				{
+					if( xExecuted < pxTCB->xTaskWCET )
+					{
+						xEDFSlackLeft[ uxTask ] = pxTCB->xTaskWCET - xExecuted;
+					}
+
+					ulWork += xEDFSlackLeft[ uxTask ];
+				}
+
+				ulTail += pxTCB->xTaskWCET;
 			}
-#else
+
+			/* Every deadline up to the horizon. */
+			for( uxTask = 0U; uxTask < uxEDFSlackTasks; uxTask++ )
 			{
-				pucEndOfStack = ( uint8_t * ) pxTCB->pxEndOfStack;
-			}
-#endif
+				pxTCB = pxEDFSlackTasks[ uxTask ];
 
-			uxReturn = prvTaskCheckFreeStackSpace( pucEndOfStack );
+				if( pxTCB->xTaskWCET == 0U )
+				{
+					continue;
+				}
 
-			return uxReturn;
-		}
+				/* The deadline of the current job, then of the later ones. */
+				xDeadline = ( xEDFSlackActive[ uxTask ] != pdFALSE ) ? xEDFSlackDeadline[ uxTask ] : ( xEDFSlackNext[ uxTask ] + pxTCB->xTaskRelativeDeadline );
 
-#endif /* INCLUDE_uxTaskGetStackHighWaterMark2 */
-		/*-----------------------------------------------------------*/
+				while( xDeadline <= xHorizon )
+				{
+					ulDemand = 0UL;
 
-#if ( INCLUDE_uxTaskGetStackHighWaterMark == 1 )
+					for( uxOther = 0U; uxOther < uxEDFSlackTasks; uxOther++ )
+					{
+						if( ( xEDFSlackActive[ uxOther ] != pdFALSE ) && ( xEDFSlackDeadline[ uxOther ] <= xDeadline ) )
+						{
+							ulDemand += xEDFSlackLeft[ uxOther ];
+						}
 
-		UBaseType_t uxTaskGetStackHighWaterMark( TaskHandle_t xTask )
-		{
-			TCB_t * pxTCB;
-			uint8_t * pucEndOfStack;
-			UBaseType_t uxReturn;
+						if( xDeadline >= ( xEDFSlackNext[ uxOther ] + pxEDFSlackTasks[ uxOther ]->xTaskRelativeDeadline ) )
+						{
+							ulDemand += ( ( ( xDeadline - xEDFSlackNext[ uxOther ] - pxEDFSlackTasks[ uxOther ]->xTaskRelativeDeadline ) / pxEDFSlackTasks[ uxOther ]->xTaskPeriod ) + 1UL ) *
+										pxEDFSlackTasks[ uxOther ]->xTaskWCET;
+						}
+					}
 
-			pxTCB = prvGetTCBFromHandle( xTask );
+					if( ( ( int32_t ) xDeadline - ( int32_t ) ulDemand ) < lSlack )
+					{
+						lSlack = ( int32_t ) xDeadline - ( int32_t ) ulDemand;
+					}
 
-#if portSTACK_GROWTH < 0
-			{
-				pucEndOfStack = ( uint8_t * ) pxTCB->pxStack;
+					if( ( xEDFSlackActive[ uxTask ] != pdFALSE ) && ( xDeadline == xEDFSlackDeadline[ uxTask ] ) )
+					{
+						xDeadline = xEDFSlackNext[ uxTask ] + pxTCB->xTaskRelativeDeadline;
+					}
+					else
+					{
+						xDeadline += pxTCB->xTaskPeriod;
+					}
+				}
+
+				/* Jobs released before the horizon, for the bound below. */
+				if( xEDFSlackNext[ uxTask ] < xHorizon )
+				{
+					ulWork += ( ( ( xHorizon - 1U - xEDFSlackNext[ uxTask ] ) / pxTCB->xTaskPeriod ) + 1UL ) * pxTCB->xTaskWCET;
+				}
 			}
-#else
+
+			/* Past the horizon the jobs released after it need at most the
+			 * time elapsed since, give or take a WCET per task for the
+			 * constrained deadlines, with a utilisation of at most 1. */
+			if( ( ( int32_t ) xHorizon - ( int32_t ) ( ulWork + ulTail ) ) < lSlack )
 			{
-				pucEndOfStack = ( uint8_t * ) pxTCB->pxEndOfStack;
+				lSlack = ( int32_t ) xHorizon - ( int32_t ) ( ulWork + ulTail );
 			}
-#endif
 
-			uxReturn = ( UBaseType_t ) prvTaskCheckFreeStackSpace( pucEndOfStack );
+			/* The current tick may already be partly used. */
+			lSlack -= 1;
 
-			return uxReturn;
+			return ( lSlack > 0 ) ? ( TickType_t ) lSlack : 0U;
 		}
-
-#endif /* INCLUDE_uxTaskGetStackHighWaterMark */
 		/*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskDelete == 1 )
+		static BaseType_t prvEDFSlackMoveStealers( void )
+		{
+			UBaseType_t uxStealer;
+			TCB_t * pxTCB;
+			BaseType_t xSwitchRequired = pdFALSE;
 
-		static void prvDeleteTCB( TCB_t * pxTCB )
+			for( uxStealer = 0U; uxStealer < uxEDFSlackStealers; uxStealer++ )
+			{
+				pxTCB = pxEDFSlackStealers[ uxStealer ];
+
+				if( listIS_CONTAINED_WITHIN( taskEDF_READY_LIST( pxTCB ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+				{
+					( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+					listSET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ), taskEDF_KEY( pxTCB ) );
+					vListInsert( taskEDF_READY_LIST( pxTCB ), &( pxTCB->xStateListItem ) );
+
+					/* A stealer now runs ahead of the running task, or the
+					 * running stealer now runs behind the others. */
+					xSwitchRequired = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+
+			return xSwitchRequired;
+		}
+		/*-----------------------------------------------------------*/
+
+		static void prvEDFSlackUpdate( void )
 		{
-			/* This call is required specifically for the TriCore port.  It must be
-			 * above the vPortFree() calls.  The call is also used by ports/demos that
-			 * want to allocate and clean RAM statically. */
-			portCLEAN_UP_TCB( pxTCB );
+			const TickType_t xSlack = prvEDFSlackCompute();
+			BaseType_t xHadSlack;
 
-			/* Free up the memory allocated by the scheduler for the task.  It is up
-			 * to the task to free any memory allocated at the application level.
-			 * See the third party link http://www.nadler.com/embedded/newlibAndFreeRTOS.html
-			 * for additional information. */
-#if ( configUSE_NEWLIB_REENTRANT == 1 )
+			configASSERT( uxSchedulerSuspended != 0U );
+
+			/* The tick count is frozen while the scheduler is suspended, the
+			 * ticks pended meanwhile are charged to the slack computed. */
+			taskENTER_CRITICAL();
 			{
-				_reclaim_reent( &( pxTCB->xNewLib_reent ) );
+				xHadSlack = ( xEDFSlack > 0U ) ? pdTRUE : pdFALSE;
+				xEDFSlack = xSlack;
+
+				if( ( ( ( xEDFSlack > 0U ) ? pdTRUE : pdFALSE ) != xHadSlack ) &&
+					( prvEDFSlackMoveStealers() != pdFALSE ) &&
+					( xSchedulerRunning != pdFALSE ) )
+				{
+					xYieldPending = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 			}
-#endif /* configUSE_NEWLIB_REENTRANT */
+			taskEXIT_CRITICAL();
+		}
+		/*-----------------------------------------------------------*/
 
-#if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) && ( portUSING_MPU_WRAPPERS == 0 ) )
+		static void prvEDFSlackRemoveTask( const TCB_t * pxTCB )
+		{
+			UBaseType_t uxTask;
+
+			for( uxTask = 0U; uxTask < uxEDFSlackTasks; uxTask++ )
 			{
-				/* The task can only have been allocated dynamically - free both
-				 * the stack and TCB. */
-				vPortFreeStack( pxTCB->pxStack );
-				vPortFree( pxTCB );
+				if( pxEDFSlackTasks[ uxTask ] == pxTCB )
+				{
+					pxEDFSlackTasks[ uxTask ] = pxEDFSlackTasks[ --uxEDFSlackTasks ];
+					break;
+				}
 			}
-#elif ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e731 !e9029 Macro has been consolidated for readability reasons. */
+
+			for( uxTask = 0U; uxTask < uxEDFSlackStealers; uxTask++ )
 			{
-				/* The task could have been allocated statically or dynamically, so
-				 * check what was statically allocated before trying to free the
-				 * memory. */
-				if( pxTCB->ucStaticallyAllocated == tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB )
+				if( pxEDFSlackStealers[ uxTask ] == pxTCB )
 				{
-					/* Both the stack and TCB were allocated dynamically, so both
-					 * must be freed. */
-					vPortFreeStack( pxTCB->pxStack );
-					vPortFree( pxTCB );
+					pxEDFSlackStealers[ uxTask ] = pxEDFSlackStealers[ --uxEDFSlackStealers ];
+					break;
 				}
-				else if( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_ONLY )
+			}
+		}
+		/*-----------------------------------------------------------*/
+
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+		BaseType_t xTaskCreateSlackStealer( TaskFunction_t pxTaskCode,
+				const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+				const configSTACK_DEPTH_TYPE usStackDepth,
+				void * const pvParameters,
+				TaskHandle_t * const pxCreatedTask )
+		{
+			TaskHandle_t xCreated = NULL;
+			TCB_t * pxTCB;
+			BaseType_t xReturn;
+
+			/* Created as a periodic task then turned into a stealer before it
+			 * can run.  The period only sets the deadline it would have if it
+			 * were released by a delay. */
+			vTaskSuspendAll();
+			{
+				xReturn = xTaskPeriodicCreate( pxTaskCode, pcName, usStackDepth, pvParameters, tskIDLE_PRIORITY, &xCreated, 1U );
+
+				if( xReturn == pdPASS )
 				{
-					/* Only the stack was statically allocated, so the TCB is the
-					 * only memory that must be freed. */
-					vPortFree( pxTCB );
+					pxTCB = xCreated;
+
+					taskENTER_CRITICAL();
+					{
+						configASSERT( uxEDFSlackStealers < ( UBaseType_t ) configEDF_SLACK_MAX_STEALERS );
+
+						prvEDFSlackRemoveTask( pxTCB );
+						pxEDFSlackStealers[ uxEDFSlackStealers++ ] = pxTCB;
+						pxTCB->xTaskSlackStealer = pdTRUE;
+						pxTCB->xTaskJobActive = pdFALSE;
+						pxTCB->xTaskWCET = 0U;
+#if ( configUSE_EDF_DVFS == 1 )
+						prvEDFDvfsSetUtilisation( pxTCB, 0UL );
+#endif
+#if ( configUSE_EDF_SPORADIC == 1 )
+						prvEDFSetDensity( pxTCB, 0UL );
+#endif
+
+						( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+						listSET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ), taskEDF_KEY( pxTCB ) );
+						vListInsert( taskEDF_READY_LIST( pxTCB ), &( pxTCB->xStateListItem ) );
+					}
+					taskEXIT_CRITICAL();
+
+					prvEDFSlackUpdate();
+
+					if( pxCreatedTask != NULL )
+					{
+						*pxCreatedTask = xCreated;
+					}
 				}
 				else
 				{
-					/* Neither the stack nor the TCB were allocated dynamically, so
-					 * nothing needs to be freed. */
-					configASSERT( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_AND_TCB );
 					mtCOVERAGE_TEST_MARKER();
 				}
 			}
+
+			if( ( xTaskResumeAll() == pdFALSE ) && ( xReturn == pdPASS ) && ( xSchedulerRunning != pdFALSE ) && ( xEDFSlack > 0U ) )
+			{
+				/* The stealer can run straight away. */
+				taskYIELD_IF_USING_PREEMPTION();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			return xReturn;
+		}
+
 #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+		/*-----------------------------------------------------------*/
+
+		TickType_t xTaskGetSlack( void )
+		{
+			return xEDFSlack;
 		}
+		/*-----------------------------------------------------------*/
+
+#endif /* configUSE_EDF_SLACK_STEALING */
 
-#endif /* INCLUDE_vTaskDelete */
+#if ( configUSE_EDF_SPORADIC == 1 )
+
+		static void prvEDFSporadicRelease( TCB_t * pxTCB )
+		{
+			configASSERT( pxTCB->uxTaskPendingCount < ( UBaseType_t ) configEDF_SPORADIC_MAX_PENDING );
+
+			pxTCB->xTaskLastArrival = taskEDF_TASK_TICK_COUNT( pxTCB );
+			pxTCB->xTaskPendingReleases[ ( pxTCB->uxTaskPendingHead + pxTCB->uxTaskPendingCount ) % ( UBaseType_t ) configEDF_SPORADIC_MAX_PENDING ] = taskEDF_TASK_TICK_COUNT( pxTCB );
+			pxTCB->uxTaskPendingCount++;
+		}
 		/*-----------------------------------------------------------*/
 
-		static void prvResetNextTaskUnblockTime( void )
+		static BaseType_t prvEDFSporadicArrival( TCB_t * pxTCB )
 		{
-			if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+			BaseType_t xReturn = pdFALSE;
+			BaseType_t xEarly;
+
+			configASSERT( pxTCB->xTaskSporadic != pdFALSE );
+
+			xEarly = ( ( TickType_t ) ( taskEDF_TASK_TICK_COUNT( pxTCB ) - pxTCB->xTaskLastArrival ) < pxTCB->xTaskPeriod ) ? pdTRUE : pdFALSE;
+
+			/* Earlier arrivals go first. */
+			if( ( pxTCB->uxTaskDeferredArrivals == 0U ) && ( xEarly == pdFALSE ) &&
+				( pxTCB->uxTaskPendingCount < ( UBaseType_t ) configEDF_SPORADIC_MAX_PENDING ) )
 			{
-				/* The new current delayed list is empty.  Set xNextTaskUnblockTime to
-				 * the maximum possible value so it is  extremely unlikely that the
-				 * if( xTickCount >= xNextTaskUnblockTime ) test will pass until
-				 * there is an item in the delayed list. */
-				xNextTaskUnblockTime = portMAX_DELAY;
+				prvEDFSporadicRelease( pxTCB );
+				xReturn = pdTRUE;
 			}
 			else
 			{
-				/* The new current delayed list is not empty, get the value of
-				 * the item at the head of the delayed list.  This is the time at
-				 * which the task at the head of the delayed list should be removed
-				 * from the Blocked state. */
-				xNextTaskUnblockTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxDelayedTaskList );
+				pxTCB->uxTaskDeferredArrivals++;
+				uxEDFSporadicDeferred++;
+
+				if( xEarly != pdFALSE )
+				{
+					pxTCB->uxTaskEarlyArrivals++;
+				}
 			}
+
+			return xReturn;
 		}
 		/*-----------------------------------------------------------*/
 
-#if ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) )
-
-		TaskHandle_t xTaskGetCurrentTaskHandle( void )
+		static BaseType_t prvEDFSporadicReleaseDeferred( void )
 		{
-			TaskHandle_t xReturn;
+			TCB_t * pxTCB;
+			UBaseType_t uxTask;
+			BaseType_t xSwitchRequired = pdFALSE;
 
-			/* A critical section is not required as this is not called from
-			 * an interrupt and the current TCB will always be the same for any
-			 * individual execution thread. */
-			xReturn = pxCurrentTCB;
+			for( uxTask = 0U; uxTask < uxEDFSporadicTasks; uxTask++ )
+			{
+				pxTCB = pxEDFSporadicTasks[ uxTask ];
 
-			return xReturn;
+				if( ( pxTCB->uxTaskDeferredArrivals > 0U ) &&
+					( pxTCB->uxTaskPendingCount < ( UBaseType_t ) configEDF_SPORADIC_MAX_PENDING ) &&
+					( ( TickType_t ) ( taskEDF_TASK_TICK_COUNT( pxTCB ) - pxTCB->xTaskLastArrival ) >= pxTCB->xTaskPeriod ) )
+				{
+					pxTCB->uxTaskDeferredArrivals--;
+					uxEDFSporadicDeferred--;
+					prvEDFSporadicRelease( pxTCB );
+					vTaskNotifyGiveIndexedFromISR( pxTCB, configEDF_SPORADIC_NOTIFY_INDEX, &xSwitchRequired );
+				}
+			}
+
+			return xSwitchRequired;
 		}
+		/*-----------------------------------------------------------*/
 
-#endif /* ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) ) */
+		static uint32_t prvEDFDensity( TickType_t xWCET,
+				TickType_t xDeadline )
+		{
+			uint64_t ullDensity;
+
+			configASSERT( xDeadline > 0U );
+
+			ullDensity = ( ( ( uint64_t ) xWCET * ( uint64_t ) taskEDF_DENSITY_FULL ) + ( uint64_t ) xDeadline - 1U ) / ( uint64_t ) xDeadline;
+
+			return ( ullDensity > ( uint64_t ) taskEDF_DENSITY_OVER ) ? taskEDF_DENSITY_OVER : ( uint32_t ) ullDensity;
+		}
 		/*-----------------------------------------------------------*/
 
-#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+		static void prvEDFSetDensity( TCB_t * pxTCB,
+				uint32_t ulDensity )
+		{
+			ulEDFDensity -= pxTCB->ulTaskDensity;
+			pxTCB->ulTaskDensity = ulDensity;
+			ulEDFDensity += ulDensity;
+		}
+		/*-----------------------------------------------------------*/
 
-		BaseType_t xTaskGetSchedulerState( void )
+		static void prvEDFSporadicRemoveTask( const TCB_t * pxTCB )
 		{
-			BaseType_t xReturn;
+			UBaseType_t uxTask;
 
-			if( xSchedulerRunning == pdFALSE )
-			{
-				xReturn = taskSCHEDULER_NOT_STARTED;
-			}
-			else
+			ulEDFDensity -= pxTCB->ulTaskDensity;
+
+			for( uxTask = 0U; uxTask < uxEDFSporadicTasks; uxTask++ )
 			{
-				if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+				if( pxEDFSporadicTasks[ uxTask ] == pxTCB )
 				{
-					xReturn = taskSCHEDULER_RUNNING;
-				}
-				else
-				{
-					xReturn = taskSCHEDULER_SUSPENDED;
+					uxEDFSporadicDeferred -= pxTCB->uxTaskDeferredArrivals;
+					pxEDFSporadicTasks[ uxTask ] = pxEDFSporadicTasks[ --uxEDFSporadicTasks ];
+					break;
 				}
 			}
-
-			return xReturn;
 		}
-
-#endif /* ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) ) */
 		/*-----------------------------------------------------------*/
 
-#if ( configUSE_MUTEXES == 1 )
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
 
-		BaseType_t xTaskPriorityInherit( TaskHandle_t const pxMutexHolder )
+		BaseType_t xTaskSporadicCreate( TaskFunction_t pxTaskCode,
+				const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+				const configSTACK_DEPTH_TYPE usStackDepth,
+				void * const pvParameters,
+				UBaseType_t uxPriority,
+				TaskHandle_t * const pxCreatedTask,
+				TickType_t xMinInterArrival,
+				TickType_t xDeadline,
+				TickType_t xWCET )
 		{
-			TCB_t * const pxMutexHolderTCB = pxMutexHolder;
-			BaseType_t xReturn = pdFALSE;
+			TaskHandle_t xCreated = NULL;
+			TCB_t * pxTCB;
+			uint32_t ulDensity;
+			BaseType_t xReturn = pdFAIL;
 
-			/* If the mutex was given back by an interrupt while the queue was
-			 * locked then the mutex holder might now be NULL.  _RB_ Is this still
-			 * needed as interrupts can no longer use mutexes? */
-			if( pxMutexHolder != NULL )
+			configASSERT( ( xWCET > 0U ) && ( xWCET <= xDeadline ) && ( xDeadline <= xMinInterArrival ) );
+
+			ulDensity = prvEDFDensity( xWCET, xDeadline );
+
+			/* Created as a periodic task then turned into a sporadic one before
+			 * it can run. */
+			vTaskSuspendAll();
 			{
-				/* If the holder of the mutex has a priority below the priority of
-				 * the task attempting to obtain the mutex then it will temporarily
-				 * inherit the priority of the task attempting to obtain the mutex. */
-				if( pxMutexHolderTCB->uxPriority < pxCurrentTCB->uxPriority )
+				taskENTER_CRITICAL();
 				{
-					/* Adjust the mutex holder state to account for its new
-					 * priority.  Only reset the event list item value if the value is
-					 * not being used for anything else. */
-					if( ( listGET_LIST_ITEM_VALUE( &( pxMutexHolderTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
-					{
-						listSET_LIST_ITEM_VALUE( &( pxMutexHolderTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxCurrentTCB->uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-					}
-					else
+					/* ulEDFDensity can be above taskEDF_DENSITY_FULL already. */
+					if( ( uxEDFSporadicTasks < ( UBaseType_t ) configEDF_SPORADIC_MAX_TASKS ) &&
+						( ulDensity <= taskEDF_DENSITY_FULL ) &&
+						( ulEDFDensity <= ( taskEDF_DENSITY_FULL - ulDensity ) ) )
 					{
-						mtCOVERAGE_TEST_MARKER();
+						/* Reserved while the task is created. */
+						ulEDFDensity += ulDensity;
+						xReturn = pdPASS;
 					}
+				}
+				taskEXIT_CRITICAL();
 
-					/* If the task being modified is in the ready state it will need
-					 * to be moved into a new list. */
-					if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxMutexHolderTCB->uxPriority ] ), &( pxMutexHolderTCB->xStateListItem ) ) != pdFALSE )
+				if( xReturn == pdPASS )
+				{
+					xReturn = xTaskPeriodicCreateWithDeadline( pxTaskCode, pcName, usStackDepth, pvParameters, uxPriority, &xCreated, xMinInterArrival, xDeadline );
+
+					taskENTER_CRITICAL();
 					{
-						if( uxListRemove( &( pxMutexHolderTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+						if( xReturn == pdPASS )
 						{
-							/* It is known that the task is in its ready list so
-							 * there is no need to check again and the port level
-							 * reset macro can be called directly. */
-							portRESET_READY_PRIORITY( pxMutexHolderTCB->uxPriority, uxTopReadyPriority );
+							pxTCB = xCreated;
+							pxEDFSporadicTasks[ uxEDFSporadicTasks++ ] = pxTCB;
+							pxTCB->xTaskSporadic = pdTRUE;
+
+							/* The reservation becomes the density of the task. */
+							ulEDFDensity -= ulDensity;
+							prvEDFSetDensity( pxTCB, ulDensity );
+							pxTCB->uxTaskReleaseNotifyIndex = configEDF_SPORADIC_NOTIFY_INDEX;
+
+							/* The first job is released by the creation. */
+							pxTCB->xTaskLastArrival = taskEDF_TASK_TICK_COUNT( pxTCB );
 						}
 						else
 						{
-							mtCOVERAGE_TEST_MARKER();
+							ulEDFDensity -= ulDensity;
 						}
-
-						/* Inherit the priority before being moved into the new list. */
-						pxMutexHolderTCB->uxPriority = pxCurrentTCB->uxPriority;
-						prvAddTaskToReadyList( pxMutexHolderTCB );
-					}
-					else
-					{
-						/* Just inherit the priority. */
-						pxMutexHolderTCB->uxPriority = pxCurrentTCB->uxPriority;
 					}
-
-					traceTASK_PRIORITY_INHERIT( pxMutexHolderTCB, pxCurrentTCB->uxPriority );
-
-					/* Inheritance occurred. */
-					xReturn = pdTRUE;
+					taskEXIT_CRITICAL();
 				}
 				else
 				{
-					if( pxMutexHolderTCB->uxBasePriority < pxCurrentTCB->uxPriority )
-					{
-						/* The base priority of the mutex holder is lower than the
-						 * priority of the task attempting to take the mutex, but the
-						 * current priority of the mutex holder is not lower than the
-						 * priority of the task attempting to take the mutex.
-						 * Therefore the mutex holder must have already inherited a
-						 * priority, but inheritance would have occurred if that had
-						 * not been the case. */
-						xReturn = pdTRUE;
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+					mtCOVERAGE_TEST_MARKER();
 				}
 			}
-			else
+			( void ) xTaskResumeAll();
+
+			if( xReturn == pdPASS )
 			{
-				mtCOVERAGE_TEST_MARKER();
+				/* Also sets the utilisation and the slack of the task. */
+				vTaskSetWorstCaseExecutionTime( xCreated, xWCET );
+
+				if( pxCreatedTask != NULL )
+				{
+					*pxCreatedTask = xCreated;
+				}
 			}
 
 			return xReturn;
 		}
 
-#endif /* configUSE_MUTEXES */
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
 		/*-----------------------------------------------------------*/
 
-#if ( configUSE_MUTEXES == 1 )
+		BaseType_t xTaskReleaseSporadic( TaskHandle_t xTask )
+		{
+			BaseType_t xReturn;
 
-		BaseType_t xTaskPriorityDisinherit( TaskHandle_t const pxMutexHolder )
+			configASSERT( xTask );
+
+			taskENTER_CRITICAL();
+			{
+				xReturn = prvEDFSporadicArrival( xTask );
+
+				if( xReturn != pdFALSE )
+				{
+					( void ) xTaskNotifyGiveIndexed( xTask, configEDF_SPORADIC_NOTIFY_INDEX );
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			return ( xReturn != pdFALSE ) ? pdPASS : pdFAIL;
+		}
+		/*-----------------------------------------------------------*/
+
+		BaseType_t xTaskReleaseSporadicFromISR( TaskHandle_t xTask,
+				BaseType_t * pxHigherPriorityTaskWoken )
 		{
-			TCB_t * const pxTCB = pxMutexHolder;
-			BaseType_t xReturn = pdFALSE;
+			BaseType_t xReturn;
+			UBaseType_t uxSavedInterruptStatus;
 
-			if( pxMutexHolder != NULL )
+			configASSERT( xTask );
+
+			uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
 			{
-				/* A task can only have an inherited priority if it holds the mutex.
-				 * If the mutex is held by a task then it cannot be given from an
-				 * interrupt, and if a mutex is given by the holding task then it must
-				 * be the running state task. */
-				configASSERT( pxTCB == pxCurrentTCB );
-				configASSERT( pxTCB->uxMutexesHeld );
-				( pxTCB->uxMutexesHeld )--;
+				xReturn = prvEDFSporadicArrival( xTask );
 
-				/* Has the holder of the mutex inherited the priority of another
-				 * task? */
-				if( pxTCB->uxPriority != pxTCB->uxBasePriority )
+				if( xReturn != pdFALSE )
 				{
-					/* Only disinherit if no other mutexes are held. */
-					if( pxTCB->uxMutexesHeld == ( UBaseType_t ) 0 )
-					{
-						/* A task can only have an inherited priority if it holds
-						 * the mutex.  If the mutex is held by a task then it cannot be
-						 * given from an interrupt, and if a mutex is given by the
-						 * holding task then it must be the running state task.  Remove
-						 * the holding task from the ready list. */
-						if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
-						{
-							portRESET_READY_PRIORITY( pxTCB->uxPriority, uxTopReadyPriority );
-						}
-						else
-						{
-							mtCOVERAGE_TEST_MARKER();
-						}
+					vTaskNotifyGiveIndexedFromISR( xTask, configEDF_SPORADIC_NOTIFY_INDEX, pxHigherPriorityTaskWoken );
+				}
+			}
+			taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
 
-						/* Disinherit the priority before adding the task into the
-						 * new  ready list. */
-						traceTASK_PRIORITY_DISINHERIT( pxTCB, pxTCB->uxBasePriority );
-						pxTCB->uxPriority = pxTCB->uxBasePriority;
+			return ( xReturn != pdFALSE ) ? pdPASS : pdFAIL;
+		}
+		/*-----------------------------------------------------------*/
 
-						/* Reset the event list item value.  It cannot be in use for
-						 * any other purpose if this task is running, and it must be
-						 * running to give back the mutex. */
-						listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxTCB->uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-						prvAddTaskToReadyList( pxTCB );
+		BaseType_t xTaskWaitSporadicRelease( TickType_t xTicksToWait )
+		{
+			/* One notification per job released. */
+			return ( ulTaskNotifyTakeIndexed( configEDF_SPORADIC_NOTIFY_INDEX, pdFALSE, xTicksToWait ) != 0UL ) ? pdPASS : pdFAIL;
+		}
+		/*-----------------------------------------------------------*/
 
-						/* Return true to indicate that a context switch is required.
-						 * This is only actually required in the corner case whereby
-						 * multiple mutexes were held and the mutexes were given back
-						 * in an order different to that in which they were taken.
-						 * If a context switch did not occur when the first mutex was
-						 * returned, even if a task was waiting on it, then a context
-						 * switch should occur when the last mutex is returned whether
-						 * a task is waiting on it or not. */
-						xReturn = pdTRUE;
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+		UBaseType_t uxTaskGetSporadicEarlyArrivals( TaskHandle_t xTask )
+		{
+			return prvGetTCBFromHandle( xTask )->uxTaskEarlyArrivals;
+		}
+		/*-----------------------------------------------------------*/
+
+#endif /* configUSE_EDF_SPORADIC */
+
+#if ( taskEDF_USE_WCET )
+
+		void vTaskSetWorstCaseExecutionTime( TaskHandle_t xTask,
+				TickType_t xWCET )
+		{
+			TCB_t * pxTCB;
+#if ( configUSE_EDF_SPORADIC == 1 )
+			uint32_t ulDensity;
+#endif
+
+			taskENTER_CRITICAL();
+			{
+				pxTCB = prvGetTCBFromHandle( xTask );
+				configASSERT( xWCET <= pxTCB->xTaskPeriod );
+
+				/* Applies to the current job straight away. */
+				pxTCB->xTaskWCET = xWCET;
+#if ( configUSE_EDF_SPORADIC == 1 )
+				if( pxTCB != xIdleTaskHandle )
+				{
+					ulDensity = prvEDFDensity( xWCET, pxTCB->xTaskRelativeDeadline );
+
+					/* A sporadic task was admitted with its density, a larger
+					 * one must pass the admission again. */
+					configASSERT( ( pxTCB->xTaskSporadic == pdFALSE ) ||
+						( ulDensity <= pxTCB->ulTaskDensity ) ||
+						( ( ulEDFDensity - pxTCB->ulTaskDensity ) <= ( taskEDF_DENSITY_FULL - ulDensity ) ) );
+
+					prvEDFSetDensity( pxTCB, ulDensity );
 				}
 				else
 				{
 					mtCOVERAGE_TEST_MARKER();
 				}
+#endif
+#if ( configUSE_EDF_DVFS == 1 )
+				prvEDFDvfsSetUtilisation( pxTCB, ( uint32_t ) ( ( ( uint64_t ) xWCET * ( uint64_t ) tskEDF_SPEED_FULL ) / ( uint64_t ) pxTCB->xTaskPeriod ) );
+#endif
 			}
-			else
+			taskEXIT_CRITICAL();
+
+#if ( configUSE_EDF_SLACK_STEALING == 1 )
+			vTaskSuspendAll();
 			{
-				mtCOVERAGE_TEST_MARKER();
+				prvEDFSlackUpdate();
 			}
-
-			return xReturn;
+			( void ) xTaskResumeAll();
+#endif
 		}
 
-#endif /* configUSE_MUTEXES */
-		/*-----------------------------------------------------------*/
+#endif /* taskEDF_USE_WCET */
 
-#if ( configUSE_MUTEXES == 1 )
+#if ( configUSE_EDF_SCHEDULE_TABLE == 1 )
 
-		void vTaskPriorityDisinheritAfterTimeout( TaskHandle_t const pxMutexHolder,
-				UBaseType_t uxHighestPriorityWaitingTask )
+		BaseType_t xTaskScheduleTableBuild( void )
 		{
-			TCB_t * const pxTCB = pxMutexHolder;
-			UBaseType_t uxPriorityUsedOnEntry, uxPriorityToUse;
-			const UBaseType_t uxOnlyOneMutexHeld = ( UBaseType_t ) 1;
+			const ListItem_t * const pxEnd = listGET_END_MARKER( &( xReadyTasksListEDF ) );
+			const ListItem_t * pxItem;
+			TCB_t * pxTCB;
+			UBaseType_t uxTasks = 0U;
+			UBaseType_t uxTask;
+			UBaseType_t uxRunning;
+			UBaseType_t uxLast = taskEDF_TABLE_IDLE + 1U;
+			UBaseType_t uxEntries = 0U;
+			TickType_t xHyperperiod = 1U;
+			TickType_t xTick;
+			TickType_t xDivisor;
+			TickType_t xRemainder;
+			BaseType_t xReturn = pdPASS;
 
-			if( pxMutexHolder != NULL )
+			/* Before the scheduler starts every task created is ready. */
+			configASSERT( xSchedulerRunning == pdFALSE );
+
+			uxEDFTableEntries = 0U;
+
+			for( pxItem = listGET_HEAD_ENTRY( &( xReadyTasksListEDF ) ); ( pxItem != pxEnd ) && ( xReturn == pdPASS ); pxItem = listGET_NEXT( pxItem ) )
 			{
-				/* If pxMutexHolder is not NULL then the holder must hold at least
-				 * one mutex. */
-				configASSERT( pxTCB->uxMutexesHeld );
+				pxTCB = listGET_LIST_ITEM_OWNER( pxItem ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
 
-				/* Determine the priority to which the priority of the task that
-				 * holds the mutex should be set.  This will be the greater of the
-				 * holding task's base priority and the priority of the highest
-				 * priority task that is waiting to obtain the mutex. */
-				if( pxTCB->uxBasePriority < uxHighestPriorityWaitingTask )
+				if( ( uxTasks == ( UBaseType_t ) configEDF_SCHEDULE_TABLE_MAX_TASKS ) || ( pxTCB->xTaskPeriod == 0U ) )
 				{
-					uxPriorityToUse = uxHighestPriorityWaitingTask;
+					xReturn = pdFAIL;
 				}
-				else
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+				else if( pxTCB->uxTaskReleaseNotifyIndex != tskEDF_NO_RELEASE_ON_NOTIFY )
 				{
-					uxPriorityToUse = pxTCB->uxBasePriority;
+					xReturn = pdFAIL;
 				}
-
-				/* Does the priority need to change? */
-				if( pxTCB->uxPriority != uxPriorityToUse )
+#endif
+				else
 				{
-					/* Only disinherit if no other mutexes are held.  This is a
-					 * simplification in the priority inheritance implementation.  If
-					 * the task that holds the mutex is also holding other mutexes then
-					 * the other mutexes may have caused the priority inheritance. */
-					if( pxTCB->uxMutexesHeld == uxOnlyOneMutexHeld )
+					/* The hyperperiod so far divided by its greatest common divisor
+					 * with the period, times the period. */
+					xDivisor = xHyperperiod;
+					xTick = pxTCB->xTaskPeriod;
+
+					while( xTick != 0U )
 					{
-						/* If a task has timed out because it already holds the
-						 * mutex it was trying to obtain then it cannot of inherited
-						 * its own priority. */
-						configASSERT( pxTCB != pxCurrentTCB );
+						xRemainder = xDivisor % xTick;
+						xDivisor = xTick;
+						xTick = xRemainder;
+					}
 
-						/* Disinherit the priority, remembering the previous
-						 * priority to facilitate determining the subject task's
-						 * state. */
-						traceTASK_PRIORITY_DISINHERIT( pxTCB, uxPriorityToUse );
-						uxPriorityUsedOnEntry = pxTCB->uxPriority;
-						pxTCB->uxPriority = uxPriorityToUse;
+					if( ( xHyperperiod / xDivisor ) > ( configEDF_SCHEDULE_TABLE_MAX_HYPERPERIOD / pxTCB->xTaskPeriod ) )
+					{
+						xReturn = pdFAIL;
+					}
+					else
+					{
+						xHyperperiod = ( xHyperperiod / xDivisor ) * pxTCB->xTaskPeriod;
+						pxEDFTableTasks[ uxTasks ] = pxTCB;
+						xEDFTableLeft[ uxTasks ] = 0U;
+						uxTasks++;
+					}
+				}
+			}
 
-						/* Only reset the event list item value if the value is not
-						 * being used for anything else. */
-						if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+			/* EDF with every job released at the start of its period and taking
+			 * its WCET, a switch point recorded whenever another task runs. */
+			for( xTick = 0U; ( xTick < xHyperperiod ) && ( xReturn == pdPASS ); xTick++ )
+			{
+				uxRunning = taskEDF_TABLE_IDLE;
+
+				for( uxTask = 0U; uxTask < uxTasks; uxTask++ )
+				{
+					pxTCB = pxEDFTableTasks[ uxTask ];
+
+					if( ( xTick % pxTCB->xTaskPeriod ) == 0U )
+					{
+						/* The deadline is no later than the next release. */
+						if( xEDFTableLeft[ uxTask ] > 0U )
 						{
-							listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxPriorityToUse ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+							xReturn = pdFAIL;
 						}
-						else
+
+						xEDFTableLeft[ uxTask ] = pxTCB->xTaskWCET;
+						xEDFTableDeadline[ uxTask ] = xTick + pxTCB->xTaskRelativeDeadline;
+					}
+
+					if( xEDFTableLeft[ uxTask ] > 0U )
+					{
+						if( xEDFTableDeadline[ uxTask ] <= xTick )
 						{
-							mtCOVERAGE_TEST_MARKER();
+							xReturn = pdFAIL;
 						}
-
-						/* If the running task is not the task that holds the mutex
-						 * then the task that holds the mutex could be in either the
-						 * Ready, Blocked or Suspended states.  Only remove the task
-						 * from its current state list if it is in the Ready state as
-						 * the task's priority is going to change and there is one
-						 * Ready list per priority. */
-						if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+						else if( ( uxRunning == taskEDF_TABLE_IDLE ) ||
+								 ( xEDFTableDeadline[ uxTask ] < xEDFTableDeadline[ uxRunning ] ) ||
+								 ( ( xEDFTableDeadline[ uxTask ] == xEDFTableDeadline[ uxRunning ] ) && ( uxTask == uxLast ) ) )
 						{
-							if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
-							{
-								/* It is known that the task is in its ready list so
-								 * there is no need to check again and the port level
-								 * reset macro can be called directly. */
-								portRESET_READY_PRIORITY( pxTCB->uxPriority, uxTopReadyPriority );
-							}
-							else
-							{
-								mtCOVERAGE_TEST_MARKER();
-							}
-
-							prvAddTaskToReadyList( pxTCB );
+							/* On equal deadlines the task already running goes on. */
+							uxRunning = uxTask;
 						}
 						else
 						{
 							mtCOVERAGE_TEST_MARKER();
 						}
 					}
+				}
+
+				if( uxRunning != uxLast )
+				{
+					if( uxEntries == ( UBaseType_t ) configEDF_SCHEDULE_TABLE_SIZE )
+					{
+						xReturn = pdFAIL;
+					}
 					else
 					{
-						mtCOVERAGE_TEST_MARKER();
+						xEDFTable[ uxEntries ].xTick = xTick;
+						xEDFTable[ uxEntries ].pxTask = ( uxRunning == taskEDF_TABLE_IDLE ) ? NULL : pxEDFTableTasks[ uxRunning ];
+						uxEntries++;
+						uxLast = uxRunning;
 					}
 				}
-				else
+
+				if( uxRunning != taskEDF_TABLE_IDLE )
 				{
-					mtCOVERAGE_TEST_MARKER();
+					xEDFTableLeft[ uxRunning ]--;
 				}
 			}
-			else
+
+			/* The last jobs are due by the end of the hyperperiod. */
+			for( uxTask = 0U; ( uxTask < uxTasks ) && ( xReturn == pdPASS ); uxTask++ )
 			{
-				mtCOVERAGE_TEST_MARKER();
+				if( xEDFTableLeft[ uxTask ] > 0U )
+				{
+					xReturn = pdFAIL;
+				}
 			}
-		}
 
-#endif /* configUSE_MUTEXES */
+			if( xReturn == pdPASS )
+			{
+				xEDFTableHyperperiod = xHyperperiod;
+				uxEDFTableEntries = uxEntries;
+			}
+
+			return xReturn;
+		}
 		/*-----------------------------------------------------------*/
 
-#if ( portCRITICAL_NESTING_IN_TCB == 1 )
+		BaseType_t xTaskScheduleTableActive( void )
+		{
+			return xEDFTableActive;
+		}
+		/*-----------------------------------------------------------*/
 
-		void vTaskEnterCritical( void )
+		static BaseType_t prvEDFTableTick( void )
 		{
-			portDISABLE_INTERRUPTS();
+			BaseType_t xReturn = pdFALSE;
 
-			if( xSchedulerRunning != pdFALSE )
+			if( pxCurrentTCB != ( TCB_t * ) xIdleTaskHandle )
 			{
-				( pxCurrentTCB->uxCriticalNesting )++;
+				( pxCurrentTCB->xTaskTableRun )++;
 
-				/* This is not the interrupt safe version of the enter critical
-				 * function so  assert() if it is being called from an interrupt
-				 * context.  Only API functions that end in "FromISR" can be used in an
-				 * interrupt.  Only assert if the critical nesting count is 1 to
-				 * protect against recursive calls if the assert function also uses a
-				 * critical section. */
-				if( pxCurrentTCB->uxCriticalNesting == 1 )
+				if( pxCurrentTCB->xTaskTableRun > pxCurrentTCB->xTaskWCET )
 				{
-					portASSERT_IF_IN_ISR();
+					/* The job overran, the rest of the table no longer holds. */
+					prvEDFTableStop();
+
+					return pdTRUE;
 				}
 			}
-			else
+
+			xEDFTableOffset++;
+
+			if( xEDFTableOffset == xEDFTableHyperperiod )
 			{
-				mtCOVERAGE_TEST_MARKER();
+				xEDFTableOffset = 0U;
+				uxEDFTableNext = 0U;
 			}
-		}
 
-#endif /* portCRITICAL_NESTING_IN_TCB */
+			if( ( uxEDFTableNext < uxEDFTableEntries ) && ( xEDFTable[ uxEDFTableNext ].xTick == xEDFTableOffset ) )
+			{
+				pxEDFTableTask = xEDFTable[ uxEDFTableNext ].pxTask;
+				uxEDFTableNext++;
+				xReturn = pdTRUE;
+			}
+
+			return xReturn;
+		}
 		/*-----------------------------------------------------------*/
 
-#if ( portCRITICAL_NESTING_IN_TCB == 1 )
+		static void prvEDFTableStop( void )
+		{
+			List_t xSorted;
+			ListItem_t * pxItem;
 
-		void vTaskExitCritical( void )
+			xEDFTableActive = pdFALSE;
+
+			/* Sort through a list of their own, then put back in order. */
+			vListInitialise( &xSorted );
+
+			while( listLIST_IS_EMPTY( &( xReadyTasksListEDF ) ) == pdFALSE )
+			{
+				pxItem = listGET_HEAD_ENTRY( &( xReadyTasksListEDF ) );
+				( void ) uxListRemove( pxItem );
+				vListInsert( &xSorted, pxItem );
+			}
+
+			while( listLIST_IS_EMPTY( &xSorted ) == pdFALSE )
+			{
+				pxItem = listGET_HEAD_ENTRY( &xSorted );
+				( void ) uxListRemove( pxItem );
+				listINSERT_END( &( xReadyTasksListEDF ), pxItem );
+			}
+
+			/* The task running may not have the earliest deadline. */
+			xYieldPending = pdTRUE;
+		}
+		/*-----------------------------------------------------------*/
+
+		static void prvEDFTableSelect( void )
 		{
-			if( xSchedulerRunning != pdFALSE )
+			const ListItem_t * const pxEnd = listGET_END_MARKER( &( xReadyTasksListEDF ) );
+			const ListItem_t * pxItem;
+			TCB_t * const pxTask = pxEDFTableTask;
+			TCB_t * pxTCB;
+
+			if( ( pxTask != NULL ) && ( listIS_CONTAINED_WITHIN( &( xReadyTasksListEDF ), &( pxTask->xStateListItem ) ) != pdFALSE ) )
 			{
-				if( pxCurrentTCB->uxCriticalNesting > 0U )
+				pxCurrentTCB = pxTask;
+			}
+			else
+			{
+				/* The list is not sorted while the table is active. */
+				pxCurrentTCB = ( TCB_t * ) xIdleTaskHandle;
+
+				for( pxItem = listGET_HEAD_ENTRY( &( xReadyTasksListEDF ) ); pxItem != pxEnd; pxItem = listGET_NEXT( pxItem ) )
 				{
-					( pxCurrentTCB->uxCriticalNesting )--;
+					pxTCB = listGET_LIST_ITEM_OWNER( pxItem ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
 
-					if( pxCurrentTCB->uxCriticalNesting == 0U )
+					if( ( pxCurrentTCB == ( TCB_t * ) xIdleTaskHandle ) ||
+						( ( pxTCB != ( TCB_t * ) xIdleTaskHandle ) && ( listGET_LIST_ITEM_VALUE( pxItem ) < listGET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ) ) ) ) )
 					{
-						portENABLE_INTERRUPTS();
+						pxCurrentTCB = pxTCB;
 					}
 					else
 					{
 						mtCOVERAGE_TEST_MARKER();
 					}
 				}
+
+				if( pxCurrentTCB == ( TCB_t * ) xIdleTaskHandle )
+				{
+					/* Nothing to run, as in the table. */
+					mtCOVERAGE_TEST_MARKER();
+				}
+				else if( pxTask == NULL )
+				{
+					/* A job is ready in a slot the table leaves idle: one overran
+					 * or was released outside the table. */
+					prvEDFTableStop();
+					xYieldPending = pdFALSE;
+					pxCurrentTCB = listGET_OWNER_OF_HEAD_ENTRY( &( xReadyTasksListEDF ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+				}
 				else
 				{
+					/* The job of the slot completed early, the earliest deadline
+					 * runs in the time left. */
 					mtCOVERAGE_TEST_MARKER();
 				}
 			}
-			else
-			{
-				mtCOVERAGE_TEST_MARKER();
-			}
 		}
 
-#endif /* portCRITICAL_NESTING_IN_TCB */
-		/*-----------------------------------------------------------*/
+#endif /* configUSE_EDF_SCHEDULE_TABLE */
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
+#if ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 )
 
-		static char * prvWriteNameToBuffer( char * pcBuffer,
-				const char * pcTaskName )
+		void vTaskSetPreemptionThreshold( TaskHandle_t xTask,
+				TickType_t xThreshold )
 		{
-			size_t x;
-
-			/* Start by copying the entire string. */
-			strcpy( pcBuffer, pcTaskName );
-
-			/* Pad the end of the string with spaces to ensure columns line up when
-			 * printed out. */
-			for( x = strlen( pcBuffer ); x < ( size_t ) ( configMAX_TASK_NAME_LEN - 1 ); x++ )
+			taskENTER_CRITICAL();
 			{
-				pcBuffer[ x ] = ' ';
+				/* Applies from the next preemption test. */
+				prvGetTCBFromHandle( xTask )->xTaskPreemptionThreshold = xThreshold;
 			}
-
-			/* Terminate. */
-			pcBuffer[ x ] = ( char ) 0x00;
-
-			/* Return the new end of string. */
-			return &( pcBuffer[ x ] );
+			taskEXIT_CRITICAL();
 		}
+		/*-----------------------------------------------------------*/
 
-#endif /* ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) */
-		/*-----------------------------------------------------------*/
-
-#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
-
-		void vTaskList( char * pcWriteBuffer )
-		{
-			TaskStatus_t * pxTaskStatusArray;
-			UBaseType_t uxArraySize, x;
-			char cStatus;
-
-			/*
-			 * PLEASE NOTE:
-			 *
-			 * This function is provided for convenience only, and is used by many
-			 * of the demo applications.  Do not consider it to be part of the
-			 * scheduler.
-			 *
-			 * vTaskList() calls uxTaskGetSystemState(), then formats part of the
-			 * uxTaskGetSystemState() output into a human readable table that
-			 * displays task: names, states, priority, stack usage and task number.
-			 * Stack usage specified as the number of unused StackType_t words stack can hold
-			 * on top of stack - not the number of bytes.
-			 *
-			 * vTaskList() has a dependency on the sprintf() C library function that
-			 * might bloat the code size, use a lot of stack, and provide different
-			 * results on different platforms.  An alternative, tiny, third party,
-			 * and limited functionality implementation of sprintf() is provided in
-			 * many of the FreeRTOS/Demo sub-directories in a file called
-			 * printf-stdarg.c (note printf-stdarg.c does not provide a full
-			 * snprintf() implementation!).
-			 *
-			 * It is recommended that production systems call uxTaskGetSystemState()
-			 * directly to get access to raw stats data, rather than indirectly
-			 * through a call to vTaskList().
-			 */
-
+		TickType_t xTaskGetPreemptionThreshold( TaskHandle_t xTask )
+		{
+			return prvGetTCBFromHandle( xTask )->xTaskPreemptionThreshold;
+		}
+		/*-----------------------------------------------------------*/
 
-			/* Make sure the write buffer does not contain a string. */
-			*pcWriteBuffer = ( char ) 0x00;
+		BaseType_t xTaskAssignPreemptionThresholds( void )
+		{
+			const ListItem_t * const pxEnd = listGET_END_MARKER( &( xReadyTasksListEDF ) );
+			const ListItem_t * pxItem;
+			TCB_t * pxTCB;
+			UBaseType_t uxTasks = 0U;
+			UBaseType_t uxTask;
+			UBaseType_t uxOther;
+			TickType_t xThreshold;
+			TickType_t xBlocked;
+			BaseType_t xReturn = pdPASS;
 
-			/* Take a snapshot of the number of tasks in case it changes while this
-			 * function is executing. */
-			uxArraySize = uxCurrentNumberOfTasks;
+			/* Before the scheduler starts every task created is ready. */
+			configASSERT( xSchedulerRunning == pdFALSE );
 
-			/* Allocate an array index for each task.  NOTE!  if
-			 * configSUPPORT_DYNAMIC_ALLOCATION is set to 0 then pvPortMalloc() will
-			 * equate to NULL. */
-			pxTaskStatusArray = pvPortMalloc( uxCurrentNumberOfTasks * sizeof( TaskStatus_t ) ); /*lint !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack and this allocation allocates a struct that has the alignment requirements of a pointer. */
+			/* By increasing relative deadline, the idle task is not created yet. */
+			for( pxItem = listGET_HEAD_ENTRY( &( xReadyTasksListEDF ) ); ( pxItem != pxEnd ) && ( xReturn == pdPASS ); pxItem = listGET_NEXT( pxItem ) )
+			{
+				pxTCB = listGET_LIST_ITEM_OWNER( pxItem ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
 
-			if( pxTaskStatusArray != NULL )
+				if( ( uxTasks == ( UBaseType_t ) configEDF_THRESHOLD_MAX_TASKS ) || ( pxTCB->xTaskRelativeDeadline == 0U ) )
+				{
+					xReturn = pdFAIL;
+				}
+				else
+				{
+					for( uxTask = uxTasks; ( uxTask > 0U ) && ( pxEDFThresholdTasks[ uxTask - 1U ]->xTaskRelativeDeadline > pxTCB->xTaskRelativeDeadline ); uxTask-- )
+					{
+						pxEDFThresholdTasks[ uxTask ] = pxEDFThresholdTasks[ uxTask - 1U ];
+					}
+
+					pxEDFThresholdTasks[ uxTask ] = pxTCB;
+					uxTasks++;
+				}
+			}
+
+			for( uxTask = 0U; ( uxTask < uxTasks ) && ( xReturn == pdPASS ); uxTask++ )
 			{
-				/* Generate the (binary) data. */
-				uxArraySize = uxTaskGetSystemState( pxTaskStatusArray, uxArraySize, NULL );
+				ulEDFThresholdDensity[ uxTask ] = 0UL;
+				xEDFThresholdBlocking[ uxTask ] = 0U;
 
-				/* Create a human readable table from the binary data. */
-				for( x = 0; x < uxArraySize; x++ )
+				for( uxOther = 0U; uxOther < uxTasks; uxOther++ )
 				{
-					switch( pxTaskStatusArray[ x ].eCurrentState )
+					if( pxEDFThresholdTasks[ uxOther ]->xTaskRelativeDeadline <= pxEDFThresholdTasks[ uxTask ]->xTaskRelativeDeadline )
 					{
-					case eRunning:
-						cStatus = tskRUNNING_CHAR;
-						break;
+						ulEDFThresholdDensity[ uxTask ] += ( uint32_t ) ( ( ( ( uint64_t ) pxEDFThresholdTasks[ uxOther ]->xTaskWCET * ( uint64_t ) taskEDF_THRESHOLD_FULL ) + ( uint64_t ) pxEDFThresholdTasks[ uxOther ]->xTaskRelativeDeadline - 1U ) /
+															  ( uint64_t ) pxEDFThresholdTasks[ uxOther ]->xTaskRelativeDeadline );
+					}
+				}
 
-					case eReady:
-						cStatus = tskREADY_CHAR;
-						break;
+				/* Not schedulable even without thresholds, as far as the test
+				 * can tell. */
+				if( ulEDFThresholdDensity[ uxTask ] > taskEDF_THRESHOLD_FULL )
+				{
+					xReturn = pdFAIL;
+				}
+			}
 
-					case eBlocked:
-						cStatus = tskBLOCKED_CHAR;
-						break;
+			for( uxTask = 0U; ( uxTask < uxTasks ) && ( xReturn == pdPASS ); uxTask++ )
+			{
+				pxTCB = pxEDFThresholdTasks[ uxTask ];
+				xThreshold = portMAX_DELAY;
 
-					case eSuspended:
-						cStatus = tskSUSPENDED_CHAR;
-						break;
+				/* Walk down the tasks of lower relative deadline while the task
+				 * can block them.  Tasks of equal relative deadline are held off
+				 * together, so the threshold only stops at the first of them. */
+				for( uxOther = uxTask; uxOther > 0U; uxOther-- )
+				{
+					if( pxEDFThresholdTasks[ uxOther - 1U ]->xTaskRelativeDeadline < pxTCB->xTaskRelativeDeadline )
+					{
+						xBlocked = ( xEDFThresholdBlocking[ uxOther - 1U ] > pxTCB->xTaskWCET ) ? xEDFThresholdBlocking[ uxOther - 1U ] : pxTCB->xTaskWCET;
 
-					case eDeleted:
-						cStatus = tskDELETED_CHAR;
-						break;
+						if( ( ulEDFThresholdDensity[ uxOther - 1U ] +
+							  ( uint32_t ) ( ( ( ( uint64_t ) xBlocked * ( uint64_t ) taskEDF_THRESHOLD_FULL ) + ( uint64_t ) pxEDFThresholdTasks[ uxOther - 1U ]->xTaskRelativeDeadline - 1U ) /
+											 ( uint64_t ) pxEDFThresholdTasks[ uxOther - 1U ]->xTaskRelativeDeadline ) ) > taskEDF_THRESHOLD_FULL )
+						{
+							break;
+						}
 
-					case eInvalid: /* Fall through. */
-					default:       /* Should not get here, but it is included
-					 * to prevent static checking errors. */
-					 cStatus = ( char ) 0x00;
-					break;
+						if( ( uxOther == 1U ) || ( pxEDFThresholdTasks[ uxOther - 2U ]->xTaskRelativeDeadline < pxEDFThresholdTasks[ uxOther - 1U ]->xTaskRelativeDeadline ) )
+						{
+							xThreshold = pxEDFThresholdTasks[ uxOther - 1U ]->xTaskRelativeDeadline;
+						}
 					}
+				}
 
-					/* Write the task name to the string, padding with spaces so it
-					 * can be printed in tabular form more easily. */
-					pcWriteBuffer = prvWriteNameToBuffer( pcWriteBuffer, pxTaskStatusArray[ x ].pcTaskName );
-
-					/* Write the rest of the string. */
-					sprintf( pcWriteBuffer, "\t%c\t%u\t%u\t%u\r\n", cStatus, ( unsigned int ) pxTaskStatusArray[ x ].uxCurrentPriority, ( unsigned int ) pxTaskStatusArray[ x ].usStackHighWaterMark, ( unsigned int ) pxTaskStatusArray[ x ].xTaskNumber ); /*lint !e586 sprintf() allowed as this is compiled with many compilers and this is a utility function only - not part of the core kernel implementation. */
-					pcWriteBuffer += strlen( pcWriteBuffer );                                                                                                                                                                                                /*lint !e9016 Pointer arithmetic ok on char pointers especially as in this case where it best denotes the intent of the code. */
+				for( uxOther = 0U; uxOther < uxTask; uxOther++ )
+				{
+					if( ( pxEDFThresholdTasks[ uxOther ]->xTaskRelativeDeadline >= xThreshold ) &&
+						( pxEDFThresholdTasks[ uxOther ]->xTaskRelativeDeadline < pxTCB->xTaskRelativeDeadline ) &&
+						( xEDFThresholdBlocking[ uxOther ] < pxTCB->xTaskWCET ) )
+					{
+						xEDFThresholdBlocking[ uxOther ] = pxTCB->xTaskWCET;
+					}
 				}
 
-				/* Free the array again.  NOTE!  If configSUPPORT_DYNAMIC_ALLOCATION
-				 * is 0 then vPortFree() will be #defined to nothing. */
-				vPortFree( pxTaskStatusArray );
+				pxTCB->xTaskPreemptionThreshold = xThreshold;
+			}
+
+			return xReturn;
+		}
+		/*-----------------------------------------------------------*/
+
+		static void prvEDFThresholdSelect( void )
+		{
+			TCB_t * const pxRunning = pxCurrentTCB;
+			const ListItem_t * pxItem;
+			TCB_t * pxTCB;
+
+			if( ( pxRunning->xTaskPreemptionThreshold != portMAX_DELAY ) &&
+				( listIS_CONTAINED_WITHIN( &( xReadyTasksListEDF ), &( pxRunning->xStateListItem ) ) != pdFALSE ) )
+			{
+				/* Only the tasks ahead of the running one have a deadline that is
+				 * not later. */
+				for( pxItem = listGET_HEAD_ENTRY( &( xReadyTasksListEDF ) ); pxItem != &( pxRunning->xStateListItem ); pxItem = listGET_NEXT( pxItem ) )
+				{
+					pxTCB = listGET_LIST_ITEM_OWNER( pxItem ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+					if( pxTCB->xTaskRelativeDeadline < pxRunning->xTaskPreemptionThreshold )
+					{
+						pxCurrentTCB = pxTCB;
+						break;
+					}
+				}
 			}
 			else
 			{
-				mtCOVERAGE_TEST_MARKER();
+				pxCurrentTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( &( xReadyTasksListEDF ) );
 			}
 		}
 
-#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
-		/*----------------------------------------------------------*/
+#endif /* configUSE_EDF_PREEMPTION_THRESHOLD */
 
-#if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+#if ( configUSE_EDF_DEFERRED_PREEMPTION == 1 )
 
-		void vTaskGetRunTimeStats( char * pcWriteBuffer )
+		void vTaskSetNonPreemptiveRegion( TaskHandle_t xTask,
+				TickType_t xTicks )
 		{
-			TaskStatus_t * pxTaskStatusArray;
-			UBaseType_t uxArraySize, x;
-			configRUN_TIME_COUNTER_TYPE ulTotalTime, ulStatsAsPercentage;
-
-#if ( configUSE_TRACE_FACILITY != 1 )
+			taskENTER_CRITICAL();
 			{
-#error configUSE_TRACE_FACILITY must also be set to 1 in FreeRTOSConfig.h to use vTaskGetRunTimeStats().
+				prvGetTCBFromHandle( xTask )->xTaskNonPreemptiveTicks = xTicks;
 			}
-#endif
+			taskEXIT_CRITICAL();
+		}
+		/*-----------------------------------------------------------*/
 
-			/*
-			 * PLEASE NOTE:
-			 *
-			 * This function is provided for convenience only, and is used by many
-			 * of the demo applications.  Do not consider it to be part of the
-			 * scheduler.
-			 *
-			 * vTaskGetRunTimeStats() calls uxTaskGetSystemState(), then formats part
-			 * of the uxTaskGetSystemState() output into a human readable table that
-			 * displays the amount of time each task has spent in the Running state
-			 * in both absolute and percentage terms.
-			 *
-			 * vTaskGetRunTimeStats() has a dependency on the sprintf() C library
-			 * function that might bloat the code size, use a lot of stack, and
-			 * provide different results on different platforms.  An alternative,
-			 * tiny, third party, and limited functionality implementation of
-			 * sprintf() is provided in many of the FreeRTOS/Demo sub-directories in
-			 * a file called printf-stdarg.c (note printf-stdarg.c does not provide
-			 * a full snprintf() implementation!).
-			 *
-			 * It is recommended that production systems call uxTaskGetSystemState()
-			 * directly to get access to raw stats data, rather than indirectly
-			 * through a call to vTaskGetRunTimeStats().
-			 */
+		TickType_t xTaskGetNonPreemptiveRegion( TaskHandle_t xTask )
+		{
+			return prvGetTCBFromHandle( xTask )->xTaskNonPreemptiveTicks;
+		}
+		/*-----------------------------------------------------------*/
 
-			/* Make sure the write buffer does not contain a string. */
-			*pcWriteBuffer = ( char ) 0x00;
+		void vTaskPreemptionPoint( void )
+		{
+			BaseType_t xYield = pdFALSE;
 
-			/* Take a snapshot of the number of tasks in case it changes while this
-			 * function is executing. */
-			uxArraySize = uxCurrentNumberOfTasks;
+			taskENTER_CRITICAL();
+			{
+				if( xEDFPreemptionDeferred != pdFALSE )
+				{
+					xEDFPreemptionDeferred = pdFALSE;
+					xYield = pdTRUE;
+				}
+			}
+			taskEXIT_CRITICAL();
 
-			/* Allocate an array index for each task.  NOTE!  If
-			 * configSUPPORT_DYNAMIC_ALLOCATION is set to 0 then pvPortMalloc() will
-			 * equate to NULL. */
-			pxTaskStatusArray = pvPortMalloc( uxCurrentNumberOfTasks * sizeof( TaskStatus_t ) ); /*lint !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack and this allocation allocates a struct that has the alignment requirements of a pointer. */
+			if( xYield != pdFALSE )
+			{
+				portYIELD_WITHIN_API();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		/*-----------------------------------------------------------*/
 
-			if( pxTaskStatusArray != NULL )
+		BaseType_t xTaskAssignNonPreemptiveRegions( void )
+		{
+			const ListItem_t * const pxEnd = listGET_END_MARKER( &( xReadyTasksListEDF ) );
+			const ListItem_t * pxItem;
+			const ListItem_t * pxOther;
+			TCB_t * pxTCB;
+			TCB_t * pxOtherTCB;
+			TickType_t xTicks;
+			TickType_t xTime;
+			TickType_t xDemand;
+			TickType_t xLongest = 0U;
+			BaseType_t xReturn = pdPASS;
+
+			/* Before the scheduler starts every task created is ready. */
+			configASSERT( xSchedulerRunning == pdFALSE );
+
+			for( pxItem = listGET_HEAD_ENTRY( &( xReadyTasksListEDF ) ); ( pxItem != pxEnd ) && ( xReturn == pdPASS ); pxItem = listGET_NEXT( pxItem ) )
 			{
-				/* Generate the (binary) data. */
-				uxArraySize = uxTaskGetSystemState( pxTaskStatusArray, uxArraySize, &ulTotalTime );
+				pxTCB = listGET_LIST_ITEM_OWNER( pxItem ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
 
-				/* For percentage calculations. */
-				ulTotalTime /= 100UL;
+				if( pxTCB->xTaskPeriod == 0U )
+				{
+					xReturn = pdFAIL;
+				}
+				else if( pxTCB->xTaskRelativeDeadline > xLongest )
+				{
+					xLongest = pxTCB->xTaskRelativeDeadline;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
 
-				/* Avoid divide by zero errors. */
-				if( ulTotalTime > 0UL )
+			/* No slack may be negative at the deadlines the regions are computed
+			 * over, the tasks would miss deadlines even fully preemptive.  Checked
+			 * first so the regions are left unchanged if the test fails. */
+			for( pxOther = listGET_HEAD_ENTRY( &( xReadyTasksListEDF ) ); ( pxOther != pxEnd ) && ( xReturn == pdPASS ); pxOther = listGET_NEXT( pxOther ) )
+			{
+				pxOtherTCB = listGET_LIST_ITEM_OWNER( pxOther ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+				for( xTime = pxOtherTCB->xTaskRelativeDeadline; ( xTime < xLongest ) && ( xReturn == pdPASS ); xTime += pxOtherTCB->xTaskPeriod )
 				{
-					/* Create a human readable table from the binary data. */
-					for( x = 0; x < uxArraySize; x++ )
+					if( prvEDFDemandBound( xTime ) > xTime )
 					{
-						/* What percentage of the total run time has the task used?
-						 * This will always be rounded down to the nearest integer.
-						 * ulTotalRunTime has already been divided by 100. */
-						ulStatsAsPercentage = pxTaskStatusArray[ x ].ulRunTimeCounter / ulTotalTime;
+						xReturn = pdFAIL;
+					}
+				}
+			}
 
-						/* Write the task name to the string, padding with
-						 * spaces so it can be printed in tabular form more
-						 * easily. */
-						pcWriteBuffer = prvWriteNameToBuffer( pcWriteBuffer, pxTaskStatusArray[ x ].pcTaskName );
+			/* The region of a task holds off the jobs of the tasks of lower
+			 * relative deadline, due before that of the task, for its length.
+			 * It never needs to be longer than a job. */
+			for( pxItem = listGET_HEAD_ENTRY( &( xReadyTasksListEDF ) ); ( pxItem != pxEnd ) && ( xReturn == pdPASS ); pxItem = listGET_NEXT( pxItem ) )
+			{
+				pxTCB = listGET_LIST_ITEM_OWNER( pxItem ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+				xTicks = pxTCB->xTaskWCET;
 
-						if( ulStatsAsPercentage > 0UL )
-						{
-#ifdef portLU_PRINTF_SPECIFIER_REQUIRED
-							{
-								sprintf( pcWriteBuffer, "\t%lu\t\t%lu%%\r\n", pxTaskStatusArray[ x ].ulRunTimeCounter, ulStatsAsPercentage );
-							}
-#else
-							{
-								/* sizeof( int ) == sizeof( long ) so a smaller
-								 * printf() library can be used. */
-								sprintf( pcWriteBuffer, "\t%u\t\t%u%%\r\n", ( unsigned int ) pxTaskStatusArray[ x ].ulRunTimeCounter, ( unsigned int ) ulStatsAsPercentage ); /*lint !e586 sprintf() allowed as this is compiled with many compilers and this is a utility function only - not part of the core kernel implementation. */
-							}
-#endif
-						}
-						else
+				for( pxOther = listGET_HEAD_ENTRY( &( xReadyTasksListEDF ) ); pxOther != pxEnd; pxOther = listGET_NEXT( pxOther ) )
+				{
+					pxOtherTCB = listGET_LIST_ITEM_OWNER( pxOther ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+					for( xTime = pxOtherTCB->xTaskRelativeDeadline; xTime < pxTCB->xTaskRelativeDeadline; xTime += pxOtherTCB->xTaskPeriod )
+					{
+						xDemand = prvEDFDemandBound( xTime );
+
+						if( ( xTime - xDemand ) < xTicks )
 						{
-							/* If the percentage is zero here then the task has
-							 * consumed less than 1% of the total run time. */
-#ifdef portLU_PRINTF_SPECIFIER_REQUIRED
-							{
-								sprintf( pcWriteBuffer, "\t%lu\t\t<1%%\r\n", pxTaskStatusArray[ x ].ulRunTimeCounter );
-							}
-#else
-							{
-								/* sizeof( int ) == sizeof( long ) so a smaller
-								 * printf() library can be used. */
-								sprintf( pcWriteBuffer, "\t%u\t\t<1%%\r\n", ( unsigned int ) pxTaskStatusArray[ x ].ulRunTimeCounter ); /*lint !e586 sprintf() allowed as this is compiled with many compilers and this is a utility function only - not part of the core kernel implementation. */
-							}
-#endif
+							xTicks = xTime - xDemand;
 						}
-
-						pcWriteBuffer += strlen( pcWriteBuffer ); /*lint !e9016 Pointer arithmetic ok on char pointers especially as in this case where it best denotes the intent of the code. */
 					}
 				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
 
-				/* Free the array again.  NOTE!  If configSUPPORT_DYNAMIC_ALLOCATION
-				 * is 0 then vPortFree() will be #defined to nothing. */
-				vPortFree( pxTaskStatusArray );
+				pxTCB->xTaskNonPreemptiveTicks = xTicks;
 			}
-			else
+
+			return xReturn;
+		}
+		/*-----------------------------------------------------------*/
+
+		static TickType_t prvEDFDemandBound( TickType_t xTime )
+		{
+			const ListItem_t * const pxEnd = listGET_END_MARKER( &( xReadyTasksListEDF ) );
+			const ListItem_t * pxItem;
+			TCB_t * pxTCB;
+			TickType_t xDemand = 0U;
+
+			for( pxItem = listGET_HEAD_ENTRY( &( xReadyTasksListEDF ) ); pxItem != pxEnd; pxItem = listGET_NEXT( pxItem ) )
 			{
-				mtCOVERAGE_TEST_MARKER();
+				pxTCB = listGET_LIST_ITEM_OWNER( pxItem ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+				if( xTime >= pxTCB->xTaskRelativeDeadline )
+				{
+					xDemand += ( ( ( xTime - pxTCB->xTaskRelativeDeadline ) / pxTCB->xTaskPeriod ) + 1U ) * pxTCB->xTaskWCET;
+				}
 			}
-		}
 
-#endif /* ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) ) */
+			return xDemand;
+		}
 		/*-----------------------------------------------------------*/
 
-		TickType_t uxTaskResetEventItemValue( void )
+		static BaseType_t prvEDFPreemptNow( void )
 		{
-			TickType_t uxReturn;
+			BaseType_t xReturn = pdTRUE;
 
-			uxReturn = listGET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ) );
+			if( pxCurrentTCB->xTaskNonPreemptiveTicks > 0U )
+			{
+				if( xEDFPreemptionDeferred == pdFALSE )
+				{
+					xEDFPreemptionDeferred = pdTRUE;
+					xEDFDeferredSince = xTickCount;
+				}
 
-			/* Reset the event list item to its normal value - so it can be used with
-			 * queues and semaphores. */
-			listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxCurrentTCB->uxPriority ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+				xReturn = pdFALSE;
+			}
 
-			return uxReturn;
+			return xReturn;
 		}
 		/*-----------------------------------------------------------*/
 
-#if ( configUSE_MUTEXES == 1 )
-
-		TaskHandle_t pvTaskIncrementMutexHeldCount( void )
+		static BaseType_t prvEDFPreemptionDeferred( void )
 		{
-			/* If xSemaphoreCreateMutex() is called before any tasks have been created
-			 * then pxCurrentTCB will be NULL. */
-			if( pxCurrentTCB != NULL )
+			BaseType_t xReturn = pdFALSE;
+
+			if( ( xEDFPreemptionDeferred != pdFALSE ) &&
+				( listIS_CONTAINED_WITHIN( &( xReadyTasksListEDF ), &( pxCurrentTCB->xStateListItem ) ) != pdFALSE ) )
 			{
-				( pxCurrentTCB->uxMutexesHeld )++;
+				xReturn = pdTRUE;
+			}
+			else
+			{
+				/* The job completed, or the region ended. */
+				xEDFPreemptionDeferred = pdFALSE;
 			}
 
-			return pxCurrentTCB;
+			return xReturn;
 		}
 
-#endif /* configUSE_MUTEXES */
-		/*-----------------------------------------------------------*/
+#endif /* configUSE_EDF_DEFERRED_PREEMPTION */
 
-#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+#if ( configUSE_EDF_HIGH_RES_TIME == 1 )
 
-		uint32_t ulTaskGenericNotifyTake( UBaseType_t uxIndexToWait,
-				BaseType_t xClearCountOnExit,
-				TickType_t xTicksToWait )
+		BaseType_t xTaskDelayUntilUs( uint32_t * const pulPreviousWakeTimeUs,
+				const uint32_t ulTimeIncrementUs )
 		{
-			uint32_t ulReturn;
+			TCB_t * const pxTCB = pxCurrentTCB;
+			TickType_t xTimeToWake;
+			BaseType_t xShouldDelay = pdFALSE;
 
-			configASSERT( uxIndexToWait < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+			configASSERT( pulPreviousWakeTimeUs );
+			configASSERT( ( ulTimeIncrementUs > 0U ) && ( ( TickType_t ) ulTimeIncrementUs < taskEDF_EPOCH_LAG ) );
+			configASSERT( uxSchedulerSuspended == 0 );
 
 			taskENTER_CRITICAL();
 			{
-				/* Only block if the notification count is not already non-zero. */
-				if( pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ] == 0UL )
+				xTimeToWake = ( TickType_t ) ( *pulPreviousWakeTimeUs + ulTimeIncrementUs );
+				*pulPreviousWakeTimeUs = ( uint32_t ) xTimeToWake;
+
+				/* Once per job, at the end of it. */
+				traceTASK_JOB_COMPLETE( pxTCB );
+				taskEDF_JOB_COMPLETE( pxTCB );
+#if ( configUSE_EDF_DVFS == 1 )
+				prvEDFDvfsComplete( pxTCB );
+#endif
+
+				( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+
+				if( ( TickType_t ) ( ( TickType_t ) ( xTimeToWake - taskEDF_NOW() ) - 1U ) < ( taskEDF_TIME_BEFORE - 1U ) )
 				{
-					/* Mark this task as waiting for a notification. */
-					pxCurrentTCB->ucNotifyState[ uxIndexToWait ] = taskWAITING_NOTIFICATION;
+					/* Sleep until the wake time, the alarm is moved to it if it
+					 * is the earliest. */
+					xShouldDelay = pdTRUE;
+					listSET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ), ( TickType_t ) ( xTimeToWake - xEDFEpochUs ) );
+					vListInsert( &( xEDFTimerList ), &( pxTCB->xStateListItem ) );
 
-					if( xTicksToWait > ( TickType_t ) 0 )
+					if( listGET_HEAD_ENTRY( &( xEDFTimerList ) ) == &( pxTCB->xStateListItem ) )
 					{
-						prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
-						traceTASK_NOTIFY_TAKE_BLOCK( uxIndexToWait );
-
-						/* All ports are written to allow a yield in a critical
-						 * section (some will yield immediately, others wait until the
-						 * critical section exits) - but it is not something that
-						 * application code should ever do. */
-						portYIELD_WITHIN_API();
+						configEDF_SET_ALARM_US( ( uint32_t ) xTimeToWake );
 					}
 					else
 					{
@@ -4961,237 +10432,348 @@ return xReturn;
 				}
 				else
 				{
-					mtCOVERAGE_TEST_MARKER();
+					/* Late, the next job is released at once, still due relative
+					 * to its wake time. */
+					pxTCB->xTaskAbsoluteDeadline = xTimeToWake + pxTCB->xTaskRelativeDeadlineUs;
+					pxTCB->ulTaskJobs++;
+#if ( configUSE_EDF_DVFS == 1 )
+					prvEDFDvfsRelease( pxTCB );
+#endif
+					traceTASK_JOB_RELEASE( pxTCB );
+					prvAddTaskToReadyList( pxTCB );
 				}
 			}
 			taskEXIT_CRITICAL();
 
-			taskENTER_CRITICAL();
-			{
-				traceTASK_NOTIFY_TAKE( uxIndexToWait );
-				ulReturn = pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ];
+			/* Either way the task is now behind its deadline in the ready list,
+			 * or not in it. */
+			portYIELD_WITHIN_API();
 
-				if( ulReturn != 0UL )
+			return xShouldDelay;
+		}
+		/*-----------------------------------------------------------*/
+
+		BaseType_t xTaskHighResAlarmFromISR( void )
+		{
+			BaseType_t xReturn = pdFALSE;
+			UBaseType_t uxSavedInterruptStatus;
+
+			uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+			{
+				/* With the scheduler suspended the next tick releases the
+				 * tasks. */
+				if( ( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE ) && ( prvEDFTimerReleaseDue() != pdFALSE ) )
 				{
-					if( xClearCountOnExit != pdFALSE )
-					{
-						pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ] = 0UL;
-					}
-					else
-					{
-						pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ] = ulReturn - ( uint32_t ) 1;
-					}
+					xReturn = pdTRUE;
 				}
 				else
 				{
 					mtCOVERAGE_TEST_MARKER();
 				}
-
-				pxCurrentTCB->ucNotifyState[ uxIndexToWait ] = taskNOT_WAITING_NOTIFICATION;
 			}
-			taskEXIT_CRITICAL();
+			taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
 
-			return ulReturn;
+			return xReturn;
 		}
-
-#endif /* configUSE_TASK_NOTIFICATIONS */
 		/*-----------------------------------------------------------*/
 
-#if ( configUSE_TASK_NOTIFICATIONS == 1 )
-
-		BaseType_t xTaskGenericNotifyWait( UBaseType_t uxIndexToWait,
-				uint32_t ulBitsToClearOnEntry,
-				uint32_t ulBitsToClearOnExit,
-				uint32_t * pulNotificationValue,
-				TickType_t xTicksToWait )
+		void vTaskSetRelativeDeadlineUs( TaskHandle_t xTask,
+				uint32_t ulDeadlineUs )
 		{
-			BaseType_t xReturn;
-
-			configASSERT( uxIndexToWait < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+			configASSERT( ( TickType_t ) ulDeadlineUs < taskEDF_EPOCH_LAG );
 
 			taskENTER_CRITICAL();
 			{
-				/* Only block if a notification is not already pending. */
-				if( pxCurrentTCB->ucNotifyState[ uxIndexToWait ] != taskNOTIFICATION_RECEIVED )
-				{
-					/* Clear bits in the task's notification value as bits may get
-					 * set  by the notifying task or interrupt.  This can be used to
-					 * clear the value to zero. */
-					pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ] &= ~ulBitsToClearOnEntry;
-
-					/* Mark this task as waiting for a notification. */
-					pxCurrentTCB->ucNotifyState[ uxIndexToWait ] = taskWAITING_NOTIFICATION;
-
-					if( xTicksToWait > ( TickType_t ) 0 )
-					{
-						prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
-						traceTASK_NOTIFY_WAIT_BLOCK( uxIndexToWait );
-
-						/* All ports are written to allow a yield in a critical
-						 * section (some will yield immediately, others wait until the
-						 * critical section exits) - but it is not something that
-						 * application code should ever do. */
-						portYIELD_WITHIN_API();
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
+				prvGetTCBFromHandle( xTask )->xTaskRelativeDeadlineUs = ( TickType_t ) ulDeadlineUs;
 			}
 			taskEXIT_CRITICAL();
+		}
+		/*-----------------------------------------------------------*/
 
-			taskENTER_CRITICAL();
+		uint32_t ulTaskGetTimeUs( void )
+		{
+			return ( uint32_t ) configEDF_TIME_US();
+		}
+		/*-----------------------------------------------------------*/
+
+		static BaseType_t prvEDFTimerReleaseDue( void )
+		{
+			const TickType_t xNow = taskEDF_NOW();
+			TickType_t xTimeToWake;
+			TCB_t * pxTCB;
+			BaseType_t xReleased = pdFALSE;
+			BaseType_t xReturn = pdFALSE;
+
+			while( listLIST_IS_EMPTY( &( xEDFTimerList ) ) == pdFALSE )
 			{
-				traceTASK_NOTIFY_WAIT( uxIndexToWait );
+				pxTCB = listGET_OWNER_OF_HEAD_ENTRY( &( xEDFTimerList ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+				xTimeToWake = xEDFEpochUs + listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) );
 
-				if( pulNotificationValue != NULL )
+				if( ( TickType_t ) ( xNow - xTimeToWake ) >= taskEDF_TIME_BEFORE )
 				{
-					/* Output the current notification value, which may or may not
-					 * have changed. */
-					*pulNotificationValue = pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ];
+					/* Not due yet, nor are the ones after it. */
+					break;
 				}
 
-				/* If ucNotifyValue is set then either the task never entered the
-				 * blocked state (because a notification was already pending) or the
-				 * task unblocked because of a notification.  Otherwise the task
-				 * unblocked because of a timeout. */
-				if( pxCurrentTCB->ucNotifyState[ uxIndexToWait ] != taskNOTIFICATION_RECEIVED )
+				( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+				pxTCB->xTaskAbsoluteDeadline = xTimeToWake + pxTCB->xTaskRelativeDeadlineUs;
+				pxTCB->ulTaskJobs++;
+#if ( configUSE_EDF_DVFS == 1 )
+				prvEDFDvfsRelease( pxTCB );
+#endif
+				traceTASK_JOB_RELEASE( pxTCB );
+				prvAddTaskToReadyList( pxTCB );
+				xReleased = pdTRUE;
+
+				if( taskEDF_PREEMPTS( pxTCB ) )
 				{
-					/* A notification was not received. */
-					xReturn = pdFALSE;
+					xReturn = pdTRUE;
 				}
 				else
 				{
-					/* A notification was already pending or a notification was
-					 * received while the task was waiting. */
-					pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ] &= ~ulBitsToClearOnExit;
-					xReturn = pdTRUE;
+					mtCOVERAGE_TEST_MARKER();
 				}
+			}
 
-				pxCurrentTCB->ucNotifyState[ uxIndexToWait ] = taskNOT_WAITING_NOTIFICATION;
+			if( ( xReleased != pdFALSE ) && ( listLIST_IS_EMPTY( &( xEDFTimerList ) ) == pdFALSE ) )
+			{
+				configEDF_SET_ALARM_US( ( uint32_t ) ( xEDFEpochUs + listGET_ITEM_VALUE_OF_HEAD_ENTRY( &( xEDFTimerList ) ) ) );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
 			}
-			taskEXIT_CRITICAL();
 
 			return xReturn;
 		}
-
-#endif /* configUSE_TASK_NOTIFICATIONS */
 		/*-----------------------------------------------------------*/
 
-#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+		static void prvEDFRebase( void )
+		{
+			const TickType_t xSinceEpoch = ( TickType_t ) ( taskEDF_NOW() - xEDFEpochUs );
+			TickType_t xDelta;
 
-		BaseType_t xTaskGenericNotify( TaskHandle_t xTaskToNotify,
-				UBaseType_t uxIndexToNotify,
-				uint32_t ulValue,
-				eNotifyAction eAction,
-				uint32_t * pulPreviousNotificationValue )
+			if( xSinceEpoch >= taskEDF_EPOCH_REBASE )
+			{
+				xDelta = xSinceEpoch - taskEDF_EPOCH_LAG;
+				xEDFEpochUs += xDelta;
+				prvEDFRebaseList( &( xReadyTasksListEDF ), xDelta );
+				prvEDFRebaseList( &( xEDFTimerList ), xDelta );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		/*-----------------------------------------------------------*/
+
+		static void prvEDFRebaseList( List_t * pxList,
+				TickType_t xDelta )
 		{
-			TCB_t * pxTCB;
-			BaseType_t xReturn = pdPASS;
-			uint8_t ucOriginalNotifyState;
+			const ListItem_t * const pxEnd = listGET_END_MARKER( pxList );
+			ListItem_t * pxItem;
+			TickType_t xValue;
 
-			configASSERT( uxIndexToNotify < configTASK_NOTIFICATION_ARRAY_ENTRIES );
-			configASSERT( xTaskToNotify );
-			pxTCB = xTaskToNotify;
+			/* The same amount off every value, the order does not change. */
+			for( pxItem = listGET_HEAD_ENTRY( pxList ); pxItem != pxEnd; pxItem = listGET_NEXT( pxItem ) )
+			{
+				xValue = listGET_LIST_ITEM_VALUE( pxItem );
+				listSET_LIST_ITEM_VALUE( pxItem, ( xValue > xDelta ) ? ( xValue - xDelta ) : ( TickType_t ) 0U );
+			}
+		}
 
-			taskENTER_CRITICAL();
+#endif /* configUSE_EDF_HIGH_RES_TIME */
+
+#if ( configUSE_EDF_TICKLESS_KERNEL == 1 )
+
+		BaseType_t xTaskProcessTimerEvent( void )
+		{
+			BaseType_t xSwitchRequired = pdFALSE;
+			UBaseType_t uxSavedInterruptStatus;
+
+			uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
 			{
-				if( pulPreviousNotificationValue != NULL )
+				if( xEDFTicklessStarted != pdFALSE )
 				{
-					*pulPreviousNotificationValue = pxTCB->ulNotifiedValue[ uxIndexToNotify ];
+					/* The event is consumed, whatever it was programmed for. */
+					xEDFTicklessEventSet = pdFALSE;
+					xSwitchRequired = prvEDFTicklessAdvance();
+
+					/* Also left by a catch up from a task. */
+					if( xYieldPending != pdFALSE )
+					{
+						xSwitchRequired = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
 				}
+			}
+			taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
 
-				ucOriginalNotifyState = pxTCB->ucNotifyState[ uxIndexToNotify ];
+			return xSwitchRequired;
+		}
+		/*-----------------------------------------------------------*/
 
-				pxTCB->ucNotifyState[ uxIndexToNotify ] = taskNOTIFICATION_RECEIVED;
+		static BaseType_t prvEDFTicklessAdvance( void )
+		{
+			TickType_t xElapsed = ( TickType_t ) configEDF_TICKLESS_ELAPSED();
+			TickType_t xStep;
+			BaseType_t xSwitchRequired = pdFALSE;
 
-				switch( eAction )
-				{
-				case eSetBits:
-					pxTCB->ulNotifiedValue[ uxIndexToNotify ] |= ulValue;
-					break;
+			if( uxSchedulerSuspended != ( UBaseType_t ) pdFALSE )
+			{
+				/* Like the ticks of a ticking kernel, xTaskResumeAll() processes
+				 * them. */
+				xPendedTicks += xElapsed;
+				xElapsed = 0U;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 
-				case eIncrement:
-					( pxTCB->ulNotifiedValue[ uxIndexToNotify ] )++;
-					break;
+			while( xElapsed > ( TickType_t ) 0U )
+			{
+				/* Nothing happens before the tick of the next release, nor at the
+				 * tick overflow, as xNextTaskUnblockTime is then at most
+				 * portMAX_DELAY.  The last tick of the jump is a real one. */
+				xStep = ( xNextTaskUnblockTime > xTickCount ) ? ( ( xNextTaskUnblockTime - xTickCount ) - ( TickType_t ) 1U ) : ( TickType_t ) 0U;
 
-				case eSetValueWithOverwrite:
-					pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
-					break;
+				if( xStep > ( xElapsed - ( TickType_t ) 1U ) )
+				{
+					xStep = xElapsed - ( TickType_t ) 1U;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 
-				case eSetValueWithoutOverwrite:
+				xTickCount += xStep;
+				xElapsed -= xStep;
+				traceINCREASE_TICK_COUNT( xStep );
 
-					if( ucOriginalNotifyState != taskNOTIFICATION_RECEIVED )
-					{
-						pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
-					}
-					else
-					{
-						/* The value could not be written to the task. */
-						xReturn = pdFAIL;
-					}
+				if( xTaskIncrementTick() != pdFALSE )
+				{
+					xSwitchRequired = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 
-					break;
+				xElapsed--;
+			}
 
-				case eNoAction:
+			prvEDFTicklessProgram( pdFALSE );
 
-					/* The task is being notified without its notify value being
-					 * updated. */
-					 break;
+			return xSwitchRequired;
+		}
+		/*-----------------------------------------------------------*/
 
-				default:
+		static void prvEDFTicklessProgram( BaseType_t xForce )
+		{
+			/* The ticks pended while the scheduler is suspended have passed
+			 * already. */
+			const TickType_t xNow = xTickCount + xPendedTicks;
+			TickType_t xTicks;
 
-					/* Should not get here if all enums are handled.
-					 * Artificially force an assert by testing a value the
-					 * compiler can't assume is const. */
-					configASSERT( xTickCount == ( TickType_t ) 0 );
+			if( listLIST_IS_EMPTY( pxDelayedTaskList ) == pdFALSE )
+			{
+				/* A wake time that has passed is due at once. */
+				xTicks = xNextTaskUnblockTime - xNow;
 
-					break;
+				if( xTicks > ( portMAX_DELAY >> 1 ) )
+				{
+					xTicks = 0U;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
 				}
+			}
+			else if( listLIST_IS_EMPTY( pxOverflowDelayedTaskList ) == pdFALSE )
+			{
+				/* The next release is after the tick count wraps, which swaps
+				 * the delayed lists. */
+				xTicks = ( TickType_t ) 0U - xNow;
+			}
+			else
+			{
+				/* Nothing to release.  The farthest event the timer allows
+				 * still comes, so the time it keeps does not wrap unseen. */
+				xTicks = portMAX_DELAY;
+			}
 
-				traceTASK_NOTIFY( uxIndexToNotify );
+#if ( configUSE_EDF_DEFERRED_PREEMPTION == 1 )
+			if( xEDFPreemptionDeferred != pdFALSE )
+			{
+				TickType_t xTicksToRegionEnd = ( xEDFDeferredSince + pxCurrentTCB->xTaskNonPreemptiveTicks ) - xNow;
 
-				/* If the task is in the blocked state specifically to wait for a
-				 * notification then unblock it now. */
-				if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
+				if( xTicksToRegionEnd > ( portMAX_DELAY >> 1 ) )
 				{
-					listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
-					prvAddTaskToReadyList( pxTCB );
-
-					/* The task should not have been on an event list. */
-					configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
+					xTicksToRegionEnd = 0U;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 
-#if ( configUSE_TICKLESS_IDLE != 0 )
-					{
-						/* If a task is blocked waiting for a notification then
-						 * xNextTaskUnblockTime might be set to the blocked task's time
-						 * out time.  If the task is unblocked for a reason other than
-						 * a timeout xNextTaskUnblockTime is normally left unchanged,
-						 * because it will automatically get reset to a new value when
-						 * the tick count equals xNextTaskUnblockTime.  However if
-						 * tickless idling is used it might be more important to enter
-						 * sleep mode at the earliest possible time - so reset
-						 * xNextTaskUnblockTime here to ensure it is updated at the
-						 * earliest possible time. */
-						prvResetNextTaskUnblockTime();
-					}
+				if( xTicksToRegionEnd < xTicks )
+				{
+					xTicks = xTicksToRegionEnd;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 #endif
 
-					if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
-					{
-						/* The notified task has a priority above the currently
-						 * executing task so a yield is required. */
-						taskYIELD_IF_USING_PREEMPTION();
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+			if( ( xTicks == ( TickType_t ) 0U ) && ( uxSchedulerSuspended != ( UBaseType_t ) pdFALSE ) )
+			{
+				/* xTaskResumeAll() releases what is due and programs the event
+				 * again, until then the time is counted a tick at a time. */
+				xTicks = 1U;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( ( xForce != pdFALSE ) || ( xEDFTicklessEventSet == pdFALSE ) || ( ( TickType_t ) ( xNow + xTicks ) != xEDFTicklessEvent ) )
+			{
+				xEDFTicklessEvent = xNow + xTicks;
+				xEDFTicklessEventSet = pdTRUE;
+				configEDF_TICKLESS_SET_EVENT( xTicks );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		/*-----------------------------------------------------------*/
+
+		static void prvEDFTicklessCatchUp( void )
+		{
+			taskENTER_CRITICAL();
+			{
+				if( ( xEDFTicklessStarted != pdFALSE ) && ( prvEDFTicklessAdvance() != pdFALSE ) )
+				{
+					/* Switched by the event, as if the release had come before
+					 * the call. */
+					xYieldPending = pdTRUE;
+					xEDFTicklessEventSet = pdFALSE;
+					configEDF_TICKLESS_SET_EVENT( 0U );
 				}
 				else
 				{
@@ -5199,345 +10781,434 @@ return xReturn;
 				}
 			}
 			taskEXIT_CRITICAL();
-
-			return xReturn;
 		}
 
-#endif /* configUSE_TASK_NOTIFICATIONS */
+#endif /* configUSE_EDF_TICKLESS_KERNEL */
+		/* END of special for EDF */
 		/*-----------------------------------------------------------*/
 
-#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+		/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
 
-		BaseType_t xTaskGenericNotifyFromISR( TaskHandle_t xTaskToNotify,
-				UBaseType_t uxIndexToNotify,
-				uint32_t ulValue,
-				eNotifyAction eAction,
-				uint32_t * pulPreviousNotificationValue,
-				BaseType_t * pxHigherPriorityTaskWoken )
+		static BaseType_t prvEDFIsIdleTask( const TCB_t * pxTCB )
 		{
-			TCB_t * pxTCB;
-			uint8_t ucOriginalNotifyState;
-			BaseType_t xReturn = pdPASS;
-			UBaseType_t uxSavedInterruptStatus;
+			BaseType_t xCoreID;
 
-			configASSERT( xTaskToNotify );
-			configASSERT( uxIndexToNotify < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+			for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+			{
+				if( pxTCB == ( const TCB_t * ) xIdleTaskHandles[ xCoreID ] )
+				{
+					return pdTRUE;
+				}
+			}
 
-			/* RTOS ports that support interrupt nesting have the concept of a
-			 * maximum  system call (or maximum API call) interrupt priority.
-			 * Interrupts that are  above the maximum system call priority are keep
-			 * permanently enabled, even when the RTOS kernel is in a critical section,
-			 * but cannot make any calls to FreeRTOS API functions.  If configASSERT()
-			 * is defined in FreeRTOSConfig.h then
-			 * portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
-			 * failure if a FreeRTOS API function is called from an interrupt that has
-			 * been assigned a priority above the configured maximum system call
-			 * priority.  Only FreeRTOS functions that end in FromISR can be called
-			 * from interrupts  that have been assigned a priority at or (logically)
-			 * below the maximum system call interrupt priority.  FreeRTOS maintains a
-			 * separate interrupt safe API to ensure interrupt entry is as fast and as
-			 * simple as possible.  More information (albeit Cortex-M specific) is
-			 * provided on the following link:
-			 * https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
-			portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+			return pdFALSE;
+		}
+		/*-----------------------------------------------------------*/
 
-			pxTCB = xTaskToNotify;
+		static void prvEDFLockPartitionsOf( const TCB_t * pxTCB )
+		{
+			( void ) pxTCB;
 
-			uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+#if ( configUSE_EDF_SEMI_PARTITIONED == 1 )
+			/* A split job moves between the partitions of its two cores, both
+			 * are locked, in ascending order. */
+			if( pxTCB->xTaskSplitCore != taskTASK_NOT_SPLIT )
 			{
-				if( pulPreviousNotificationValue != NULL )
+				if( pxTCB->xTaskFirstCore < pxTCB->xTaskSplitCore )
 				{
-					*pulPreviousNotificationValue = pxTCB->ulNotifiedValue[ uxIndexToNotify ];
+					portGET_PARTITION_LOCK( taskEDF_CORE_PARTITION( pxTCB->xTaskFirstCore ) );
+					portGET_PARTITION_LOCK( taskEDF_CORE_PARTITION( pxTCB->xTaskSplitCore ) );
 				}
-
-				ucOriginalNotifyState = pxTCB->ucNotifyState[ uxIndexToNotify ];
-				pxTCB->ucNotifyState[ uxIndexToNotify ] = taskNOTIFICATION_RECEIVED;
-
-				switch( eAction )
+				else
 				{
-				case eSetBits:
-					pxTCB->ulNotifiedValue[ uxIndexToNotify ] |= ulValue;
-					break;
-
-				case eIncrement:
-					( pxTCB->ulNotifiedValue[ uxIndexToNotify ] )++;
-					break;
-
-				case eSetValueWithOverwrite:
-					pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
-					break;
-
-				case eSetValueWithoutOverwrite:
-
-					if( ucOriginalNotifyState != taskNOTIFICATION_RECEIVED )
-					{
-						pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
-					}
-					else
-					{
-						/* The value could not be written to the task. */
-						xReturn = pdFAIL;
-					}
+					portGET_PARTITION_LOCK( taskEDF_CORE_PARTITION( pxTCB->xTaskSplitCore ) );
+					portGET_PARTITION_LOCK( taskEDF_CORE_PARTITION( pxTCB->xTaskFirstCore ) );
+				}
 
-					break;
+				return;
+			}
+#endif
 
-				case eNoAction:
+			portGET_PARTITION_LOCK( taskEDF_TASK_PARTITION( pxTCB ) );
+		}
+		/*-----------------------------------------------------------*/
 
-					/* The task is being notified without its notify value being
-					 * updated. */
-					 break;
+		static void prvEDFUnlockPartitionsOf( const TCB_t * pxTCB )
+		{
+			( void ) pxTCB;
 
-				default:
+#if ( configUSE_EDF_SEMI_PARTITIONED == 1 )
+			if( pxTCB->xTaskSplitCore != taskTASK_NOT_SPLIT )
+			{
+				portRELEASE_PARTITION_LOCK( taskEDF_CORE_PARTITION( pxTCB->xTaskFirstCore ) );
+				portRELEASE_PARTITION_LOCK( taskEDF_CORE_PARTITION( pxTCB->xTaskSplitCore ) );
 
-					/* Should not get here if all enums are handled.
-					 * Artificially force an assert by testing a value the
-					 * compiler can't assume is const. */
-					configASSERT( xTickCount == ( TickType_t ) 0 );
-					break;
-				}
+				return;
+			}
+#endif
 
-				traceTASK_NOTIFY_FROM_ISR( uxIndexToNotify );
+			portRELEASE_PARTITION_LOCK( taskEDF_TASK_PARTITION( pxTCB ) );
+		}
+		/*-----------------------------------------------------------*/
 
-				/* If the task is in the blocked state specifically to wait for a
-				 * notification then unblock it now. */
-				if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
-				{
-					/* The task should not have been on an event list. */
-					configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
+		static void prvEDFLockAllPartitions( void )
+		{
+			BaseType_t xPartition;
 
-					if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
-					{
-						listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
-						prvAddTaskToReadyList( pxTCB );
-					}
-					else
-					{
-						/* The delayed and ready lists cannot be accessed, so hold
-						 * this task pending until the scheduler is resumed. */
-						listINSERT_END( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
-					}
+			for( xPartition = 0; xPartition < taskEDF_PARTITIONS; xPartition++ )
+			{
+				portGET_PARTITION_LOCK( xPartition );
+			}
+		}
+		/*-----------------------------------------------------------*/
 
-					if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
-					{
-						/* The notified task has a priority above the currently
-						 * executing task so a yield is required. */
-						if( pxHigherPriorityTaskWoken != NULL )
-						{
-							*pxHigherPriorityTaskWoken = pdTRUE;
-						}
+		static void prvEDFUnlockAllPartitions( void )
+		{
+			BaseType_t xPartition;
 
-						/* Mark that a yield is pending in case the user is not
-						 * using the "xHigherPriorityTaskWoken" parameter to an ISR
-						 * safe FreeRTOS function. */
-						xYieldPending = pdTRUE;
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+			for( xPartition = taskEDF_PARTITIONS; xPartition > 0; xPartition-- )
+			{
+				portRELEASE_PARTITION_LOCK( xPartition - 1 );
+			}
+		}
+		/*-----------------------------------------------------------*/
+
+		static BaseType_t prvEDFPartitionSuspended( BaseType_t xPartition )
+		{
+			BaseType_t xCoreID;
+
+			for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+			{
+				if( ( taskEDF_CORE_PARTITION( xCoreID ) == xPartition ) && ( uxSchedulerSuspendeds[ xCoreID ] != ( UBaseType_t ) pdFALSE ) )
+				{
+					return pdTRUE;
 				}
 			}
-			portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
 
-			return xReturn;
+			return pdFALSE;
 		}
-
-#endif /* configUSE_TASK_NOTIFICATIONS */
 		/*-----------------------------------------------------------*/
 
-#if ( configUSE_TASK_NOTIFICATIONS == 1 )
-
-		void vTaskGenericNotifyGiveFromISR( TaskHandle_t xTaskToNotify,
-				UBaseType_t uxIndexToNotify,
-				BaseType_t * pxHigherPriorityTaskWoken )
+		static BaseType_t prvEDFTickNeedsEventLists( void )
 		{
-			TCB_t * pxTCB;
-			uint8_t ucOriginalNotifyState;
-			UBaseType_t uxSavedInterruptStatus;
+			const TickType_t xNextTickCount = xTickCount + ( TickType_t ) 1;
+			const List_t * pxList;
+			const ListItem_t * pxItem;
+			const ListItem_t * pxEndMarker;
 
-			configASSERT( xTaskToNotify );
-			configASSERT( uxIndexToNotify < configTASK_NOTIFICATION_ARRAY_ENTRIES );
-
-			/* RTOS ports that support interrupt nesting have the concept of a
-			 * maximum  system call (or maximum API call) interrupt priority.
-			 * Interrupts that are  above the maximum system call priority are keep
-			 * permanently enabled, even when the RTOS kernel is in a critical section,
-			 * but cannot make any calls to FreeRTOS API functions.  If configASSERT()
-			 * is defined in FreeRTOSConfig.h then
-			 * portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
-			 * failure if a FreeRTOS API function is called from an interrupt that has
-			 * been assigned a priority above the configured maximum system call
-			 * priority.  Only FreeRTOS functions that end in FromISR can be called
-			 * from interrupts  that have been assigned a priority at or (logically)
-			 * below the maximum system call interrupt priority.  FreeRTOS maintains a
-			 * separate interrupt safe API to ensure interrupt entry is as fast and as
-			 * simple as possible.  More information (albeit Cortex-M specific) is
-			 * provided on the following link:
-			 * https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
-			portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+			/* Nothing is due, unless the tick count wraps and the lists are
+			 * switched. */
+			if( ( xNextTickCount != ( TickType_t ) 0U ) && ( xNextTickCount < xNextTaskUnblockTime ) )
+			{
+				return pdFALSE;
+			}
 
-			pxTCB = xTaskToNotify;
+			pxList = ( xNextTickCount == ( TickType_t ) 0U ) ? pxOverflowDelayedTaskList : pxDelayedTaskList;
+			pxEndMarker = listGET_END_MARKER( pxList );
 
-			uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+			for( pxItem = listGET_HEAD_ENTRY( pxList ); ( pxItem != pxEndMarker ) && ( listGET_LIST_ITEM_VALUE( pxItem ) <= xNextTickCount ); pxItem = listGET_NEXT( pxItem ) )
 			{
-				ucOriginalNotifyState = pxTCB->ucNotifyState[ uxIndexToNotify ];
-				pxTCB->ucNotifyState[ uxIndexToNotify ] = taskNOTIFICATION_RECEIVED;
+				if( listLIST_ITEM_CONTAINER( &( ( ( const TCB_t * ) listGET_LIST_ITEM_OWNER( pxItem ) )->xEventListItem ) ) != NULL )
+				{
+					return pdTRUE;
+				}
+			}
 
-				/* 'Giving' is equivalent to incrementing a count in a counting
-				 * semaphore. */
-				( pxTCB->ulNotifiedValue[ uxIndexToNotify ] )++;
+			return pdFALSE;
+		}
+		/*-----------------------------------------------------------*/
 
-				traceTASK_NOTIFY_GIVE_FROM_ISR( uxIndexToNotify );
+#if ( configUSE_EDF_SEMI_PARTITIONED == 1 )
 
-				/* If the task is in the blocked state specifically to wait for a
-				 * notification then unblock it now. */
-				if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
-				{
-					/* The task should not have been on an event list. */
-					configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
+		static BaseType_t prvEDFTickMovesSplitJob( void )
+		{
+			const BaseType_t xCoreID = portGET_CORE_ID();
+			const TCB_t * const pxRunningTCB = pxCurrentTCBs[ xCoreID ];
+			const TickType_t xNextTickCount = xTickCount + ( TickType_t ) 1;
+			const List_t * pxList;
+			const ListItem_t * pxItem;
+			const ListItem_t * pxEndMarker;
+			const TCB_t * pxTCB;
 
-					if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
-					{
-						listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
-						prvAddTaskToReadyList( pxTCB );
-					}
-					else
-					{
-						/* The delayed and ready lists cannot be accessed, so hold
-						 * this task pending until the scheduler is resumed. */
-						listINSERT_END( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
-					}
+			/* See prvEDFSplitCharge(). */
+			if( ( pxRunningTCB->xTaskSplitCore != taskTASK_NOT_SPLIT ) && ( pxRunningTCB->xTaskFirstCore == xCoreID ) &&
+				( pxRunningTCB->xTaskCore == xCoreID ) && ( pxRunningTCB->xTaskBudgetLeft <= ( TickType_t ) 1U ) )
+			{
+				return pdTRUE;
+			}
 
-					if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
-					{
-						/* The notified task has a priority above the currently
-						 * executing task so a yield is required. */
-						if( pxHigherPriorityTaskWoken != NULL )
-						{
-							*pxHigherPriorityTaskWoken = pdTRUE;
-						}
+			if( ( xNextTickCount != ( TickType_t ) 0U ) && ( xNextTickCount < xNextTaskUnblockTime ) )
+			{
+				return pdFALSE;
+			}
 
-						/* Mark that a yield is pending in case the user is not
-						 * using the "xHigherPriorityTaskWoken" parameter in an ISR
-						 * safe FreeRTOS function. */
-						xYieldPending = pdTRUE;
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+			pxList = ( xNextTickCount == ( TickType_t ) 0U ) ? pxOverflowDelayedTaskList : pxDelayedTaskList;
+			pxEndMarker = listGET_END_MARKER( pxList );
+
+			/* A job that blocked on its second core is released on its first
+			 * one, see prvEDFSplitRelease(). */
+			for( pxItem = listGET_HEAD_ENTRY( pxList ); ( pxItem != pxEndMarker ) && ( listGET_LIST_ITEM_VALUE( pxItem ) <= xNextTickCount ); pxItem = listGET_NEXT( pxItem ) )
+			{
+				pxTCB = ( const TCB_t * ) listGET_LIST_ITEM_OWNER( pxItem );
+
+				if( ( pxTCB->xTaskSplitCore != taskTASK_NOT_SPLIT ) && ( pxTCB->xTaskFirstCore != xCoreID ) )
+				{
+					return pdTRUE;
 				}
 			}
-			portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
-		}
 
-#endif /* configUSE_TASK_NOTIFICATIONS */
+			return pdFALSE;
+		}
 		/*-----------------------------------------------------------*/
 
-#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+#endif /* configUSE_EDF_SEMI_PARTITIONED */
 
-		BaseType_t xTaskGenericNotifyStateClear( TaskHandle_t xTask,
-				UBaseType_t uxIndexToClear )
+		static void prvEDFSelectTaskForCore( BaseType_t xCoreID )
 		{
-			TCB_t * pxTCB;
-			BaseType_t xReturn;
+			TCB_t * pxTCB = NULL;
+			TCB_t * const pxPreviousTCB = pxCurrentTCBs[ xCoreID ];
 
-			configASSERT( uxIndexToClear < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+			const ListItem_t * const pxEndMarker = listGET_END_MARKER( taskEDF_CORE_READY_LIST( xCoreID ) );
+			const ListItem_t * pxItem;
 
-			/* If null is passed in here then it is the calling task that is having
-			 * its notification state cleared. */
-			pxTCB = prvGetTCBFromHandle( xTask );
+			/* The list is in deadline order, the first task not running on
+			 * another core is the earliest deadline this core may run.  It is
+			 * never empty of those as every core has its idle task.  With
+			 * partitioned EDF the list only holds the tasks of this core, so
+			 * that is the head unless a split job that just migrated here is
+			 * still running on its first core. */
+			for( pxItem = listGET_HEAD_ENTRY( taskEDF_CORE_READY_LIST( xCoreID ) ); pxItem != pxEndMarker; pxItem = listGET_NEXT( pxItem ) )
+			{
+				pxTCB = ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxItem );
 
-			taskENTER_CRITICAL();
+				if( ( pxTCB->xTaskRunState == taskTASK_NOT_RUNNING ) || ( pxTCB->xTaskRunState == xCoreID ) )
+				{
+					break;
+				}
+			}
+
+			configASSERT( pxItem != pxEndMarker );
+
+			/* The previous task may have blocked, so is not found in the list,
+			 * but it no longer runs here either way. */
+			if( ( pxPreviousTCB != NULL ) && ( pxPreviousTCB->xTaskRunState == xCoreID ) )
 			{
-				if( pxTCB->ucNotifyState[ uxIndexToClear ] == taskNOTIFICATION_RECEIVED )
+				pxPreviousTCB->xTaskRunState = taskTASK_NOT_RUNNING;
+			}
+
+			pxTCB->xTaskRunState = xCoreID;
+			pxCurrentTCBs[ xCoreID ] = pxTCB;
+
+#if ( configUSE_EDF_SEMI_PARTITIONED == 1 )
+			{
+				/* A split job that migrated while running here can now run on
+				 * its second core. */
+				if( ( pxPreviousTCB != NULL ) && ( pxPreviousTCB != pxTCB ) && ( pxPreviousTCB->xTaskCore != xCoreID ) &&
+					( listLIST_ITEM_CONTAINER( &( pxPreviousTCB->xStateListItem ) ) == taskEDF_READY_LIST( pxPreviousTCB ) ) )
 				{
-					pxTCB->ucNotifyState[ uxIndexToClear ] = taskNOT_WAITING_NOTIFICATION;
-					xReturn = pdPASS;
+					( void ) prvEDFPreemptCoreFor( pxPreviousTCB, NULL );
 				}
 				else
 				{
-					xReturn = pdFAIL;
+					mtCOVERAGE_TEST_MARKER();
 				}
 			}
-			taskEXIT_CRITICAL();
-
-			return xReturn;
+#endif
 		}
-
-#endif /* configUSE_TASK_NOTIFICATIONS */
 		/*-----------------------------------------------------------*/
 
-#if ( configUSE_TASK_NOTIFICATIONS == 1 )
-
-		uint32_t ulTaskGenericNotifyValueClear( TaskHandle_t xTask,
-				UBaseType_t uxIndexToClear,
-				uint32_t ulBitsToClear )
+		static BaseType_t prvEDFPreemptCoreFor( const TCB_t * pxTCB,
+				UBaseType_t * puxCoresYielding )
 		{
-			TCB_t * pxTCB;
-			uint32_t ulReturn;
+			BaseType_t xCoreID, xTargetCore = taskTASK_NOT_RUNNING;
+			BaseType_t xTargetIsIdle = pdFALSE;
+			TickType_t xLatestDeadline = 0;
+			const TCB_t * pxRunningTCB;
+			BaseType_t xReturn = pdFALSE;
 
-			/* If null is passed in here then it is the calling task that is having
-			 * its notification state cleared. */
-			pxTCB = prvGetTCBFromHandle( xTask );
+#if ( configUSE_EDF_PARTITIONED == 1 )
+			/* Only the core the task is bound to can run it. */
+			xTargetCore = pxTCB->xTaskCore;
+			pxRunningTCB = pxCurrentTCBs[ xTargetCore ];
+			xTargetIsIdle = prvEDFIsIdleTask( pxRunningTCB );
+			xLatestDeadline = taskEDF_KEY( pxRunningTCB );
+			( void ) xCoreID;
+#else
+			for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+			{
+				if( ( puxCoresYielding != NULL ) && ( ( *puxCoresYielding & ( ( UBaseType_t ) 1U << xCoreID ) ) != 0U ) )
+				{
+					continue;
+				}
 
-			taskENTER_CRITICAL();
+				pxRunningTCB = pxCurrentTCBs[ xCoreID ];
+
+				/* An idle core is always the cheapest one to preempt. */
+				if( prvEDFIsIdleTask( pxRunningTCB ) != pdFALSE )
+				{
+					xTargetCore = xCoreID;
+					xTargetIsIdle = pdTRUE;
+					break;
+				}
+
+				if( ( xTargetCore == taskTASK_NOT_RUNNING ) ||
+					( taskEDF_KEY( pxRunningTCB ) > xLatestDeadline ) )
+				{
+					xTargetCore = xCoreID;
+					xLatestDeadline = taskEDF_KEY( pxRunningTCB );
+				}
+			}
+#endif /* configUSE_EDF_PARTITIONED */
+
+			/* Same test as the single core scheduler, an equal deadline
+			 * preempts. */
+			if( ( xTargetCore != taskTASK_NOT_RUNNING ) &&
+				( ( xTargetIsIdle != pdFALSE ) || ( taskEDF_KEY( pxTCB ) <= xLatestDeadline ) ) )
 			{
-				/* Return the notification as it was before the bits were cleared,
-				 * then clear the bit mask. */
-				ulReturn = pxTCB->ulNotifiedValue[ uxIndexToClear ];
-				pxTCB->ulNotifiedValue[ uxIndexToClear ] &= ~ulBitsToClear;
+				if( xTargetCore == portGET_CORE_ID() )
+				{
+					xReturn = pdTRUE;
+				}
+				else if( ( puxCoresYielding == NULL ) || ( ( *puxCoresYielding & ( ( UBaseType_t ) 1U << xTargetCore ) ) == 0U ) )
+				{
+					/* With partitioned EDF the core may already have been
+					 * interrupted by this tick. */
+					portYIELD_CORE( xTargetCore );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				if( puxCoresYielding != NULL )
+				{
+					*puxCoresYielding |= ( UBaseType_t ) 1U << xTargetCore;
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
 			}
-			taskEXIT_CRITICAL();
 
-			return ulReturn;
+			return xReturn;
 		}
-
-#endif /* configUSE_TASK_NOTIFICATIONS */
 		/*-----------------------------------------------------------*/
 
-#if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( INCLUDE_xTaskGetIdleTaskHandle == 1 ) )
+#if ( configUSE_EDF_SEMI_PARTITIONED == 1 )
 
-		configRUN_TIME_COUNTER_TYPE ulTaskGetIdleRunTimeCounter( void )
+		static void prvEDFSplitRelease( TCB_t * pxTCB )
 		{
-			return xIdleTaskHandle->ulRunTimeCounter;
+			if( pxTCB->xTaskSplitCore != taskTASK_NOT_SPLIT )
+			{
+				/* The local deadline counts from the release of the job, not
+				 * from the tick of the core that released it. */
+				pxTCB->xTaskJobDeadline = pxTCB->xTaskAbsoluteDeadline;
+				pxTCB->xTaskAbsoluteDeadline = ( pxTCB->xTaskJobDeadline - pxTCB->xTaskRelativeDeadline ) + pxTCB->xTaskSplitDeadline;
+				pxTCB->xTaskCore = pxTCB->xTaskFirstCore;
+				pxTCB->xTaskBudgetLeft = pxTCB->xTaskSplitBudget;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
-
-#endif
 		/*-----------------------------------------------------------*/
 
-#if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( INCLUDE_xTaskGetIdleTaskHandle == 1 ) )
-
-		configRUN_TIME_COUNTER_TYPE ulTaskGetIdleRunTimePercent( void )
+		static BaseType_t prvEDFSplitCharge( UBaseType_t * puxCoresYielding )
 		{
-			configRUN_TIME_COUNTER_TYPE ulTotalTime, ulReturn;
-
-			ulTotalTime = portGET_RUN_TIME_COUNTER_VALUE();
+			const BaseType_t xCoreID = portGET_CORE_ID();
+			TCB_t * const pxTCB = pxCurrentTCBs[ xCoreID ];
+			BaseType_t xReturn = pdFALSE;
 
-			/* For percentage calculations. */
-			ulTotalTime /= ( configRUN_TIME_COUNTER_TYPE ) 100;
+			/* Only a job still on its first core and in the Ready state (it
+			 * may have blocked and not be switched out yet) is charged. */
+			if( ( pxTCB->xTaskSplitCore == taskTASK_NOT_SPLIT ) ||
+				( pxTCB->xTaskFirstCore != xCoreID ) ||
+				( pxTCB->xTaskCore != xCoreID ) ||
+				( listLIST_ITEM_CONTAINER( &( pxTCB->xStateListItem ) ) != taskEDF_CORE_READY_LIST( xCoreID ) ) )
+			{
+				return pdFALSE;
+			}
 
-			/* Avoid divide by zero errors. */
-			if( ulTotalTime > ( configRUN_TIME_COUNTER_TYPE ) 0 )
+			if( pxTCB->xTaskBudgetLeft > ( TickType_t ) 1U )
 			{
-				ulReturn = xIdleTaskHandle->ulRunTimeCounter / ulTotalTime;
+				pxTCB->xTaskBudgetLeft--;
 			}
 			else
 			{
-				ulReturn = 0;
+				/* Budget used up, the rest of the job runs on the second core
+				 * against the deadline of the whole job.  The move is not a
+				 * release, so the ready trace macro is not used. */
+				pxTCB->xTaskBudgetLeft = 0;
+				( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+				pxTCB->xTaskCore = pxTCB->xTaskSplitCore;
+				pxTCB->xTaskAbsoluteDeadline = pxTCB->xTaskJobDeadline;
+				listSET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ), pxTCB->xTaskAbsoluteDeadline );
+				vListInsert( taskEDF_READY_LIST( pxTCB ), &( pxTCB->xStateListItem ) );
+
+				/* The first core picks another task, the second core is
+				 * interrupted when the first one has switched the job out, see
+				 * prvEDFSelectTaskForCore(). */
+				xReturn = pdTRUE;
+				*puxCoresYielding |= ( UBaseType_t ) 1U << xCoreID;
 			}
 
-			return ulReturn;
+			return xReturn;
 		}
 
-#endif /* if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( INCLUDE_xTaskGetIdleTaskHandle == 1 ) ) */
+#endif /* configUSE_EDF_SEMI_PARTITIONED */
+
+#endif /* configNUMBER_OF_CORES > 1 */
+		/* END of special for EDF */
 		/*-----------------------------------------------------------*/
 
 		static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
 				const BaseType_t xCanBlockIndefinitely )
 		{
 			TickType_t xTimeToWake;
-			const TickType_t xConstTickCount = xTickCount;
+			TickType_t xConstTickCount;
+
+			/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+			UBaseType_t uxSavedInterruptStatus;
+#if ( INCLUDE_vTaskSuspend == 1 )
+			const BaseType_t xToSuspendedList = ( ( xTicksToWait == portMAX_DELAY ) && ( xCanBlockIndefinitely != pdFALSE ) ) ? pdTRUE : pdFALSE;
+#else
+			const BaseType_t xToSuspendedList = pdFALSE;
+#endif
+#endif
+
+			/* The block time counts from now, not from the last timer event.
+			 * With the scheduler suspended the tick count was brought up to date
+			 * by vTaskSuspendAll() and stays put. */
+			taskEDF_TICKLESS_CATCH_UP();
+
+#if ( configUSE_EDF_SCHEDULE_TABLE == 1 )
+			/* The job completes, the next one starts from no run time. */
+			pxCurrentTCB->xTaskTableRun = 0U;
+#endif
+
+#if ( configNUMBER_OF_CORES > 1 )
+			/* The suspended list is guarded by the critical sections, which the
+			 * callers blocking on an event already hold, the other lists by the
+			 * lock of the partition.  The caller may hold the latter already, so
+			 * the critical section is only entered for the suspended list. */
+			if( xToSuspendedList != pdFALSE )
+			{
+				taskENTER_CRITICAL();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			uxSavedInterruptStatus = portSET_INTERRUPT_MASK();
+			taskEDF_LOCK_PARTITIONS_OF( pxCurrentTCB );
+#endif
+			/* END of special for EDF */
+
+			xConstTickCount = xTickCount;
 
 #if ( INCLUDE_xTaskAbortDelay == 1 )
 			{
@@ -5580,6 +11251,11 @@ return xReturn;
 					/* The list item will be inserted in wake time order. */
 					listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
 
+					/* START of special for EDF */
+#if ( configUSE_EDF_TIMING_WHEEL == 1 )
+					prvWheelInsert( &( pxCurrentTCB->xStateListItem ), xConstTickCount );
+#else
+					/* END of special for EDF */
 					if( xTimeToWake < xConstTickCount )
 					{
 						/* Wake time has overflowed.  Place this item in the overflow
@@ -5604,6 +11280,7 @@ return xReturn;
 							mtCOVERAGE_TEST_MARKER();
 						}
 					}
+#endif
 				}
 			}
 #else /* INCLUDE_vTaskSuspend */
@@ -5616,6 +11293,11 @@ return xReturn;
 				/* The list item will be inserted in wake time order. */
 				listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
 
+				/* START of special for EDF */
+#if ( configUSE_EDF_TIMING_WHEEL == 1 )
+				prvWheelInsert( &( pxCurrentTCB->xStateListItem ), xConstTickCount );
+#else
+				/* END of special for EDF */
 				if( xTimeToWake < xConstTickCount )
 				{
 					/* Wake time has overflowed.  Place this item in the overflow list. */
@@ -5638,11 +11320,28 @@ return xReturn;
 						mtCOVERAGE_TEST_MARKER();
 					}
 				}
+#endif
 
 				/* Avoid compiler warning when INCLUDE_vTaskSuspend is not 1. */
 				( void ) xCanBlockIndefinitely;
 			}
 #endif /* INCLUDE_vTaskSuspend */
+
+			/* START of special for EDF */
+#if ( configNUMBER_OF_CORES > 1 )
+			taskEDF_UNLOCK_PARTITIONS_OF( pxCurrentTCB );
+			portCLEAR_INTERRUPT_MASK( uxSavedInterruptStatus );
+
+			if( xToSuspendedList != pdFALSE )
+			{
+				taskEXIT_CRITICAL();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+#endif
+			/* END of special for EDF */
 		}
 
 		/* Code below here allows additional code to be inserted into this source file,
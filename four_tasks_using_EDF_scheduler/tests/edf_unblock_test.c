@@ -0,0 +1,365 @@
+/*
+ * Host tests of the EDF scheduler, one for each way a blocked task is made
+ * ready again: its release at the tick, a wake from an event list, a resume,
+ * a resume from an ISR, a notification, the pending ready list and an aborted
+ * delay.
+ *
+ * In each test a task H with the earlier deadline (period 10) runs first and
+ * blocks, then the task L with the later deadline (period 100) wakes it and
+ * checks H preempted it right away, that is before the call waking H returned.
+ * H blocks with a timeout ending after the deadline of L, so its state list
+ * item holds the wake time, which must not be taken for its deadline once it
+ * is ready again.
+ *
+ * The tests run the kernel of ../source on the single threaded port of this
+ * directory, each in a process of its own as the scheduler starts only once.
+ * Build and run them on a POSIX host with a FreeRTOS-Kernel V10.4.6 checkout:
+ *
+ *   gcc -I. -I../source -I$FREERTOS_KERNEL/include -o edf_unblock_test \
+ *       edf_unblock_test.c port.c ../source/tasks.c $FREERTOS_KERNEL/list.c
+ *   ./edf_unblock_test [test name]
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#define testHIGH_PERIOD    ( ( TickType_t ) 10 )
+#define testLOW_PERIOD     ( ( TickType_t ) 100 )
+
+/* block time of H, ending after the deadline of L */
+#define testBLOCK_TICKS    ( ( TickType_t ) 500 )
+
+/* ticks after which a test that did not end fails */
+#define testTIMEOUT        ( ( TickType_t ) 1000 )
+
+/* fail the running test if x is false */
+#define testCHECK( x )     if( !( x ) ) prvTestFail( #x, __LINE__ )
+
+typedef struct TestCase
+{
+	const char * pcName;
+	TaskFunction_t pxHighTask;
+	TaskFunction_t pxLowTask;
+} TestCase_t;
+
+static TaskHandle_t xHighTask = NULL;
+static List_t xEventList;
+
+/* the letters the tasks log as they run, upper case when a test task first
+ * runs and lower case when H runs again */
+static char cLog[ 16 ];
+static size_t uxLogLength = 0;
+
+static BaseType_t xTestResult = pdFAIL;
+
+/*-----------------------------------------------------------*/
+
+static void prvLog( char cLetter )
+{
+	if( uxLogLength < ( sizeof( cLog ) - 1U ) )
+	{
+		cLog[ uxLogLength++ ] = cLetter;
+		cLog[ uxLogLength ] = '\0';
+	}
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvLogIs( const char * pcExpected )
+{
+	return ( strcmp( cLog, pcExpected ) == 0 ) ? pdTRUE : pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestFail( const char * pcCheck, int iLine )
+{
+	printf( "  line %d: %s failed, log \"%s\"\n", iLine, pcCheck, cLog );
+	xTestResult = pdFAIL;
+	vTaskEndScheduler();
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestPass( void )
+{
+	xTestResult = pdPASS;
+	vTaskEndScheduler();
+}
+/*-----------------------------------------------------------*/
+
+void vAssertCalled( const char * pcFile, unsigned long ulLine )
+{
+	printf( "  %s:%lu: assert failed, log \"%s\"\n", pcFile, ulLine, cLog );
+	exit( EXIT_FAILURE );
+}
+/*-----------------------------------------------------------*/
+
+/* Time moves on only while nothing but the idle task is ready. */
+void vApplicationIdleHook( void )
+{
+	if( xTaskGetTickCount() >= testTIMEOUT )
+	{
+		prvTestFail( "the test ending", __LINE__ );
+	}
+
+	vPortTickInterrupt();
+}
+/*-----------------------------------------------------------*/
+
+/* H running its jobs periodically. */
+static void prvPeriodicTask( void * pvParameters )
+{
+	TickType_t xLastWakeTime = xTaskGetTickCount();
+
+	( void ) pvParameters;
+
+	for( ; ; )
+	{
+		prvLog( 'H' );
+		xTaskDelayUntil( &xLastWakeTime, testHIGH_PERIOD );
+	}
+}
+/*-----------------------------------------------------------*/
+
+/* L letting the ticks come until the second release of H. */
+static void prvTickReleaseTask( void * pvParameters )
+{
+	( void ) pvParameters;
+
+	prvLog( 'L' );
+
+	while( xTaskGetTickCount() < testHIGH_PERIOD )
+	{
+		testCHECK( prvLogIs( "HL" ) );
+		vPortTickInterrupt();
+	}
+
+	testCHECK( prvLogIs( "HLH" ) );
+	prvTestPass();
+}
+/*-----------------------------------------------------------*/
+
+/* H waiting on an event list the way a queue does. */
+static void prvEventListTask( void * pvParameters )
+{
+	( void ) pvParameters;
+
+	prvLog( 'H' );
+
+	vTaskSuspendAll();
+	vTaskPlaceOnEventList( &xEventList, testBLOCK_TICKS );
+
+	if( xTaskResumeAll() == pdFALSE )
+	{
+		portYIELD();
+	}
+
+	prvLog( 'h' );
+	vTaskSuspend( NULL );
+}
+/*-----------------------------------------------------------*/
+
+/* L waking H from the event list the way a queue does. */
+static void prvEventListWakeTask( void * pvParameters )
+{
+	BaseType_t xYieldRequired;
+
+	( void ) pvParameters;
+
+	prvLog( 'L' );
+
+	taskENTER_CRITICAL();
+	{
+		xYieldRequired = xTaskRemoveFromEventList( &xEventList );
+	}
+	taskEXIT_CRITICAL();
+
+	testCHECK( xYieldRequired == pdTRUE );
+
+	if( xYieldRequired != pdFALSE )
+	{
+		portYIELD();
+	}
+
+	testCHECK( prvLogIs( "HLh" ) );
+	prvTestPass();
+}
+/*-----------------------------------------------------------*/
+
+/* H delaying itself, then suspended or woken by L. */
+static void prvDelayedTask( void * pvParameters )
+{
+	( void ) pvParameters;
+
+	prvLog( 'H' );
+	vTaskDelay( testBLOCK_TICKS );
+	prvLog( 'h' );
+	vTaskSuspend( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvResumeTask( void * pvParameters )
+{
+	( void ) pvParameters;
+
+	prvLog( 'L' );
+
+	/* H keeps the wake time it was delayed with. */
+	vTaskSuspend( xHighTask );
+	testCHECK( prvLogIs( "HL" ) );
+	vTaskResume( xHighTask );
+
+	testCHECK( prvLogIs( "HLh" ) );
+	prvTestPass();
+}
+/*-----------------------------------------------------------*/
+
+static void prvResumeFromISRTask( void * pvParameters )
+{
+	BaseType_t xYieldRequired;
+
+	( void ) pvParameters;
+
+	prvLog( 'L' );
+
+	vTaskSuspend( xHighTask );
+	testCHECK( prvLogIs( "HL" ) );
+
+	/* What an interrupt taken here would do. */
+	xYieldRequired = xTaskResumeFromISR( xHighTask );
+	testCHECK( xYieldRequired == pdTRUE );
+	portYIELD_FROM_ISR( xYieldRequired );
+
+	testCHECK( prvLogIs( "HLh" ) );
+	prvTestPass();
+}
+/*-----------------------------------------------------------*/
+
+/* H waiting for a notification. */
+static void prvNotifiedTask( void * pvParameters )
+{
+	( void ) pvParameters;
+
+	prvLog( 'H' );
+	ulTaskNotifyTake( pdTRUE, testBLOCK_TICKS );
+	prvLog( 'h' );
+	vTaskSuspend( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvNotifyTask( void * pvParameters )
+{
+	( void ) pvParameters;
+
+	prvLog( 'L' );
+	xTaskNotifyGive( xHighTask );
+
+	testCHECK( prvLogIs( "HLh" ) );
+	prvTestPass();
+}
+/*-----------------------------------------------------------*/
+
+/* L notifying H from an interrupt taken with the scheduler suspended, so H
+ * waits on the pending ready list until the scheduler is resumed. */
+static void prvPendingReadyTask( void * pvParameters )
+{
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	( void ) pvParameters;
+
+	prvLog( 'L' );
+
+	vTaskSuspendAll();
+	vTaskNotifyGiveFromISR( xHighTask, &xHigherPriorityTaskWoken );
+	testCHECK( prvLogIs( "HL" ) );
+	testCHECK( xTaskResumeAll() == pdTRUE );
+
+	testCHECK( prvLogIs( "HLh" ) );
+	prvTestPass();
+}
+/*-----------------------------------------------------------*/
+
+static void prvAbortDelayTask( void * pvParameters )
+{
+	( void ) pvParameters;
+
+	prvLog( 'L' );
+	testCHECK( xTaskAbortDelay( xHighTask ) == pdPASS );
+
+	testCHECK( prvLogIs( "HLh" ) );
+	prvTestPass();
+}
+/*-----------------------------------------------------------*/
+
+static const TestCase_t xTestCases[] =
+{
+	{ "tick_release",     prvPeriodicTask,  prvTickReleaseTask   },
+	{ "event_list_wake",  prvEventListTask, prvEventListWakeTask },
+	{ "resume",           prvDelayedTask,   prvResumeTask        },
+	{ "resume_from_isr",  prvDelayedTask,   prvResumeFromISRTask },
+	{ "notify",           prvNotifiedTask,  prvNotifyTask        },
+	{ "pending_ready",    prvNotifiedTask,  prvPendingReadyTask  },
+	{ "abort_delay",      prvDelayedTask,   prvAbortDelayTask    },
+};
+
+#define testNUM_CASES    ( sizeof( xTestCases ) / sizeof( xTestCases[ 0 ] ) )
+
+/*-----------------------------------------------------------*/
+
+static int prvRunTestCase( const TestCase_t * pxTestCase )
+{
+	vListInitialise( &xEventList );
+
+	xTaskPeriodicCreate( pxTestCase->pxHighTask, "H", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 1, &xHighTask, testHIGH_PERIOD );
+	xTaskPeriodicCreate( pxTestCase->pxLowTask, "L", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 1, NULL, testLOW_PERIOD );
+
+	vTaskStartScheduler();
+
+	return ( xTestResult == pdPASS ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+/*-----------------------------------------------------------*/
+
+int main( int argc, char * argv[] )
+{
+	size_t x;
+	int iFailed = 0;
+
+	for( x = 0; x < testNUM_CASES; x++ )
+	{
+		const TestCase_t * pxTestCase = &xTestCases[ x ];
+		pid_t xChild;
+		int iStatus = EXIT_FAILURE;
+
+		if( ( argc > 1 ) && ( strcmp( argv[ 1 ], pxTestCase->pcName ) != 0 ) )
+		{
+			continue;
+		}
+
+		fflush( stdout );
+		xChild = fork();
+
+		if( xChild == 0 )
+		{
+			exit( prvRunTestCase( pxTestCase ) );
+		}
+
+		if( ( xChild > 0 ) && ( waitpid( xChild, &iStatus, 0 ) == xChild ) &&
+			WIFEXITED( iStatus ) && ( WEXITSTATUS( iStatus ) == EXIT_SUCCESS ) )
+		{
+			printf( "PASS %s\n", pxTestCase->pcName );
+		}
+		else
+		{
+			printf( "FAIL %s\n", pxTestCase->pcName );
+			iFailed++;
+		}
+	}
+
+	return ( iFailed == 0 ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
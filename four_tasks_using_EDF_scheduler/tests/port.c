@@ -0,0 +1,186 @@
+/*
+ * FreeRTOS Kernel V10.4.6
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*-----------------------------------------------------------
+ * Implementation of functions defined in portable.h for the host tests.
+ *
+ * Each task gets a ucontext_t and a stack of its own from the C heap.  The
+ * kernel stack of the task only holds the pointer to the context, which is
+ * where pxTopOfStack points, so the first member of the TCB finds it.
+ *----------------------------------------------------------*/
+
+#include <stdlib.h>
+#include <ucontext.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#define portTASK_STACK_SIZE    ( 64 * 1024 )
+
+typedef struct PortContext
+{
+	ucontext_t xContext;
+	TaskFunction_t pxCode;
+	void * pvParameters;
+} PortContext_t;
+
+/* The first member of the TCB is pxTopOfStack. */
+extern void * volatile pxCurrentTCB;
+
+static ucontext_t xSchedulerContext;
+static UBaseType_t uxCriticalNesting = 0;
+static BaseType_t xPortYieldPending = pdFALSE;
+
+/*-----------------------------------------------------------*/
+
+static PortContext_t * prvCurrentContext( void )
+{
+	return ( PortContext_t * ) **( StackType_t ** ) pxCurrentTCB;
+}
+/*-----------------------------------------------------------*/
+
+static void prvTaskEntry( void )
+{
+	PortContext_t * pxContext = prvCurrentContext();
+
+	pxContext->pxCode( pxContext->pvParameters );
+
+	/* Tasks must not return. */
+	configASSERT( pdFALSE );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSwitchContext( void )
+{
+	PortContext_t * pxFrom = prvCurrentContext();
+	PortContext_t * pxTo;
+
+	xPortYieldPending = pdFALSE;
+	vTaskSwitchContext();
+	pxTo = prvCurrentContext();
+
+	if( pxTo != pxFrom )
+	{
+		swapcontext( &( pxFrom->xContext ), &( pxTo->xContext ) );
+	}
+}
+/*-----------------------------------------------------------*/
+
+StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
+									 TaskFunction_t pxCode,
+									 void * pvParameters )
+{
+	PortContext_t * pxContext = malloc( sizeof( PortContext_t ) );
+	void * pvStack = malloc( portTASK_STACK_SIZE );
+
+	configASSERT( ( pxContext != NULL ) && ( pvStack != NULL ) );
+
+	pxContext->pxCode = pxCode;
+	pxContext->pvParameters = pvParameters;
+	getcontext( &( pxContext->xContext ) );
+	pxContext->xContext.uc_stack.ss_sp = pvStack;
+	pxContext->xContext.uc_stack.ss_size = portTASK_STACK_SIZE;
+	pxContext->xContext.uc_link = NULL;
+	makecontext( &( pxContext->xContext ), prvTaskEntry, 0 );
+
+	*pxTopOfStack = ( StackType_t ) pxContext;
+
+	return pxTopOfStack;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortStartScheduler( void )
+{
+	swapcontext( &xSchedulerContext, &( prvCurrentContext()->xContext ) );
+
+	/* Back here once a task called vTaskEndScheduler(). */
+	return pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+	swapcontext( &( prvCurrentContext()->xContext ), &xSchedulerContext );
+}
+/*-----------------------------------------------------------*/
+
+void vPortYield( void )
+{
+	if( uxCriticalNesting == 0U )
+	{
+		prvSwitchContext();
+	}
+	else
+	{
+		xPortYieldPending = pdTRUE;
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnterCritical( void )
+{
+	uxCriticalNesting++;
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitCritical( void )
+{
+	configASSERT( uxCriticalNesting > 0U );
+	uxCriticalNesting--;
+
+	if( ( uxCriticalNesting == 0U ) && ( xPortYieldPending != pdFALSE ) )
+	{
+		prvSwitchContext();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortTickInterrupt( void )
+{
+	/* The tick is never taken inside a critical section. */
+	configASSERT( uxCriticalNesting == 0U );
+
+	if( xTaskIncrementTick() != pdFALSE )
+	{
+		prvSwitchContext();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void * pvPortMalloc( size_t xWantedSize )
+{
+	return malloc( xWantedSize );
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void * pv )
+{
+	free( pv );
+}
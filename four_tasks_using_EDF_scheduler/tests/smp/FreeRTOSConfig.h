@@ -0,0 +1,79 @@
+/*
+ * FreeRTOS V202112.00
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+/*-----------------------------------------------------------
+ * Configuration of the multicore host tests (see edf_smp_test.c), the EDF
+ * scheduler of ../../source on the simulated cores of this directory.  The
+ * tests of edf_partitioned_test.c are built with -DconfigUSE_EDF_PARTITIONED=1.
+ *----------------------------------------------------------*/
+
+#define configUSE_PREEMPTION	    1
+#define configUSE_IDLE_HOOK		    1	/* time passes while only the idle task is ready */
+#define configUSE_TICK_HOOK			0
+#define configTICK_RATE_HZ			( ( TickType_t ) 1000 )
+#define configMAX_PRIORITIES		( 4 )
+#define configMINIMAL_STACK_SIZE	( ( unsigned short ) 90 )
+#define configMAX_TASK_NAME_LEN	    ( 8 )
+#define configUSE_TRACE_FACILITY	1	/* the deadline misses are read with uxTaskGetSystemState() */
+#define configUSE_16_BIT_TICKS		0
+#define configIDLE_SHOULD_YIELD		0
+#define configUSE_TIME_SLICING           1
+#define configSUPPORT_DYNAMIC_ALLOCATION 1
+#define configUSE_MUTEXES                1
+
+#define configUSE_EDF_SCHEDULER   1
+#define configNUMBER_OF_CORES     2
+
+#define configQUEUE_REGISTRY_SIZE 0
+
+/* Co-routine definitions. */
+#define configUSE_CO_ROUTINES 		      0
+#define configMAX_CO_ROUTINE_PRIORITIES ( 2 )
+
+/* Set the following definitions to 1 to include the API function, or zero
+to exclude the API function. */
+
+#define INCLUDE_vTaskPrioritySet		1
+#define INCLUDE_uxTaskPriorityGet	    1
+#define INCLUDE_vTaskDelete		        1
+#define INCLUDE_vTaskCleanUpResources	0
+#define INCLUDE_vTaskSuspend		    1
+#define INCLUDE_xTaskResumeFromISR	    1
+#define INCLUDE_xTaskAbortDelay		    1
+#define INCLUDE_vTaskDelayUntil		   	1
+#define INCLUDE_vTaskDelay			    1
+#define INCLUDE_xTaskGetCurrentTaskHandle	1
+#define INCLUDE_eTaskGetState		    1
+
+/* a failed assert fails the test it happens in */
+extern void vAssertCalled( const char * pcFile, unsigned long ulLine );
+#define configASSERT( x )    if( ( x ) == 0 ) vAssertCalled( __FILE__, __LINE__ )
+
+#endif /* FREERTOS_CONFIG_H */
@@ -0,0 +1,448 @@
+/*
+ * Host tests of the partitioned EDF scheduler on two cores:
+ *  - bound: the tasks of a core run there one after the other, even with
+ *    the other core idle.
+ *  - own_ticks: while core 0 has the scheduler suspended, and its ticks
+ *    pended, the tick of core 1 goes on releasing the jobs there.
+ *  - tick_locks: the tick, the end of a job and the task switch on either
+ *    core take neither the task lock nor the ISR lock, only the lock of the
+ *    partition of the core.
+ *  - remote_wake: a notification from core 0 wakes a task of core 1, which
+ *    preempts the idle task of core 1 right away.
+ *  - split_handoff (with -DconfigUSE_EDF_SEMI_PARTITIONED=1 too): each job
+ *    of a split task runs its budget on core 0, then moves to core 1 for
+ *    the rest, preempting the later deadline there while core 0 picks its
+ *    other task, and the next job starts on core 0 again.
+ *
+ * The tasks do their work with vPortSimStep(), the cores take turns at each
+ * step, and every core ticks its own partition (portSTEPS_PER_TICK steps a
+ * tick).  The tests run the kernel of ../../source on the simulated cores of
+ * this directory, each in a process of its own as the scheduler starts only
+ * once.  Build and run them on a POSIX host with a FreeRTOS-Kernel V10.4.6
+ * checkout:
+ *
+ *   gcc -DconfigUSE_EDF_PARTITIONED=1 [-DconfigUSE_EDF_SEMI_PARTITIONED=1] \
+ *       -I. -I../../source \
+ *       -I$FREERTOS_KERNEL/include -o edf_partitioned_test \
+ *       edf_partitioned_test.c port.c ../../source/tasks.c \
+ *       $FREERTOS_KERNEL/list.c -lpthread
+ *   ./edf_partitioned_test [test name]
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#if ( configUSE_EDF_PARTITIONED != 1 )
+#error "Build the partitioned EDF tests with -DconfigUSE_EDF_PARTITIONED=1"
+#endif
+
+/* the bound test, two jobs of 15 ticks on core 1 in a period of 50 */
+#define testBOUND_PERIOD     ( ( TickType_t ) 50 )
+#define testBOUND_JOB        ( ( TickType_t ) 15 )
+
+/* the own_ticks test, the suspension on core 0 and the period on core 1 */
+#define testSUSPENDED_TICKS  ( ( TickType_t ) 20 )
+#define testOWN_PERIOD       ( ( TickType_t ) 5 )
+
+/* the jobs of the tick_locks test */
+#define testLOCKS_PERIOD     ( ( TickType_t ) 3 )
+#define testLOCKS_JOBS       ( 20U )
+
+/* the split task of the split_handoff test */
+#define testSPLIT_PERIOD     ( ( TickType_t ) 40 )
+#define testSPLIT_BUDGET     ( ( TickType_t ) 5 )
+#define testSPLIT_DEADLINE   ( ( TickType_t ) 10 )
+#define testSPLIT_JOB        ( ( TickType_t ) 12 )
+#define testSPLIT_JOBS       ( 2U )
+
+/* ticks after which a test that did not end fails */
+#define testTIMEOUT          ( ( TickType_t ) 600 )
+
+/* fail the running test if x is false */
+#define testCHECK( x )       if( !( x ) ) prvTestFail( #x, __LINE__ )
+
+typedef struct TestCase
+{
+	const char * pcName;
+	void ( * pvCreateTasks )( void );
+} TestCase_t;
+
+static TaskHandle_t xWokenTask = NULL;
+
+#if ( configUSE_EDF_SEMI_PARTITIONED == 1 )
+static TaskHandle_t xFirstCoreTask = NULL;
+static TaskHandle_t xSecondCoreTask = NULL;
+#endif
+
+/* the tasks inside prvWork() now and at most */
+static volatile UBaseType_t uxWorking = 0;
+static volatile UBaseType_t uxMostWorking = 0;
+
+static volatile UBaseType_t uxJobsDone = 0;
+static volatile TickType_t xNotifyTime = 0;
+
+static volatile BaseType_t xTestResult = pdFAIL;
+
+/*-----------------------------------------------------------*/
+
+static void prvTestFail( const char * pcCheck, int iLine )
+{
+	printf( "  line %d: %s failed at tick %lu of core %ld\n", iLine, pcCheck, ( unsigned long ) xTaskGetTickCount(), ( long ) portGET_CORE_ID() );
+	xTestResult = pdFAIL;
+	vTaskEndScheduler();
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestPass( void )
+{
+	xTestResult = pdPASS;
+	vTaskEndScheduler();
+}
+/*-----------------------------------------------------------*/
+
+void vAssertCalled( const char * pcFile, unsigned long ulLine )
+{
+	printf( "  %s:%lu: assert failed on core %ld\n", pcFile, ulLine, ( long ) portGET_CORE_ID() );
+	exit( EXIT_FAILURE );
+}
+/*-----------------------------------------------------------*/
+
+static void prvStep( void )
+{
+	if( xTaskGetTickCount() >= testTIMEOUT )
+	{
+		prvTestFail( "the test ending", __LINE__ );
+	}
+
+	vPortSimStep();
+}
+/*-----------------------------------------------------------*/
+
+/* The idle task of each core lets the other cores run. */
+void vApplicationIdleHook( void )
+{
+	prvStep();
+}
+/*-----------------------------------------------------------*/
+
+/* Runs for xTicks ticks on core xCoreID, the core of the task.  The ticks
+ * count the time, the other cores take the baton more or less often. */
+static void prvWork( TickType_t xTicks,
+					 BaseType_t xCoreID )
+{
+	const TickType_t xStart = xTaskGetTickCount();
+
+	if( ++uxWorking > uxMostWorking )
+	{
+		uxMostWorking = uxWorking;
+	}
+
+	while( ( TickType_t ) ( xTaskGetTickCount() - xStart ) < xTicks )
+	{
+		testCHECK( portGET_CORE_ID() == xCoreID );
+		prvStep();
+	}
+
+	uxWorking--;
+}
+/*-----------------------------------------------------------*/
+
+static void prvBoundTask( void * pvParameters )
+{
+	TickType_t xLastWakeTime = xTaskGetTickCount();
+
+	( void ) pvParameters;
+
+	for( ; ; )
+	{
+		prvWork( testBOUND_JOB, 1 );
+
+		/* Core 0 stayed idle, the jobs ran one after the other. */
+		if( ++uxJobsDone == 2U )
+		{
+			testCHECK( uxMostWorking == 1U );
+			testCHECK( xTaskGetTickCount() >= ( testBOUND_JOB * 3U ) / 2U );
+			prvTestPass();
+		}
+
+		xTaskDelayUntil( &xLastWakeTime, testBOUND_PERIOD );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvCreateBoundTasks( void )
+{
+	xTaskPeriodicCreateOnCore( prvBoundTask, "B1", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 1, NULL, testBOUND_PERIOD, testBOUND_PERIOD, 1 );
+	xTaskPeriodicCreateOnCore( prvBoundTask, "B2", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 1, NULL, testBOUND_PERIOD, testBOUND_PERIOD, 1 );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSuspendingTask( void * pvParameters )
+{
+	TickType_t xStart;
+	UBaseType_t uxJobsBefore;
+	uint32_t ulStep;
+
+	( void ) pvParameters;
+
+	prvWork( 2, 0 );
+
+	vTaskSuspendAll();
+	xStart = xTaskGetTickCount();
+	uxJobsBefore = uxJobsDone;
+
+	/* The tick count of core 0 stands still, its steps count the time. */
+	for( ulStep = 0; ulStep < ( uint32_t ) testSUSPENDED_TICKS * portSTEPS_PER_TICK; ulStep++ )
+	{
+		prvStep();
+	}
+
+	/* The ticks of core 0 were pended, not those of core 1. */
+	testCHECK( xTaskGetTickCount() == xStart );
+	testCHECK( uxJobsDone - uxJobsBefore >= ( testSUSPENDED_TICKS / testOWN_PERIOD ) - 1U );
+
+	( void ) xTaskResumeAll();
+	testCHECK( xTaskGetTickCount() - xStart >= testSUSPENDED_TICKS - 1U );
+	prvTestPass();
+}
+/*-----------------------------------------------------------*/
+
+static void prvOwnTickTask( void * pvParameters )
+{
+	TickType_t xLastWakeTime = xTaskGetTickCount();
+
+	( void ) pvParameters;
+
+	for( ; ; )
+	{
+		uxJobsDone++;
+		xTaskDelayUntil( &xLastWakeTime, testOWN_PERIOD );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvCreateOwnTickTasks( void )
+{
+	xTaskPeriodicCreateOnCore( prvSuspendingTask, "S", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 1, NULL, 100, 100, 0 );
+	xTaskPeriodicCreateOnCore( prvOwnTickTask, "P", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 1, NULL, testOWN_PERIOD, testOWN_PERIOD, 1 );
+}
+/*-----------------------------------------------------------*/
+
+static void prvPeriodicTask( void * pvParameters )
+{
+	const BaseType_t xCoreID = ( BaseType_t ) ( intptr_t ) pvParameters;
+	TickType_t xLastWakeTime = xTaskGetTickCount();
+	uint32_t ulTaskLocks, ulISRLocks, ulCore0Locks, ulCore1Locks;
+	UBaseType_t uxJob;
+
+	prvWork( 1, xCoreID );
+	xTaskDelayUntil( &xLastWakeTime, testLOCKS_PERIOD );
+
+	ulTaskLocks = ulPortLockCount( portTASK_LOCK );
+	ulISRLocks = ulPortLockCount( portISR_LOCK );
+	ulCore0Locks = ulPortLockCount( portPARTITION_LOCK( 0 ) );
+	ulCore1Locks = ulPortLockCount( portPARTITION_LOCK( 1 ) );
+
+	for( uxJob = 0; uxJob < testLOCKS_JOBS; uxJob++ )
+	{
+		prvWork( 1, xCoreID );
+		xTaskDelayUntil( &xLastWakeTime, testLOCKS_PERIOD );
+	}
+
+	testCHECK( ulPortLockCount( portTASK_LOCK ) == ulTaskLocks );
+	testCHECK( ulPortLockCount( portISR_LOCK ) == ulISRLocks );
+	testCHECK( ulPortLockCount( portPARTITION_LOCK( 0 ) ) > ulCore0Locks );
+	testCHECK( ulPortLockCount( portPARTITION_LOCK( 1 ) ) > ulCore1Locks );
+	prvTestPass();
+}
+/*-----------------------------------------------------------*/
+
+static void prvCreatePeriodicTasks( void )
+{
+	xTaskPeriodicCreateOnCore( prvPeriodicTask, "T0", configMINIMAL_STACK_SIZE, ( void * ) 0, tskIDLE_PRIORITY + 1, NULL, testLOCKS_PERIOD, testLOCKS_PERIOD, 0 );
+	xTaskPeriodicCreateOnCore( prvPeriodicTask, "T1", configMINIMAL_STACK_SIZE, ( void * ) 1, tskIDLE_PRIORITY + 1, NULL, testLOCKS_PERIOD, testLOCKS_PERIOD, 1 );
+}
+/*-----------------------------------------------------------*/
+
+static void prvNotifyingTask( void * pvParameters )
+{
+	( void ) pvParameters;
+
+	prvWork( 5, 0 );
+
+	xNotifyTime = xTaskGetTickCount();
+	xTaskNotifyGive( xWokenTask );
+
+	/* Core 0 stays busy. */
+	for( ; ; )
+	{
+		prvWork( 1, 0 );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvWokenTask( void * pvParameters )
+{
+	( void ) pvParameters;
+
+	( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+
+	/* Both ticks count from the start, about together. */
+	testCHECK( portGET_CORE_ID() == 1 );
+	testCHECK( xNotifyTime != 0U );
+	testCHECK( xTaskGetTickCount() - xNotifyTime <= 2U );
+	prvTestPass();
+}
+/*-----------------------------------------------------------*/
+
+static void prvCreateWakeTasks( void )
+{
+	xTaskPeriodicCreateOnCore( prvNotifyingTask, "N", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 1, NULL, 100, 100, 0 );
+	xTaskPeriodicCreateOnCore( prvWokenTask, "W", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 1, &xWokenTask, 100, 100, 1 );
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SEMI_PARTITIONED == 1 )
+
+static void prvSplitTask( void * pvParameters )
+{
+	TickType_t xLastWakeTime = xTaskGetTickCount();
+	TickType_t xStart, xHandOff;
+	BaseType_t xCoreID;
+	UBaseType_t uxJob;
+
+	( void ) pvParameters;
+
+	for( uxJob = 0; uxJob < testSPLIT_JOBS; uxJob++ )
+	{
+		xStart = xTaskGetTickCount();
+		xHandOff = 0;
+		testCHECK( portGET_CORE_ID() == 0 );
+
+		while( ( TickType_t ) ( xTaskGetTickCount() - xStart ) < testSPLIT_JOB )
+		{
+			xCoreID = portGET_CORE_ID();
+
+			if( xCoreID == 1 )
+			{
+				if( xHandOff == 0U )
+				{
+					xHandOff = xTaskGetTickCount();
+				}
+
+				/* Both cores are busy, each with its own task. */
+				testCHECK( eTaskGetState( xSecondCoreTask ) == eReady );
+				testCHECK( eTaskGetState( xFirstCoreTask ) == eRunning );
+			}
+			else
+			{
+				/* Never back on core 0 before the end of the job. */
+				testCHECK( xHandOff == 0U );
+			}
+
+			prvStep();
+		}
+
+		/* The budget was used up on core 0, the job ended on core 1. */
+		testCHECK( portGET_CORE_ID() == 1 );
+		testCHECK( xHandOff - xStart == testSPLIT_BUDGET );
+
+		xTaskDelayUntil( &xLastWakeTime, testSPLIT_PERIOD );
+	}
+
+	prvTestPass();
+}
+/*-----------------------------------------------------------*/
+
+static void prvBusyTask( void * pvParameters )
+{
+	const BaseType_t xCoreID = ( BaseType_t ) ( intptr_t ) pvParameters;
+
+	for( ; ; )
+	{
+		prvWork( 1, xCoreID );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvCreateSplitTasks( void )
+{
+	xTaskPeriodicCreateSplit( prvSplitTask, "S", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 1, NULL, testSPLIT_PERIOD, testSPLIT_PERIOD, 0, testSPLIT_BUDGET, testSPLIT_DEADLINE, 1 );
+	xTaskPeriodicCreateOnCore( prvBusyTask, "Z", configMINIMAL_STACK_SIZE, ( void * ) 0, tskIDLE_PRIORITY + 1, &xFirstCoreTask, 200, 200, 0 );
+	xTaskPeriodicCreateOnCore( prvBusyTask, "F", configMINIMAL_STACK_SIZE, ( void * ) 1, tskIDLE_PRIORITY + 1, &xSecondCoreTask, 200, 200, 1 );
+}
+
+#endif /* configUSE_EDF_SEMI_PARTITIONED */
+/*-----------------------------------------------------------*/
+
+static const TestCase_t xTestCases[] =
+{
+	{ "bound",         prvCreateBoundTasks    },
+	{ "own_ticks",     prvCreateOwnTickTasks  },
+	{ "tick_locks",    prvCreatePeriodicTasks },
+	{ "remote_wake",   prvCreateWakeTasks     },
+#if ( configUSE_EDF_SEMI_PARTITIONED == 1 )
+	{ "split_handoff", prvCreateSplitTasks    },
+#endif
+};
+
+#define testNUM_CASES    ( sizeof( xTestCases ) / sizeof( xTestCases[ 0 ] ) )
+
+/*-----------------------------------------------------------*/
+
+static int prvRunTestCase( const TestCase_t * pxTestCase )
+{
+	pxTestCase->pvCreateTasks();
+
+	vTaskStartScheduler();
+
+	return ( xTestResult == pdPASS ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+/*-----------------------------------------------------------*/
+
+int main( int argc, char * argv[] )
+{
+	size_t x;
+	int iFailed = 0;
+
+	for( x = 0; x < testNUM_CASES; x++ )
+	{
+		const TestCase_t * pxTestCase = &xTestCases[ x ];
+		pid_t xChild;
+		int iStatus = EXIT_FAILURE;
+
+		if( ( argc > 1 ) && ( strcmp( argv[ 1 ], pxTestCase->pcName ) != 0 ) )
+		{
+			continue;
+		}
+
+		fflush( stdout );
+		xChild = fork();
+
+		if( xChild == 0 )
+		{
+			exit( prvRunTestCase( pxTestCase ) );
+		}
+
+		if( ( xChild > 0 ) && ( waitpid( xChild, &iStatus, 0 ) == xChild ) &&
+			WIFEXITED( iStatus ) && ( WEXITSTATUS( iStatus ) == EXIT_SUCCESS ) )
+		{
+			printf( "PASS %s\n", pxTestCase->pcName );
+		}
+		else
+		{
+			printf( "FAIL %s\n", pxTestCase->pcName );
+			iFailed++;
+		}
+	}
+
+	return ( iFailed == 0 ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
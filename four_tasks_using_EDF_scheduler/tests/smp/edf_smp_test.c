@@ -0,0 +1,370 @@
+/*
+ * Host tests of the global EDF scheduler on two cores:
+ *  - parallel: two tasks released together run their jobs at the same time.
+ *  - preempt_latest: a job released while both cores are busy preempts the
+ *    core running the latest deadline, here not the core taking the tick,
+ *    and the other core goes on.
+ *  - u_above_one: three tasks needing 1.2 cores meet all their deadlines,
+ *    which no single core could.
+ *  - tick_locks: releasing delayed tasks at the tick and switching them in
+ *    takes neither the task lock nor the ISR lock, only the lock of the
+ *    partition.
+ *
+ * The tasks do their work with vPortSimStep(), the cores take turns at each
+ * step, and time passes with the steps of core 0 (portSTEPS_PER_TICK steps a
+ * tick).  The tests run the kernel of ../../source on the simulated cores of
+ * this directory, each in a process of its own as the scheduler starts only
+ * once.  Build and run them on a POSIX host with a FreeRTOS-Kernel V10.4.6
+ * checkout:
+ *
+ *   gcc -I. -I../../source -I$FREERTOS_KERNEL/include -o edf_smp_test \
+ *       edf_smp_test.c port.c ../../source/tasks.c $FREERTOS_KERNEL/list.c \
+ *       -lpthread
+ *   ./edf_smp_test [test name]
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* the parallel test, two jobs of 30 ticks in a period of 100 */
+#define testPARALLEL_PERIOD    ( ( TickType_t ) 100 )
+#define testPARALLEL_JOB       ( ( TickType_t ) 30 )
+
+/* the u_above_one test, three jobs of 12 ticks in a period of 30 */
+#define testLOAD_PERIOD        ( ( TickType_t ) 30 )
+#define testLOAD_JOB           ( ( TickType_t ) 12 )
+#define testLOAD_TASKS         ( 3 )
+#define testLOAD_END           ( ( TickType_t ) 300 )
+
+/* the delays of the tick_locks test */
+#define testLOCKS_DELAYS       ( 20 )
+
+/* ticks after which a test that did not end fails */
+#define testTIMEOUT            ( ( TickType_t ) 600 )
+
+/* fail the running test if x is false */
+#define testCHECK( x )         if( !( x ) ) prvTestFail( #x, __LINE__ )
+
+typedef struct TestCase
+{
+	const char * pcName;
+	void ( * pvCreateTasks )( void );
+} TestCase_t;
+
+static TaskHandle_t xTaskA = NULL;
+static TaskHandle_t xTaskB = NULL;
+
+/* the tasks inside prvWork() now and at most */
+static volatile UBaseType_t uxWorking = 0;
+static volatile UBaseType_t uxMostWorking = 0;
+
+static volatile UBaseType_t uxJobsDone = 0;
+static volatile BaseType_t xCoreOfB = -1;
+
+static volatile BaseType_t xTestResult = pdFAIL;
+
+/*-----------------------------------------------------------*/
+
+static void prvTestFail( const char * pcCheck, int iLine )
+{
+	printf( "  line %d: %s failed at tick %lu\n", iLine, pcCheck, ( unsigned long ) xTaskGetTickCount() );
+	xTestResult = pdFAIL;
+	vTaskEndScheduler();
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestPass( void )
+{
+	xTestResult = pdPASS;
+	vTaskEndScheduler();
+}
+/*-----------------------------------------------------------*/
+
+void vAssertCalled( const char * pcFile, unsigned long ulLine )
+{
+	printf( "  %s:%lu: assert failed on core %ld\n", pcFile, ulLine, ( long ) portGET_CORE_ID() );
+	exit( EXIT_FAILURE );
+}
+/*-----------------------------------------------------------*/
+
+static void prvStep( void )
+{
+	if( xTaskGetTickCount() >= testTIMEOUT )
+	{
+		prvTestFail( "the test ending", __LINE__ );
+	}
+
+	vPortSimStep();
+}
+/*-----------------------------------------------------------*/
+
+/* The idle task of each core lets the other cores run. */
+void vApplicationIdleHook( void )
+{
+	prvStep();
+}
+/*-----------------------------------------------------------*/
+
+/* Runs for about xTicks ticks of the core the task is on. */
+static void prvWork( TickType_t xTicks )
+{
+	uint32_t ulStep;
+
+	if( ++uxWorking > uxMostWorking )
+	{
+		uxMostWorking = uxWorking;
+	}
+
+	for( ulStep = 0; ulStep < ( uint32_t ) xTicks * portSTEPS_PER_TICK; ulStep++ )
+	{
+		prvStep();
+	}
+
+	uxWorking--;
+}
+/*-----------------------------------------------------------*/
+
+static void prvParallelTask( void * pvParameters )
+{
+	TickType_t xLastWakeTime = xTaskGetTickCount();
+
+	( void ) pvParameters;
+
+	for( ; ; )
+	{
+		prvWork( testPARALLEL_JOB );
+
+		/* One after the other the jobs would take twice as long. */
+		if( ++uxJobsDone == 2U )
+		{
+			testCHECK( uxMostWorking == 2U );
+			testCHECK( xTaskGetTickCount() < ( testPARALLEL_JOB * 3U ) / 2U );
+			prvTestPass();
+		}
+
+		xTaskDelayUntil( &xLastWakeTime, testPARALLEL_PERIOD );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvCreateParallelTasks( void )
+{
+	xTaskPeriodicCreate( prvParallelTask, "P1", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 1, NULL, testPARALLEL_PERIOD );
+	xTaskPeriodicCreate( prvParallelTask, "P2", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 1, NULL, testPARALLEL_PERIOD );
+}
+/*-----------------------------------------------------------*/
+
+/* X (deadline 30) only frees core 0 first, so that A (120) runs there and B
+ * (180) on core 1 once C (40) completes its first job. */
+static void prvFirstTask( void * pvParameters )
+{
+	( void ) pvParameters;
+
+	prvWork( 2 );
+	vTaskSuspend( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvReleasedTask( void * pvParameters )
+{
+	TickType_t xLastWakeTime = xTaskGetTickCount();
+
+	( void ) pvParameters;
+
+	prvWork( 10 );
+	xTaskDelayUntil( &xLastWakeTime, 40 );
+
+	/* The tick of core 0 released this job, with deadline 80. */
+	testCHECK( xCoreOfB == 1 );
+	testCHECK( portGET_CORE_ID() == xCoreOfB );
+	testCHECK( eTaskGetState( xTaskB ) == eReady );
+	testCHECK( eTaskGetState( xTaskA ) == eRunning );
+	prvTestPass();
+}
+/*-----------------------------------------------------------*/
+
+static void prvBusyTask( void * pvParameters )
+{
+	( void ) pvParameters;
+
+	for( ; ; )
+	{
+		prvStep();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvLatestTask( void * pvParameters )
+{
+	( void ) pvParameters;
+
+	for( ; ; )
+	{
+		xCoreOfB = portGET_CORE_ID();
+		prvStep();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvCreatePreemptTasks( void )
+{
+	xTaskPeriodicCreate( prvFirstTask, "X", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 1, NULL, 30 );
+	xTaskPeriodicCreate( prvReleasedTask, "C", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 1, NULL, 40 );
+	xTaskPeriodicCreate( prvBusyTask, "A", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 1, &xTaskA, 120 );
+	xTaskPeriodicCreate( prvLatestTask, "B", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 1, &xTaskB, 180 );
+}
+/*-----------------------------------------------------------*/
+
+static void prvLoadTask( void * pvParameters )
+{
+	TickType_t xLastWakeTime = xTaskGetTickCount();
+
+	( void ) pvParameters;
+
+	for( ; ; )
+	{
+		if( xTaskGetTickCount() >= testLOAD_END )
+		{
+			TaskStatus_t xStatus[ testLOAD_TASKS + configNUMBER_OF_CORES ];
+			const UBaseType_t uxTasks = uxTaskGetSystemState( xStatus, testLOAD_TASKS + configNUMBER_OF_CORES, NULL );
+			UBaseType_t x;
+
+			testCHECK( uxTasks == testLOAD_TASKS + configNUMBER_OF_CORES );
+
+			for( x = 0; x < uxTasks; x++ )
+			{
+				testCHECK( xStatus[ x ].ulDeadlineMisses == 0U );
+
+				if( xStatus[ x ].xPeriod == testLOAD_PERIOD )
+				{
+					testCHECK( xStatus[ x ].ulJobCount >= testLOAD_END / testLOAD_PERIOD );
+				}
+			}
+
+			prvTestPass();
+		}
+
+		prvWork( testLOAD_JOB );
+		xTaskDelayUntil( &xLastWakeTime, testLOAD_PERIOD );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvCreateLoadTasks( void )
+{
+	xTaskPeriodicCreate( prvLoadTask, "L1", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 1, NULL, testLOAD_PERIOD );
+	xTaskPeriodicCreate( prvLoadTask, "L2", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 1, NULL, testLOAD_PERIOD );
+	xTaskPeriodicCreate( prvLoadTask, "L3", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 1, NULL, testLOAD_PERIOD );
+}
+/*-----------------------------------------------------------*/
+
+static void prvDelayingTask( void * pvParameters )
+{
+	const TickType_t xDelay = ( TickType_t ) ( uintptr_t ) pvParameters;
+	uint32_t ulTaskLocks, ulISRLocks, ulPartitionLocks;
+	TickType_t xStart;
+	int i;
+
+	vTaskDelay( xDelay );
+
+	ulTaskLocks = ulPortLockCount( portTASK_LOCK );
+	ulISRLocks = ulPortLockCount( portISR_LOCK );
+	ulPartitionLocks = ulPortLockCount( portPARTITION_LOCK( 0 ) );
+	xStart = xTaskGetTickCount();
+
+	for( i = 0; i < testLOCKS_DELAYS; i++ )
+	{
+		vTaskDelay( xDelay );
+	}
+
+	if( xDelay == 2U )
+	{
+		testCHECK( xTaskGetTickCount() - xStart >= testLOCKS_DELAYS * xDelay );
+		testCHECK( ulPortLockCount( portTASK_LOCK ) == ulTaskLocks );
+		testCHECK( ulPortLockCount( portISR_LOCK ) == ulISRLocks );
+		testCHECK( ulPortLockCount( portPARTITION_LOCK( 0 ) ) > ulPartitionLocks );
+		prvTestPass();
+	}
+
+	for( ; ; )
+	{
+		vTaskDelay( xDelay );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvCreateDelayingTasks( void )
+{
+	xTaskPeriodicCreate( prvDelayingTask, "D2", configMINIMAL_STACK_SIZE, ( void * ) 2, tskIDLE_PRIORITY + 1, NULL, 100 );
+	xTaskPeriodicCreate( prvDelayingTask, "D3", configMINIMAL_STACK_SIZE, ( void * ) 3, tskIDLE_PRIORITY + 1, NULL, 100 );
+}
+/*-----------------------------------------------------------*/
+
+static const TestCase_t xTestCases[] =
+{
+	{ "parallel",       prvCreateParallelTasks },
+	{ "preempt_latest", prvCreatePreemptTasks  },
+	{ "u_above_one",    prvCreateLoadTasks     },
+	{ "tick_locks",     prvCreateDelayingTasks },
+};
+
+#define testNUM_CASES    ( sizeof( xTestCases ) / sizeof( xTestCases[ 0 ] ) )
+
+/*-----------------------------------------------------------*/
+
+static int prvRunTestCase( const TestCase_t * pxTestCase )
+{
+	pxTestCase->pvCreateTasks();
+
+	vTaskStartScheduler();
+
+	return ( xTestResult == pdPASS ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+/*-----------------------------------------------------------*/
+
+int main( int argc, char * argv[] )
+{
+	size_t x;
+	int iFailed = 0;
+
+	for( x = 0; x < testNUM_CASES; x++ )
+	{
+		const TestCase_t * pxTestCase = &xTestCases[ x ];
+		pid_t xChild;
+		int iStatus = EXIT_FAILURE;
+
+		if( ( argc > 1 ) && ( strcmp( argv[ 1 ], pxTestCase->pcName ) != 0 ) )
+		{
+			continue;
+		}
+
+		fflush( stdout );
+		xChild = fork();
+
+		if( xChild == 0 )
+		{
+			exit( prvRunTestCase( pxTestCase ) );
+		}
+
+		if( ( xChild > 0 ) && ( waitpid( xChild, &iStatus, 0 ) == xChild ) &&
+			WIFEXITED( iStatus ) && ( WEXITSTATUS( iStatus ) == EXIT_SUCCESS ) )
+		{
+			printf( "PASS %s\n", pxTestCase->pcName );
+		}
+		else
+		{
+			printf( "FAIL %s\n", pxTestCase->pcName );
+			iFailed++;
+		}
+	}
+
+	return ( iFailed == 0 ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,479 @@
+/*
+ * FreeRTOS Kernel V10.4.6
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*-----------------------------------------------------------
+ * Implementation of functions defined in portable.h for the multicore host
+ * tests.
+ *
+ * As in the single core host port each task gets a ucontext_t and a stack of
+ * its own from the C heap, and the kernel stack of the task only holds the
+ * pointer to the context.  Each core is a thread that swaps into the context
+ * of the task pxCurrentTCBs[] gives it.  A task switched out on one core may
+ * be switched in on another, so the port reads the core it runs on again
+ * after each switch.
+ *
+ * The threads take turns: one baton goes round the cores that have not
+ * stopped, the core holding it is the only one running.  A core passes it on
+ * at each vPortSimStep() and before each lock it takes, and nowhere between
+ * the selection of a task and the switch to its context.
+ *----------------------------------------------------------*/
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <ucontext.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#define portTASK_STACK_SIZE    ( 64 * 1024 )
+
+/* Turns a core spins for a lock before it is taken for a deadlock. */
+#define portLOCK_SPIN_LIMIT    ( 100000UL )
+
+#define portNO_CORE            ( ( BaseType_t ) -1 )
+
+typedef struct PortContext
+{
+	ucontext_t xContext;
+	TaskFunction_t pxCode;
+	void * pvParameters;
+} PortContext_t;
+
+typedef struct PortLock
+{
+	BaseType_t xOwner;
+	UBaseType_t uxCount;
+	uint32_t ulTaken;
+} PortLock_t;
+
+/* The first member of the TCB is pxTopOfStack. */
+extern void * volatile pxCurrentTCBs[];
+
+/* The core of the calling thread. */
+static __thread BaseType_t xThisCore = 0;
+
+static pthread_t xCoreThreads[ configNUMBER_OF_CORES ];
+static ucontext_t xCoreContexts[ configNUMBER_OF_CORES ];
+
+static pthread_mutex_t xBatonMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t xBatonCondition = PTHREAD_COND_INITIALIZER;
+static BaseType_t xBatonCore = 0;
+static BaseType_t xCoresStarted = pdFALSE;
+static BaseType_t xCoreStopped[ configNUMBER_OF_CORES ];
+static volatile BaseType_t xSchedulerEnded = pdFALSE;
+
+static PortLock_t xLocks[ portLOCKS ];
+
+/* The interrupt state of each core. */
+static BaseType_t xInterruptsMasked[ configNUMBER_OF_CORES ];
+static BaseType_t xInInterrupt[ configNUMBER_OF_CORES ];
+static BaseType_t xTickPending[ configNUMBER_OF_CORES ];
+static BaseType_t xSwitchPending[ configNUMBER_OF_CORES ];
+static uint32_t ulSteps[ configNUMBER_OF_CORES ];
+
+static void prvStopCore( void );
+
+/*-----------------------------------------------------------*/
+
+/* Not inlined, the thread reading it changes when a task migrates. */
+__attribute__( ( noinline, noipa ) ) BaseType_t xPortGetCoreID( void )
+{
+	return xThisCore;
+}
+/*-----------------------------------------------------------*/
+
+static PortContext_t * prvContextOf( BaseType_t xCoreID )
+{
+	return ( PortContext_t * ) **( StackType_t ** ) pxCurrentTCBs[ xCoreID ];
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvNextCore( BaseType_t xCoreID )
+{
+	BaseType_t x;
+
+	for( x = 1; x <= ( BaseType_t ) configNUMBER_OF_CORES; x++ )
+	{
+		const BaseType_t xNext = ( xCoreID + x ) % ( BaseType_t ) configNUMBER_OF_CORES;
+
+		if( xCoreStopped[ xNext ] == pdFALSE )
+		{
+			return xNext;
+		}
+	}
+
+	return portNO_CORE;
+}
+/*-----------------------------------------------------------*/
+
+/* Lets the other cores run once, then goes on. */
+static void prvPassBaton( void )
+{
+	const BaseType_t xCoreID = xPortGetCoreID();
+
+	if( xCoresStarted == pdFALSE )
+	{
+		return;
+	}
+
+	pthread_mutex_lock( &xBatonMutex );
+	xBatonCore = prvNextCore( xCoreID );
+	pthread_cond_broadcast( &xBatonCondition );
+
+	while( xBatonCore != xCoreID )
+	{
+		pthread_cond_wait( &xBatonCondition, &xBatonMutex );
+	}
+
+	pthread_mutex_unlock( &xBatonMutex );
+
+	if( xSchedulerEnded != pdFALSE )
+	{
+		prvStopCore();
+	}
+}
+/*-----------------------------------------------------------*/
+
+/* Hands the baton on for good and leaves the thread of the core. */
+static void prvStopCore( void )
+{
+	const BaseType_t xCoreID = xPortGetCoreID();
+
+	pthread_mutex_lock( &xBatonMutex );
+	xCoreStopped[ xCoreID ] = pdTRUE;
+	xBatonCore = prvNextCore( xCoreID );
+	pthread_cond_broadcast( &xBatonCondition );
+	pthread_mutex_unlock( &xBatonMutex );
+
+	setcontext( &( xCoreContexts[ xCoreID ] ) );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSwitchContext( void )
+{
+	const BaseType_t xCoreID = xPortGetCoreID();
+	PortContext_t * pxFrom = prvContextOf( xCoreID );
+	PortContext_t * pxTo;
+
+	/* No baton is passed from here to the switch, so no other core can
+	 * switch in the task switched out until its context is saved. */
+	vTaskSwitchContext();
+	pxTo = prvContextOf( xCoreID );
+
+	if( pxTo != pxFrom )
+	{
+		swapcontext( &( pxFrom->xContext ), &( pxTo->xContext ) );
+	}
+}
+/*-----------------------------------------------------------*/
+
+/* Takes the interrupts pending on the calling core while they are unmasked. */
+static void prvServiceInterrupts( void )
+{
+	BaseType_t xCoreID = xPortGetCoreID();
+
+	while( ( xInterruptsMasked[ xCoreID ] == pdFALSE ) &&
+		   ( ( xTickPending[ xCoreID ] != pdFALSE ) || ( xSwitchPending[ xCoreID ] != pdFALSE ) ) )
+	{
+		xInterruptsMasked[ xCoreID ] = pdTRUE;
+		xInInterrupt[ xCoreID ] = pdTRUE;
+
+		if( xTickPending[ xCoreID ] != pdFALSE )
+		{
+			xTickPending[ xCoreID ] = pdFALSE;
+
+			if( xTaskIncrementTick() != pdFALSE )
+			{
+				xSwitchPending[ xCoreID ] = pdTRUE;
+			}
+		}
+
+		if( xSwitchPending[ xCoreID ] != pdFALSE )
+		{
+			xSwitchPending[ xCoreID ] = pdFALSE;
+			prvSwitchContext();
+
+			/* The task may be back on another core. */
+			xCoreID = xPortGetCoreID();
+		}
+
+		xInInterrupt[ xCoreID ] = pdFALSE;
+		xInterruptsMasked[ xCoreID ] = pdFALSE;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvTaskEntry( void )
+{
+	const BaseType_t xCoreID = xPortGetCoreID();
+	PortContext_t * pxContext = prvContextOf( xCoreID );
+
+	/* A task starts where the switch interrupt of its core returns. */
+	xInInterrupt[ xCoreID ] = pdFALSE;
+	vPortClearInterruptMask( pdFALSE );
+
+	pxContext->pxCode( pxContext->pvParameters );
+
+	/* Tasks must not return. */
+	configASSERT( pdFALSE );
+}
+/*-----------------------------------------------------------*/
+
+static void * prvCoreThread( void * pvParameters )
+{
+	xThisCore = ( BaseType_t ) ( intptr_t ) pvParameters;
+
+	pthread_mutex_lock( &xBatonMutex );
+
+	while( xBatonCore != xThisCore )
+	{
+		pthread_cond_wait( &xBatonCondition, &xBatonMutex );
+	}
+
+	pthread_mutex_unlock( &xBatonMutex );
+
+	if( xSchedulerEnded == pdFALSE )
+	{
+		/* Back here from prvStopCore(). */
+		swapcontext( &( xCoreContexts[ xThisCore ] ), &( prvContextOf( xThisCore )->xContext ) );
+	}
+	else
+	{
+		pthread_mutex_lock( &xBatonMutex );
+		xCoreStopped[ xThisCore ] = pdTRUE;
+		xBatonCore = prvNextCore( xThisCore );
+		pthread_cond_broadcast( &xBatonCondition );
+		pthread_mutex_unlock( &xBatonMutex );
+	}
+
+	return NULL;
+}
+/*-----------------------------------------------------------*/
+
+StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
+									 TaskFunction_t pxCode,
+									 void * pvParameters )
+{
+	PortContext_t * pxContext = malloc( sizeof( PortContext_t ) );
+	void * pvStack = malloc( portTASK_STACK_SIZE );
+
+	configASSERT( ( pxContext != NULL ) && ( pvStack != NULL ) );
+
+	pxContext->pxCode = pxCode;
+	pxContext->pvParameters = pvParameters;
+	getcontext( &( pxContext->xContext ) );
+	pxContext->xContext.uc_stack.ss_sp = pvStack;
+	pxContext->xContext.uc_stack.ss_size = portTASK_STACK_SIZE;
+	pxContext->xContext.uc_link = NULL;
+	makecontext( &( pxContext->xContext ), prvTaskEntry, 0 );
+
+	*pxTopOfStack = ( StackType_t ) pxContext;
+
+	return pxTopOfStack;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortStartScheduler( void )
+{
+	BaseType_t xCoreID;
+
+	/* Every core starts its first task with interrupts masked, as from the
+	 * switch interrupt. */
+	for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+	{
+		xInterruptsMasked[ xCoreID ] = pdTRUE;
+		xInInterrupt[ xCoreID ] = pdTRUE;
+	}
+
+	xCoresStarted = pdTRUE;
+
+	for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+	{
+		configASSERT( pthread_create( &( xCoreThreads[ xCoreID ] ), NULL, prvCoreThread, ( void * ) ( intptr_t ) xCoreID ) == 0 );
+	}
+
+	/* Back here once a task called vTaskEndScheduler(). */
+	for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+	{
+		pthread_join( xCoreThreads[ xCoreID ], NULL );
+	}
+
+	return pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+	/* The other cores stop the next time they get the baton. */
+	xSchedulerEnded = pdTRUE;
+	prvStopCore();
+}
+/*-----------------------------------------------------------*/
+
+void vPortYield( void )
+{
+	const UBaseType_t uxSavedInterruptStatus = uxPortSetInterruptMask();
+
+	xSwitchPending[ xPortGetCoreID() ] = pdTRUE;
+	vPortClearInterruptMask( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+void vPortYieldCore( BaseType_t xCoreID )
+{
+	xSwitchPending[ xCoreID ] = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortSimStep( void )
+{
+	const UBaseType_t uxSavedInterruptStatus = uxPortSetInterruptMask();
+	const BaseType_t xCoreID = xPortGetCoreID();
+
+	ulSteps[ xCoreID ]++;
+
+	/* The steps of core 0 keep the time.  Its timer interrupts core 0 with
+	 * global EDF, and every core, each ticking its partition, with
+	 * partitioned EDF. */
+	if( ( xCoreID == 0 ) && ( ( ulSteps[ xCoreID ] % portSTEPS_PER_TICK ) == 0U ) )
+	{
+		BaseType_t x;
+
+		for( x = 0; x < ( ( configUSE_EDF_PARTITIONED == 1 ) ? configNUMBER_OF_CORES : 1 ); x++ )
+		{
+			xTickPending[ x ] = pdTRUE;
+		}
+	}
+
+	prvPassBaton();
+	vPortClearInterruptMask( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetLock( BaseType_t xLock )
+{
+	const BaseType_t xCoreID = xPortGetCoreID();
+	PortLock_t * const pxLock = &( xLocks[ xLock ] );
+	uint32_t ulSpins = 0;
+	BaseType_t x;
+
+	configASSERT( xInterruptsMasked[ xCoreID ] != pdFALSE );
+
+	if( pxLock->xOwner == xCoreID + 1 )
+	{
+		pxLock->uxCount++;
+		return;
+	}
+
+	/* The locks are taken in order, none after this one may be held. */
+	for( x = xLock + 1; x < portLOCKS; x++ )
+	{
+		configASSERT( xLocks[ x ].xOwner != xCoreID + 1 );
+	}
+
+	prvPassBaton();
+
+	while( pxLock->xOwner != 0 )
+	{
+		configASSERT( ++ulSpins < portLOCK_SPIN_LIMIT );
+		prvPassBaton();
+	}
+
+	pxLock->xOwner = xCoreID + 1;
+	pxLock->uxCount = 1;
+	pxLock->ulTaken++;
+}
+/*-----------------------------------------------------------*/
+
+void vPortReleaseLock( BaseType_t xLock )
+{
+	PortLock_t * const pxLock = &( xLocks[ xLock ] );
+
+	configASSERT( pxLock->xOwner == xPortGetCoreID() + 1 );
+
+	if( --( pxLock->uxCount ) == 0U )
+	{
+		pxLock->xOwner = 0;
+	}
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulPortLockCount( BaseType_t xLock )
+{
+	return xLocks[ xLock ].ulTaken;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxPortSetInterruptMask( void )
+{
+	const BaseType_t xCoreID = xPortGetCoreID();
+	const UBaseType_t uxSavedInterruptStatus = ( UBaseType_t ) xInterruptsMasked[ xCoreID ];
+
+	xInterruptsMasked[ xCoreID ] = pdTRUE;
+
+	return uxSavedInterruptStatus;
+}
+/*-----------------------------------------------------------*/
+
+void vPortClearInterruptMask( UBaseType_t uxSavedInterruptStatus )
+{
+	xInterruptsMasked[ xPortGetCoreID() ] = ( BaseType_t ) uxSavedInterruptStatus;
+	prvServiceInterrupts();
+}
+/*-----------------------------------------------------------*/
+
+void vPortDisableInterrupts( void )
+{
+	xInterruptsMasked[ xPortGetCoreID() ] = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnableInterrupts( void )
+{
+	vPortClearInterruptMask( pdFALSE );
+}
+/*-----------------------------------------------------------*/
+
+void vPortAssertIfInISR( void )
+{
+	configASSERT( xInInterrupt[ xPortGetCoreID() ] == pdFALSE );
+}
+/*-----------------------------------------------------------*/
+
+void * pvPortMalloc( size_t xWantedSize )
+{
+	return malloc( xWantedSize );
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void * pv )
+{
+	free( pv );
+}
@@ -0,0 +1,143 @@
+/*
+ * FreeRTOS Kernel V10.4.6
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef PORTMACRO_H
+#define PORTMACRO_H
+
+/*-----------------------------------------------------------
+ * Port specific definitions for the multicore host tests.
+ *
+ * Each core is a POSIX thread and the tasks switch with swapcontext(), as in
+ * the single core host port.  Only one core runs at a time: a core hands the
+ * baton on to the next one, round robin, at each step of the tasks
+ * (vPortSimStep()) and each time it takes a lock, so a test runs the same way
+ * every time while the cores still interleave inside the kernel.
+ *
+ * The tick and the yield of another core are interrupts, pending until the
+ * core they are for has its interrupts unmasked at a step or when they are
+ * unmasked.  The steps of core 0 keep the time: the tick is for core 0, or with
+ * partitioned EDF for every core.  The locks are recursive spin locks that
+ * check the lock order of tasks.c and count how many times they are taken.
+ *-----------------------------------------------------------
+ */
+
+#include <stdint.h>
+
+/* Type definitions. */
+#define portCHAR          char
+#define portFLOAT         float
+#define portDOUBLE        double
+#define portLONG          long
+#define portSHORT         short
+#define portSTACK_TYPE    uintptr_t
+#define portBASE_TYPE     long
+#define portPOINTER_SIZE_TYPE    uintptr_t
+
+typedef portSTACK_TYPE   StackType_t;
+typedef long             BaseType_t;
+typedef unsigned long    UBaseType_t;
+
+#if ( configUSE_16_BIT_TICKS == 1 )
+	typedef uint16_t     TickType_t;
+	#define portMAX_DELAY    ( TickType_t ) 0xffff
+#else
+	typedef uint32_t     TickType_t;
+	#define portMAX_DELAY    ( TickType_t ) 0xffffffffUL
+	#define portTICK_TYPE_IS_ATOMIC    1
+#endif
+/*-----------------------------------------------------------*/
+
+/* Architecture specifics. */
+#define portSTACK_GROWTH      ( -1 )
+#define portTICK_PERIOD_MS    ( ( TickType_t ) 1000 / configTICK_RATE_HZ )
+#define portBYTE_ALIGNMENT    8
+#define portNOP()
+
+/* Steps of each core between two ticks. */
+#define portSTEPS_PER_TICK    10
+/*-----------------------------------------------------------*/
+
+/* Multicore specifics. */
+extern BaseType_t xPortGetCoreID( void );
+extern void vPortYieldCore( BaseType_t xCoreID );
+extern void vPortGetLock( BaseType_t xLock );
+extern void vPortReleaseLock( BaseType_t xLock );
+extern uint32_t ulPortLockCount( BaseType_t xLock );
+
+/* The locks in the order tasks.c takes them. */
+#define portTASK_LOCK                  ( ( BaseType_t ) 0 )
+#define portISR_LOCK                   ( ( BaseType_t ) 1 )
+#define portPARTITION_LOCK( x )        ( ( BaseType_t ) 2 + ( BaseType_t ) ( x ) )
+#define portLOCKS                      ( 2 + configNUMBER_OF_CORES )
+
+#define portGET_CORE_ID()              xPortGetCoreID()
+#define portYIELD_CORE( xCoreID )      vPortYieldCore( xCoreID )
+#define portGET_TASK_LOCK()            vPortGetLock( portTASK_LOCK )
+#define portRELEASE_TASK_LOCK()        vPortReleaseLock( portTASK_LOCK )
+#define portGET_ISR_LOCK()             vPortGetLock( portISR_LOCK )
+#define portRELEASE_ISR_LOCK()         vPortReleaseLock( portISR_LOCK )
+#define portGET_PARTITION_LOCK( x )    vPortGetLock( portPARTITION_LOCK( x ) )
+#define portRELEASE_PARTITION_LOCK( x )    vPortReleaseLock( portPARTITION_LOCK( x ) )
+/*-----------------------------------------------------------*/
+
+/* Scheduler utilities. */
+extern void vPortYield( void );
+extern void vPortSimStep( void );
+
+#define portYIELD()                                 vPortYield()
+#define portEND_SWITCHING_ISR( xSwitchRequired )    if( xSwitchRequired != pdFALSE ) vPortYield()
+#define portYIELD_FROM_ISR( x )                     portEND_SWITCHING_ISR( x )
+/*-----------------------------------------------------------*/
+
+/* Critical section management. */
+extern void vTaskEnterCritical( void );
+extern void vTaskExitCritical( void );
+extern UBaseType_t uxPortSetInterruptMask( void );
+extern void vPortClearInterruptMask( UBaseType_t uxSavedInterruptStatus );
+extern void vPortDisableInterrupts( void );
+extern void vPortEnableInterrupts( void );
+extern void vPortAssertIfInISR( void );
+
+#define portDISABLE_INTERRUPTS()                  vPortDisableInterrupts()
+#define portENABLE_INTERRUPTS()                   vPortEnableInterrupts()
+#define portENTER_CRITICAL()                      vTaskEnterCritical()
+#define portEXIT_CRITICAL()                       vTaskExitCritical()
+#define portSET_INTERRUPT_MASK()                  uxPortSetInterruptMask()
+#define portCLEAR_INTERRUPT_MASK( x )             vPortClearInterruptMask( x )
+#define portSET_INTERRUPT_MASK_FROM_ISR()         uxPortSetInterruptMask()
+#define portCLEAR_INTERRUPT_MASK_FROM_ISR( x )    vPortClearInterruptMask( x )
+#define portASSERT_IF_IN_ISR()                    vPortAssertIfInISR()
+/*-----------------------------------------------------------*/
+
+/* Task function macros as described on the FreeRTOS.org WEB site. */
+#define portTASK_FUNCTION_PROTO( vFunction, pvParameters )    void vFunction( void * pvParameters )
+#define portTASK_FUNCTION( vFunction, pvParameters )          void vFunction( void * pvParameters )
+/*-----------------------------------------------------------*/
+
+#endif /* PORTMACRO_H */